@@ -0,0 +1,100 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+
+
+#ifndef __TIZEN_MULTIMEDIA_CAMERA_FUZZ_H__
+#define	__TIZEN_MULTIMEDIA_CAMERA_FUZZ_H__
+#include <stddef.h>
+#include <stdint.h>
+#include <camera.h>
+#include <mm_camcorder.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Shared by the fuzz targets. Every input runs on a camera of its own, created
+ * on the stand-in camcorder with all the application callbacks set, so an
+ * input replays the same way whatever ran before it. The callbacks read every
+ * byte the library hands them, a buffer that is shorter than the size it is
+ * delivered with shows up under AddressSanitizer.
+ */
+
+/**
+ * @brief Reads the fuzz input front to back, past the end every read gives 0.
+ */
+typedef struct {
+	const uint8_t *data;
+	size_t size;
+	size_t pos;
+} camera_fuzz_input_s;
+
+void camera_fuzz_input_init(camera_fuzz_input_s *input, const uint8_t *data, size_t size);
+size_t camera_fuzz_input_remaining(camera_fuzz_input_s *input);
+unsigned int camera_fuzz_read_u8(camera_fuzz_input_s *input);
+unsigned int camera_fuzz_read_u16(camera_fuzz_input_s *input);
+int camera_fuzz_read_int(camera_fuzz_input_s *input);
+
+/**
+ * @brief Copies up to @a size input bytes in a buffer of exactly that many bytes.
+ * @return The buffer, NULL when @a size is 0, free() it
+ */
+unsigned char *camera_fuzz_read_bytes(camera_fuzz_input_s *input, size_t size);
+
+/**
+ * @brief Creates a camera with every callback set and starts its preview.
+ * @return The camera, NULL when it could not be created
+ */
+camera_h camera_fuzz_open(void);
+
+/**
+ * @brief Returns the stand-in camcorder of the camera.
+ */
+MMHandleType camera_fuzz_mm_handle(camera_h camera);
+
+/**
+ * @brief Delivers the queued camcorder messages and runs the pending main loop sources.
+ */
+void camera_fuzz_settle(camera_h camera);
+
+/**
+ * @brief Takes the camcorder down whatever state the input left it in, and destroys the camera.
+ */
+void camera_fuzz_close(camera_h camera);
+
+/**
+ * @brief The capturing callback, it reads every image it is given.
+ */
+void camera_fuzz_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data);
+
+/**
+ * @brief The capture completed callback.
+ */
+void camera_fuzz_capture_completed_cb(void *user_data);
+
+/**
+ * @brief The libFuzzer entry point, each target defines it.
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__TIZEN_MULTIMEDIA_CAMERA_FUZZ_H__
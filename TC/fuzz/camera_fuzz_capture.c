@@ -0,0 +1,187 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <camera.h>
+#include <camera_private.h>
+#include "camera_harness_backend.h"
+#include "camera_fuzz.h"
+
+#define FUZZ_CONFIG_EFFECT			0x01
+#define FUZZ_CONFIG_ANTI_SHAKE		0x02
+#define FUZZ_CONFIG_AUTO_CONTRAST	0x04
+#define FUZZ_CONFIG_TRANSFORM		0x08
+#define FUZZ_CONFIG_AF_AREA			0x10
+#define FUZZ_CONFIG_METRIC_AREA		0x20
+#define FUZZ_CONFIG_JPEG_ENCODING	0x40
+#define FUZZ_CONFIG_THUMBNAIL		0x80
+
+/*
+ * Hands preview and capture frames made from the input to the video stream
+ * and capture callbacks of the library. The input starts with a header
+ *
+ *   config (u8)       FUZZ_CONFIG_xxx, the software stages to turn on
+ *   rotation, flip, effect (u8 each)
+ *
+ * followed by frame records
+ *
+ *   kind (u8)         bit 0 set for a capture frame, bit 1 adds a thumbnail
+ *   frame             format (u8), width, height (u16 each), length (u16)
+ *                     and that many bytes, fewer at the end of the input
+ *   thumbnail         another frame when bit 1 of the kind is set
+ *
+ * The format, the size and the data length of a frame are independent, a
+ * frame may well be shorter than its format and size call for. The data is
+ * allocated at its exact length so a read past it is caught. A preview
+ * encoder runs all along, it reads the frames by their format and size as a
+ * hardware encoder would.
+ */
+
+static unsigned int g_fuzz_encoded;
+
+static int __fuzz_encoder_open(int width, int height, camera_pixel_format_e format, void *user_data, void **instance){
+	*instance = &g_fuzz_encoded;
+	return CAMERA_ERROR_NONE;
+}
+
+static int __fuzz_encoder_encode(void *instance, camera_image_data_s *frame, long long pts, camera_preview_encoder_output_cb output, void *output_data){
+	unsigned int size = _camera_get_image_size(frame->format, frame->width, frame->height);
+	unsigned int i;
+
+	for( i = 0 ; i < size ; i++ )
+		g_fuzz_encoded += frame->data[i];
+	output((const unsigned char*)&g_fuzz_encoded, sizeof(g_fuzz_encoded), pts, true, output_data);
+	return CAMERA_ERROR_NONE;
+}
+
+static void __fuzz_encoder_close(void *instance, camera_preview_encoder_output_cb output, void *output_data){
+}
+
+static const camera_preview_encoder_s g_fuzz_encoder = { __fuzz_encoder_open, __fuzz_encoder_encode, __fuzz_encoder_close, NULL };
+
+static void __fuzz_configure(camera_h camera, camera_fuzz_input_s *input){
+	unsigned int config = camera_fuzz_read_u8(input);
+	unsigned int rotation = camera_fuzz_read_u8(input);
+	unsigned int flip = camera_fuzz_read_u8(input);
+	unsigned int effect = camera_fuzz_read_u8(input);
+
+	// the stand-in camcorder takes every attribute, a failed set makes the library fall back to software
+	if( config & FUZZ_CONFIG_EFFECT ){
+		camera_harness_backend_fail_next(CAMERA_HARNESS_CALL_SET_ATTRIBUTES, MM_ERROR_CAMCORDER_NOT_SUPPORTED);
+		camera_attr_set_effect(camera, CAMERA_ATTR_EFFECT_MONO + effect % CAMERA_ATTR_EFFECT_SKETCH);
+	}
+	if( config & FUZZ_CONFIG_ANTI_SHAKE ){
+		camera_harness_backend_fail_next(CAMERA_HARNESS_CALL_SET_ATTRIBUTES, MM_ERROR_CAMCORDER_NOT_SUPPORTED);
+		camera_attr_enable_anti_shake(camera, true);
+	}
+	if( config & FUZZ_CONFIG_AUTO_CONTRAST )
+		camera_attr_enable_auto_contrast(camera, true);
+	if( config & FUZZ_CONFIG_TRANSFORM ){
+		camera_harness_backend_fail_next(CAMERA_HARNESS_CALL_SET_ATTRIBUTES, MM_ERROR_CAMCORDER_NOT_SUPPORTED);
+		camera_attr_set_stream_rotation(camera, CAMERA_ROTATION_90 + rotation % CAMERA_ROTATION_270);
+		camera_attr_set_stream_flip(camera, flip % (CAMERA_FLIP_BOTH + 1));
+	}
+	if( config & FUZZ_CONFIG_AF_AREA )
+		camera_attr_set_af_area(camera, rotation * 4, flip * 4);
+	if( config & FUZZ_CONFIG_METRIC_AREA )
+		camera_attr_set_focus_metric_area(camera, rotation, flip, effect + 1, effect + 1);
+	if( config & FUZZ_CONFIG_JPEG_ENCODING )
+		camera_attr_enable_software_jpeg_encoding(camera, true);
+	if( config & FUZZ_CONFIG_THUMBNAIL )
+		camera_attr_set_software_thumbnail_size(camera, 32, 24);
+	camera_start_preview_encoder(camera, &g_fuzz_encoder, NULL, 4);
+	camera_harness_backend_reset();
+}
+
+static unsigned char *__fuzz_read_frame(camera_fuzz_input_s *input, int *format, int *width, int *height, unsigned int *length){
+	*format = camera_fuzz_read_u8(input);
+	*width = camera_fuzz_read_u16(input);
+	*height = camera_fuzz_read_u16(input);
+	*length = camera_fuzz_read_u16(input);
+	if( *length > camera_fuzz_input_remaining(input) )
+		*length = camera_fuzz_input_remaining(input);
+	return camera_fuzz_read_bytes(input, *length);
+}
+
+static void __fuzz_preview_frame(camera_h camera, camera_fuzz_input_s *input){
+	MMCamcorderVideoStreamDataType stream;
+	int format;
+	int width;
+	int height;
+
+	memset(&stream, 0, sizeof(stream));
+	stream.data = __fuzz_read_frame(input, &format, &width, &height, &stream.length);
+	stream.format = format;
+	stream.width = width;
+	stream.height = height;
+	camera_harness_backend_deliver_stream(camera_fuzz_mm_handle(camera), &stream);
+	free(stream.data);
+}
+
+static void __fuzz_capture_frame(camera_h camera, camera_fuzz_input_s *input, bool with_thumbnail){
+	MMHandleType camcorder = camera_fuzz_mm_handle(camera);
+	MMCamcorderCaptureDataType frame;
+	MMCamcorderCaptureDataType thumbnail;
+	MMMessageParamType param;
+	camera_state_e state = CAMERA_STATE_NONE;
+	int format;
+
+	memset(&frame, 0, sizeof(frame));
+	memset(&thumbnail, 0, sizeof(thumbnail));
+	frame.data = __fuzz_read_frame(input, &format, &frame.width, &frame.height, &frame.length);
+	frame.format = format;
+	if( with_thumbnail ){
+		thumbnail.data = __fuzz_read_frame(input, &format, &thumbnail.width, &thumbnail.height, &thumbnail.length);
+		thumbnail.format = format;
+	}
+
+	camera_get_state(camera, &state);
+	if( state == CAMERA_STATE_CAPTURED )
+		camera_start_preview(camera);
+	camera_start_capture(camera, camera_fuzz_capturing_cb, camera_fuzz_capture_completed_cb, NULL);
+	camera_harness_backend_deliver_capture(camcorder, &frame, with_thumbnail ? &thumbnail : NULL);
+	free(frame.data);
+	free(thumbnail.data);
+
+	memset(&param, 0, sizeof(param));
+	param.code = 1;
+	camera_harness_backend_post(camcorder, MM_MESSAGE_CAMCORDER_CAPTURED, &param);
+	camera_fuzz_settle(camera);
+	camera_start_preview(camera);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+	camera_fuzz_input_s input;
+	camera_h camera = camera_fuzz_open();
+	unsigned int kind;
+
+	if( camera == NULL )
+		return 0;
+	camera_fuzz_input_init(&input, data, size);
+	__fuzz_configure(camera, &input);
+	while( camera_fuzz_input_remaining(&input) > 0 ){
+		kind = camera_fuzz_read_u8(&input);
+		if( kind & 1 )
+			__fuzz_capture_frame(camera, &input, (kind & 2) != 0);
+		else
+			__fuzz_preview_frame(camera, &input);
+		camera_fuzz_settle(camera);
+	}
+	camera_fuzz_close(camera);
+	return 0;
+}
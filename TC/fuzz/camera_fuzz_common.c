@@ -0,0 +1,205 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include "camera_harness_backend.h"
+#include "camera_fuzz.h"
+
+#define FUZZ_SETTLE_ROUNDS 16			// a message may post more, give up on a loop that keeps posting
+
+// the callbacks fold what they read in here so the reads are not optimized out
+static volatile unsigned int g_fuzz_sink;
+
+void camera_fuzz_input_init(camera_fuzz_input_s *input, const uint8_t *data, size_t size){
+	input->data = data;
+	input->size = size;
+	input->pos = 0;
+}
+
+size_t camera_fuzz_input_remaining(camera_fuzz_input_s *input){
+	return input->size - input->pos;
+}
+
+unsigned int camera_fuzz_read_u8(camera_fuzz_input_s *input){
+	if( input->pos >= input->size )
+		return 0;
+	return input->data[input->pos++];
+}
+
+unsigned int camera_fuzz_read_u16(camera_fuzz_input_s *input){
+	unsigned int value = camera_fuzz_read_u8(input);
+	return value | (camera_fuzz_read_u8(input) << 8);
+}
+
+int camera_fuzz_read_int(camera_fuzz_input_s *input){
+	unsigned int value = camera_fuzz_read_u16(input);
+	return (int)(value | (camera_fuzz_read_u16(input) << 16));
+}
+
+unsigned char *camera_fuzz_read_bytes(camera_fuzz_input_s *input, size_t size){
+	unsigned char *data;
+
+	if( size > camera_fuzz_input_remaining(input) )
+		size = camera_fuzz_input_remaining(input);
+	if( size == 0 )
+		return NULL;
+	// exactly the bytes given, a read past them is caught by the sanitizer
+	data = (unsigned char*)malloc(size);
+	if( data == NULL )
+		return NULL;
+	memcpy(data, input->data + input->pos, size);
+	input->pos += size;
+	return data;
+}
+
+static void __fuzz_touch(const void *data, int size){
+	const unsigned char *p = (const unsigned char*)data;
+	unsigned int sum = 0;
+	int i;
+
+	if( data == NULL || size <= 0 )
+		return;
+	for( i = 0 ; i < size ; i++ )
+		sum += p[i];
+	g_fuzz_sink += sum;
+}
+
+static void __fuzz_touch_image(camera_image_data_s *image){
+	if( image )
+		__fuzz_touch(image->data, image->size);
+}
+
+static void __fuzz_state_changed_cb(camera_state_e previous, camera_state_e current, bool by_policy, void *user_data){
+	g_fuzz_sink += previous + current + by_policy;
+}
+
+static void __fuzz_interrupted_cb(camera_policy_e policy, camera_state_e previous, camera_state_e current, void *user_data){
+	g_fuzz_sink += policy + previous + current;
+}
+
+static void __fuzz_focus_changed_cb(camera_focus_state_e state, void *user_data){
+	g_fuzz_sink += state;
+}
+
+static void __fuzz_error_cb(camera_error_e error, camera_state_e current_state, void *user_data){
+	g_fuzz_sink += error + current_state;
+}
+
+static void __fuzz_hdr_progress_cb(int percent, void *user_data){
+	g_fuzz_sink += percent;
+}
+
+static void __fuzz_face_detected_cb(camera_detected_face_s *faces, int count, void *user_data){
+	__fuzz_touch(faces, count * (int)sizeof(camera_detected_face_s));
+}
+
+static void __fuzz_preview_cb(void *stream_buffer, int buffer_size, int width, int height, camera_pixel_format_e format, void *user_data){
+	__fuzz_touch(stream_buffer, buffer_size);
+}
+
+static void __fuzz_preview_statistics_cb(const camera_frame_statistics_s *statistics, void *user_data){
+	__fuzz_touch(statistics, sizeof(camera_frame_statistics_s));
+}
+
+static void __fuzz_focus_metric_cb(unsigned int sharpness, void *user_data){
+	g_fuzz_sink += sharpness;
+}
+
+static void __fuzz_focus_peaking_cb(unsigned char *mask, int width, int height, void *user_data){
+	__fuzz_touch(mask, width * height);
+}
+
+void camera_fuzz_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data){
+	__fuzz_touch_image(image);
+	__fuzz_touch_image(postview);
+	__fuzz_touch_image(thumbnail);
+}
+
+void camera_fuzz_capture_completed_cb(void *user_data){
+	g_fuzz_sink++;
+}
+
+camera_h camera_fuzz_open(void){
+	camera_h camera = NULL;
+
+	camera_harness_backend_reset();
+	if( camera_create(CAMERA_DEVICE_CAMERA0, &camera) != CAMERA_ERROR_NONE )
+		return NULL;
+	camera_set_state_changed_cb(camera, __fuzz_state_changed_cb, NULL);
+	camera_set_interrupted_cb(camera, __fuzz_interrupted_cb, NULL);
+	camera_set_focus_changed_cb(camera, __fuzz_focus_changed_cb, NULL);
+	camera_set_error_cb(camera, __fuzz_error_cb, NULL);
+	camera_attr_set_hdr_capture_progress_cb(camera, __fuzz_hdr_progress_cb, NULL);
+	camera_set_preview_cb(camera, __fuzz_preview_cb, NULL);
+	camera_set_preview_statistics_cb(camera, __fuzz_preview_statistics_cb, NULL);
+	camera_set_focus_metric_cb(camera, __fuzz_focus_metric_cb, NULL);
+	camera_set_focus_peaking_cb(camera, __fuzz_focus_peaking_cb, NULL);
+	camera_attr_enable_capture_postview(camera, true);
+	if( camera_start_preview(camera) != CAMERA_ERROR_NONE ){
+		camera_destroy(camera);
+		return NULL;
+	}
+	camera_start_face_detection(camera, __fuzz_face_detected_cb, NULL);
+	camera_fuzz_settle(camera);
+	return camera;
+}
+
+MMHandleType camera_fuzz_mm_handle(camera_h camera){
+	return ((camera_s*)camera)->mm_handle;
+}
+
+void camera_fuzz_settle(camera_h camera){
+	int rounds;
+	int delivered;
+
+	for( rounds = 0 ; rounds < FUZZ_SETTLE_ROUNDS ; rounds++ ){
+		delivered = camera_harness_backend_dispatch(camera_fuzz_mm_handle(camera));
+		while( g_main_context_iteration(NULL, FALSE) )
+			delivered++;
+		if( delivered == 0 )
+			break;
+	}
+}
+
+void camera_fuzz_close(camera_h camera){
+	MMHandleType camcorder;
+	MMCamcorderStateType state = MM_CAMCORDER_STATE_NONE;
+
+	if( camera == NULL )
+		return;
+	camcorder = camera_fuzz_mm_handle(camera);
+	camera_harness_backend_reset();
+	camera_stop_face_detection(camera);
+	camera_fuzz_settle(camera);
+
+	// the messages of an input may leave the library out of step with the device, go by the device
+	mm_camcorder_get_state(camcorder, &state);
+	if( state == MM_CAMCORDER_STATE_CAPTURING )
+		mm_camcorder_capture_stop(camcorder);
+	mm_camcorder_get_state(camcorder, &state);
+	if( state == MM_CAMCORDER_STATE_PREPARE )
+		mm_camcorder_stop(camcorder);
+	mm_camcorder_get_state(camcorder, &state);
+	if( state == MM_CAMCORDER_STATE_READY )
+		mm_camcorder_unrealize(camcorder);
+	camera_fuzz_settle(camera);
+	camera_destroy(camera);
+}
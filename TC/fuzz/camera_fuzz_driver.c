@@ -0,0 +1,168 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "camera_fuzz.h"
+
+#define DRIVER_MAX_INPUT 65536
+#define DRIVER_MAX_SEEDS 256
+#define DRIVER_MUTATIONS 8			// byte edits at most per benchmark input
+
+/*
+ * Runs a fuzz target without libFuzzer, for toolchains that lack it and for
+ * the throughput benchmark.
+ *
+ *   <target> <file>...                  runs each file once, a corpus replay
+ *   <target> --bench <runs> [seed] <file>...
+ *                                       runs mutations of the files and
+ *                                       prints the executions per second
+ *
+ * The mutations flip, overwrite, insert and drop bytes, which is enough to
+ * take the inputs off the paths the corpus covers. Finding new paths is
+ * left to libFuzzer.
+ */
+
+typedef struct {
+	unsigned char *data;
+	size_t size;
+} driver_seed_s;
+
+static unsigned int g_driver_random = 2463534242u;
+
+static unsigned int __driver_random(void){
+	g_driver_random ^= g_driver_random << 13;
+	g_driver_random ^= g_driver_random >> 17;
+	g_driver_random ^= g_driver_random << 5;
+	return g_driver_random;
+}
+
+static int __driver_load(const char *path, driver_seed_s *seed){
+	FILE *fp = fopen(path, "rb");
+
+	if( fp == NULL ){
+		fprintf(stderr, "%s: can not open\n", path);
+		return -1;
+	}
+	seed->data = (unsigned char*)malloc(DRIVER_MAX_INPUT);
+	if( seed->data == NULL ){
+		fclose(fp);
+		return -1;
+	}
+	seed->size = fread(seed->data, 1, DRIVER_MAX_INPUT, fp);
+	fclose(fp);
+	return 0;
+}
+
+static size_t __driver_mutate(const driver_seed_s *seed, unsigned char *out){
+	size_t size = seed->size;
+	int edits = 1 + __driver_random() % DRIVER_MUTATIONS;
+	size_t at;
+
+	memcpy(out, seed->data, size);
+	while( edits-- > 0 ){
+		at = size ? __driver_random() % size : 0;
+		switch( __driver_random() % 4 ){
+			case 0:
+				if( size )
+					out[at] ^= 1 << (__driver_random() % 8);
+				break;
+			case 1:
+				if( size )
+					out[at] = __driver_random();
+				break;
+			case 2:
+				if( size < DRIVER_MAX_INPUT ){
+					memmove(out + at + 1, out + at, size - at);
+					out[at] = __driver_random();
+					size++;
+				}
+				break;
+			case 3:
+				if( size ){
+					memmove(out + at, out + at + 1, size - at - 1);
+					size--;
+				}
+				break;
+		}
+	}
+	return size;
+}
+
+static int __driver_bench(long runs, int count, char **paths){
+	driver_seed_s seeds[DRIVER_MAX_SEEDS];
+	unsigned char *input;
+	struct timespec start;
+	struct timespec end;
+	double elapsed;
+	long run;
+	int loaded = 0;
+	int i;
+
+	for( i = 0 ; i < count && loaded < DRIVER_MAX_SEEDS ; i++ ){
+		if( __driver_load(paths[i], &seeds[loaded]) == 0 )
+			loaded++;
+	}
+	if( loaded == 0 ){
+		fprintf(stderr, "no seed input\n");
+		return 1;
+	}
+	input = (unsigned char*)malloc(DRIVER_MAX_INPUT);
+	if( input == NULL )
+		return 1;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for( run = 0 ; run < runs ; run++ )
+		LLVMFuzzerTestOneInput(input, __driver_mutate(&seeds[run % loaded], input));
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	printf("%ld runs of %d seeds in %.3f s, %.0f exec/s\n", runs, loaded, elapsed, elapsed > 0 ? runs / elapsed : 0.0);
+	free(input);
+	for( i = 0 ; i < loaded ; i++ )
+		free(seeds[i].data);
+	return 0;
+}
+
+int main(int argc, char **argv){
+	driver_seed_s seed;
+	int failed = 0;
+	int i;
+
+	if( argc > 2 && strcmp(argv[1], "--bench") == 0 ){
+		long runs = atol(argv[2]);
+		int first = 3;
+		// a numeric argument after the runs is the mutation seed, a corpus file name is not
+		if( argc > 3 && strspn(argv[3], "0123456789") == strlen(argv[3]) ){
+			g_driver_random = strtoul(argv[3], NULL, 10) | 1;
+			first = 4;
+		}
+		return __driver_bench(runs, argc - first, argv + first);
+	}
+
+	for( i = 1 ; i < argc ; i++ ){
+		if( __driver_load(argv[i], &seed) != 0 ){
+			failed = 1;
+			continue;
+		}
+		LLVMFuzzerTestOneInput(seed.data, seed.size);
+		free(seed.data);
+	}
+	return failed;
+}
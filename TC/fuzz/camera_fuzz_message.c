@@ -0,0 +1,217 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <camera.h>
+#include "camera_harness_backend.h"
+#include "camera_fuzz.h"
+
+#define FUZZ_MAX_FACES 512			// above the cap of the library, so the cap is hit too
+#define FUZZ_MAX_FILENAME 64
+
+/*
+ * Feeds camcorder messages with fields taken from the input to the message
+ * callback of the library. The input is a list of records, each one a kind
+ * byte and the fields of that kind:
+ *
+ *   0 state changed, 1 by sound policy, 2 by security policy
+ *       previous, current, code (int32 each)
+ *   3 focus changed, 4 captured, 6 video snapshot captured, 7 error,
+ *   8 hdr progress
+ *       code (int32)
+ *   5 captured in video mode
+ *       flags (u8), filename length (u8) and bytes; flag 1 sends no report,
+ *       flag 2 a report without file name
+ *   9 face detect info
+ *       count (int32), flags (u8) then id, score, x, y, width, height
+ *       (int32 each) per face; flag 1 sends no face array
+ *   10 API call
+ *       call (u8), argument (u8)
+ *
+ * The messages are delivered one at a time, so a record sees the state the
+ * previous ones left. The message data always matches what the camcorder
+ * would allocate for it, the fields in it are what the input makes them.
+ */
+
+static void __fuzz_post_code(camera_h camera, int message, int code){
+	MMMessageParamType param;
+
+	memset(&param, 0, sizeof(param));
+	param.code = code;
+	camera_harness_backend_post(camera_fuzz_mm_handle(camera), message, &param);
+}
+
+static void __fuzz_post_state(camera_h camera, int message, camera_fuzz_input_s *input){
+	MMMessageParamType param;
+
+	memset(&param, 0, sizeof(param));
+	param.state.previous = camera_fuzz_read_int(input);
+	param.state.current = camera_fuzz_read_int(input);
+	param.state.code = camera_fuzz_read_int(input);
+	camera_harness_backend_post(camera_fuzz_mm_handle(camera), message, &param);
+}
+
+static void __fuzz_post_video_captured(camera_h camera, camera_fuzz_input_s *input){
+	MMHandleType camcorder = camera_fuzz_mm_handle(camera);
+	MMMessageParamType param;
+	MMCamRecordingReport *report = NULL;
+	unsigned int flags = camera_fuzz_read_u8(input);
+	unsigned int length = camera_fuzz_read_u8(input) % (FUZZ_MAX_FILENAME + 1);
+	unsigned char *name;
+
+	if( length > camera_fuzz_input_remaining(input) )
+		length = camera_fuzz_input_remaining(input);
+	name = camera_fuzz_read_bytes(input, length);
+
+	// the report and its file name belong to whoever gets the message, as with the camcorder
+	if( !(flags & 1) ){
+		report = (MMCamRecordingReport*)calloc(1, sizeof(MMCamRecordingReport));
+		if( report && !(flags & 2) ){
+			report->recording_filename = (char*)calloc(1, length + 1);
+			if( report->recording_filename && name )
+				memcpy(report->recording_filename, name, length);
+		}
+	}
+	free(name);
+
+	memset(&param, 0, sizeof(param));
+	param.data = report;
+	mm_camcorder_set_attributes(camcorder, NULL, MMCAM_MODE, MM_CAMCORDER_MODE_VIDEO, NULL);
+	if( camera_harness_backend_post(camcorder, MM_MESSAGE_CAMCORDER_CAPTURED, &param) != MM_ERROR_NONE && report ){
+		free(report->recording_filename);
+		free(report);
+	}
+	camera_fuzz_settle(camera);
+	mm_camcorder_set_attributes(camcorder, NULL, MMCAM_MODE, MM_CAMCORDER_MODE_IMAGE, NULL);
+}
+
+static void __fuzz_post_faces(camera_h camera, camera_fuzz_input_s *input){
+	MMMessageParamType param;
+	MMCamFaceDetectInfo info;
+	int count = camera_fuzz_read_int(input);
+	unsigned int flags = camera_fuzz_read_u8(input);
+	int entries = 0;
+	int i;
+
+	info.num_of_faces = count;
+	info.face_info = NULL;
+	// the array holds as many faces as the message says, a message without one keeps any count
+	if( !(flags & 1) && count > 0 ){
+		entries = count < FUZZ_MAX_FACES ? count : FUZZ_MAX_FACES;
+		info.num_of_faces = entries;
+		info.face_info = (MMCamFaceInfo*)malloc(entries * sizeof(MMCamFaceInfo));
+		if( info.face_info == NULL )
+			return;
+		for( i = 0 ; i < entries ; i++ ){
+			info.face_info[i].id = camera_fuzz_read_int(input);
+			info.face_info[i].score = camera_fuzz_read_int(input);
+			info.face_info[i].rect.x = camera_fuzz_read_int(input);
+			info.face_info[i].rect.y = camera_fuzz_read_int(input);
+			info.face_info[i].rect.width = camera_fuzz_read_int(input);
+			info.face_info[i].rect.height = camera_fuzz_read_int(input);
+		}
+	}
+
+	memset(&param, 0, sizeof(param));
+	param.data = &info;
+	camera_harness_backend_post(camera_fuzz_mm_handle(camera), MM_MESSAGE_CAMCORDER_FACE_DETECT_INFO, &param);
+	// the message points at the array, it is delivered before the array goes
+	camera_fuzz_settle(camera);
+	free(info.face_info);
+}
+
+static void __fuzz_call(camera_h camera, camera_fuzz_input_s *input){
+	unsigned int call = camera_fuzz_read_u8(input);
+	unsigned int argument = camera_fuzz_read_u8(input);
+
+	switch( call % 8 ){
+		case 0:
+			camera_start_preview(camera);
+			break;
+		case 1:
+			camera_stop_preview(camera);
+			break;
+		case 2:
+			camera_start_capture(camera, camera_fuzz_capturing_cb, camera_fuzz_capture_completed_cb, NULL);
+			break;
+		case 3:
+			camera_start_continuous_capture(camera, 2 + argument % 4, 0, camera_fuzz_capturing_cb, camera_fuzz_capture_completed_cb, NULL);
+			break;
+		case 4:
+			camera_stop_continuous_capture(camera);
+			break;
+		case 5:
+			camera_harness_backend_shot(camera_fuzz_mm_handle(camera));
+			break;
+		case 6:
+			camera_harness_backend_interrupt(camera_fuzz_mm_handle(camera), (argument & 1) ? MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_SECURITY : MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_ASM);
+			break;
+		case 7:
+			camera_start_face_detection(camera, NULL, NULL);
+			break;
+	}
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+	camera_fuzz_input_s input;
+	camera_h camera = camera_fuzz_open();
+
+	if( camera == NULL )
+		return 0;
+	camera_fuzz_input_init(&input, data, size);
+	while( camera_fuzz_input_remaining(&input) > 0 ){
+		switch( camera_fuzz_read_u8(&input) % 11 ){
+			case 0:
+				__fuzz_post_state(camera, MM_MESSAGE_CAMCORDER_STATE_CHANGED, &input);
+				break;
+			case 1:
+				__fuzz_post_state(camera, MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_ASM, &input);
+				break;
+			case 2:
+				__fuzz_post_state(camera, MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_SECURITY, &input);
+				break;
+			case 3:
+				__fuzz_post_code(camera, MM_MESSAGE_CAMCORDER_FOCUS_CHANGED, camera_fuzz_read_int(&input));
+				break;
+			case 4:
+				__fuzz_post_code(camera, MM_MESSAGE_CAMCORDER_CAPTURED, camera_fuzz_read_int(&input));
+				break;
+			case 5:
+				__fuzz_post_video_captured(camera, &input);
+				break;
+			case 6:
+				__fuzz_post_code(camera, MM_MESSAGE_CAMCORDER_VIDEO_SNAPSHOT_CAPTURED, camera_fuzz_read_int(&input));
+				break;
+			case 7:
+				__fuzz_post_code(camera, MM_MESSAGE_CAMCORDER_ERROR, camera_fuzz_read_int(&input));
+				break;
+			case 8:
+				__fuzz_post_code(camera, MM_MESSAGE_CAMCORDER_HDR_PROGRESS, camera_fuzz_read_int(&input));
+				break;
+			case 9:
+				__fuzz_post_faces(camera, &input);
+				break;
+			case 10:
+				__fuzz_call(camera, &input);
+				break;
+		}
+		camera_fuzz_settle(camera);
+	}
+	camera_fuzz_close(camera);
+	return 0;
+}
@@ -0,0 +1,530 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <mm_camcorder.h>
+#include "camera_harness_backend.h"
+
+#define HARNESS_MAX_ATTRIBUTES 128		// distinct attribute names one device keeps
+#define HARNESS_MAX_MESSAGES 64			// messages queued before the oldest is dropped
+#define HARNESS_FRAME_WIDTH 16
+#define HARNESS_FRAME_HEIGHT 16
+
+/*
+ * Attributes are kept by name. The camcorder types a few of them as data
+ * (pointer and size) or double, every other attribute the library uses is an
+ * int. Names that were never set read as 0, except for the defaults below.
+ */
+
+typedef enum {
+	_HARNESS_ATTR_INT,
+	_HARNESS_ATTR_DOUBLE,
+	_HARNESS_ATTR_DATA,
+} _harness_attr_type_e;
+
+typedef struct {
+	const char *name;
+	int type;
+	int ivalue;
+	double dvalue;
+	void *data;
+	int size;
+} _harness_attr_s;
+
+typedef struct {
+	int message;
+	MMMessageParamType param;
+} _harness_message_s;
+
+typedef struct {
+	int state;
+
+	_harness_attr_s attrs[HARNESS_MAX_ATTRIBUTES];
+	int attr_count;
+
+	_harness_message_s messages[HARNESS_MAX_MESSAGES];
+	int message_head;
+	int message_count;
+	int dispatching;
+
+	MMMessageCallback message_cb;
+	void *message_data;
+	mm_camcorder_video_stream_callback stream_cb;
+	void *stream_data;
+	mm_camcorder_video_capture_callback capture_cb;
+	void *capture_data;
+
+	int shots;
+	int shot_break;
+	unsigned int frame_timestamp;
+} _harness_device_s;
+
+static int g_fail_next[CAMERA_HARNESS_CALL_NUM];
+
+static unsigned char g_preview_frame[HARNESS_FRAME_WIDTH * HARNESS_FRAME_HEIGHT * 3 / 2];
+
+// SOI, an APP0 stub and EOI, the library does not decode the shot
+static unsigned char g_jpeg_frame[] = { 0xff, 0xd8, 0xff, 0xe0, 0x00, 0x04, 0x00, 0x00, 0xff, 0xd9 };
+
+static const char *g_data_attrs[] = { "captured-screennail", MMCAM_TAG_IMAGE_DESCRIPTION, MMCAM_TAG_SOFTWARE, MMCAM_DISPLAY_HANDLE };
+static const char *g_double_attrs[] = { MMCAM_TAG_LATITUDE, MMCAM_TAG_LONGITUDE, MMCAM_TAG_ALTITUDE };
+
+static int __harness_take_failure(camera_harness_call_e call){
+	int error = g_fail_next[call];
+	g_fail_next[call] = MM_ERROR_NONE;
+	return error;
+}
+
+static _harness_attr_s *__harness_attr(_harness_device_s *device, const char *name){
+	unsigned int i;
+
+	for( i = 0 ; i < (unsigned int)device->attr_count ; i++ ){
+		if( strcmp(device->attrs[i].name, name) == 0 )
+			return &device->attrs[i];
+	}
+	if( device->attr_count == HARNESS_MAX_ATTRIBUTES )
+		return NULL;
+
+	_harness_attr_s *attr = &device->attrs[device->attr_count++];
+	memset(attr, 0, sizeof(_harness_attr_s));
+	attr->name = strdup(name);
+	attr->type = _HARNESS_ATTR_INT;
+	for( i = 0 ; i < sizeof(g_data_attrs)/sizeof(g_data_attrs[0]) ; i++ ){
+		if( strcmp(g_data_attrs[i], name) == 0 )
+			attr->type = _HARNESS_ATTR_DATA;
+	}
+	for( i = 0 ; i < sizeof(g_double_attrs)/sizeof(g_double_attrs[0]) ; i++ ){
+		if( strcmp(g_double_attrs[i], name) == 0 )
+			attr->type = _HARNESS_ATTR_DOUBLE;
+	}
+	return attr;
+}
+
+static void __harness_set_int(_harness_device_s *device, const char *name, int value){
+	_harness_attr_s *attr = __harness_attr(device, name);
+	if( attr )
+		attr->ivalue = value;
+}
+
+static int __harness_get_int(_harness_device_s *device, const char *name){
+	_harness_attr_s *attr = __harness_attr(device, name);
+	return attr ? attr->ivalue : 0;
+}
+
+static void __harness_post_state(_harness_device_s *device, int message, int previous, int current){
+	MMMessageParamType param;
+
+	memset(&param, 0, sizeof(param));
+	param.state.previous = previous;
+	param.state.current = current;
+	param.state.code = 0;
+	camera_harness_backend_post((MMHandleType)device, message, &param);
+}
+
+static int __harness_transition(_harness_device_s *device, camera_harness_call_e call, int from, int to){
+	int ret = __harness_take_failure(call);
+
+	if( ret != MM_ERROR_NONE )
+		return ret;
+	if( device->state != from )
+		return MM_ERROR_CAMCORDER_INVALID_STATE;
+	device->state = to;
+	__harness_post_state(device, MM_MESSAGE_CAMCORDER_STATE_CHANGED, from, to);
+	return MM_ERROR_NONE;
+}
+
+void camera_harness_backend_fail_next(camera_harness_call_e call, int error){
+	if( call >= 0 && call < CAMERA_HARNESS_CALL_NUM )
+		g_fail_next[call] = error;
+}
+
+void camera_harness_backend_reset(void){
+	memset(g_fail_next, 0, sizeof(g_fail_next));
+}
+
+int camera_harness_backend_post(MMHandleType camcorder, int message, const MMMessageParamType *param){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+
+	if( device == NULL || param == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	if( device->message_count == HARNESS_MAX_MESSAGES ){
+		device->message_head = (device->message_head + 1) % HARNESS_MAX_MESSAGES;
+		device->message_count--;
+	}
+	_harness_message_s *slot = &device->messages[(device->message_head + device->message_count) % HARNESS_MAX_MESSAGES];
+	slot->message = message;
+	slot->param = *param;
+	device->message_count++;
+	return MM_ERROR_NONE;
+}
+
+int camera_harness_backend_dispatch(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	int delivered = 0;
+
+	// a callback that calls back into the camcorder posts behind the message being delivered
+	if( device == NULL || device->dispatching )
+		return 0;
+	device->dispatching = 1;
+	while( device->message_count > 0 ){
+		_harness_message_s message = device->messages[device->message_head];
+		device->message_head = (device->message_head + 1) % HARNESS_MAX_MESSAGES;
+		device->message_count--;
+		if( device->message_cb )
+			device->message_cb(message.message, &message.param, device->message_data);
+		delivered++;
+	}
+	device->dispatching = 0;
+	return delivered;
+}
+
+int camera_harness_backend_pending(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	return device ? device->message_count : 0;
+}
+
+int camera_harness_backend_interrupt(MMHandleType camcorder, int message){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	int previous;
+
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	if( device->state == MM_CAMCORDER_STATE_NULL || device->state == MM_CAMCORDER_STATE_READY )
+		return MM_ERROR_CAMCORDER_INVALID_STATE;
+	previous = device->state;
+	device->state = MM_CAMCORDER_STATE_READY;
+	__harness_post_state(device, message, previous, MM_CAMCORDER_STATE_READY);
+	return MM_ERROR_NONE;
+}
+
+int camera_harness_backend_shot_due(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+
+	if( device == NULL || device->state != MM_CAMCORDER_STATE_CAPTURING || device->shot_break )
+		return 0;
+	return device->shots < __harness_get_int(device, MMCAM_CAPTURE_COUNT);
+}
+
+int camera_harness_backend_shot(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	MMCamcorderCaptureDataType frame;
+	MMMessageParamType param;
+
+	if( !camera_harness_backend_shot_due(camcorder) )
+		return MM_ERROR_CAMCORDER_INVALID_STATE;
+
+	memset(&frame, 0, sizeof(frame));
+	frame.data = g_jpeg_frame;
+	frame.length = sizeof(g_jpeg_frame);
+	frame.format = MM_PIXEL_FORMAT_ENCODED;
+	frame.width = HARNESS_FRAME_WIDTH;
+	frame.height = HARNESS_FRAME_HEIGHT;
+	device->shots++;
+	if( device->capture_cb )
+		device->capture_cb(&frame, NULL, device->capture_data);
+
+	memset(&param, 0, sizeof(param));
+	param.code = device->shots;
+	return camera_harness_backend_post(camcorder, MM_MESSAGE_CAMCORDER_CAPTURED, &param);
+}
+
+int camera_harness_backend_preview_frame(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	MMCamcorderVideoStreamDataType stream;
+
+	if( device == NULL || (device->state != MM_CAMCORDER_STATE_PREPARE && device->state != MM_CAMCORDER_STATE_CAPTURING) )
+		return MM_ERROR_CAMCORDER_INVALID_STATE;
+	if( device->stream_cb == NULL )
+		return MM_ERROR_NONE;
+
+	memset(&stream, 0, sizeof(stream));
+	stream.data = g_preview_frame;
+	stream.length = sizeof(g_preview_frame);
+	stream.format = MM_PIXEL_FORMAT_NV12;
+	stream.width = HARNESS_FRAME_WIDTH;
+	stream.height = HARNESS_FRAME_HEIGHT;
+	stream.timestamp = device->frame_timestamp;
+	device->frame_timestamp += 33;
+	device->stream_cb(&stream, device->stream_data);
+	return MM_ERROR_NONE;
+}
+
+int camera_harness_backend_deliver_capture(MMHandleType camcorder, MMCamcorderCaptureDataType *frame, MMCamcorderCaptureDataType *thumbnail){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+
+	if( device == NULL || device->state != MM_CAMCORDER_STATE_CAPTURING )
+		return MM_ERROR_CAMCORDER_INVALID_STATE;
+	if( device->capture_cb )
+		device->capture_cb(frame, thumbnail, device->capture_data);
+	return MM_ERROR_NONE;
+}
+
+int camera_harness_backend_deliver_stream(MMHandleType camcorder, MMCamcorderVideoStreamDataType *stream){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+
+	if( device == NULL || (device->state != MM_CAMCORDER_STATE_PREPARE && device->state != MM_CAMCORDER_STATE_CAPTURING) )
+		return MM_ERROR_CAMCORDER_INVALID_STATE;
+	if( device->stream_cb )
+		device->stream_cb(stream, device->stream_data);
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_create(MMHandleType *camcorder, MMCamPreset *info){
+	int ret = __harness_take_failure(CAMERA_HARNESS_CALL_CREATE);
+
+	if( camcorder == NULL || info == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	if( ret != MM_ERROR_NONE )
+		return ret;
+
+	_harness_device_s *device = (_harness_device_s*)calloc(1, sizeof(_harness_device_s));
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_LOW_MEMORY;
+	device->state = MM_CAMCORDER_STATE_NULL;
+	__harness_set_int(device, MMCAM_MODE, MM_CAMCORDER_MODE_IMAGE);
+	__harness_set_int(device, MMCAM_CAMERA_WIDTH, 640);
+	__harness_set_int(device, MMCAM_CAMERA_HEIGHT, 480);
+	__harness_set_int(device, MMCAM_CAPTURE_WIDTH, 640);
+	__harness_set_int(device, MMCAM_CAPTURE_HEIGHT, 480);
+	__harness_set_int(device, MMCAM_CAPTURE_COUNT, 1);
+	__harness_set_int(device, MMCAM_RECOMMEND_PREVIEW_FORMAT_FOR_CAPTURE, MM_PIXEL_FORMAT_NV12);
+	__harness_set_int(device, MMCAM_CAMERA_FOCUS_MODE, MM_CAMCORDER_FOCUS_MODE_AUTO);
+	__harness_set_int(device, MMCAM_CAMERA_AF_SCAN_RANGE, MM_CAMCORDER_AUTO_FOCUS_NORMAL);
+	*camcorder = (MMHandleType)device;
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_destroy(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	int ret = __harness_take_failure(CAMERA_HARNESS_CALL_DESTROY);
+	int i;
+
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	if( ret != MM_ERROR_NONE )
+		return ret;
+	if( device->state != MM_CAMCORDER_STATE_NULL )
+		return MM_ERROR_CAMCORDER_INVALID_STATE;
+	for( i = 0 ; i < device->attr_count ; i++ ){
+		free((void*)device->attrs[i].name);
+		free(device->attrs[i].data);
+	}
+	free(device);
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_realize(MMHandleType camcorder){
+	if( camcorder == 0 )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	return __harness_transition((_harness_device_s*)camcorder, CAMERA_HARNESS_CALL_REALIZE, MM_CAMCORDER_STATE_NULL, MM_CAMCORDER_STATE_READY);
+}
+
+int mm_camcorder_unrealize(MMHandleType camcorder){
+	if( camcorder == 0 )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	return __harness_transition((_harness_device_s*)camcorder, CAMERA_HARNESS_CALL_UNREALIZE, MM_CAMCORDER_STATE_READY, MM_CAMCORDER_STATE_NULL);
+}
+
+int mm_camcorder_start(MMHandleType camcorder){
+	if( camcorder == 0 )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	return __harness_transition((_harness_device_s*)camcorder, CAMERA_HARNESS_CALL_START, MM_CAMCORDER_STATE_READY, MM_CAMCORDER_STATE_PREPARE);
+}
+
+int mm_camcorder_stop(MMHandleType camcorder){
+	if( camcorder == 0 )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	return __harness_transition((_harness_device_s*)camcorder, CAMERA_HARNESS_CALL_STOP, MM_CAMCORDER_STATE_PREPARE, MM_CAMCORDER_STATE_READY);
+}
+
+int mm_camcorder_capture_start(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	int ret;
+
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	ret = __harness_transition(device, CAMERA_HARNESS_CALL_CAPTURE_START, MM_CAMCORDER_STATE_PREPARE, MM_CAMCORDER_STATE_CAPTURING);
+	if( ret == MM_ERROR_NONE ){
+		device->shots = 0;
+		device->shot_break = 0;
+	}
+	return ret;
+}
+
+int mm_camcorder_capture_stop(MMHandleType camcorder){
+	if( camcorder == 0 )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	return __harness_transition((_harness_device_s*)camcorder, CAMERA_HARNESS_CALL_CAPTURE_STOP, MM_CAMCORDER_STATE_CAPTURING, MM_CAMCORDER_STATE_PREPARE);
+}
+
+int mm_camcorder_start_focusing(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	int ret = __harness_take_failure(CAMERA_HARNESS_CALL_START_FOCUSING);
+
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	if( ret != MM_ERROR_NONE )
+		return ret;
+	return device->state == MM_CAMCORDER_STATE_PREPARE ? MM_ERROR_NONE : MM_ERROR_CAMCORDER_INVALID_STATE;
+}
+
+int mm_camcorder_stop_focusing(MMHandleType camcorder){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	int ret = __harness_take_failure(CAMERA_HARNESS_CALL_STOP_FOCUSING);
+
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	if( ret != MM_ERROR_NONE )
+		return ret;
+	return device->state == MM_CAMCORDER_STATE_PREPARE ? MM_ERROR_NONE : MM_ERROR_CAMCORDER_INVALID_STATE;
+}
+
+int mm_camcorder_get_state(MMHandleType camcorder, MMCamcorderStateType *state){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+
+	if( device == NULL || state == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	*state = device->state;
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_get_attributes(MMHandleType camcorder, char **err_attr_name, const char *attribute_name, ...){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	const char *name = attribute_name;
+	va_list args;
+
+	if( err_attr_name )
+		*err_attr_name = NULL;
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+
+	va_start(args, attribute_name);
+	while( name ){
+		_harness_attr_s *attr = __harness_attr(device, name);
+		if( attr == NULL ){
+			va_end(args);
+			if( err_attr_name )
+				*err_attr_name = strdup(name);
+			return MM_ERROR_COMMON_OUT_OF_MEMORY;
+		}
+		if( attr->type == _HARNESS_ATTR_DATA ){
+			void **data = va_arg(args, void**);
+			int *size = va_arg(args, int*);
+			*data = attr->data;
+			*size = attr->size;
+		}else if( attr->type == _HARNESS_ATTR_DOUBLE ){
+			*va_arg(args, double*) = attr->dvalue;
+		}else{
+			*va_arg(args, int*) = attr->ivalue;
+		}
+		name = va_arg(args, const char*);
+	}
+	va_end(args);
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_set_attributes(MMHandleType camcorder, char **err_attr_name, const char *attribute_name, ...){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+	const char *name = attribute_name;
+	int ret = __harness_take_failure(CAMERA_HARNESS_CALL_SET_ATTRIBUTES);
+	va_list args;
+
+	if( err_attr_name )
+		*err_attr_name = NULL;
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	if( ret != MM_ERROR_NONE ){
+		if( err_attr_name && attribute_name )
+			*err_attr_name = strdup(attribute_name);
+		return ret;
+	}
+
+	va_start(args, attribute_name);
+	while( name ){
+		_harness_attr_s *attr = __harness_attr(device, name);
+		if( attr == NULL ){
+			va_end(args);
+			if( err_attr_name )
+				*err_attr_name = strdup(name);
+			return MM_ERROR_COMMON_OUT_OF_MEMORY;
+		}
+		if( attr->type == _HARNESS_ATTR_DATA ){
+			void *data = va_arg(args, void*);
+			int size = va_arg(args, int);
+			free(attr->data);
+			attr->data = NULL;
+			attr->size = 0;
+			if( data && size > 0 ){
+				attr->data = malloc(size);
+				if( attr->data ){
+					memcpy(attr->data, data, size);
+					attr->size = size;
+				}
+			}
+		}else if( attr->type == _HARNESS_ATTR_DOUBLE ){
+			attr->dvalue = va_arg(args, double);
+		}else{
+			attr->ivalue = va_arg(args, int);
+			// the break is a command, the camcorder stops delivering shots of a running continuous shot
+			if( strcmp(name, "capture-break-cont-shot") == 0 && attr->ivalue && device->state == MM_CAMCORDER_STATE_CAPTURING && __harness_get_int(device, MMCAM_CAPTURE_COUNT) > 1 )
+				device->shot_break = 1;
+		}
+		name = va_arg(args, const char*);
+	}
+	va_end(args);
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_get_attribute_info(MMHandleType camcorder, const char *attribute_name, MMCamAttrsInfo *info){
+	if( camcorder == 0 || attribute_name == NULL || info == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	memset(info, 0, sizeof(MMCamAttrsInfo));
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_set_message_callback(MMHandleType camcorder, MMMessageCallback callback, void *user_data){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	device->message_cb = callback;
+	device->message_data = user_data;
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_set_video_stream_callback(MMHandleType camcorder, mm_camcorder_video_stream_callback callback, void *user_data){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	device->stream_cb = callback;
+	device->stream_data = user_data;
+	return MM_ERROR_NONE;
+}
+
+int mm_camcorder_set_video_capture_callback(MMHandleType camcorder, mm_camcorder_video_capture_callback callback, void *user_data){
+	_harness_device_s *device = (_harness_device_s*)camcorder;
+
+	if( device == NULL )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	device->capture_cb = callback;
+	device->capture_data = user_data;
+	return MM_ERROR_NONE;
+}
@@ -0,0 +1,124 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+
+
+#ifndef __TIZEN_MULTIMEDIA_CAMERA_HARNESS_BACKEND_H__
+#define	__TIZEN_MULTIMEDIA_CAMERA_HARNESS_BACKEND_H__
+#include <mm_camcorder.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Stand-in for libmm-camcorder. It implements the mm_camcorder_* calls the
+ * camera library makes with the device state machine of the real camcorder
+ * (NULL, READY, PREPARE, CAPTURING) and no device behind it. Messages are
+ * queued the way the camcorder posts them from its bus and are only
+ * delivered by camera_harness_backend_dispatch(), so a script decides when
+ * the library sees them.
+ */
+
+/**
+ * @brief The camcorder calls a failure can be injected into.
+ */
+typedef enum
+{
+	CAMERA_HARNESS_CALL_CREATE,
+	CAMERA_HARNESS_CALL_DESTROY,
+	CAMERA_HARNESS_CALL_REALIZE,
+	CAMERA_HARNESS_CALL_UNREALIZE,
+	CAMERA_HARNESS_CALL_START,
+	CAMERA_HARNESS_CALL_STOP,
+	CAMERA_HARNESS_CALL_CAPTURE_START,
+	CAMERA_HARNESS_CALL_CAPTURE_STOP,
+	CAMERA_HARNESS_CALL_START_FOCUSING,
+	CAMERA_HARNESS_CALL_STOP_FOCUSING,
+	CAMERA_HARNESS_CALL_SET_ATTRIBUTES,
+	CAMERA_HARNESS_CALL_NUM,
+} camera_harness_call_e;
+
+/**
+ * @brief Makes the next call of the given kind fail with an MM error, whatever the device state.
+ */
+void camera_harness_backend_fail_next(camera_harness_call_e call, int error);
+
+/**
+ * @brief Forgets the injected failures that were not hit.
+ */
+void camera_harness_backend_reset(void);
+
+/**
+ * @brief Queues a message as if the camcorder posted it.
+ */
+int camera_harness_backend_post(MMHandleType camcorder, int message, const MMMessageParamType *param);
+
+/**
+ * @brief Delivers the queued messages, including the ones posted while delivering.
+ * @return The number of messages delivered
+ */
+int camera_harness_backend_dispatch(MMHandleType camcorder);
+
+/**
+ * @brief Returns the number of queued messages.
+ */
+int camera_harness_backend_pending(MMHandleType camcorder);
+
+/**
+ * @brief Takes the device to READY the way a sound or security policy does, and posts the message.
+ * @param[in] message	MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_ASM or MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_SECURITY
+ * @return MM_ERROR_CAMCORDER_INVALID_STATE when the device is not realized
+ */
+int camera_harness_backend_interrupt(MMHandleType camcorder, int message);
+
+/**
+ * @brief Delivers the next shot of the running capture and posts MM_MESSAGE_CAMCORDER_CAPTURED.
+ * @return MM_ERROR_CAMCORDER_INVALID_STATE when no shot is due
+ */
+int camera_harness_backend_shot(MMHandleType camcorder);
+
+/**
+ * @brief Delivers a preview frame to the video stream callback.
+ * @return MM_ERROR_CAMCORDER_INVALID_STATE when the preview is not running
+ */
+int camera_harness_backend_preview_frame(MMHandleType camcorder);
+
+/**
+ * @brief Hands a frame the caller built to the capture callback, as is.
+ * @remarks The frame is not checked, the fuzz targets use it to deliver malformed frames.
+ * @return MM_ERROR_CAMCORDER_INVALID_STATE when no capture is running
+ */
+int camera_harness_backend_deliver_capture(MMHandleType camcorder, MMCamcorderCaptureDataType *frame, MMCamcorderCaptureDataType *thumbnail);
+
+/**
+ * @brief Hands a frame the caller built to the video stream callback, as is.
+ * @remarks The frame is not checked, the fuzz targets use it to deliver malformed frames.
+ * @return MM_ERROR_CAMCORDER_INVALID_STATE when the preview is not running
+ */
+int camera_harness_backend_deliver_stream(MMHandleType camcorder, MMCamcorderVideoStreamDataType *stream);
+
+/**
+ * @brief Returns true when the running capture has another shot to deliver.
+ */
+int camera_harness_backend_shot_due(MMHandleType camcorder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__TIZEN_MULTIMEDIA_CAMERA_HARNESS_BACKEND_H__
@@ -0,0 +1,791 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include "camera_harness_backend.h"
+
+#define HARNESS_MAX_EVENTS 64			// events a script step can leave before they are checked
+#define HARNESS_EVENT_LENGTH 96
+#define HARNESS_MAX_TOKENS 8
+#define HARNESS_FUZZ_STEPS 24			// random steps between create and destroy of a fuzz sequence
+
+/*
+ * Replays scenario scripts against the camera library running on the
+ * stand-in camcorder, and checks the states and the callbacks the
+ * application sees. One command per line, '#' starts a comment.
+ *
+ *   create, destroy, start_preview, stop_preview, start_capture,
+ *   start_continuous_capture <count> <interval>, stop_continuous_capture,
+ *   start_focusing [continuous], cancel_focusing,
+ *   set_preview_resolution <width> <height>
+ *       call the API, "=> <CAMERA_ERROR_xxx>" after the command sets the
+ *       expected result, CAMERA_ERROR_NONE otherwise
+ *   recorder_realize, recorder_unrealize
+ *                                 take the camcorder as the recorder does
+ *                                 and realize or unrealize it directly
+ *   fail <call> <MM_ERROR_xxx>    the next camcorder call of the kind fails
+ *   interrupt asm|security        a policy takes the device to READY
+ *   shot                          the device delivers the next shot
+ *   preview_frame                 the device delivers a preview frame
+ *   focus <RELEASED|ONGOING|FOCUSED|FAILED>, error <MM_ERROR_xxx>
+ *   message <state_changed|asm|security> <mm state> <mm state> <code>
+ *   captured <code>               post a camcorder message as is
+ *   hold, release                 keep camcorder messages and main loop
+ *                                 sources queued, release delivers them
+ *   expect state <STATE>          camera_get_state() result
+ *   expect preview_size <W>x<H>   the preview size the camcorder has
+ *   expect sources none           no main loop source is left on the
+ *                                 camera destroyed last
+ *   expect <event>                next callback, as printed by the harness
+ *   expect none                   no callback is left
+ *
+ * Queued messages and idle sources are delivered after every command unless
+ * held. A callback that is not expected before the next command fails the
+ * script, so a scenario spells out the exact callback order.
+ */
+
+typedef struct {
+	const char *name;
+	int value;
+} harness_name_s;
+
+#define HARNESS_NAME(x) { #x, x }
+
+static const harness_name_s g_camera_errors[] = {
+	HARNESS_NAME(CAMERA_ERROR_NONE),
+	HARNESS_NAME(CAMERA_ERROR_INVALID_PARAMETER),
+	HARNESS_NAME(CAMERA_ERROR_INVALID_STATE),
+	HARNESS_NAME(CAMERA_ERROR_OUT_OF_MEMORY),
+	HARNESS_NAME(CAMERA_ERROR_DEVICE),
+	HARNESS_NAME(CAMERA_ERROR_INVALID_OPERATION),
+	HARNESS_NAME(CAMERA_ERROR_SOUND_POLICY),
+	HARNESS_NAME(CAMERA_ERROR_SECURITY_RESTRICTED),
+	HARNESS_NAME(CAMERA_ERROR_DEVICE_BUSY),
+	HARNESS_NAME(CAMERA_ERROR_DEVICE_NOT_FOUND),
+	{ NULL, 0 }
+};
+
+static const harness_name_s g_mm_errors[] = {
+	HARNESS_NAME(MM_ERROR_NONE),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_INVALID_ARGUMENT),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_INVALID_STATE),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_DEVICE),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_DEVICE_BUSY),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_DEVICE_NOT_FOUND),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_DEVICE_TIMEOUT),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_GST_CORE),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_GST_STATECHANGE),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_INTERNAL),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_LOW_MEMORY),
+	HARNESS_NAME(MM_ERROR_CAMCORDER_RESPONSE_TIMEOUT),
+	HARNESS_NAME(MM_ERROR_POLICY_BLOCKED),
+	HARNESS_NAME(MM_ERROR_POLICY_RESTRICTED),
+	{ NULL, 0 }
+};
+
+static const harness_name_s g_mm_states[] = {
+	{ "NONE", MM_CAMCORDER_STATE_NONE },
+	{ "NULL", MM_CAMCORDER_STATE_NULL },
+	{ "READY", MM_CAMCORDER_STATE_READY },
+	{ "PREPARE", MM_CAMCORDER_STATE_PREPARE },
+	{ "CAPTURING", MM_CAMCORDER_STATE_CAPTURING },
+	{ "RECORDING", MM_CAMCORDER_STATE_RECORDING },
+	{ "PAUSED", MM_CAMCORDER_STATE_PAUSED },
+	{ NULL, 0 }
+};
+
+static const harness_name_s g_calls[] = {
+	{ "create", CAMERA_HARNESS_CALL_CREATE },
+	{ "destroy", CAMERA_HARNESS_CALL_DESTROY },
+	{ "realize", CAMERA_HARNESS_CALL_REALIZE },
+	{ "unrealize", CAMERA_HARNESS_CALL_UNREALIZE },
+	{ "start", CAMERA_HARNESS_CALL_START },
+	{ "stop", CAMERA_HARNESS_CALL_STOP },
+	{ "capture_start", CAMERA_HARNESS_CALL_CAPTURE_START },
+	{ "capture_stop", CAMERA_HARNESS_CALL_CAPTURE_STOP },
+	{ "start_focusing", CAMERA_HARNESS_CALL_START_FOCUSING },
+	{ "stop_focusing", CAMERA_HARNESS_CALL_STOP_FOCUSING },
+	{ "set_attributes", CAMERA_HARNESS_CALL_SET_ATTRIBUTES },
+	{ NULL, 0 }
+};
+
+static const harness_name_s g_focus_states[] = {
+	{ "RELEASED", CAMERA_FOCUS_STATE_RELEASED },
+	{ "ONGOING", CAMERA_FOCUS_STATE_ONGOING },
+	{ "FOCUSED", CAMERA_FOCUS_STATE_FOCUSED },
+	{ "FAILED", CAMERA_FOCUS_STATE_FAILED },
+	{ NULL, 0 }
+};
+
+static const char *g_camera_states[] = { "NONE", "CREATED", "PREVIEW", "CAPTURING", "CAPTURED" };
+static const char *g_policies[] = { "NONE", "SOUND", "SECURITY" };
+
+typedef struct {
+	camera_h camera;
+	camera_h destroyed;	// the last handle destroyed, no main loop source may still point at it
+	bool hold;
+
+	char events[HARNESS_MAX_EVENTS][HARNESS_EVENT_LENGTH];
+	int event_head;
+	int event_count;
+
+	// what the callbacks reported, checked by the fuzzer
+	camera_state_e reported_state;
+	int state_errors;
+	int capture_starts;
+	int capture_completions;
+} harness_s;
+
+static harness_s g_harness;
+
+static bool __harness_lookup(const harness_name_s *names, const char *name, int *value){
+	for( ; names->name ; names++ ){
+		if( strcmp(names->name, name) == 0 ){
+			*value = names->value;
+			return true;
+		}
+	}
+	return false;
+}
+
+static const char *__harness_name(const harness_name_s *names, int value){
+	for( ; names->name ; names++ ){
+		if( names->value == value )
+			return names->name;
+	}
+	return "UNKNOWN";
+}
+
+static const char *__harness_state_name(camera_state_e state){
+	if( (unsigned int)state < sizeof(g_camera_states)/sizeof(g_camera_states[0]) )
+		return g_camera_states[state];
+	return "UNKNOWN";
+}
+
+static void __harness_event(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static void __harness_event(const char *format, ...){
+	va_list args;
+
+	if( g_harness.event_count == HARNESS_MAX_EVENTS ){
+		g_harness.event_head = (g_harness.event_head + 1) % HARNESS_MAX_EVENTS;
+		g_harness.event_count--;
+	}
+	va_start(args, format);
+	vsnprintf(g_harness.events[(g_harness.event_head + g_harness.event_count) % HARNESS_MAX_EVENTS], HARNESS_EVENT_LENGTH, format, args);
+	va_end(args);
+	g_harness.event_count++;
+}
+
+static const char *__harness_next_event(void){
+	if( g_harness.event_count == 0 )
+		return NULL;
+	return g_harness.events[g_harness.event_head];
+}
+
+static void __harness_pop_event(void){
+	g_harness.event_head = (g_harness.event_head + 1) % HARNESS_MAX_EVENTS;
+	g_harness.event_count--;
+}
+
+static void __harness_state_changed_cb(camera_state_e previous, camera_state_e current, bool by_policy, void *user_data){
+	if( previous == current || previous != g_harness.reported_state )
+		g_harness.state_errors++;
+	g_harness.reported_state = current;
+	__harness_event("state_changed %s %s%s", __harness_state_name(previous), __harness_state_name(current), by_policy ? " by_policy" : "");
+}
+
+static void __harness_interrupted_cb(camera_policy_e policy, camera_state_e previous, camera_state_e current, void *user_data){
+	__harness_event("interrupted %s %s %s", (unsigned int)policy < 3 ? g_policies[policy] : "UNKNOWN", __harness_state_name(previous), __harness_state_name(current));
+}
+
+static void __harness_focus_changed_cb(camera_focus_state_e state, void *user_data){
+	__harness_event("focus_changed %s", __harness_name(g_focus_states, state));
+}
+
+static void __harness_error_cb(camera_error_e error, camera_state_e current_state, void *user_data){
+	__harness_event("error %s %s", __harness_name(g_camera_errors, error), __harness_state_name(current_state));
+}
+
+static void __harness_preview_cb(void *stream_buffer, int buffer_size, int width, int height, camera_pixel_format_e format, void *user_data){
+	__harness_event("preview %dx%d", width, height);
+}
+
+static void __harness_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data){
+	__harness_event("capturing %dx%d", image ? image->width : 0, image ? image->height : 0);
+}
+
+static void __harness_capture_completed_cb(void *user_data){
+	g_harness.capture_completions++;
+	__harness_event("capture_completed");
+}
+
+static MMHandleType __harness_mm_handle(void){
+	return g_harness.camera ? ((camera_s*)g_harness.camera)->mm_handle : 0;
+}
+
+static void __harness_drain(void){
+	bool busy = true;
+
+	if( g_harness.hold )
+		return;
+	while( busy ){
+		busy = false;
+		if( g_harness.camera && camera_harness_backend_dispatch(__harness_mm_handle()) > 0 )
+			busy = true;
+		while( g_main_context_iteration(NULL, FALSE) )
+			busy = true;
+	}
+}
+
+static int __harness_create(void){
+	int ret = camera_create(CAMERA_DEVICE_CAMERA0, &g_harness.camera);
+
+	if( ret != CAMERA_ERROR_NONE ){
+		g_harness.camera = NULL;
+		return ret;
+	}
+	g_harness.reported_state = CAMERA_STATE_CREATED;
+	camera_set_state_changed_cb(g_harness.camera, __harness_state_changed_cb, NULL);
+	camera_set_interrupted_cb(g_harness.camera, __harness_interrupted_cb, NULL);
+	camera_set_focus_changed_cb(g_harness.camera, __harness_focus_changed_cb, NULL);
+	camera_set_error_cb(g_harness.camera, __harness_error_cb, NULL);
+	camera_set_preview_cb(g_harness.camera, __harness_preview_cb, NULL);
+	return ret;
+}
+
+static int __harness_destroy(void){
+	int ret = camera_destroy(g_harness.camera);
+
+	if( ret == CAMERA_ERROR_NONE ){
+		g_harness.destroyed = g_harness.camera;
+		g_harness.camera = NULL;
+	}
+	return ret;
+}
+
+static int __harness_start_capture(void){
+	int ret = camera_start_capture(g_harness.camera, __harness_capturing_cb, __harness_capture_completed_cb, NULL);
+
+	if( ret == CAMERA_ERROR_NONE )
+		g_harness.capture_starts++;
+	return ret;
+}
+
+/* what the recorder does with a camera handle, it drives the camcorder itself */
+static int __harness_recorder_realize(bool realize){
+	MMHandleType mm;
+	int ret = _camera_get_mm_handle(g_harness.camera, &mm);
+
+	if( ret != CAMERA_ERROR_NONE )
+		return ret;
+	ret = realize ? mm_camcorder_realize(mm) : mm_camcorder_unrealize(mm);
+	return ret == MM_ERROR_NONE ? CAMERA_ERROR_NONE : CAMERA_ERROR_INVALID_OPERATION;
+}
+
+static int __harness_start_continuous_capture(int count, int interval){
+	int ret = camera_start_continuous_capture(g_harness.camera, count, interval, __harness_capturing_cb, __harness_capture_completed_cb, NULL);
+
+	if( ret == CAMERA_ERROR_NONE )
+		g_harness.capture_starts++;
+	return ret;
+}
+
+static void __harness_post_state(int message, int previous, int current, int code){
+	MMMessageParamType param;
+
+	memset(&param, 0, sizeof(param));
+	param.state.previous = previous;
+	param.state.current = current;
+	param.state.code = code;
+	camera_harness_backend_post(__harness_mm_handle(), message, &param);
+}
+
+static void __harness_post_code(int message, int code){
+	MMMessageParamType param;
+
+	memset(&param, 0, sizeof(param));
+	param.code = code;
+	camera_harness_backend_post(__harness_mm_handle(), message, &param);
+}
+
+/* the commands that call the API, the result is compared with the expected error */
+static bool __harness_api_command(char **tokens, int count, int *result){
+	const char *command = tokens[0];
+
+	if( strcmp(command, "create") == 0 ){
+		*result = __harness_create();
+	}else if( g_harness.camera == NULL ){
+		return false;
+	}else if( strcmp(command, "destroy") == 0 ){
+		*result = __harness_destroy();
+	}else if( strcmp(command, "start_preview") == 0 ){
+		*result = camera_start_preview(g_harness.camera);
+	}else if( strcmp(command, "stop_preview") == 0 ){
+		*result = camera_stop_preview(g_harness.camera);
+	}else if( strcmp(command, "start_capture") == 0 ){
+		*result = __harness_start_capture();
+	}else if( strcmp(command, "start_continuous_capture") == 0 && count == 3 ){
+		*result = __harness_start_continuous_capture(atoi(tokens[1]), atoi(tokens[2]));
+	}else if( strcmp(command, "stop_continuous_capture") == 0 ){
+		*result = camera_stop_continuous_capture(g_harness.camera);
+	}else if( strcmp(command, "start_focusing") == 0 ){
+		*result = camera_start_focusing(g_harness.camera, count > 1 && strcmp(tokens[1], "continuous") == 0);
+	}else if( strcmp(command, "cancel_focusing") == 0 ){
+		*result = camera_cancel_focusing(g_harness.camera);
+	}else if( strcmp(command, "set_preview_resolution") == 0 && count == 3 ){
+		*result = camera_set_preview_resolution(g_harness.camera, atoi(tokens[1]), atoi(tokens[2]));
+	}else if( strcmp(command, "recorder_realize") == 0 ){
+		*result = __harness_recorder_realize(true);
+	}else if( strcmp(command, "recorder_unrealize") == 0 ){
+		*result = __harness_recorder_realize(false);
+	}else{
+		return false;
+	}
+	return true;
+}
+
+/* the commands that drive the stand-in camcorder, returns false on a malformed command */
+static bool __harness_device_command(char **tokens, int count, char *error, int error_size){
+	const char *command = tokens[0];
+	MMHandleType mm = __harness_mm_handle();
+	int value;
+	int previous;
+	int current;
+
+	if( strcmp(command, "fail") == 0 && count == 3 ){
+		if( !__harness_lookup(g_calls, tokens[1], &value) || !__harness_lookup(g_mm_errors, tokens[2], &current) )
+			return false;
+		camera_harness_backend_fail_next(value, current);
+		return true;
+	}
+	if( strcmp(command, "hold") == 0 ){
+		g_harness.hold = true;
+		return true;
+	}
+	if( strcmp(command, "release") == 0 ){
+		g_harness.hold = false;
+		return true;
+	}
+	if( mm == 0 ){
+		snprintf(error, error_size, "%s needs a camera", command);
+		return true;
+	}
+	if( strcmp(command, "interrupt") == 0 && count == 2 ){
+		if( strcmp(tokens[1], "asm") == 0 )
+			value = MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_ASM;
+		else if( strcmp(tokens[1], "security") == 0 )
+			value = MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_SECURITY;
+		else
+			return false;
+		if( camera_harness_backend_interrupt(mm, value) != MM_ERROR_NONE )
+			snprintf(error, error_size, "device is not realized");
+	}else if( strcmp(command, "shot") == 0 ){
+		if( camera_harness_backend_shot(mm) != MM_ERROR_NONE )
+			snprintf(error, error_size, "no shot is due");
+	}else if( strcmp(command, "preview_frame") == 0 ){
+		if( camera_harness_backend_preview_frame(mm) != MM_ERROR_NONE )
+			snprintf(error, error_size, "preview is not running");
+	}else if( strcmp(command, "focus") == 0 && count == 2 ){
+		if( !__harness_lookup(g_focus_states, tokens[1], &value) )
+			return false;
+		__harness_post_code(MM_MESSAGE_CAMCORDER_FOCUS_CHANGED, value);
+	}else if( strcmp(command, "error") == 0 && count == 2 ){
+		if( !__harness_lookup(g_mm_errors, tokens[1], &value) )
+			return false;
+		__harness_post_code(MM_MESSAGE_CAMCORDER_ERROR, value);
+	}else if( strcmp(command, "captured") == 0 && count == 2 ){
+		__harness_post_code(MM_MESSAGE_CAMCORDER_CAPTURED, atoi(tokens[1]));
+	}else if( strcmp(command, "message") == 0 && count == 5 ){
+		if( strcmp(tokens[1], "state_changed") == 0 )
+			value = MM_MESSAGE_CAMCORDER_STATE_CHANGED;
+		else if( strcmp(tokens[1], "asm") == 0 )
+			value = MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_ASM;
+		else if( strcmp(tokens[1], "security") == 0 )
+			value = MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_SECURITY;
+		else
+			return false;
+		// numbers are passed as is so that malformed messages can be replayed
+		if( !__harness_lookup(g_mm_states, tokens[2], &previous) )
+			previous = atoi(tokens[2]);
+		if( !__harness_lookup(g_mm_states, tokens[3], &current) )
+			current = atoi(tokens[3]);
+		__harness_post_state(value, previous, current, atoi(tokens[4]));
+	}else{
+		return false;
+	}
+	return true;
+}
+
+static bool __harness_expect(char **tokens, int count, char *error, int error_size){
+	char expected[HARNESS_EVENT_LENGTH] = "";
+	const char *event = __harness_next_event();
+	int i;
+
+	if( count == 3 && strcmp(tokens[1], "state") == 0 ){
+		camera_state_e state = CAMERA_STATE_NONE;
+		if( g_harness.camera )
+			camera_get_state(g_harness.camera, &state);
+		if( strcmp(__harness_state_name(state), tokens[2]) != 0 )
+			snprintf(error, error_size, "state is %s", __harness_state_name(state));
+		return true;
+	}
+	if( count == 3 && strcmp(tokens[1], "preview_size") == 0 ){
+		int width = 0;
+		int height = 0;
+		if( g_harness.camera )
+			mm_camcorder_get_attributes(__harness_mm_handle(), NULL, MMCAM_CAMERA_WIDTH, &width, MMCAM_CAMERA_HEIGHT, &height, NULL);
+		snprintf(expected, sizeof(expected), "%dx%d", width, height);
+		if( strcmp(expected, tokens[2]) != 0 )
+			snprintf(error, error_size, "preview size is %s", expected);
+		return true;
+	}
+	if( count == 3 && strcmp(tokens[1], "sources") == 0 && strcmp(tokens[2], "none") == 0 ){
+		if( g_harness.destroyed && g_main_context_find_source_by_user_data(NULL, g_harness.destroyed) )
+			snprintf(error, error_size, "a main loop source still holds the destroyed camera");
+		return true;
+	}
+	if( count == 2 && strcmp(tokens[1], "none") == 0 ){
+		if( event )
+			snprintf(error, error_size, "unexpected event \"%s\"", event);
+		return true;
+	}
+	for( i = 1 ; i < count ; i++ ){
+		if( i > 1 )
+			strncat(expected, " ", sizeof(expected) - strlen(expected) - 1);
+		strncat(expected, tokens[i], sizeof(expected) - strlen(expected) - 1);
+	}
+	if( event == NULL )
+		snprintf(error, error_size, "no event, expected \"%s\"", expected);
+	else if( strcmp(event, expected) != 0 )
+		snprintf(error, error_size, "event \"%s\", expected \"%s\"", event, expected);
+	else
+		__harness_pop_event();
+	return true;
+}
+
+static void __harness_reset(void){
+	if( g_harness.camera ){
+		g_harness.hold = false;
+		__harness_drain();
+		// take the device down whatever the script left it in
+		camera_stop_preview(g_harness.camera);
+		camera_destroy(g_harness.camera);
+	}
+	camera_harness_backend_reset();
+	memset(&g_harness, 0, sizeof(g_harness));
+}
+
+static int __harness_run_script(const char *path){
+	char line[256];
+	char error[HARNESS_EVENT_LENGTH * 2];
+	int line_number = 0;
+	int failures = 0;
+	FILE *script = fopen(path, "r");
+
+	if( script == NULL ){
+		fprintf(stderr, "%s: cannot open\n", path);
+		return 1;
+	}
+
+	__harness_reset();
+	while( fgets(line, sizeof(line), script) ){
+		char *tokens[HARNESS_MAX_TOKENS];
+		char *expected_error = NULL;
+		char *saveptr = NULL;
+		char *token;
+		int count = 0;
+		int result;
+
+		line_number++;
+		if( strchr(line, '#') )
+			*strchr(line, '#') = '\0';
+		for( token = strtok_r(line, " \t\r\n", &saveptr) ; token && count < HARNESS_MAX_TOKENS ; token = strtok_r(NULL, " \t\r\n", &saveptr) ){
+			if( strcmp(token, "=>") == 0 ){
+				expected_error = strtok_r(NULL, " \t\r\n", &saveptr);
+				break;
+			}
+			tokens[count++] = token;
+		}
+		if( count == 0 )
+			continue;
+
+		error[0] = '\0';
+		if( strcmp(tokens[0], "expect") == 0 && count > 1 ){
+			__harness_expect(tokens, count, error, sizeof(error));
+		}else{
+			const char *event = __harness_next_event();
+			if( event ){
+				fprintf(stderr, "%s:%d: unexpected event \"%s\"\n", path, line_number, event);
+				failures++;
+				g_harness.event_count = 0;
+			}
+			if( __harness_api_command(tokens, count, &result) ){
+				int expected = CAMERA_ERROR_NONE;
+				if( expected_error && !__harness_lookup(g_camera_errors, expected_error, &expected) )
+					snprintf(error, sizeof(error), "unknown error %s", expected_error);
+				else if( result != expected )
+					snprintf(error, sizeof(error), "%s returned %s", tokens[0], __harness_name(g_camera_errors, result));
+			}else if( !__harness_device_command(tokens, count, error, sizeof(error)) ){
+				snprintf(error, sizeof(error), "malformed command");
+			}
+			__harness_drain();
+		}
+		if( error[0] ){
+			fprintf(stderr, "%s:%d: %s\n", path, line_number, error);
+			failures++;
+		}
+	}
+	fclose(script);
+
+	if( __harness_next_event() ){
+		fprintf(stderr, "%s: unexpected event \"%s\" at the end\n", path, __harness_next_event());
+		failures++;
+	}
+	__harness_reset();
+	printf("%s: %s\n", path, failures ? "FAIL" : "PASS");
+	return failures ? 1 : 0;
+}
+
+/*
+ * Fuzzing : random API calls, device events and injected failures, with the
+ * message delivery deferred at random. The callbacks are checked against the
+ * invariants of the state machine instead of a script.
+ */
+
+typedef struct {
+	unsigned int seed;
+	const char *trace[HARNESS_FUZZ_STEPS * 2 + 8];
+	int trace_count;
+} harness_fuzz_s;
+
+static unsigned int __harness_random(harness_fuzz_s *fuzz){
+	// xorshift32, the seed alone reproduces a sequence
+	fuzz->seed ^= fuzz->seed << 13;
+	fuzz->seed ^= fuzz->seed >> 17;
+	fuzz->seed ^= fuzz->seed << 5;
+	return fuzz->seed;
+}
+
+static void __harness_trace(harness_fuzz_s *fuzz, const char *step){
+	if( fuzz->trace_count < (int)(sizeof(fuzz->trace)/sizeof(fuzz->trace[0])) )
+		fuzz->trace[fuzz->trace_count++] = step;
+}
+
+static const char *__harness_check(void){
+	camera_state_e state;
+
+	if( g_harness.state_errors )
+		return "state change does not follow the last reported state";
+	if( g_harness.capture_completions > g_harness.capture_starts )
+		return "capture completed more often than started";
+	if( g_harness.camera == NULL || g_harness.hold )
+		return NULL;
+
+	camera_get_state(g_harness.camera, &state);
+	if( state < CAMERA_STATE_CREATED || state > CAMERA_STATE_CAPTURED )
+		return "state out of range";
+	if( state != g_harness.reported_state && !(state == CAMERA_STATE_CAPTURED && g_harness.reported_state == CAMERA_STATE_CAPTURING) )
+		return "reported state differs from camera_get_state()";
+	return NULL;
+}
+
+static const char *__harness_fuzz_step(harness_fuzz_s *fuzz){
+	static const int errors[] = { MM_ERROR_CAMCORDER_DEVICE, MM_ERROR_CAMCORDER_DEVICE_BUSY, MM_ERROR_CAMCORDER_INTERNAL, MM_ERROR_CAMCORDER_INVALID_STATE };
+	MMHandleType mm = __harness_mm_handle();
+	unsigned int choice = __harness_random(fuzz) % 16;
+	int events;
+
+	switch( choice ){
+		case 0:
+		case 1:
+			__harness_trace(fuzz, "start_preview");
+			camera_start_preview(g_harness.camera);
+			break;
+		case 2:
+			__harness_trace(fuzz, "stop_preview");
+			camera_stop_preview(g_harness.camera);
+			break;
+		case 3:
+			__harness_trace(fuzz, "start_capture");
+			__harness_start_capture();
+			break;
+		case 4:
+			__harness_trace(fuzz, "start_continuous_capture");
+			__harness_start_continuous_capture(2 + __harness_random(fuzz) % 3, 0);
+			break;
+		case 5:
+			__harness_trace(fuzz, "stop_continuous_capture");
+			camera_stop_continuous_capture(g_harness.camera);
+			break;
+		case 6:
+		case 7:
+			__harness_trace(fuzz, "shot");
+			camera_harness_backend_shot(mm);
+			break;
+		case 8:
+			__harness_trace(fuzz, (choice = __harness_random(fuzz) & 1) ? "interrupt asm" : "interrupt security");
+			camera_harness_backend_interrupt(mm, choice ? MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_ASM : MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_SECURITY);
+			break;
+		case 9:
+			__harness_trace(fuzz, "fail");
+			camera_harness_backend_fail_next(__harness_random(fuzz) % CAMERA_HARNESS_CALL_NUM, errors[__harness_random(fuzz) % 4]);
+			break;
+		case 10:
+			__harness_trace(fuzz, "start_focusing");
+			camera_start_focusing(g_harness.camera, __harness_random(fuzz) & 1);
+			__harness_post_code(MM_MESSAGE_CAMCORDER_FOCUS_CHANGED, CAMERA_FOCUS_STATE_FOCUSED);
+			break;
+		case 11:
+			__harness_trace(fuzz, "preview_frame");
+			camera_harness_backend_preview_frame(mm);
+			break;
+		case 12:
+			__harness_trace(fuzz, "error");
+			__harness_post_code(MM_MESSAGE_CAMCORDER_ERROR, MM_ERROR_CAMCORDER_DEVICE);
+			break;
+		case 13:
+			// a malformed state change is dropped without a callback
+			if( g_harness.hold )
+				break;
+			__harness_trace(fuzz, "malformed state_changed");
+			events = g_harness.event_count;
+			__harness_post_state(MM_MESSAGE_CAMCORDER_STATE_CHANGED, MM_CAMCORDER_STATE_PAUSED + 1 + __harness_random(fuzz) % 4, MM_CAMCORDER_STATE_NULL, 0);
+			__harness_post_state(MM_MESSAGE_CAMCORDER_STATE_CHANGED, MM_CAMCORDER_STATE_PREPARE, MM_CAMCORDER_STATE_NULL, 1 + __harness_random(fuzz) % 4);
+			__harness_drain();
+			if( g_harness.event_count != events )
+				return "malformed state change was delivered";
+			break;
+		case 14:
+			__harness_trace(fuzz, "hold");
+			g_harness.hold = true;
+			break;
+		case 15:
+			__harness_trace(fuzz, "release");
+			g_harness.hold = false;
+			break;
+	}
+	__harness_drain();
+	g_harness.event_count = 0;
+	return __harness_check();
+}
+
+/* brings the device back to CREATED and destroys it, as an application closing the camera would */
+static const char *__harness_fuzz_teardown(harness_fuzz_s *fuzz){
+	camera_state_e state;
+	int attempts;
+
+	camera_harness_backend_reset();
+	for( attempts = 0 ; attempts < 16 ; attempts++ ){
+		while( camera_harness_backend_shot(__harness_mm_handle()) == MM_ERROR_NONE )
+			__harness_drain();
+		camera_get_state(g_harness.camera, &state);
+		if( state == CAMERA_STATE_CAPTURING ){
+			// the completion comes from the main loop, the application waits for it
+			g_harness.hold = false;
+			__harness_trace(fuzz, "teardown stop_continuous_capture");
+			camera_stop_continuous_capture(g_harness.camera);
+		}else if( state == CAMERA_STATE_CAPTURED ){
+			__harness_trace(fuzz, "teardown start_preview");
+			camera_start_preview(g_harness.camera);
+		}else if( state == CAMERA_STATE_PREVIEW ){
+			__harness_trace(fuzz, "teardown stop_preview");
+			camera_stop_preview(g_harness.camera);
+		}else{
+			__harness_trace(fuzz, "teardown destroy");
+			if( __harness_destroy() != CAMERA_ERROR_NONE ){
+				// a failed unrealize leaves the device realized in CREATED, the application stops again
+				__harness_trace(fuzz, "teardown stop_preview");
+				camera_stop_preview(g_harness.camera);
+				__harness_drain();
+				g_harness.event_count = 0;
+				continue;
+			}
+			if( g_main_context_find_source_by_user_data(NULL, g_harness.destroyed) )
+				return "a main loop source outlives the camera";
+			// the main loop runs on after the camera is gone
+			g_harness.hold = false;
+			__harness_drain();
+			g_harness.event_count = 0;
+			return __harness_check();
+		}
+		__harness_drain();
+		g_harness.event_count = 0;
+	}
+	return "camera does not return to CREATED";
+}
+
+static int __harness_fuzz(int sequences, unsigned int seed){
+	harness_fuzz_s fuzz;
+	struct timespec start;
+	struct timespec end;
+	int sequence;
+	int step;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for( sequence = 0 ; sequence < sequences ; sequence++ ){
+		const char *failure = NULL;
+		unsigned int sequence_seed = seed + sequence;
+
+		memset(&fuzz, 0, sizeof(fuzz));
+		fuzz.seed = sequence_seed ? sequence_seed : 1;
+		memset(&g_harness, 0, sizeof(g_harness));
+		if( __harness_create() != CAMERA_ERROR_NONE ){
+			fprintf(stderr, "fuzz: create failed\n");
+			return 1;
+		}
+		for( step = 0 ; step < HARNESS_FUZZ_STEPS && failure == NULL ; step++ )
+			failure = __harness_fuzz_step(&fuzz);
+		// the device is taken down with messages still held half of the time
+		if( failure == NULL )
+			failure = __harness_fuzz_teardown(&fuzz);
+		if( failure ){
+			fprintf(stderr, "fuzz: sequence %d (seed %u): %s\n", sequence, sequence_seed, failure);
+			for( i = 0 ; i < fuzz.trace_count ; i++ )
+				fprintf(stderr, "  %s\n", fuzz.trace[i]);
+			return 1;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	double elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	printf("fuzz: %d sequences, %.0f sequences/s\n", sequences, elapsed > 0 ? sequences / elapsed : 0);
+	return 0;
+}
+
+int main(int argc, char **argv){
+	int failures = 0;
+	int i;
+
+	if( argc >= 3 && strcmp(argv[1], "--fuzz") == 0 )
+		return __harness_fuzz(atoi(argv[2]), argc >= 4 ? strtoul(argv[3], NULL, 0) : (unsigned int)time(NULL));
+
+	if( argc < 2 ){
+		fprintf(stderr, "usage: %s <scenario>...\n       %s --fuzz <sequences> [seed]\n", argv[0], argv[0]);
+		return 2;
+	}
+	for( i = 1 ; i < argc ; i++ )
+		failures += __harness_run_script(argv[i]);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,170 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+
+#include <tet_api.h>
+#include <media/camera.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MY_ASSERT( fun , test , msg ) \
+{\
+	if( !test ) \
+		dts_fail(fun , msg ); \
+}
+
+static void startup(void);
+static void cleanup(void);
+
+void (*tet_startup)(void) = startup;
+void (*tet_cleanup)(void) = cleanup;
+
+static void utc_media_camera_image_update_exif_negative(void);
+static void utc_media_camera_image_update_exif_positive(void);
+static void utc_media_camera_image_transform_negative(void);
+static void utc_media_camera_image_transform_positive(void);
+static void utc_media_camera_image_apply_effect_negative(void);
+static void utc_media_camera_image_apply_effect_positive(void);
+
+struct tet_testlist tet_testlist[] = {
+	{utc_media_camera_image_update_exif_negative, 1},
+	{utc_media_camera_image_update_exif_positive, 2},
+	{utc_media_camera_image_transform_negative, 3},
+	{utc_media_camera_image_transform_positive, 4},
+	{utc_media_camera_image_apply_effect_negative, 5},
+	{utc_media_camera_image_apply_effect_positive, 6},
+	{NULL, 0},
+};
+
+/* SOI, a JFIF APP0 and EOI, no EXIF yet */
+static unsigned char g_jpeg[] = {
+	0xff, 0xd8,
+	0xff, 0xe0, 0x00, 0x10, 'J', 'F', 'I', 'F', 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+	0xff, 0xd9,
+};
+
+/* 4x2 I420, Y is 0..7 row by row, then U 8 and V 9 */
+static unsigned char g_i420[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9 };
+
+static void startup(void)
+{
+	/* start of TC */
+}
+
+static void cleanup(void)
+{
+	/* end of TC */
+}
+
+static void utc_media_camera_image_update_exif_negative(void)
+{
+	int ret;
+	unsigned char not_jpeg[4] = { 0, 0, 0, 0 };
+	camera_image_data_s image = { not_jpeg, sizeof(not_jpeg), 0, 0, CAMERA_PIXEL_FORMAT_JPEG };
+	camera_exif_info_s info;
+	camera_image_data_s updated;
+
+	memset(&info, 0, sizeof(info));
+	ret = camera_image_update_exif(NULL, &info, &updated);
+	MY_ASSERT(__func__, (ret != CAMERA_ERROR_NONE), "NULL image is not allowed");
+	ret = camera_image_update_exif(&image, &info, &updated);
+	dts_check_eq(__func__, ret, CAMERA_ERROR_INVALID_PARAMETER, "a stream without SOI is not allowed");
+}
+
+static void utc_media_camera_image_update_exif_positive(void)
+{
+	int ret;
+	camera_image_data_s image = { g_jpeg, sizeof(g_jpeg), 0, 0, CAMERA_PIXEL_FORMAT_JPEG };
+	camera_exif_info_s info;
+	camera_image_data_s updated;
+
+	memset(&info, 0, sizeof(info));
+	info.set_orientation = true;
+	info.orientation = CAMERA_ATTR_TAG_ORIENTATION_RIGHT_TOP;
+	info.software = "utc";
+	ret = camera_image_update_exif(&image, &info, &updated);
+	MY_ASSERT(__func__, (ret == CAMERA_ERROR_NONE), "update exif fail");
+	/* the EXIF APP1 goes after the JFIF APP0 */
+	MY_ASSERT(__func__, (updated.size > image.size && updated.data[20] == 0xff && updated.data[21] == 0xe1 && memcmp(updated.data + 24, "Exif\0\0", 6) == 0), "no EXIF segment after APP0");
+	MY_ASSERT(__func__, (updated.data[updated.size - 2] == 0xff && updated.data[updated.size - 1] == 0xd9), "the image is not kept");
+	free(updated.data);
+	dts_pass(__func__, "PASS");
+}
+
+static void utc_media_camera_image_transform_negative(void)
+{
+	int ret;
+	camera_image_data_s image = { g_jpeg, sizeof(g_jpeg), 4, 2, CAMERA_PIXEL_FORMAT_JPEG };
+	camera_image_data_s transformed;
+
+	ret = camera_image_transform(NULL, CAMERA_ROTATION_90, CAMERA_FLIP_NONE, &transformed);
+	MY_ASSERT(__func__, (ret != CAMERA_ERROR_NONE), "NULL image is not allowed");
+	ret = camera_image_transform(&image, CAMERA_ROTATION_90, CAMERA_FLIP_NONE, &transformed);
+	dts_check_eq(__func__, ret, CAMERA_ERROR_INVALID_PARAMETER, "JPEG can not be transformed");
+}
+
+static void utc_media_camera_image_transform_positive(void)
+{
+	int ret;
+	camera_image_data_s image = { g_i420, sizeof(g_i420), 4, 2, CAMERA_PIXEL_FORMAT_I420 };
+	camera_image_data_s transformed;
+
+	ret = camera_image_transform(&image, CAMERA_ROTATION_NONE, CAMERA_FLIP_HORIZONTAL, &transformed);
+	MY_ASSERT(__func__, (ret == CAMERA_ERROR_NONE), "flip fail");
+	MY_ASSERT(__func__, (transformed.width == 4 && transformed.height == 2 && transformed.format == CAMERA_PIXEL_FORMAT_I420), "flip changed the size");
+	MY_ASSERT(__func__, (transformed.data[0] == 3 && transformed.data[3] == 0 && transformed.data[4] == 7 && transformed.data[7] == 4), "Y is not mirrored");
+	free(transformed.data);
+
+	ret = camera_image_transform(&image, CAMERA_ROTATION_90, CAMERA_FLIP_NONE, &transformed);
+	MY_ASSERT(__func__, (ret == CAMERA_ERROR_NONE), "rotation fail");
+	MY_ASSERT(__func__, (transformed.width == 2 && transformed.height == 4 && transformed.size == sizeof(g_i420)), "rotation did not swap the size");
+	free(transformed.data);
+	dts_pass(__func__, "PASS");
+}
+
+static void utc_media_camera_image_apply_effect_negative(void)
+{
+	int ret;
+	camera_image_data_s image = { g_i420, sizeof(g_i420), 4, 2, CAMERA_PIXEL_FORMAT_I420 };
+	camera_image_data_s jpeg = { g_jpeg, sizeof(g_jpeg), 4, 2, CAMERA_PIXEL_FORMAT_JPEG };
+	camera_image_data_s result;
+
+	ret = camera_image_apply_effect(&image, -1, &result);
+	MY_ASSERT(__func__, (ret != CAMERA_ERROR_NONE), "-1 is not allowed");
+	ret = camera_image_apply_effect(&jpeg, CAMERA_ATTR_EFFECT_MONO, &result);
+	dts_check_eq(__func__, ret, CAMERA_ERROR_INVALID_PARAMETER, "JPEG can not be processed");
+}
+
+static void utc_media_camera_image_apply_effect_positive(void)
+{
+	int ret;
+	camera_image_data_s image = { g_i420, sizeof(g_i420), 4, 2, CAMERA_PIXEL_FORMAT_I420 };
+	camera_image_data_s result;
+
+	ret = camera_image_apply_effect(&image, CAMERA_ATTR_EFFECT_NEGATIVE, &result);
+	MY_ASSERT(__func__, (ret == CAMERA_ERROR_NONE), "negative fail");
+	MY_ASSERT(__func__, (result.width == 4 && result.height == 2 && result.size == sizeof(g_i420)), "negative changed the size");
+	MY_ASSERT(__func__, (result.data[0] == 255 && result.data[7] == 248 && result.data[8] == 247 && result.data[10] == 246), "the image is not inverted");
+	free(result.data);
+
+	ret = camera_image_apply_effect(&image, CAMERA_ATTR_EFFECT_MONO, &result);
+	MY_ASSERT(__func__, (ret == CAMERA_ERROR_NONE), "mono fail");
+	MY_ASSERT(__func__, (result.data[7] == 7 && result.data[8] == 128 && result.data[11] == 128), "the chroma is not grey");
+	free(result.data);
+	dts_pass(__func__, "PASS");
+}
@@ -116,12 +116,28 @@ typedef enum
 } camera_display_type_e;
 
 
+/**
+ * @brief	Enumerations of the fsync policy used by camera_start_capture_to_path().
+ */
+typedef enum
+{
+	CAMERA_FILE_SYNC_NONE = 0,	/**< Files are left to the kernel writeback */
+	CAMERA_FILE_SYNC_BURST,	/**< Files are synced in batches and at the end of the capture (default) */
+	CAMERA_FILE_SYNC_EACH,	/**< Each file is synced as soon as it is written */
+} camera_file_sync_policy_e;
+
+
 /**
  * @brief	The handle to the camera.
  * @see	recorder_create_videorecorder()
  */
 typedef struct camera_s *camera_h;
 
+/**
+ * @brief	The handle to a session running both cameras together
+ */
+typedef struct camera_session_s *camera_session_h;
+
 
 /**
  * @brief	The handle to the camera display.
@@ -220,6 +236,195 @@ typedef struct
 	int height;		/**< The height of face */
 }camera_detected_face_s;
 
+/**
+ * @brief Struct of a weighted focus or metering region, in preview frame coordinates
+ */
+typedef struct
+{
+	int x;				/**< The x coordinates of the top left corner */
+	int y;				/**< The y coordinates of the top left corner */
+	int width;		/**< The width of the region */
+	int height;		/**< The height of the region */
+	int weight;		/**< The weight of the region, from 1 to 1000 */
+}camera_region_s;
+
+/**
+ * @brief The number of bins of a region luma histogram, each bin covers 4 luma levels
+ */
+#define CAMERA_REGION_HISTOGRAM_BINS 64
+
+/**
+ * @brief Struct of the luma statistics of a metering region
+ */
+typedef struct
+{
+	unsigned int histogram[CAMERA_REGION_HISTOGRAM_BINS];	/**< The luma histogram, bin i counts the luma levels 4 * i to 4 * i + 3 */
+	unsigned int pixels;		/**< The number of sampled pixels, the sum of the histogram */
+	int mean;				/**< The mean luma, from 0 to 255 */
+	int dark_clipping;		/**< The part of the pixels clipped to black, in 1/1000 */
+	int bright_clipping;		/**< The part of the pixels clipped to white, in 1/1000 */
+	unsigned int frame;		/**< The number of the preview frame the statistics come from, counting from 1 */
+}camera_region_statistics_s;
+
+/**
+ * @brief The number of columns of the white balance grid of #camera_frame_statistics_s
+ */
+#define CAMERA_STATISTICS_GRID_COLUMNS 8
+
+/**
+ * @brief The number of rows of the white balance grid of #camera_frame_statistics_s
+ */
+#define CAMERA_STATISTICS_GRID_ROWS 6
+
+/**
+ * @brief Struct of the gray world white balance estimate of a cell of the frame
+ */
+typedef struct
+{
+	int red_gain;			/**< The gain of the red channel that makes the cell gray, 1024 is 1.0 */
+	int blue_gain;			/**< The gain of the blue channel that makes the cell gray, 1024 is 1.0 */
+	unsigned int pixels;		/**< The number of pixels the estimate comes from, 0 when the cell has no usable pixel and the gains are 1.0 */
+}camera_awb_cell_s;
+
+/**
+ * @brief Struct of the statistics of a preview frame
+ */
+typedef struct
+{
+	unsigned int frame;		/**< The number of the preview frame, counting from 1 */
+	unsigned int pixels;		/**< The number of pixels measured */
+	unsigned int luma_histogram[256];	/**< The luma histogram */
+	int luma_mean;			/**< The mean luma, from 0 to 255 */
+	int red_mean;			/**< The mean red, from 0 to 255 */
+	int green_mean;			/**< The mean green, from 0 to 255 */
+	int blue_mean;			/**< The mean blue, from 0 to 255 */
+	unsigned int clipped_red;	/**< The number of pixels whose red is clipped to 255 */
+	unsigned int clipped_green;	/**< The number of pixels whose green is clipped to 255 */
+	unsigned int clipped_blue;	/**< The number of pixels whose blue is clipped to 255 */
+	camera_awb_cell_s awb_grid[CAMERA_STATISTICS_GRID_ROWS][CAMERA_STATISTICS_GRID_COLUMNS];	/**< The white balance estimates, row by row from the top left of the frame */
+}camera_frame_statistics_s;
+
+/**
+ * @brief Struct of the skew statistics of a camera session, the skews are in microseconds
+ */
+typedef struct
+{
+	unsigned int pairs;			/**< The number of frame pairs made */
+	unsigned int unpaired_first;		/**< The number of frames of #CAMERA_DEVICE_CAMERA0 given up without a partner */
+	unsigned int unpaired_second;	/**< The number of frames of #CAMERA_DEVICE_CAMERA1 given up without a partner */
+	int mean_skew;			/**< The mean absolute skew of the pairs */
+	int last_skew;			/**< The skew of the last pair, positive when the #CAMERA_DEVICE_CAMERA1 frame came later */
+	int largest_skew;		/**< The largest absolute skew of a pair */
+}camera_session_skew_s;
+
+/**
+ * @brief Struct of an access unit put out by a preview encoder
+ */
+typedef struct
+{
+	unsigned char *data;		/**< The encoded data */
+	unsigned int size;		/**< The size of the encoded data */
+	long long pts;			/**< The arrival time of the preview frame it encodes, on the monotonic clock in microseconds */
+	long long queued;		/**< The time it was queued, on the monotonic clock in microseconds */
+	bool key_frame;			/**< Whether it decodes without the units before */
+	bool discontinuity;		/**< Whether units were given up right before it, or the encoder was opened again */
+}camera_encoded_unit_s;
+
+/**
+ * @brief Struct of the statistics of a preview encoder, the times are in microseconds
+ */
+typedef struct
+{
+	unsigned int frames;		/**< The number of preview frames handed to the encoder */
+	unsigned int failed_frames;	/**< The number of preview frames the encoder failed on */
+	unsigned int units;		/**< The number of access units the encoder put out */
+	unsigned int dropped_units;	/**< The number of access units given up because the queue overflowed */
+	unsigned int queued_units;	/**< The number of access units waiting to be polled */
+	int mean_encode_time;		/**< The mean time the encoder takes per frame, the time the preview is held up */
+	int last_lag;			/**< The time from the arrival of the frame to the output of its access unit, for the last unit */
+	int mean_lag;			/**< The mean lag of the access units */
+	int largest_lag;		/**< The largest lag of an access unit */
+	int last_queue_delay;		/**< The time the last polled access unit waited in the queue */
+	int mean_queue_delay;		/**< The mean time the access units wait in the queue */
+}camera_preview_encoder_statistics_s;
+
+/**
+ * @brief Enumerations of the reasons the fps governor changes the preview frame rate.
+ */
+typedef enum
+{
+	CAMERA_FPS_GOVERNOR_REASON_FRAME_DROP,		/**< Frames were missing from the preview stream */
+	CAMERA_FPS_GOVERNOR_REASON_CALLBACK_DURATION,	/**< Handling a preview frame took most of the frame interval */
+	CAMERA_FPS_GOVERNOR_REASON_QUEUE_DEPTH,		/**< The queues of the preview encoder or the camera session filled up */
+	CAMERA_FPS_GOVERNOR_REASON_CPU_LOAD,		/**< The CPU was nearly fully loaded */
+	CAMERA_FPS_GOVERNOR_REASON_RECOVERED,		/**< The load went down, the rate is raised back */
+	CAMERA_FPS_GOVERNOR_REASON_THERMAL,		/**< The thermal policy lowered the highest rate allowed */
+} camera_fps_governor_reason_e;
+
+/**
+ * @brief Struct of the statistics of the fps governor, the times are in microseconds
+ */
+typedef struct
+{
+	unsigned int frames;		/**< The number of preview frames watched */
+	unsigned int dropped_frames;	/**< The number of frames missing from the preview stream, found from the gaps between frame timestamps */
+	unsigned int steps_down;	/**< The number of times the rate was lowered */
+	unsigned int steps_up;		/**< The number of times the rate was raised */
+	int mean_callback_time;		/**< The mean time a preview frame is handled in */
+	int largest_callback_time;	/**< The longest time a preview frame was handled in */
+	int cpu_load;			/**< The CPU load in percent over the last second or so, -1 when it is not known */
+	int queue_level;		/**< How full the preview queues got over the last second or so, in percent */
+	int fps;			/**< The rate the governor applied last, in frames per second */
+}camera_fps_governor_statistics_s;
+
+/**
+ * @brief The number of steps kept in the statistics of the thermal policy
+ */
+#define CAMERA_THERMAL_STEP_LOG 8
+
+/**
+ * @brief Enumerations of the levels of thermal pressure, every level keeps the steps of the levels below it.
+ */
+typedef enum
+{
+	CAMERA_THERMAL_LEVEL_NORMAL,	/**< Nothing is scaled down */
+	CAMERA_THERMAL_LEVEL_WARM,	/**< The software stages run at a lower quality */
+	CAMERA_THERMAL_LEVEL_HOT,	/**< The preview frame rate is stepped down */
+	CAMERA_THERMAL_LEVEL_CRITICAL,	/**< The frame rate is stepped down further and the preview resolution is lowered */
+} camera_thermal_level_e;
+
+/**
+ * @brief Struct of a step of the thermal policy, with the settings it left
+ */
+typedef struct
+{
+	camera_thermal_level_e previous;	/**< The level before the step */
+	camera_thermal_level_e level;		/**< The level after the step */
+	int temperature;			/**< The temperature of the hottest thermal zone, in millidegrees Celsius */
+	int cpu_frequency;			/**< The highest CPU frequency allowed in percent of the maximum, -1 when it is not known */
+	long long timestamp;			/**< The time of the step in milliseconds since the policy started */
+	int fps;				/**< The preview frame rate the step asked for */
+	int preview_width;			/**< The preview width the step asked for */
+	int preview_height;			/**< The preview height the step asked for */
+	int jpeg_quality;			/**< The quality of the software JPEG encoding after the step */
+}camera_thermal_step_s;
+
+/**
+ * @brief Struct of the statistics of the thermal policy
+ */
+typedef struct
+{
+	camera_thermal_level_e level;	/**< The current level */
+	int zones;			/**< The number of thermal zones read at the last poll, 0 when the temperature is not known */
+	int temperature;		/**< The temperature of the hottest thermal zone at the last poll, in millidegrees Celsius */
+	int cpu_frequency;		/**< The highest CPU frequency allowed in percent of the maximum, -1 when it is not known */
+	unsigned int polls;		/**< The number of times the sensors were read */
+	unsigned int steps_down;	/**< The number of times the settings were scaled down */
+	unsigned int steps_up;		/**< The number of times the settings were restored */
+	int step_count;			/**< The number of steps in @a steps */
+	camera_thermal_step_s steps[CAMERA_THERMAL_STEP_LOG];	/**< The last steps, the oldest first */
+}camera_thermal_statistics_s;
+
 
 /**
  * @}
@@ -371,6 +576,22 @@ typedef enum
 } camera_attr_tag_orientation_e;
 
 
+/**
+ * @brief	Struct of the EXIF tags updated by camera_image_update_exif().
+ */
+typedef struct
+{
+	bool set_orientation;	/**< Whether @a orientation is written */
+	camera_attr_tag_orientation_e orientation;	/**< The orientation tag */
+	const char *software;	/**< The software tag, or NULL to leave it unchanged */
+	const char *image_description;	/**< The image description tag, or NULL to leave it unchanged */
+	bool set_geotag;	/**< Whether @a latitude, @a longitude and @a altitude are written */
+	double latitude;	/**< The latitude in degrees */
+	double longitude;	/**< The longitude in degrees */
+	double altitude;	/**< The altitude in meters */
+} camera_exif_info_s;
+
+
 /**
  * @brief	Enumerations of the flash mode.
  */
@@ -499,6 +720,122 @@ typedef void (*camera_focus_changed_cb)(camera_focus_state_e state, void *user_d
 typedef void (*camera_preview_cb)(void *stream_buffer, int buffer_size, int width, int height,
         camera_pixel_format_e format, void *user_data);
 
+/**
+ * @brief	Called with the statistics of every preview frame.
+ *
+ * @remarks This function is issued in the context of gstreamer (video sink thread) so you should not directly invoke UI update code.\n
+ * It is called for a frame right before camera_preview_cb() is called with the same frame, @a frame tells them apart from the frames before.\n
+ * The statistics are owned by the camera and only valid until the callback returns, copy what you need to keep.
+ *
+ * @param[in] statistics        The statistics of the frame
+ * @param[in] user_data     	The user data passed from the callback registration function
+ * @pre	camera_start_preview() will invoke this callback function if you register this callback using camera_set_preview_statistics_cb().
+ * @see	camera_set_preview_statistics_cb()
+ * @see	camera_unset_preview_statistics_cb()
+ */
+typedef void (*camera_preview_statistics_cb)(const camera_frame_statistics_s *statistics, void *user_data);
+
+/**
+ * @brief	Called by a preview encoder with each access unit it puts out.
+ *
+ * @remarks The encoder must only call this function from within its encode and close functions, with the @a output_data it was given.
+ * The data is copied into the queue before the function returns.
+ *
+ * @param[in] data          The encoded data
+ * @param[in] size          The size of the encoded data
+ * @param[in] pts           The @a pts of the frame the unit encodes, as given to the encode function
+ * @param[in] key_frame     Whether the unit decodes without the units before
+ * @param[in] output_data   The data given to the encode or close function
+ * @see	camera_preview_encoder_s
+ */
+typedef void (*camera_preview_encoder_output_cb)(const unsigned char *data, unsigned int size, long long pts, bool key_frame, void *output_data);
+
+/**
+ * @brief	Called when a frame replay ends.
+ *
+ * @remarks This function is issued in the context of the replay thread. It is called when the replay is stopped too.
+ *
+ * @param[in] frames        The number of frames replayed, a capture and its thumbnail count as one
+ * @param[in] user_data     The user data passed from the replay start function
+ * @see	camera_start_frame_replay()
+ */
+typedef void (*camera_frame_replay_completed_cb)(int frames, void *user_data);
+
+/**
+ * @brief	Called when the fps governor changed the preview frame rate.
+ *
+ * @remarks This function is issued in the context of glib main loop.
+ *
+ * @param[in] previous      The rate before
+ * @param[in] current       The rate now
+ * @param[in] reason        Why the rate was changed
+ * @param[in] user_data     The user data passed from the governor start function
+ * @see	camera_start_fps_governor()
+ */
+typedef void (*camera_fps_changed_cb)(camera_attr_fps_e previous, camera_attr_fps_e current, camera_fps_governor_reason_e reason, void *user_data);
+
+/**
+ * @brief	Called when the thermal policy moved to another level.
+ *
+ * @remarks This function is issued in the context of glib main loop.\n
+ * A preview resolution change of the new level is already applied when this function is called, a running preview was
+ * restarted at the new resolution.
+ *
+ * @param[in] previous      The level before
+ * @param[in] current       The level now
+ * @param[in] user_data     The user data passed from the policy start function
+ * @see	camera_start_thermal_policy()
+ */
+typedef void (*camera_thermal_level_changed_cb)(camera_thermal_level_e previous, camera_thermal_level_e current, void *user_data);
+
+/**
+ * @brief Struct of the functions of a preview encoder
+ *
+ * @remarks The functions are called on the streaming thread, except close which may also be called from camera_stop_preview_encoder()
+ * or camera_destroy(). They are never called at the same time. An encoder instance only sees frames of one size and format.
+ */
+typedef struct
+{
+	int (*open)(int width, int height, camera_pixel_format_e format, void *user_data, void **instance);	/**< Opens an encoder instance for the frames, returns #CAMERA_ERROR_NONE on success */
+	int (*encode)(void *instance, camera_image_data_s *frame, long long pts, camera_preview_encoder_output_cb output, void *output_data);	/**< Encodes a frame, which is only valid until it returns, returns #CAMERA_ERROR_NONE on success */
+	void (*close)(void *instance, camera_preview_encoder_output_cb output, void *output_data);	/**< Puts out the units still held and closes the instance */
+	void (*request_key_frame)(void *instance);	/**< Asks for the next unit to be a key frame, can be NULL */
+}camera_preview_encoder_s;
+
+/**
+ * @brief	Called with the sharpness of every preview frame.
+ *
+ * @remarks This function is issued in the context of gstreamer (video sink thread) so you should not directly invoke UI update code.\n
+ * The sharpness is the mean squared luma gradient (Tenengrad) inside the focus metric area, see camera_attr_set_focus_metric_area().\n
+ * It only compares frames of the same scene : the higher, the better focused, so it can drive a contrast detection autofocus
+ * or tell whether camera_start_focusing() reached a sharp image.
+ *
+ * @param[in] sharpness         The sharpness of the frame, 0 for a flat image
+ * @param[in] user_data     	The user data passed from the callback registration function
+ * @pre	camera_start_preview() will invoke this callback function if you register this callback using camera_set_focus_metric_cb().
+ * @see	camera_set_focus_metric_cb()
+ * @see	camera_unset_focus_metric_cb()
+ * @see	camera_attr_set_focus_metric_area()
+ */
+typedef void (*camera_focus_metric_cb)(unsigned int sharpness, void *user_data);
+
+/**
+ * @brief	Called with the focus peaking mask of every preview frame.
+ *
+ * @remarks This function is issued in the context of gstreamer (video sink thread) so you should not directly invoke UI update code.\n
+ * The mask has one byte per preview pixel, row by row, set to 255 on the sharpest edges of the frame and to 0 elsewhere.
+ * It is owned by the camera and is only valid during the callback, copy it to draw it later.
+ *
+ * @param[in] mask              The focus peaking mask
+ * @param[in] width             The width of the mask, the width of the preview frame
+ * @param[in] height            The height of the mask, the height of the preview frame
+ * @param[in] user_data     	The user data passed from the callback registration function
+ * @pre	camera_start_preview() will invoke this callback function if you register this callback using camera_set_focus_peaking_cb().
+ * @see	camera_set_focus_peaking_cb()
+ * @see	camera_unset_focus_peaking_cb()
+ */
+typedef void (*camera_focus_peaking_cb)(unsigned char *mask, int width, int height, void *user_data);
+
 /**
  * @brief	Called to get information about image data taken by the camera once per frame while capturing.
  *
@@ -506,7 +843,7 @@ typedef void (*camera_preview_cb)(void *stream_buffer, int buffer_size, int widt
  * You must not call camera_start_preview() within this callback.
  *
  * @param[in] image     The image data of captured picture
- * @param[in] postview  The image data of postvew
+ * @param[in] postview  The image data of postvew ( It is NULL, unless camera_attr_enable_capture_postview() enabled it. )
  * @param[in] thumbnail The image data of thumbnail ( It could be NULL, if available thumbnail data is not existed. )
  * @param[in] user_data     The user data passed from the callback registration function
  * @pre	camera_start_capture() or camera_start_continuous_capture() will invoke this callback function if you register this callback using camera_start_capture() or camera_start_continuous_capture()
@@ -534,6 +871,21 @@ typedef void (*camera_capturing_cb)(camera_image_data_s* image, camera_image_dat
 typedef void (*camera_capture_completed_cb)(void *user_data);
 
 
+/**
+ * @brief	Called when a still image captured by camera_start_capture_to_path() is written to storage.
+ *
+ * @remarks This function is issued in the context of the file writer thread so you should not directly invoke UI update code.
+ *
+ * @param[in] index     The sequence number of the image, starting from 1
+ * @param[in] path      The path of the written file
+ * @param[in] error     #CAMERA_ERROR_NONE on success, #CAMERA_ERROR_OUT_OF_MEMORY if the image was dropped because too many images were waiting for storage, otherwise the file could not be written and was removed
+ * @param[in] user_data     The user data passed from the callback registration function
+ * @pre	camera_start_capture_to_path() will invoke this callback function if you register this callback using camera_start_capture_to_path()
+ * @see	camera_start_capture_to_path()
+ */
+typedef void (*camera_capture_file_saved_cb)(int index, const char *path, camera_error_e error, void *user_data);
+
+
 /**
  * @brief	Called when the error occurred.
  *
@@ -558,6 +910,13 @@ typedef void (*camera_error_cb)(camera_error_e error, camera_state_e current_sta
 /**
  * @brief Called when face detected in the preview frame
  *
+ * @remarks The faces are tracked across frames : a face keeps its id as long as it is followed, and its box is smoothed so that it does not jitter.\n
+ * A face is reported from its second detection on, and for a few frames after it was last detected.\n
+ * The callback is invoked from an idle of the default main loop, so the application must run one, and only when the faces changed.\n
+ * It is not called once per preview frame : while the main loop is busy, the detections of the frames in between are merged and only the latest faces are delivered when it gets idle.\n
+ * The application that needs the faces of each frame should not block the main loop for longer than a preview frame.\n
+ * All the detected faces are reported, however many. The array is owned by the camera and only valid until the callback returns, copy what you need to keep.
+ *
  * @param[in] faces The detected face array
  * @param[in] count The length of array
  * @param[in] user_data The user data passed from the callback registration function
@@ -665,14 +1024,17 @@ int camera_create(camera_device_e device, camera_h *camera);
 /**
  * @brief Destroys the camera handle and releases all its resources.
  *
+ * @remarks A camera of a session is not destroyed with this function, it goes with camera_session_destroy().
+ *
  * @param[in]	camera	The handle to the camera
  * @return      0 on success, otherwise a negative error value.
  * @retval      #CAMERA_ERROR_NONE Successful
  * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval      #CAMERA_ERROR_INVALID_STATE Invalid state
- * @retval      #CAMERA_ERROR_INVALID_OPERATION Invalid operation
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION Invalid operation, or the camera belongs to a session
  *
  * @see camera_create()
+ * @see camera_session_destroy()
  */
 int camera_destroy(camera_h camera);
 
@@ -811,6 +1173,41 @@ int camera_start_continuous_capture(camera_h camera, int count, int interval, ca
  */
 int camera_stop_continuous_capture(camera_h camera);
 
+/**
+ * @brief Starts capturing of still images directly to files.
+ *
+ * @remarks
+ * Captured images are copied and written by a dedicated writer thread, so the capture thread never waits for storage.\n
+ * At most 32 images are held in memory waiting for storage. An image captured while 32 are waiting is dropped, no file is written for it
+ * and camera_capture_file_saved_cb() reports it with #CAMERA_ERROR_OUT_OF_MEMORY.\n
+ * The file name is made from @a path_template, where a single \%d (or a zero padded form like \%04d) is replaced by the sequence number of the image starting from 1, and \%\% is a literal percent.\n
+ * The template must contain the sequence number if @a count is greater than 1. Existing files are overwritten.\n
+ * Each written file is reported through camera_capture_file_saved_cb(), and camera_capture_completed_cb() is invoked after the last file is written and synced according to camera_attr_set_capture_file_sync_policy().\n
+ * The camera state changes as with camera_start_capture() or camera_start_continuous_capture(), and camera_stop_continuous_capture() can abort a burst.\n
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[in]	path_template	The path template of the files
+ * @param[in]	count	The number of still images
+ * @param[in] interval	The interval of capture ( millisecond ), ignored if @a count is 1
+ * @param[in] saved_cb The callback for notification of each written file
+ * @param[in] completed_cb The callback for notification of completed
+ * @param[in] user_data The user data
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_STATE Invalid state
+ * @retval      #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION Invalid operation
+ *
+ * @post   If it succeeds the camera state will be #CAMERA_STATE_CAPTURED.
+ *
+ * @see camera_start_capture()
+ * @see camera_start_continuous_capture()
+ * @see camera_attr_set_capture_file_sync_policy()
+ * @see camera_attr_enable_capture_file_direct_io()
+ */
+int camera_start_capture_to_path(camera_h camera, const char *path_template, int count, int interval, camera_capture_file_saved_cb saved_cb, camera_capture_completed_cb completed_cb, void *user_data);
+
 
 /**
  * @brief Gets the state of the camera.
@@ -888,7 +1285,9 @@ int camera_set_display(camera_h camera, camera_display_type_e type, camera_displ
 /**
  * @brief Sets the resolution of preview.
  *
- * @remarks  This function should be called before previewing (camera_start_preview()).
+ * @remarks  This function should be called before previewing (camera_start_preview()).\n
+ * In the #CAMERA_STATE_CREATED state the resolution is only recorded, it is applied together with the preview format and frame rate when camera_start_preview() realizes the camera.
+ * A resolution the device does not list is refused right away with #CAMERA_ERROR_INVALID_PARAMETER, and the recorded values are kept when camera_start_preview() fails to apply them.
  *
  * @param[in] camera	The handle to the camera
  * @param[in] width	The preview width
@@ -944,7 +1343,8 @@ int camera_get_recommended_preview_resolution(camera_h camera, int *width, int *
  * The callback will invoked when face detected in preview frame.\n
  * Internally starting continuous focus and focusing on detected face.\n
  * When the face detection is running, camera_start_focusing(), camera_cancel_focusing(), camera_attr_set_af_mode(), 	camera_attr_set_af_area(), camera_attr_set_exposure_mode() and camera_attr_set_whitebalance() settings are ignored.\n
- * If invoke camera_stop_preview(), face detection is stopped. and then resuming preview with camera_start_preview(), you should call this method again to resume face detection.
+ * If invoke camera_stop_preview(), face detection is stopped. and then resuming preview with camera_start_preview(), you should call this method again to resume face detection.\n
+ * When the device can not detect faces, frontal faces are searched in a downscaled preview frame in software, at most ten times a second. A face has to be about a thirteenth of the preview width at least to be found, and focus is not driven by the detected faces.
  *
  * @param[in] camera	The handle to the camera
  * @param[in] callback  The callback for notify detected face
@@ -955,6 +1355,7 @@ int camera_get_recommended_preview_resolution(camera_h camera, int *width, int *
  * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval    #CAMERA_ERROR_INVALID_STATE Not preview state
  * @retval    #CAMERA_ERROR_INVALID_OPERATION Not supported this feature
+ * @retval    #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
  *
  * @pre    The camera state must be #CAMERA_STATE_PREVIEW
  *
@@ -983,6 +1384,7 @@ int camera_stop_face_detection(camera_h camera);
  * @brief Zooming on the detected face
  *
  * @remarks The face id is getting from camera_face_detected_cb().\n
+ * The zoom follows the face while it moves, until camera_cancel_face_zoom() is called or face detection is stopped.\n
  *
  * @param[in]	camera	The handle to the camera
  * @param[in] face_id	The face id to zoom
@@ -1302,7 +1704,9 @@ int camera_foreach_supported_capture_format(camera_h camera,
  * @brief Sets the preview data format.
  *
  *
- * @remarks  This function should be called before previewing (see camera_start_preview()).
+ * @remarks  This function should be called before previewing (see camera_start_preview()).\n
+ * In the #CAMERA_STATE_CREATED state the format is only recorded, it is applied together with the preview resolution and frame rate when camera_start_preview() realizes the camera.
+ * A format the device does not list is refused right away with #CAMERA_ERROR_INVALID_PARAMETER, and the recorded values are kept when camera_start_preview() fails to apply them.
  *
  * @param[in]	camera	The handle to the camera
  * @param[out]  format  The preview data format
@@ -1363,6 +1767,7 @@ int camera_foreach_supported_preview_format(camera_h camera,
 /**
  * @biref Gets face detection feature supported state
  * @ingroup CAPI_MEDIA_CAMERA_CAPABILITY_MODULE
+ * @remarks When the device can not detect faces, they are searched in the preview stream in software, which depends on the preview format.
  * @param[in]	camera The handle to the camera
  * @return true on supported, otherwise false
  *
@@ -1417,101 +1822,435 @@ int camera_set_preview_cb(camera_h camera, camera_preview_cb callback, void *use
 int camera_unset_preview_cb(camera_h camera);
 
 /**
- * @brief	Registers a callback function to be called when camera state changes.
+ * @brief	Registers a callback function to be called with the statistics of every preview frame.
+ *
+ * @remarks The statistics are computed in software, in one pass over the preview frame as the sensor delivers it,
+ * before any software rotation, effect or tone mapping. It needs a YUV preview format.\n
+ * The callback can be registered while previewing.
  *
  * @param[in] camera	The handle to the camera
- * @param[in] callback	  The callback function to register
+ * @param[in] callback    The callback function to register
  * @param[in] user_data   The user data to be passed to the callback function
- *
  * @return	  0 on success, otherwise a negative error value.
  * @retval    #CAMERA_ERROR_NONE Successful
  * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
- * @post	 This function will invoke camera_state_changed_cb() when camera state changes.
+ * @retval    #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
  *
- * @see camera_unset_state_changed_cb()
- * @see	camera_state_changed_cb()
+ * @see	camera_unset_preview_statistics_cb()
+ * @see	camera_preview_statistics_cb()
  */
-int camera_set_state_changed_cb(camera_h camera, camera_state_changed_cb callback,
-        void *user_data);
+int camera_set_preview_statistics_cb(camera_h camera, camera_preview_statistics_cb callback, void *user_data);
 
 /**
  * @brief	Unregisters the callback function.
  *
  * @param[in]	camera	The handle to the camera
- * @return	  0 on success, otherwise a negative error value.
- * @retval    #CAMERA_ERROR_NONE Successful
- * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
  *
- * @see     camera_set_state_changed_cb()
+ * @see camera_set_preview_statistics_cb()
  */
-int camera_unset_state_changed_cb(camera_h camera);
+int camera_unset_preview_statistics_cb(camera_h camera);
 
 /**
- * @brief	Registers a callback function to be called when camera interrupted by policy.
+ * @brief	Starts handing the preview frames to an encoder.
  *
- * @param[in] camera	The handle to the camera
- * @param[in] callback	  The callback function to register
- * @param[in] user_data   The user data to be passed to the callback function
+ * @remarks The encoder gets the preview frames straight from the camera buffer, on the streaming thread, before any software rotation, effect or tone mapping.
+ * No frame is copied, but the preview waits for the encoder, keep it real time and check @a mean_encode_time of camera_preview_encoder_get_statistics().\n
+ * The encoder is opened on the first frame, and closed and opened again when the preview resolution or format changes.
+ * Its access units are queued for camera_preview_encoder_poll(). When the queue overflows, it is emptied and the units are given up until the encoder puts out a key frame.\n
+ * The encoder can be started while previewing. Starting it again empties the queue, units polled before are not valid anymore.
  *
+ * @param[in] camera	The handle to the camera
+ * @param[in] encoder	The encoder functions, they are copied
+ * @param[in] user_data	The user data to be passed to the open function of the encoder
+ * @param[in] queue_size	The largest number of access units waiting to be polled, from 1 to 256
  * @return	  0 on success, otherwise a negative error value.
  * @retval    #CAMERA_ERROR_NONE Successful
  * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval    #CAMERA_ERROR_INVALID_STATE The encoder is already started
+ * @retval    #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @see	camera_stop_preview_encoder()
+ * @see	camera_preview_encoder_poll()
+ */
+int camera_start_preview_encoder(camera_h camera, const camera_preview_encoder_s *encoder, void *user_data, int queue_size);
+
+/**
+ * @brief	Stops handing the preview frames to the encoder and closes it.
  *
- * @see camera_unset_interrupted_cb()
- * @see	camera_interrupted_cb()
+ * @remarks The access units the encoder puts out when it is closed are queued, they can still be polled.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_start_preview_encoder()
  */
-int camera_set_interrupted_cb(camera_h camera, camera_interrupted_cb callback,
-	    void *user_data);
+int camera_stop_preview_encoder(camera_h camera);
 
 /**
- * @brief	Unregisters the callback function.
+ * @brief	Takes the oldest access unit out of the queue of the preview encoder.
+ *
+ * @remarks The unit is owned by the camera and valid until the next call of this function, call it from one thread only.\n
+ * When no unit comes within @a timeout, @a unit is cleared and #CAMERA_ERROR_NONE is returned.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[in]	timeout	The time to wait for a unit in milliseconds, 0 not to wait and -1 to wait until a unit comes or the encoder stops
+ * @param[out]	unit	The access unit
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_STATE The encoder is stopped and the queue is empty
+ * @see camera_start_preview_encoder()
+ */
+int camera_preview_encoder_poll(camera_h camera, int timeout, camera_encoded_unit_s *unit);
+
+/**
+ * @brief	Gets the statistics of the preview encoder since it was started.
  *
  * @param[in]	camera	The handle to the camera
+ * @param[out]	statistics	The statistics
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_start_preview_encoder()
+ */
+int camera_preview_encoder_get_statistics(camera_h camera, camera_preview_encoder_statistics_s *statistics);
+
+/**
+ * @brief	Starts recording the preview and capture frames to a trace file.
+ *
+ * @remarks The frames are recorded as the camera delivers them, before any software processing, with their format, size, arrival time and sequence number.
+ * A capture is recorded with its thumbnail.\n
+ * The file is written through a memory mapping, on the thread that delivers the frames. When the disk is full the frames are left out, the file stays readable.
+ * A trace that is never stopped, because the application died, can still be replayed.\n
+ * The trace is meant for reproducing problems, it grows by the size of every preview frame.
+ *
+ * @param[in] camera	The handle to the camera
+ * @param[in] path	The path of the trace file, an existing file is overwritten
  * @return	  0 on success, otherwise a negative error value.
  * @retval    #CAMERA_ERROR_NONE Successful
  * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
- *
- * @see     camera_set_interrupted_cb()
+ * @retval    #CAMERA_ERROR_INVALID_STATE A trace is already recording
+ * @retval    #CAMERA_ERROR_OUT_OF_MEMORY Out of memory or storage
+ * @retval    #CAMERA_ERROR_INVALID_OPERATION The file can not be created
+ * @see	camera_stop_frame_trace()
+ * @see	camera_start_frame_replay()
  */
-int camera_unset_interrupted_cb(camera_h camera);
+int camera_start_frame_trace(camera_h camera, const char *path);
 
+/**
+ * @brief	Stops recording frames and writes the index of the trace file.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_OUT_OF_MEMORY The index did not fit on the storage, the frames can still be replayed
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION Invalid operation
+ * @see camera_start_frame_trace()
+ */
+int camera_stop_frame_trace(camera_h camera);
 
 /**
- * @brief	Registers a callback function to be called when auto-focus state changes.
+ * @brief	Feeds the frames of a trace file to the camera, as if the camera delivered them.
+ *
+ * @remarks The frames go through the same code as camera frames, so the preview, capture and analysis callbacks see them in the recorded order.
+ * They are fed from a replay thread, the camera does not need to be previewing.\n
+ * With a @a speed of 1 the frames come at the recorded pace, with a larger one that many times faster, and with 0 as fast as they are taken.\n
+ * Starting a replay stops the one running. Frames being recorded by camera_start_frame_trace() meanwhile are recorded again.
  *
  * @param[in] camera	The handle to the camera
- * @param[in] callback	The callback function to register
+ * @param[in] path	The path of the trace file
+ * @param[in] speed	The speed of the replay
+ * @param[in] callback	The callback function called when the replay ends, can be NULL
  * @param[in] user_data	The user data to be passed to the callback function
  * @return	  0 on success, otherwise a negative error value.
  * @retval    #CAMERA_ERROR_NONE Successful
- * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
- * @post	This function will invoke camera_focus_changed_cb() when auto-focus state changes.
- *
- * @see	camera_start_focusing()
- * @see	camera_cancel_focusing()
- * @see	camera_unset_focus_changed_cb()
- * @see	camera_focus_changed_cb()
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter, or not a trace file
+ * @retval    #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval    #CAMERA_ERROR_INVALID_OPERATION Invalid operation
+ * @see	camera_stop_frame_replay()
+ * @see	camera_frame_replay_completed_cb()
  */
-int camera_set_focus_changed_cb(camera_h camera, camera_focus_changed_cb callback,
-        void *user_data);
-
+int camera_start_frame_replay(camera_h camera, const char *path, int speed, camera_frame_replay_completed_cb callback, void *user_data);
 
 /**
- * @brief	Unregisters the callback function.
+ * @brief	Stops the frame replay.
+ *
+ * @remarks The function waits for the frame being fed. It must not be called from a callback of the camera while a replay runs.
  *
  * @param[in]	camera	The handle to the camera
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_start_frame_replay()
+ */
+int camera_stop_frame_replay(camera_h camera);
+
+/**
+ * @brief	Starts lowering the preview frame rate when the preview can not keep up, and raising it back when it can.
+ *
+ * @remarks The governor watches the time the preview frames are handled in, the frames missing from the stream, the queues of the preview encoder
+ * and the camera session, and the CPU load. When the preview stays overloaded for about a second, the rate steps down to the next supported one,
+ * as listed by camera_attr_foreach_supported_fps(). When it has had room for a few seconds, the rate steps back up, never above the rate the
+ * governor was started at. A preview rate of #CAMERA_ATTR_FPS_AUTO is fixed to the highest supported rate up to 60 first.\n
+ * The preview frames are taken from the camera while the governor runs, even without a preview callback.
+ * Stopping the governor restores the rate it was started at.
+ *
+ * @param[in] camera	The handle to the camera
+ * @param[in] callback	The callback function called after every rate change, can be NULL
+ * @param[in] user_data	The user data to be passed to the callback function
  * @return	  0 on success, otherwise a negative error value.
  * @retval    #CAMERA_ERROR_NONE Successful
  * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
- *
- * @see     camera_set_focus_changed_cb()
+ * @retval    #CAMERA_ERROR_INVALID_STATE The governor is already running
+ * @retval    #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval    #CAMERA_ERROR_INVALID_OPERATION The camera lists no fixed rate below the current one
+ * @see	camera_stop_fps_governor()
+ * @see	camera_fps_governor_get_statistics()
+ * @see	camera_fps_changed_cb()
  */
-int camera_unset_focus_changed_cb(camera_h camera);
+int camera_start_fps_governor(camera_h camera, camera_fps_changed_cb callback, void *user_data);
 
 /**
- * @brief	Registers a callback function to be called when an asynchronous operation error occurred.
+ * @brief	Stops the fps governor and restores the preview frame rate it was started at.
  *
- * @remarks
+ * @param[in]	camera	The handle to the camera
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_start_fps_governor()
+ */
+int camera_stop_fps_governor(camera_h camera);
+
+/**
+ * @brief	Gets the statistics of the fps governor since it was started.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[out]	statistics	The statistics
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_start_fps_governor()
+ */
+int camera_fps_governor_get_statistics(camera_h camera, camera_fps_governor_statistics_s *statistics);
+
+/**
+ * @brief	Starts scaling the preview and the software stages down while the device is hot, and back up when it cools.
+ *
+ * @remarks The policy reads the thermal zones and the CPU frequency limits of the system every second. A zone reaching a threshold
+ * raises the level after two polls in a row. The level drops back one step at a time, once every zone stayed 3 degrees below the
+ * threshold for five polls. A CPU whose frequency is capped below 80% of its maximum counts as #CAMERA_THERMAL_LEVEL_WARM at least,
+ * below 60% as #CAMERA_THERMAL_LEVEL_HOT at least.\n
+ * At #CAMERA_THERMAL_LEVEL_WARM the software JPEG encoding quality is capped and the software anti-shake and auto contrast stages
+ * are left out of the preview. At #CAMERA_THERMAL_LEVEL_HOT the preview frame rate steps down to the next supported one, at
+ * #CAMERA_THERMAL_LEVEL_CRITICAL to the one below that, and the preview resolution steps down to the next smaller supported one.
+ * While the fps governor runs, the policy lowers the highest rate the governor may use instead.\n
+ * A running preview is stopped and started again at the new resolution, without camera_state_changed_cb() and with the face
+ * detection kept, camera_get_state() reports #CAMERA_STATE_PREVIEW all along. When the preview does not start at the new
+ * resolution it is started again at the old one and the new resolution is used the next time the preview starts. When it
+ * does not start at all, camera_error_cb() is called and the camera goes back to #CAMERA_STATE_CREATED.\n
+ * Stopping the policy restores the settings it changed.
+ *
+ * @param[in] camera	The handle to the camera
+ * @param[in] warm	The temperature of #CAMERA_THERMAL_LEVEL_WARM in millidegrees Celsius, 0 for the default of 45 degrees
+ * @param[in] hot	The temperature of #CAMERA_THERMAL_LEVEL_HOT in millidegrees Celsius, 0 for the default of 55 degrees
+ * @param[in] critical	The temperature of #CAMERA_THERMAL_LEVEL_CRITICAL in millidegrees Celsius, 0 for the default of 65 degrees
+ * @param[in] callback	The callback function called after every level change, can be NULL
+ * @param[in] user_data	The user data to be passed to the callback function
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter, the temperatures must rise from @a warm to @a critical
+ * @retval    #CAMERA_ERROR_INVALID_STATE The policy is already running
+ * @retval    #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @see	camera_stop_thermal_policy()
+ * @see	camera_thermal_policy_get_statistics()
+ * @see	camera_thermal_level_changed_cb()
+ */
+int camera_start_thermal_policy(camera_h camera, int warm, int hot, int critical, camera_thermal_level_changed_cb callback, void *user_data);
+
+/**
+ * @brief	Stops the thermal policy and restores the settings it changed.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_start_thermal_policy()
+ */
+int camera_stop_thermal_policy(camera_h camera);
+
+/**
+ * @brief	Gets the statistics of the thermal policy since it was started, with its last steps.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[out]	statistics	The statistics
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_start_thermal_policy()
+ */
+int camera_thermal_policy_get_statistics(camera_h camera, camera_thermal_statistics_s *statistics);
+
+/**
+ * @brief	Registers a callback function to be called with the sharpness of every preview frame.
+ *
+ * @remarks The sharpness is measured in software on the luma of the preview frames, so it needs a YUV preview format.\n
+ * The callback can be registered while previewing.
+ *
+ * @param[in] camera	The handle to the camera
+ * @param[in] callback    The callback function to register
+ * @param[in] user_data   The user data to be passed to the callback function
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see	camera_unset_focus_metric_cb()
+ * @see	camera_focus_metric_cb()
+ * @see	camera_attr_set_focus_metric_area()
+ */
+int camera_set_focus_metric_cb(camera_h camera, camera_focus_metric_cb callback, void *user_data);
+
+/**
+ * @brief	Unregisters the callback function.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see camera_set_focus_metric_cb()
+ */
+int camera_unset_focus_metric_cb(camera_h camera);
+
+/**
+ * @brief	Registers a callback function to be called with the focus peaking mask of every preview frame.
+ *
+ * @remarks The mask is computed in software on the luma of the preview frames, so it needs a YUV preview format.\n
+ * The callback can be registered while previewing.
+ *
+ * @param[in] camera	The handle to the camera
+ * @param[in] callback    The callback function to register
+ * @param[in] user_data   The user data to be passed to the callback function
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see	camera_unset_focus_peaking_cb()
+ * @see	camera_focus_peaking_cb()
+ */
+int camera_set_focus_peaking_cb(camera_h camera, camera_focus_peaking_cb callback, void *user_data);
+
+/**
+ * @brief	Unregisters the callback function.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see camera_set_focus_peaking_cb()
+ */
+int camera_unset_focus_peaking_cb(camera_h camera);
+
+/**
+ * @brief	Registers a callback function to be called when camera state changes.
+ *
+ * @param[in] camera	The handle to the camera
+ * @param[in] callback	  The callback function to register
+ * @param[in] user_data   The user data to be passed to the callback function
+ *
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @post	 This function will invoke camera_state_changed_cb() when camera state changes.
+ *
+ * @see camera_unset_state_changed_cb()
+ * @see	camera_state_changed_cb()
+ */
+int camera_set_state_changed_cb(camera_h camera, camera_state_changed_cb callback,
+        void *user_data);
+
+/**
+ * @brief	Unregisters the callback function.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see     camera_set_state_changed_cb()
+ */
+int camera_unset_state_changed_cb(camera_h camera);
+
+/**
+ * @brief	Registers a callback function to be called when camera interrupted by policy.
+ *
+ * @param[in] camera	The handle to the camera
+ * @param[in] callback	  The callback function to register
+ * @param[in] user_data   The user data to be passed to the callback function
+ *
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see camera_unset_interrupted_cb()
+ * @see	camera_interrupted_cb()
+ */
+int camera_set_interrupted_cb(camera_h camera, camera_interrupted_cb callback,
+	    void *user_data);
+
+/**
+ * @brief	Unregisters the callback function.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see     camera_set_interrupted_cb()
+ */
+int camera_unset_interrupted_cb(camera_h camera);
+
+
+/**
+ * @brief	Registers a callback function to be called when auto-focus state changes.
+ *
+ * @param[in] camera	The handle to the camera
+ * @param[in] callback	The callback function to register
+ * @param[in] user_data	The user data to be passed to the callback function
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @post	This function will invoke camera_focus_changed_cb() when auto-focus state changes.
+ *
+ * @see	camera_start_focusing()
+ * @see	camera_cancel_focusing()
+ * @see	camera_unset_focus_changed_cb()
+ * @see	camera_focus_changed_cb()
+ */
+int camera_set_focus_changed_cb(camera_h camera, camera_focus_changed_cb callback,
+        void *user_data);
+
+
+/**
+ * @brief	Unregisters the callback function.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see     camera_set_focus_changed_cb()
+ */
+int camera_unset_focus_changed_cb(camera_h camera);
+
+/**
+ * @brief	Registers a callback function to be called when an asynchronous operation error occurred.
+ *
+ * @remarks
  * This callback inform critical error situation.\n
  * When invoked this callback, user should release the resource and terminate application.\n
  * These error code will be occurred\n
@@ -1662,7 +2401,9 @@ typedef bool (*camera_attr_supported_fps_cb)(camera_attr_fps_e fps, void *user_d
 /**
  * @brief Sets the preview frame rate.
  *
- * @remarks  This function should be called before previewing (see camera_start_preview()).
+ * @remarks  This function should be called before previewing (see camera_start_preview()).\n
+ * In the #CAMERA_STATE_CREATED state the frame rate is only recorded, it is applied together with the preview resolution and format when camera_start_preview() realizes the camera.
+ * A frame rate the device does not list is refused right away with #CAMERA_ERROR_INVALID_PARAMETER, and the recorded values are kept when camera_start_preview() fails to apply them.
  *
  * @param[in] camera	The handle to the camera
  * @param[in] fps	The frame rate
@@ -1758,10 +2499,169 @@ int camera_attr_set_image_quality(camera_h camera, int quality);
  */
 int camera_attr_get_image_quality(camera_h camera, int *quality);
 
+/**
+ * @brief Enable/Disable software JPEG encoding of raw captures.
+ * @remarks
+ * When the capture format is a raw format (see camera_set_capture_format()), each captured frame is copied and
+ * encoded to JPEG by a pool of worker threads, using the quality set by camera_attr_set_image_quality().\n
+ * camera_capturing_cb() is then invoked from a worker thread with #CAMERA_PIXEL_FORMAT_JPEG image data,
+ * always in shot order. camera_capture_completed_cb() is invoked after the last encoded shot is delivered.
+ *
+ * @param[in]	camera The handle to the camera
+ * @param[in]	enable The state of software JPEG encoding
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_STATE Capture is in progress
+ * @retval      #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ *
+ * @see camera_attr_is_enabled_software_jpeg_encoding()
+ * @see camera_set_capture_format()
+ * @see camera_attr_set_image_quality()
+ */
+int camera_attr_enable_software_jpeg_encoding(camera_h camera, bool enable);
+
+/**
+ * @brief Gets state of software JPEG encoding of raw captures.
+ *
+ * @param[in]	camera The handle to the camera
+ * @param[out]	enabled The state of software JPEG encoding
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see camera_attr_enable_software_jpeg_encoding()
+ */
+int camera_attr_is_enabled_software_jpeg_encoding(camera_h camera, bool *enabled);
+
+/**
+ * @brief Sets the fsync policy of camera_start_capture_to_path().
+ *
+ * @remarks #CAMERA_FILE_SYNC_BURST issues the syncs of several files together, which is much cheaper than #CAMERA_FILE_SYNC_EACH on flash storage.\n
+ * The policy takes effect from the next camera_start_capture_to_path().
+ * @param[in]	camera	The handle to the camera
+ * @param[in]	policy	The fsync policy
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_attr_get_capture_file_sync_policy()
+ * @see camera_start_capture_to_path()
+ */
+int camera_attr_set_capture_file_sync_policy(camera_h camera, camera_file_sync_policy_e policy);
+
+/**
+ * @brief Gets the fsync policy of camera_start_capture_to_path().
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[out]	policy	The fsync policy
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_attr_set_capture_file_sync_policy()
+ */
+int camera_attr_get_capture_file_sync_policy(camera_h camera, camera_file_sync_policy_e *policy);
+
+/**
+ * @brief Enables or disables direct I/O (O_DIRECT) for camera_start_capture_to_path().
+ *
+ * @remarks Direct I/O bypasses the page cache, so a long burst does not evict other data from memory.\n
+ * If the file system does not support direct I/O, buffered I/O is used instead.\n
+ * The setting takes effect from the next camera_start_capture_to_path().
+ * @param[in]	camera	The handle to the camera
+ * @param[in]	enable	If @c true direct I/O is used, otherwise @c false
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_attr_is_enabled_capture_file_direct_io()
+ * @see camera_start_capture_to_path()
+ */
+int camera_attr_enable_capture_file_direct_io(camera_h camera, bool enable);
+
+/**
+ * @brief Gets the state of direct I/O for camera_start_capture_to_path().
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[out]	enabled	@c true if direct I/O is enabled, otherwise @c false
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_attr_enable_capture_file_direct_io()
+ */
+int camera_attr_is_enabled_capture_file_direct_io(camera_h camera, bool *enabled);
+
+/**
+ * @brief Enables or disables delivery of the postview image to camera_capturing_cb().
+ *
+ * @remarks Postview is disabled by default, an application that uses the postview image enables it before the capture.
+ * Retrieving it costs an attribute lookup (and a copy, when software JPEG encoding is enabled) for every captured image,
+ * which matters for continuous capture.\n
+ * When disabled, the @a postview parameter of camera_capturing_cb() is @c NULL.\n
+ * camera_start_capture_to_path() never retrieves the postview image.
+ * @param[in]	camera	The handle to the camera
+ * @param[in]	enable	If @c true the postview image is delivered, otherwise @c false
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_attr_is_enabled_capture_postview()
+ * @see camera_capturing_cb()
+ */
+int camera_attr_enable_capture_postview(camera_h camera, bool enable);
+
+/**
+ * @brief Gets the state of postview delivery to camera_capturing_cb().
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[out]	enabled	@c true if the postview image is delivered, otherwise @c false
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_attr_enable_capture_postview()
+ */
+int camera_attr_is_enabled_capture_postview(camera_h camera, bool *enabled);
+
+/**
+ * @brief Sets the size of thumbnails generated in software for captures without a thumbnail.
+ *
+ * @remarks Many devices do not provide a thumbnail with the captured image. When a size is set and the
+ * device gives none, a JPEG thumbnail fitting in @a width x @a height (keeping the aspect ratio) is made from the captured
+ * image by a worker thread and delivered as the @a thumbnail parameter of camera_capturing_cb(), which is then invoked
+ * from that worker thread, always in shot order.\n
+ * JPEG captures are downscaled while decoding, so the full size image is never decoded.\n
+ * Set both @a width and @a height to 0 to disable thumbnail generation (default).
+ * @param[in]	camera	The handle to the camera
+ * @param[in]	width	The maximum thumbnail width
+ * @param[in]	height	The maximum thumbnail height
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_STATE Capture is in progress
+ * @retval      #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @see camera_attr_get_software_thumbnail_size()
+ * @see camera_capturing_cb()
+ */
+int camera_attr_set_software_thumbnail_size(camera_h camera, int width, int height);
+
+/**
+ * @brief Gets the size of thumbnails generated in software.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[out]	width	The maximum thumbnail width, 0 if disabled
+ * @param[out]	height	The maximum thumbnail height, 0 if disabled
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_attr_set_software_thumbnail_size()
+ */
+int camera_attr_get_software_thumbnail_size(camera_h camera, int *width, int *height);
+
 /**
  * @brief Sets the zoom level.
  * @details The range for zoom level is getting from camera_attr_get_zoom_range(). If @a zoom is out of range, #CAMERA_ERROR_INVALID_PARAMETER error occurred.
  *
+ * @remarks  Setting the zoom level already applied does nothing.\n
+ * While previewing, the zoom level, brightness and contrast are applied at most once a preview frame, the last level set in a frame is applied with the next one.
+ * If the camera refuses the levels applied with a frame, the next call of any of the three setters returns that error, its own level is still set.
+ *
  * @param[in] camera	The handle to the camera
  * @param[in] zoom	The zoom level
  * @return	  0 on success, otherwise a negative error value.
@@ -1871,6 +2771,120 @@ int camera_attr_set_af_area(camera_h camera, int x, int y);
  */
 int camera_attr_clear_af_area(camera_h camera);
 
+/**
+ * @brief Sets the area the sharpness of camera_focus_metric_cb() is measured in.
+ *
+ * @remarks The area is in preview frame coordinates and is clipped to the frame.\n
+ * By default the whole frame is measured.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[in] x The x coordinate of the top left corner of the area
+ * @param[in] y The y coordinate of the top left corner of the area
+ * @param[in] width The width of the area
+ * @param[in] height The height of the area
+ *
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see camera_set_focus_metric_cb()
+ * @see camera_attr_clear_focus_metric_area()
+ */
+int camera_attr_set_focus_metric_area(camera_h camera, int x, int y, int width, int height);
+
+/**
+ * @brief Clears the focus metric area, the whole frame is measured again.
+ *
+ * @param[in]	camera	The handle to the camera
+ *
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see camera_attr_set_focus_metric_area()
+ */
+int camera_attr_clear_focus_metric_area(camera_h camera);
+
+/**
+ * @brief Sets weighted auto focus regions.
+ *
+ * @remarks This API is invalid in CAMERA_ATTR_AF_NONE mode, except to clear the regions.\n
+ * The coordinates are mapped into preview area. The device focuses on the center of the region with the highest weight,
+ * and the sharpness of camera_focus_metric_cb() is the weighted mean of the sharpness of the regions when no focus metric area is set.\n
+ * A @a count of 0 clears the regions, as camera_attr_clear_af_area() does. camera_attr_set_af_area() replaces them by a single point.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[in] regions The focus regions, copied by the camera
+ * @param[in] count The number of regions
+ *
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION Invalid operation
+ * @retval      #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ *
+ * @see camera_attr_set_af_area()
+ * @see camera_attr_clear_af_area()
+ * @see camera_set_focus_metric_cb()
+ */
+int camera_attr_set_af_regions(camera_h camera, const camera_region_s *regions, int count);
+
+/**
+ * @brief Sets weighted exposure metering regions.
+ *
+ * @remarks The coordinates are mapped into preview area.\n
+ * The luma statistics of every region are computed in software on each preview frame, which needs a YUV preview format.
+ * The device exposure is not changed, the application drives it from the statistics with camera_attr_set_exposure().\n
+ * Large regions are sampled on a sparser grid, so that a frame costs about the same whatever the preview size.\n
+ * A @a count of 0 clears the regions and stops the statistics.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[in] regions The metering regions, copied by the camera
+ * @param[in] count The number of regions
+ *
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ *
+ * @see camera_attr_get_ae_region_statistics()
+ * @see camera_attr_get_ae_weighted_mean()
+ */
+int camera_attr_set_ae_regions(camera_h camera, const camera_region_s *regions, int count);
+
+/**
+ * @brief Gets the luma statistics of a metering region on the latest preview frame.
+ *
+ * @remarks The statistics are updated on every preview frame, compare @a frame of two calls to tell whether a new frame came.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[in] index The index of the region, in the order given to camera_attr_set_ae_regions()
+ * @param[out] statistics The statistics of the region
+ *
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION No region is set, or no preview frame arrived since they were
+ *
+ * @see camera_attr_set_ae_regions()
+ */
+int camera_attr_get_ae_region_statistics(camera_h camera, int index, camera_region_statistics_s *statistics);
+
+/**
+ * @brief Gets the mean luma of the metering regions on the latest preview frame, weighted by their weights and areas.
+ *
+ * @param[in]	camera	The handle to the camera
+ * @param[out] mean The weighted mean luma, from 0 to 255
+ *
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION No region is set, or no preview frame arrived since they were
+ *
+ * @see camera_attr_set_ae_regions()
+ */
+int camera_attr_get_ae_weighted_mean(camera_h camera, int *mean);
+
 /**
  * @}
  */
@@ -2109,6 +3123,9 @@ int camera_attr_get_theater_mode(camera_h camera, camera_attr_theater_mode_e *mo
 /**
  * @brief Sets the brightness level.
  *
+ * @remarks  Setting the brightness level already applied does nothing.\n
+ * While previewing, the zoom level, brightness and contrast are applied at most once a preview frame, the last level set in a frame is applied with the next one.
+ * If the camera refuses the levels applied with a frame, the next call of any of the three setters returns that error, its own level is still set.
  *
  * @param[in]	camera	The handle to the camera
  * @param[in]   level   The brightness level
@@ -2153,6 +3170,10 @@ int camera_attr_get_brightness_range(camera_h camera, int *min, int *max);
 /**
  * @brief Sets the contrast level.
  *
+ * @remarks  Setting the contrast level already applied does nothing.\n
+ * While previewing, the zoom level, brightness and contrast are applied at most once a preview frame, the last level set in a frame is applied with the next one.
+ * If the camera refuses the levels applied with a frame, the next call of any of the three setters returns that error, its own level is still set.
+ *
  * @param[in]   camera  The handle to the camera
  * @param[in]  level   The contrast level
  * @return      0 on success, otherwise a negative error value.
@@ -2262,6 +3283,9 @@ int camera_attr_foreach_supported_whitebalance(camera_h camera,
 /**
  * @brief Sets the camera effect mode.
  *
+ * @remarks Effects the camera device does not support are applied in software to the frames passed to camera_preview_cb()\n
+ * and to raw frames passed to camera_capturing_cb(). The display and JPEG captures, the default capture format, are not affected by software effects.\n
+ * The software effect only stands in when the device reports the effect as not supported, other errors are returned.
  * @param[in]	camera	The handle to the camera
  * @param[in]   effect  The camera effect mode
  * @return      0 on success, otherwise a negative error value.
@@ -2300,6 +3324,9 @@ int camera_attr_get_effect(camera_h camera, camera_attr_effect_mode_e *effect);
 /**
  * @brief Retrieves all supported effect modes by invoking callback function once for each supported effect mode.
  *
+ * @remarks The effects of the camera device are listed first. When the preview format is one the software effects read (NV12, NV21, I420, YV12, YUYV or UYVY),\n
+ * the effects the device lacks follow. Those are applied in software to the frames passed to camera_preview_cb() and to raw captures only,\n
+ * they never reach the display or JPEG captures.
  * @param[in]	camera	The handle to the camera
  * @param[in]   callback  The callback function to invoke
  * @param[in]   user_data   The user data to be passed to the callback function
@@ -2541,6 +3568,28 @@ int camera_attr_get_geotag(camera_h camera, double *latitude , double *longitude
  */
 int camera_attr_remove_geotag(camera_h camera);
 
+/**
+ * @brief Updates the EXIF tags of a captured JPEG image without re-encoding it.
+ *
+ * @remarks The given tags are added, or replace the existing ones, and all other EXIF data is kept.
+ * If the image has no EXIF data, a new APP1 segment is inserted.\n
+ * The pixel data is not decoded. The output image is built with a single allocation,
+ * so this is much cheaper than rewriting the file through a JPEG encoder.\n
+ * @a updated must be released with free() by you. @a image is not modified.
+ * @param[in]	image	The captured image, its format should be #CAMERA_PIXEL_FORMAT_JPEG
+ * @param[in]	info	The tags to write
+ * @param[out]	updated	The image with the updated EXIF data
+ * @return      0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter or not a JPEG image
+ * @retval      #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION The existing EXIF data is corrupted or the EXIF segment would exceed 64KB
+ * @see camera_capturing_cb()
+ * @see camera_attr_set_geotag()
+ * @see camera_attr_set_tag_orientation()
+ */
+int camera_image_update_exif(camera_image_data_s *image, const camera_exif_info_s *info, camera_image_data_s *updated);
+
 /**
  * @brief Sets the camera flash mode.
  *
@@ -2622,6 +3671,9 @@ int camera_attr_get_lens_orientation(camera_h camera, int *angle);
 /**
  * @brief Sets stream rotation
  *
+ * @remarks If the camera device can not rotate the stream, the frames passed to camera_preview_cb() and\n
+ * raw frames passed to camera_capturing_cb() are rotated in software, and JPEG captures get a matching EXIF orientation tag.\n
+ * The software fallback does not rotate the display.
  * @param[in]	camera	The handle to the camera
  * @param[in] rotation	The stream rotation
  * @return	    0 on success, otherwise a negative error value.
@@ -2654,6 +3706,7 @@ int camera_attr_get_stream_rotation(camera_h camera , camera_rotation_e *rotatio
 /**
  * @brief Sets stream flip
  *
+ * @remarks If the camera device can not flip the stream, the flip is done in software, as described in camera_attr_set_stream_rotation().
  * @param[in]	camera	The handle to the camera
  * @param[in] flip  The stream flip
  * @return	    0 on success, otherwise a negative error value.
@@ -2681,6 +3734,43 @@ int camera_attr_set_stream_flip(camera_h camera , camera_flip_e flip);
  */
 int camera_attr_get_stream_flip(camera_h camera , camera_flip_e *flip);
 
+/**
+ * @brief Rotates and flips a raw image in software.
+ *
+ * @remarks The image is flipped first and then rotated clockwise, the same order as the stream rotation and flip.\n
+ * Supported formats are #CAMERA_PIXEL_FORMAT_NV12, #CAMERA_PIXEL_FORMAT_NV21, #CAMERA_PIXEL_FORMAT_I420,\n
+ * #CAMERA_PIXEL_FORMAT_YV12, #CAMERA_PIXEL_FORMAT_YUYV and #CAMERA_PIXEL_FORMAT_UYVY.\n
+ * @a transformed->data is allocated by this function and must be released with free().
+ * @param[in]	image	The source image
+ * @param[in]	rotation	The clockwise rotation
+ * @param[in]	flip	The flip applied before the rotation
+ * @param[out]	transformed	The transformed image
+ * @return	0 on success, otherwise a negative error value.
+ * @retval	#CAMERA_ERROR_NONE Successful
+ * @retval	#CAMERA_ERROR_INVALID_PARAMETER Invalid parameter, unsupported format or odd rotated width of a packed format
+ * @retval	#CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @see camera_attr_set_stream_rotation()
+ * @see camera_attr_set_stream_flip()
+ */
+int camera_image_transform(camera_image_data_s *image, camera_rotation_e rotation, camera_flip_e flip, camera_image_data_s *transformed);
+
+/**
+ * @brief Applies a color effect to a raw image in software.
+ *
+ * @remarks The supported formats are the same as camera_image_transform().\n
+ * #CAMERA_ATTR_EFFECT_EMBOSS, #CAMERA_ATTR_EFFECT_OUTLINE and #CAMERA_ATTR_EFFECT_SKETCH produce grey images.\n
+ * @a result->data is allocated by this function and must be released with free().
+ * @param[in]	image	The source image
+ * @param[in]	effect	The effect to apply
+ * @param[out]	result	The image with the effect applied
+ * @return	0 on success, otherwise a negative error value.
+ * @retval	#CAMERA_ERROR_NONE Successful
+ * @retval	#CAMERA_ERROR_INVALID_PARAMETER Invalid parameter or unsupported format
+ * @retval	#CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @see camera_attr_set_effect()
+ */
+int camera_image_apply_effect(camera_image_data_s *image, camera_attr_effect_mode_e effect, camera_image_data_s *result);
+
 
 
 /**
@@ -2703,13 +3793,19 @@ typedef void (*camera_attr_hdr_progress_cb)(int percent, void *user_data);
  * @remarks
  * Taking multiple pictures at different exposure level and intelligently stitching them together so that we eventually arrive at a picture that is representative in both dark and bright areas.\n
  * If this attribute is setting true. camera_attr_hdr_progress_cb is invoked when capture.\n
- * If you set #CAMERA_ATTR_HDR_MODE_KEEP_ORIGINAL, the capturing callback is invoked twice. The first callback is delivering origin image data. The second callback is delivering improved image data.
+ * If you set #CAMERA_ATTR_HDR_MODE_KEEP_ORIGINAL, the capturing callback is invoked twice. The first callback is delivering origin image data. The second callback is delivering improved image data.\n
+ * If the device can not do HDR capture, it is done in software : camera_start_capture() takes three shots at the current, a lower and a higher exposure value, aligns them and fuses them into one image.
+ * Each shot is taken after the previous one completed and the exposure changed, the camera stays in #CAMERA_STATE_CAPTURING in between. A shot not taken at its exposure value drops the fused image.
+ * The fused image is delivered after the capture, before camera_capture_completed_cb(), and holds about four copies of the capture resolution in memory while it is made.
+ * When the fused image can not be made, camera_error_cb() is called with the error, #CAMERA_ERROR_OUT_OF_MEMORY when memory ran out, and camera_capture_completed_cb() follows without a fused image.
+ * If the exposure range no longer spans more than one value when the capture starts, camera_start_capture() fails with #CAMERA_ERROR_INVALID_OPERATION.
  *
  * @param[in]	camera The handle to the camera
  * @param[in]	mode The mode of HDR capture
  * @return	    0 on success, otherwise a negative error value.
  * @retval      #CAMERA_ERROR_NONE Successful
- * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter, or @a mode is not a #camera_attr_hdr_mode_e value
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION The device failed to set the mode, or has no HDR capture and no exposure range to bracket
  *
  * @see camera_attr_get_hdr_mode()
  * @see camera_attr_set_hdr_capture_progress_cb()
@@ -2777,6 +3873,7 @@ int camera_attr_unset_hdr_capture_progress_cb(camera_h camera);
 /**
  * @biref Gets HDR capture supported state
  * @ingroup CAPI_MEDIA_CAMERA_CAPABILITY_MODULE
+ * @remarks HDR capture is also supported when the device only has an exposure value range, see camera_attr_set_hdr_mode().
  * @param[in]	camera The handle to the camera
  * @return true on supported, otherwise false
  *
@@ -2790,7 +3887,9 @@ bool camera_attr_is_supported_hdr_capture(camera_h camera);
 /**
  * @brief Enable/Disable Anti-shake feature
  * @remarks
- * If enabling anti-shake, zero shutter lag is disabling
+ * If enabling anti-shake, zero shutter lag is disabling\n
+ * If the device has no anti-shake, the frames of camera_preview_cb() are stabilized in software instead. They are cropped by 8% on every side, so they are smaller than the preview resolution.
+ * The display and the recorded video are not stabilized in that case. The software stage only stands in when the device reports anti-shake as not supported, other errors are returned.
  *
  * @param[in]	camera The handle to the camera
  * @param[in]	enable The state of anti-shake
@@ -2822,6 +3921,8 @@ int camera_attr_is_enabled_anti_shake(camera_h camera , bool *enabled);
 /**
  * @biref Gets Anti-shake feature supported state
  * @ingroup CAPI_MEDIA_CAMERA_CAPABILITY_MODULE
+ * @remarks Without device support, anti-shake is done in software on the preview callback frames, see camera_attr_enable_anti_shake().
+ * It is then reported as supported only if the current preview format is a YUV format the software stage reads (NV12, NV16, NV21, YUYV, UYVY, 422P, I420 or YV12).
  * @param[in]	camera The handle to the camera
  * @return true on supported, otherwise false
  *
@@ -2832,6 +3933,9 @@ bool camera_attr_is_supported_anti_shake(camera_h camera);
 
 /**
  * @brief Enable/Disable auto contrast
+ * @remarks If the device has no WDR, the luma of the preview callback frames and of raw captures is tone mapped in software with local histogram equalization.
+ * JPEG captures, the display and the recorded video are not changed in that case. The cost is about 6ms for a 1920x1080 frame.\n
+ * The software stage only stands in when the device does not list WDR or reports it as not supported, other errors are returned.
  *
  * @param[in]	camera The handle to the camera
  * @param[in]	enable The state of auto contrast
@@ -2859,6 +3963,158 @@ int camera_attr_enable_auto_contrast(camera_h camera, bool enable);
 int camera_attr_is_enabled_auto_contrast(camera_h camera, bool *enabled);
 
 
+/**
+ * @}
+ */
+
+
+/**
+ * @addtogroup CAPI_MEDIA_CAMERA_MODULE
+ * @{
+ */
+
+/**
+ * @brief	Called with a pair of preview frames of the two cameras of a session, taken at about the same time.
+ *
+ * @remarks This function is issued in the context of the session dispatch thread so you should not directly invoke UI update code.\n
+ * The frames are owned by the session and only valid until the callback returns. While it runs, newer frames wait in the session pool,
+ * a slow callback makes the session give frames up rather than delay the cameras.
+ *
+ * @param[in] first         The preview frame of #CAMERA_DEVICE_CAMERA0
+ * @param[in] second        The preview frame of #CAMERA_DEVICE_CAMERA1
+ * @param[in] skew          The arrival time of @a second minus the one of @a first, in microseconds
+ * @param[in] user_data     The user data passed from the callback registration function
+ * @pre	camera_session_start_preview() will invoke this callback function if you register this callback using camera_session_set_preview_cb().
+ * @see	camera_session_set_preview_cb()
+ * @see	camera_session_unset_preview_cb()
+ */
+typedef void (*camera_session_preview_cb)(camera_image_data_s *first, camera_image_data_s *second, int skew, void *user_data);
+
+/**
+ * @brief Creates a session that runs #CAMERA_DEVICE_CAMERA0 and #CAMERA_DEVICE_CAMERA1 together.
+ *
+ * @remarks Both cameras are created by the session, get them with camera_session_get_camera() to set them up.
+ * Their preview frames are stamped as they arrive, paired by time on a single dispatch thread and copied through a single frame pool.\n
+ * You must release @a session using camera_session_destroy(), not the cameras with camera_destroy().
+ *
+ * @param[out] session  A newly returned handle to the session
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval    #CAMERA_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval    #CAMERA_ERROR_INVALID_OPERATION Invalid operation
+ * @see	camera_session_destroy()
+ */
+int camera_session_create(camera_session_h *session);
+
+/**
+ * @brief Stops and destroys both cameras of the session and releases the session.
+ *
+ * @param[in]	session	The handle to the session
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION Invalid operation
+ * @see	camera_session_create()
+ */
+int camera_session_destroy(camera_session_h session);
+
+/**
+ * @brief Gets one of the cameras of the session.
+ *
+ * @remarks The camera can be set up with the camera API, and can have its own callbacks.
+ * It stays owned by the session.
+ *
+ * @param[in]	session	The handle to the session
+ * @param[in]	device	#CAMERA_DEVICE_CAMERA0 or #CAMERA_DEVICE_CAMERA1
+ * @param[out]	camera	The handle to the camera
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ */
+int camera_session_get_camera(camera_session_h session, camera_device_e device, camera_h *camera);
+
+/**
+ * @brief Sets the largest skew of a pair of frames.
+ *
+ * @remarks Frames further apart are not paired, the older one is given up. The default is 16667 microseconds, half a frame at 30 fps.
+ *
+ * @param[in]	session	The handle to the session
+ * @param[in]	skew	The largest skew, in microseconds
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ */
+int camera_session_set_max_skew(camera_session_h session, int skew);
+
+/**
+ * @brief	Registers a callback function to be called with each pair of preview frames.
+ *
+ * @remarks Frames are only copied into the session pool while a callback is registered, without one the session only measures the skew.
+ *
+ * @param[in] session	The handle to the session
+ * @param[in] callback    The callback function to register
+ * @param[in] user_data   The user data to be passed to the callback function
+ * @return	  0 on success, otherwise a negative error value.
+ * @retval    #CAMERA_ERROR_NONE Successful
+ * @retval    #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see	camera_session_unset_preview_cb()
+ * @see	camera_session_preview_cb()
+ */
+int camera_session_set_preview_cb(camera_session_h session, camera_session_preview_cb callback, void *user_data);
+
+/**
+ * @brief	Unregisters the callback function.
+ *
+ * @param[in]	session	The handle to the session
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see camera_session_set_preview_cb()
+ */
+int camera_session_unset_preview_cb(camera_session_h session);
+
+/**
+ * @brief Starts the preview of both cameras.
+ *
+ * @remarks When the second camera can not start, the first one is stopped again.
+ *
+ * @param[in]	session	The handle to the session
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_STATE Invalid state
+ * @retval      #CAMERA_ERROR_SOUND_POLICY Sound policy error
+ * @retval      #CAMERA_ERROR_INVALID_OPERATION Invalid operation
+ * @see	camera_session_stop_preview()
+ */
+int camera_session_start_preview(camera_session_h session);
+
+/**
+ * @brief Stops the preview of both cameras.
+ *
+ * @remarks No pair is delivered after this function returns, the frames still waiting for a partner are given up.
+ *
+ * @param[in]	session	The handle to the session
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval      #CAMERA_ERROR_INVALID_STATE Invalid state
+ * @see	camera_session_start_preview()
+ */
+int camera_session_stop_preview(camera_session_h session);
+
+/**
+ * @brief Gets the skew statistics of the session since it was created.
+ *
+ * @param[in]	session	The handle to the session
+ * @param[out]	statistics	The skew statistics
+ * @return	    0 on success, otherwise a negative error value.
+ * @retval      #CAMERA_ERROR_NONE Successful
+ * @retval      #CAMERA_ERROR_INVALID_PARAMETER Invalid parameter
+ */
+int camera_session_get_skew_statistics(camera_session_h session, camera_session_skew_s *statistics);
+
 /**
  * @}
  */
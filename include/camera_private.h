@@ -27,7 +27,73 @@
 extern "C" {
 #endif
 
-#define MAX_DETECTED_FACE 20
+#define CAMERA_HDR_MAX_FRAMES 5
+
+typedef struct _camera_jpeg_encoder_s camera_jpeg_encoder_s;
+typedef struct _camera_file_writer_s camera_file_writer_s;
+typedef struct _camera_hdr_s camera_hdr_s;
+typedef struct _camera_eis_s camera_eis_s;
+typedef struct _camera_wdr_s camera_wdr_s;
+typedef struct _camera_face_tracker_s camera_face_tracker_s;
+typedef struct _camera_face_detector_s camera_face_detector_s;
+typedef struct _camera_metering_s camera_metering_s;
+typedef struct _camera_session_s camera_session_s;
+typedef struct _camera_encoder_tap_s camera_encoder_tap_s;
+typedef struct _camera_frame_trace_writer_s camera_frame_trace_writer_s;
+typedef struct _camera_frame_trace_reader_s camera_frame_trace_reader_s;
+typedef struct _camera_frame_replay_s camera_frame_replay_s;
+typedef struct _camera_fps_governor_s camera_fps_governor_s;
+typedef struct _camera_thermal_s camera_thermal_s;
+
+/* faces found by the software detector, in stream coordinates, called on its worker thread */
+typedef void (*camera_face_detector_cb)(const camera_detected_face_s *faces, int count, void *user_data);
+
+/* side of the window the face cascade was trained on */
+#define CAMERA_FACE_CASCADE_WINDOW 20
+
+/* a rectangle of a cascade feature on the window grid, unused ones weigh 0 */
+typedef struct {
+	unsigned char x;
+	unsigned char y;
+	unsigned char width;
+	unsigned char height;
+	signed char weight;
+} _camera_face_cascade_rect_s;
+
+typedef struct {
+	_camera_face_cascade_rect_s rects[3];
+	float threshold;
+	float below;
+	float above;
+} _camera_face_stump_s;
+
+typedef struct {
+	int stumps;
+	float threshold;
+} _camera_face_stage_s;
+
+typedef struct {
+	unsigned char *data;
+	unsigned int capacity;
+} camera_image_buffer_s;
+
+typedef enum {
+	_CAMERA_FRAME_TRACE_PREVIEW,
+	_CAMERA_FRAME_TRACE_CAPTURE,
+	_CAMERA_FRAME_TRACE_THUMBNAIL,
+}_camera_frame_trace_type_e;
+
+/* a frame of a trace, the image points into the trace */
+typedef struct {
+	int type;
+	camera_image_data_s image;
+	unsigned int sequence;
+	unsigned int stream_timestamp;
+	long long timestamp;
+} camera_frame_trace_record_s;
+
+/* a replayed frame, with the thumbnail that came with a capture, called on the replay thread */
+typedef void (*camera_frame_replay_dispatch_cb)(camera_frame_trace_record_s *frame, camera_frame_trace_record_s *thumbnail, void *user_data);
 
 typedef enum {
 	_CAMERA_EVENT_TYPE_STATE_CHANGE,
@@ -39,9 +105,37 @@ typedef enum {
 	_CAMERA_EVENT_TYPE_HDR_PROGRESS,
 	_CAMERA_EVENT_TYPE_INTERRUPTED,
 	_CAMERA_EVENT_TYPE_FACE_DETECTION,
+	_CAMERA_EVENT_TYPE_FOCUS_METRIC,
+	_CAMERA_EVENT_TYPE_FOCUS_PEAKING,
+	_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS,
+	_CAMERA_EVENT_TYPE_FPS_CHANGE,
+	_CAMERA_EVENT_TYPE_THERMAL_CHANGE,
 	_CAMERA_EVENT_TYPE_NUM
 }_camera_event_e;
 
+/* preview attributes recorded while the camcorder is not realized */
+typedef enum {
+	_CAMERA_DEFERRED_RESOLUTION = 1 << 0,
+	_CAMERA_DEFERRED_FORMAT = 1 << 1,
+	_CAMERA_DEFERRED_FPS = 1 << 2,
+}_camera_deferred_attribute_e;
+
+/* attributes whose last applied value is kept, the continuous ones come first */
+typedef enum {
+	_CAMERA_CACHED_ZOOM,
+	_CAMERA_CACHED_BRIGHTNESS,
+	_CAMERA_CACHED_CONTRAST,
+	_CAMERA_CACHED_EXPOSURE_MODE,
+	_CAMERA_CACHED_EXPOSURE,
+	_CAMERA_CACHED_ISO,
+	_CAMERA_CACHED_WHITEBALANCE,
+	_CAMERA_CACHED_SCENE_MODE,
+	_CAMERA_CACHED_FLASH_MODE,
+	_CAMERA_CACHED_NUM
+}_camera_cached_attribute_e;
+
+#define _CAMERA_CACHED_CONTINUOUS_NUM (_CAMERA_CACHED_CONTRAST + 1)
+
 typedef struct _camera_s{
 	MMHandleType mm_handle;
 
@@ -61,16 +155,224 @@ typedef struct _camera_s{
 	int current_capture_count;
 	int current_capture_complete_count;
 	bool capture_resolution_modified;
-	camera_detected_face_s faceinfo[MAX_DETECTED_FACE];
+	camera_image_buffer_s face_input_buffer;
+	camera_image_buffer_s face_buffer;
 	int num_of_faces;
+	camera_face_tracker_s *face_tracker;
+	camera_face_detector_s *face_detector;
+	bool sw_face_detection;
+	volatile gint face_delivery_pending;
+	int face_zoom_id;
+	int face_zoom_x;
+	int face_zoom_y;
 	bool hdr_keep_mode;
 	bool focus_area_valid;
+	int focus_metric_x;
+	int focus_metric_y;
+	int focus_metric_width;
+	int focus_metric_height;
+	camera_image_buffer_s focus_peaking_buffer;
+	camera_metering_s *metering;
+	camera_frame_statistics_s *frame_statistics;
+	camera_session_s *session;
+	int session_device;
+	camera_encoder_tap_s *encoder_tap;
+	camera_frame_trace_writer_s *frame_trace;
+	camera_frame_replay_s *frame_replay;
+	camera_fps_governor_s *fps_governor;
+	camera_attr_fps_e fps_governor_restore;
+	volatile gint fps_change_pending;
+	camera_thermal_s *thermal;
+	guint thermal_timer;
+	camera_thermal_level_e thermal_level;
+	camera_attr_fps_e thermal_restore_fps;
+	int thermal_fps;
+	int thermal_width;
+	int thermal_height;
+	bool thermal_resize_pending;
+	bool thermal_restarting;
+	int deferred_attributes;
+	int deferred_width;
+	int deferred_height;
+	int deferred_format;
+	int deferred_fps;
+	int deferred_fps_auto;
+	bool mm_handle_shared;		// the recorder has the camcorder, attributes are no longer deferred
+	int attr_cache[_CAMERA_CACHED_NUM];
+	int attr_cache_valid;
+	GMutex attr_lock;		// guards the cache and the pending values, setters may run on any thread
+	int attr_pending[_CAMERA_CACHED_CONTINUOUS_NUM];
+	int attr_pending_mask;
+	int attr_coalesce_error;		// a refused coalesced set, returned by the next continuous setter
+	guint attr_coalesce_timer;
+	gint64 attr_applied_time;
+	camera_jpeg_encoder_s *jpeg_encoder;
+	bool jpeg_encoding;
+	int jpeg_quality;
+	int thumbnail_width;
+	int thumbnail_height;
+	camera_file_writer_s *file_writer;
+	camera_file_sync_policy_e file_sync_policy;
+	bool file_direct_io;
+	bool postview_enabled;
+	bool sw_transform;
+	camera_rotation_e sw_rotation;
+	camera_flip_e sw_flip;
+	camera_attr_effect_mode_e sw_effect;
+	camera_hdr_s *hdr;
+	camera_attr_hdr_mode_e sw_hdr_mode;
+	bool hdr_capturing;
+	int hdr_shot;
+	int hdr_shots;
+	int hdr_exposure[CAMERA_HDR_MAX_FRAMES];
+	bool hdr_bias_valid;
+	int hdr_bias[CAMERA_HDR_MAX_FRAMES];
+	int hdr_exposure_restore;
+	camera_eis_s *eis;
+	bool sw_anti_shake;
+	camera_wdr_s *wdr;
+	bool sw_wdr;
+	camera_image_buffer_s preview_frame_buffer;
+	camera_image_buffer_s capture_frame_buffer;
 } camera_s;
 
 int _camera_get_mm_handle(camera_h camera , MMHandleType *handle);
 int _camera_set_relay_mm_message_callback(camera_h camera, MMMessageCallback callback, void *user_data);
 int __camera_start_continuous_focusing(camera_h camera);
 
+unsigned int _camera_get_image_size(camera_pixel_format_e format, int width, int height);
+bool _camera_image_is_valid(camera_image_data_s *image);
+int _camera_image_copy(camera_image_data_s *dst, camera_image_data_s *src);
+int _camera_image_buffer_reserve(camera_image_buffer_s *buffer, unsigned int size);
+void _camera_image_buffer_release(camera_image_buffer_s *buffer);
+bool _camera_image_is_transform_supported(camera_pixel_format_e format);
+int _camera_image_transform(camera_image_data_s *src, camera_rotation_e rotation, camera_flip_e flip, camera_image_data_s *dst);
+bool _camera_image_is_effect_supported(camera_pixel_format_e format);
+unsigned int _camera_image_effect_scratch_size(int width);
+int _camera_image_apply_effect(camera_image_data_s *src, camera_attr_effect_mode_e effect, unsigned char *scratch, camera_image_data_s *dst);
+int _camera_image_crop(camera_image_data_s *src, int x, int y, int width, int height, camera_image_data_s *dst);
+
+bool _camera_jpeg_is_supported_format(camera_pixel_format_e format);
+int _camera_jpeg_encode(camera_image_data_s *src, int quality, unsigned char **jpeg, unsigned int *jpeg_size);
+int _camera_jpeg_to_i420(camera_image_data_s *src, camera_image_data_s *i420);
+int _camera_jpeg_make_thumbnail(camera_image_data_s *src, int max_width, int max_height, int quality, camera_image_data_s *thumbnail);
+int _camera_jpeg_encoder_create(camera_jpeg_encoder_s **encoder);
+void _camera_jpeg_encoder_destroy(camera_jpeg_encoder_s *encoder);
+int _camera_jpeg_encoder_push(camera_jpeg_encoder_s *encoder, camera_image_data_s *image, camera_image_data_s *thumbnail, camera_image_data_s *postview, int quality, bool encode, int thumbnail_width, int thumbnail_height, camera_capturing_cb callback, void *user_data);
+bool _camera_jpeg_encoder_set_drain_cb(camera_jpeg_encoder_s *encoder, camera_capture_completed_cb callback, void *user_data);
+
+int _camera_hdr_create(camera_hdr_s **hdr);
+void _camera_hdr_destroy(camera_hdr_s *hdr);
+int _camera_hdr_start(camera_hdr_s *hdr, int frames, int quality, camera_attr_hdr_progress_cb progress_cb, void *progress_user_data, camera_capturing_cb callback, void *user_data);
+int _camera_hdr_push(camera_hdr_s *hdr, camera_image_data_s *image);
+void _camera_hdr_cancel(camera_hdr_s *hdr);
+bool _camera_hdr_set_done_cb(camera_hdr_s *hdr, camera_capture_completed_cb callback, void *user_data, camera_error_cb error_cb, void *error_user_data);
+
+bool _camera_exif_get_exposure_bias(const camera_image_data_s *image, int *bias);
+
+bool _camera_eis_is_supported_format(camera_pixel_format_e format);
+void _camera_eis_get_output_size(int width, int height, int *out_width, int *out_height);
+int _camera_eis_create(camera_eis_s **eis);
+void _camera_eis_destroy(camera_eis_s *eis);
+int _camera_eis_process(camera_eis_s *eis, camera_image_data_s *frame, camera_image_data_s *dst);
+
+bool _camera_wdr_is_supported_format(camera_pixel_format_e format);
+int _camera_wdr_create(camera_wdr_s **wdr);
+void _camera_wdr_destroy(camera_wdr_s *wdr);
+int _camera_wdr_apply(camera_wdr_s *wdr, camera_image_data_s *src, camera_image_data_s *dst);
+
+int _camera_face_tracker_create(camera_face_tracker_s **tracker);
+void _camera_face_tracker_destroy(camera_face_tracker_s *tracker);
+void _camera_face_tracker_reset(camera_face_tracker_s *tracker);
+bool _camera_face_tracker_update(camera_face_tracker_s *tracker, const camera_detected_face_s *faces, int count);
+int _camera_face_tracker_get_faces(camera_face_tracker_s *tracker, camera_detected_face_s *faces, int max);
+bool _camera_face_tracker_get_face(camera_face_tracker_s *tracker, int id, camera_detected_face_s *face);
+
+bool _camera_face_detector_is_supported_format(camera_pixel_format_e format);
+int _camera_face_detector_create(camera_face_detector_s **detector, camera_face_detector_cb callback, void *user_data);
+void _camera_face_detector_destroy(camera_face_detector_s *detector);
+void _camera_face_detector_reset(camera_face_detector_s *detector);
+int _camera_face_detector_push(camera_face_detector_s *detector, camera_image_data_s *frame);
+
+extern const _camera_face_stage_s _camera_face_stages[];
+extern const _camera_face_stump_s _camera_face_stumps[];
+extern const int _camera_face_stage_count;
+extern const int _camera_face_stump_count;
+
+bool _camera_focus_is_supported_format(camera_pixel_format_e format);
+unsigned int _camera_focus_get_sharpness(camera_image_data_s *frame, int x, int y, int width, int height);
+int _camera_focus_get_peaking_mask(camera_image_data_s *frame, unsigned char *mask);
+
+int _camera_metering_create(camera_metering_s **metering);
+void _camera_metering_destroy(camera_metering_s *metering);
+bool _camera_metering_is_valid_regions(const camera_region_s *regions, int count);
+int _camera_metering_set_focus_regions(camera_metering_s *metering, const camera_region_s *regions, int count);
+int _camera_metering_set_regions(camera_metering_s *metering, const camera_region_s *regions, int count);
+bool _camera_metering_has_regions(camera_metering_s *metering);
+int _camera_metering_process(camera_metering_s *metering, camera_image_data_s *frame);
+int _camera_metering_get_statistics(camera_metering_s *metering, int index, camera_region_statistics_s *statistics);
+int _camera_metering_get_weighted_mean(camera_metering_s *metering, int *mean);
+bool _camera_metering_get_sharpness(camera_metering_s *metering, camera_image_data_s *frame, unsigned int *sharpness);
+bool _camera_metering_get_focus_point(camera_metering_s *metering, int *x, int *y);
+
+int _camera_statistics_compute(camera_image_data_s *frame, camera_frame_statistics_s *statistics);
+
+int _camera_session_push(camera_session_s *session, int device, camera_image_data_s *frame);
+int _camera_session_get_queue_level(camera_session_s *session);
+
+int _camera_encoder_tap_create(camera_encoder_tap_s **tap);
+void _camera_encoder_tap_destroy(camera_encoder_tap_s *tap);
+bool _camera_encoder_tap_is_running(camera_encoder_tap_s *tap);
+int _camera_encoder_tap_start(camera_encoder_tap_s *tap, const camera_preview_encoder_s *encoder, void *user_data, int queue_size);
+int _camera_encoder_tap_stop(camera_encoder_tap_s *tap);
+int _camera_encoder_tap_push(camera_encoder_tap_s *tap, camera_image_data_s *frame);
+int _camera_encoder_tap_poll(camera_encoder_tap_s *tap, int timeout, camera_encoded_unit_s *unit);
+int _camera_encoder_tap_get_statistics(camera_encoder_tap_s *tap, camera_preview_encoder_statistics_s *statistics);
+int _camera_encoder_tap_get_queue_level(camera_encoder_tap_s *tap);
+
+int _camera_fps_governor_create(camera_fps_governor_s **governor);
+void _camera_fps_governor_destroy(camera_fps_governor_s *governor);
+bool _camera_fps_governor_is_running(camera_fps_governor_s *governor);
+int _camera_fps_governor_start(camera_fps_governor_s *governor, const int *rates, int count, int fps);
+int _camera_fps_governor_stop(camera_fps_governor_s *governor);
+bool _camera_fps_governor_push(camera_fps_governor_s *governor, unsigned int timestamp, int duration, int queue_level);
+bool _camera_fps_governor_get_change(camera_fps_governor_s *governor, int *previous, int *fps, camera_fps_governor_reason_e *reason);
+bool _camera_fps_governor_set_limit(camera_fps_governor_s *governor, int fps);
+void _camera_fps_governor_set_applied(camera_fps_governor_s *governor, bool applied);
+int _camera_fps_governor_get_statistics(camera_fps_governor_s *governor, camera_fps_governor_statistics_s *statistics);
+
+void _camera_thermal_set_sysfs_root(const char *root);
+int _camera_thermal_create(camera_thermal_s **thermal);
+void _camera_thermal_destroy(camera_thermal_s *thermal);
+bool _camera_thermal_is_running(camera_thermal_s *thermal);
+int _camera_thermal_start(camera_thermal_s *thermal, int warm, int hot, int critical);
+void _camera_thermal_stop(camera_thermal_s *thermal);
+bool _camera_thermal_poll(camera_thermal_s *thermal, camera_thermal_level_e *previous, camera_thermal_level_e *level);
+void _camera_thermal_log_step(camera_thermal_s *thermal, camera_thermal_level_e previous, camera_thermal_level_e level, int fps, int width, int height, int jpeg_quality);
+int _camera_thermal_get_statistics(camera_thermal_s *thermal, camera_thermal_statistics_s *statistics);
+
+int _camera_frame_trace_writer_create(camera_frame_trace_writer_s **writer);
+void _camera_frame_trace_writer_destroy(camera_frame_trace_writer_s *writer);
+bool _camera_frame_trace_writer_is_open(camera_frame_trace_writer_s *writer);
+int _camera_frame_trace_writer_open(camera_frame_trace_writer_s *writer, const char *path);
+int _camera_frame_trace_writer_append(camera_frame_trace_writer_s *writer, int type, camera_image_data_s *image, camera_image_data_s *thumbnail, unsigned int stream_timestamp);
+int _camera_frame_trace_writer_close(camera_frame_trace_writer_s *writer);
+int _camera_frame_trace_reader_open(const char *path, camera_frame_trace_reader_s **reader);
+int _camera_frame_trace_reader_open_buffer(const unsigned char *data, size_t size, camera_frame_trace_reader_s **reader);
+void _camera_frame_trace_reader_close(camera_frame_trace_reader_s *reader);
+unsigned int _camera_frame_trace_reader_get_count(camera_frame_trace_reader_s *reader);
+int _camera_frame_trace_reader_get_record(camera_frame_trace_reader_s *reader, unsigned int index, camera_frame_trace_record_s *record);
+int _camera_frame_replay_start(const char *path, int speed, camera_frame_replay_dispatch_cb dispatch, void *dispatch_data,
+	camera_frame_replay_completed_cb completed_cb, void *completed_data, camera_frame_replay_s **replay);
+void _camera_frame_replay_stop(camera_frame_replay_s *replay);
+
+bool _camera_file_writer_is_valid_template(const char *path_template, int count);
+int _camera_file_writer_create(camera_file_writer_s **writer);
+void _camera_file_writer_destroy(camera_file_writer_s *writer);
+int _camera_file_writer_start(camera_file_writer_s *writer, const char *path_template, camera_file_sync_policy_e sync_policy, bool direct_io, camera_capture_file_saved_cb saved_cb, camera_capture_completed_cb completed_cb, void *user_data);
+int _camera_file_writer_push(camera_file_writer_s *writer, camera_image_data_s *image);
+int _camera_file_writer_finish(camera_file_writer_s *writer);
+
 #ifdef __cplusplus
 }
 #endif
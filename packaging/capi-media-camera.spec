@@ -9,6 +9,7 @@ BuildRequires:  cmake
 BuildRequires:  pkgconfig(dlog)
 BuildRequires:  pkgconfig(mm-camcorder)
 BuildRequires:  pkgconfig(capi-base-common)
+BuildRequires:  pkgconfig(libjpeg)
 Requires(post): /sbin/ldconfig  
 Requires(postun): /sbin/ldconfig
 
@@ -22,6 +22,7 @@
 #include <mm_camcorder.h>
 #include <mm_types.h>
 #include <math.h>
+#include <limits.h>
 #include <camera.h>
 #include <camera_private.h>
 #include <glib.h>
@@ -32,9 +33,22 @@
 #endif
 #define LOG_TAG "TIZEN_N_CAMERA"
 
+/* a face box reaching further out is not from a real frame */
+#define CAMERA_MAX_FACE_COORDINATE 16384
+/* the thermal policy reads the sensors this often, in milliseconds */
+#define CAMERA_THERMAL_POLL_INTERVAL 1000
+/* the highest software JPEG quality while the device is warm */
+#define CAMERA_THERMAL_JPEG_QUALITY 70
+
 static gboolean __mm_videostream_callback(MMCamcorderVideoStreamDataType * stream, void *user_data);
 static gboolean __mm_capture_callback(MMCamcorderCaptureDataType *frame, MMCamcorderCaptureDataType *thumbnail, void *user_data);
+static void __capture_to_path_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data);
+
 
+/* the device lacks the attribute or does not list the value, only then may a software stage stand in */
+static bool __camera_is_not_supported_error(int code){
+	return code == MM_ERROR_CAMCORDER_NOT_SUPPORTED || code == MM_ERROR_COMMON_ATTR_NOT_EXIST || code == MM_ERROR_COMMON_OUT_OF_ARRAY;
+}
 
 static int __convert_camera_error_code(const char* func, int code){
 	int ret = CAMERA_ERROR_NONE;
@@ -128,26 +142,643 @@ static int __convert_camera_error_code(const char* func, int code){
 }
 
 
+/*
+ * Stabilizes preview frames, rotates, flips, tone maps and applies the color effect the sensor can not do, into the pooled buffer.
+ * The effect line buffers sit behind the frame in the same allocation, followed by the stabilized frame when it is rotated afterwards.
+ */
+static bool __camera_process_frame(camera_s *handle, camera_image_buffer_s *buffer, camera_image_data_s *frame, bool preview, camera_image_data_s *processed){
+	// a warm device leaves the costly stages out of the preview, captures still get them
+	bool relieved = preview && handle->thermal_level >= CAMERA_THERMAL_LEVEL_WARM;
+	bool stabilize = preview && !relieved && handle->sw_anti_shake && _camera_eis_is_supported_format(frame->format);
+	bool transform = handle->sw_transform && (handle->sw_rotation != CAMERA_ROTATION_NONE || handle->sw_flip != CAMERA_FLIP_NONE);
+	bool wdr = !relieved && handle->sw_wdr && _camera_wdr_is_supported_format(frame->format);
+	bool effect = handle->sw_effect != CAMERA_ATTR_EFFECT_NONE;
+	camera_image_data_s src = *frame;
+	unsigned int size;
+	unsigned int scratch_size = 0;
+	unsigned int stabilized_size = 0;
+	int width = frame->width;
+	int height = frame->height;
+
+	if( (!stabilize && !transform && !wdr && !effect) || !_camera_image_is_transform_supported(frame->format) )
+		return false;
+	if( stabilize )
+		_camera_eis_get_output_size(frame->width, frame->height, &width, &height);
+	size = _camera_get_image_size(frame->format, width, height);
+	if( size == 0 )
+		return false;
+	if( effect )
+		scratch_size = _camera_image_effect_scratch_size(width > height ? width : height);
+	if( stabilize && transform )
+		stabilized_size = size;
+	if( _camera_image_buffer_reserve(buffer, size + scratch_size + stabilized_size) != CAMERA_ERROR_NONE )
+		return false;
+
+	processed->data = buffer->data;
+	processed->size = size;
+	if( stabilize ){
+		camera_image_data_s stabilized = { transform ? buffer->data + size + scratch_size : buffer->data, 0, 0, 0, 0 };
+		if( _camera_eis_process(handle->eis, frame, &stabilized) != CAMERA_ERROR_NONE )
+			return false;
+		src = stabilized;
+		*processed = stabilized;
+	}
+	if( transform ){
+		processed->data = buffer->data;
+		if( _camera_image_transform(&src, handle->sw_rotation, handle->sw_flip, processed) != CAMERA_ERROR_NONE )
+			return false;
+		src = *processed;
+	}
+	if( wdr ){
+		// the stream keeps its tile curves, a capture is measured on its own
+		if( _camera_wdr_apply(preview ? handle->wdr : NULL, &src, processed) != CAMERA_ERROR_NONE )
+			return false;
+		src = *processed;
+	}
+	if( effect ){
+		if( _camera_image_apply_effect(&src, handle->sw_effect, buffer->data + size, processed) != CAMERA_ERROR_NONE )
+			return false;
+	}
+	return true;
+}
+
+/* the quality of the software JPEG encoding, capped while the device is warm */
+static int __camera_get_jpeg_quality(camera_s *handle){
+	if( handle->thermal_level >= CAMERA_THERMAL_LEVEL_WARM && handle->jpeg_quality > CAMERA_THERMAL_JPEG_QUALITY )
+		return CAMERA_THERMAL_JPEG_QUALITY;
+	return handle->jpeg_quality;
+}
+
+/* JPEG captures are not re-encoded, the EXIF orientation tells viewers how to present them */
+static camera_attr_tag_orientation_e __camera_transform_orientation(camera_rotation_e rotation, camera_flip_e flip){
+	static const camera_attr_tag_orientation_e plain[4] = { CAMERA_ATTR_TAG_ORIENTATION_TOP_LEFT, CAMERA_ATTR_TAG_ORIENTATION_RIGHT_TOP, CAMERA_ATTR_TAG_ORIENTATION_BOTTOM_RIGHT, CAMERA_ATTR_TAG_ORIENTATION_LEFT_BOTTOM };
+	static const camera_attr_tag_orientation_e mirrored[4] = { CAMERA_ATTR_TAG_ORIENTATION_TOP_RIGHT, CAMERA_ATTR_TAG_ORIENTATION_RIGHT_BOTTOM, CAMERA_ATTR_TAG_ORIENTATION_BOTTOM_LEFT, CAMERA_ATTR_TAG_ORIENTATION_LEFT_TOP };
+	int quarter = rotation - CAMERA_ROTATION_NONE;
+
+	/* a vertical flip is a horizontal flip turned by 180 degrees */
+	if( flip & CAMERA_FLIP_VERTICAL ){
+		quarter += 2;
+		flip ^= CAMERA_FLIP_BOTH;
+	}
+	return (flip & CAMERA_FLIP_HORIZONTAL) ? mirrored[quarter & 3] : plain[quarter & 3];
+}
+
+/* preview frames are taken from the camcorder only while something looks at them */
+static void __camera_update_video_stream_callback(camera_s *handle){
+	if( handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW] || handle->sw_face_detection ||
+		handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_METRIC] || handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_PEAKING] ||
+		handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS] || handle->session ||
+		_camera_metering_has_regions(handle->metering) || _camera_encoder_tap_is_running(handle->encoder_tap) ||
+		_camera_frame_trace_writer_is_open(handle->frame_trace) || _camera_fps_governor_is_running(handle->fps_governor) )
+		mm_camcorder_set_video_stream_callback( handle->mm_handle, (mm_camcorder_video_stream_callback)__mm_videostream_callback, (void*)handle);
+	else
+		mm_camcorder_set_video_stream_callback( handle->mm_handle, (mm_camcorder_video_stream_callback)NULL, (void*)NULL);
+}
+
+/*
+ * Preview attributes set before the camcorder is realized are only recorded,
+ * a later set overwrites them for free. camera_start_preview hands what is
+ * left of them to the camcorder in one call. Once the recorder took the
+ * camcorder it may realize it itself, so nothing is recorded any more.
+ */
+static bool __camera_is_deferring(camera_s *handle){
+	MMCamcorderStateType state = MM_CAMCORDER_STATE_NONE;
+
+	if( handle->mm_handle_shared )
+		return false;
+	mm_camcorder_get_state(handle->mm_handle, &state);
+	return state == MM_CAMCORDER_STATE_NULL;
+}
+
+/* a recorded value is checked now against what the camcorder lists, as the set itself would */
+static int __camera_check_attribute_value(camera_s *handle, const char *attribute, int value){
+	MMCamAttrsInfo info;
+	int i;
+
+	if( mm_camcorder_get_attribute_info(handle->mm_handle, attribute, &info) != MM_ERROR_NONE )
+		return MM_ERROR_NONE;
+	if( info.validity_type == MM_CAM_ATTRS_VALID_TYPE_INT_ARRAY && info.int_array.count > 0 ){
+		for( i = 0 ; i < info.int_array.count ; i++ ){
+			if( info.int_array.array[i] == value )
+				return MM_ERROR_NONE;
+		}
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	}
+	if( info.validity_type == MM_CAM_ATTRS_VALID_TYPE_INT_RANGE && (value < info.int_range.min || value > info.int_range.max) )
+		return MM_ERROR_CAMCORDER_INVALID_ARGUMENT;
+	return MM_ERROR_NONE;
+}
+
+static int __camera_set_preview_fps(camera_s *handle, int is_auto, int fps){
+	int ret;
+
+	if( __camera_is_deferring(handle) ){
+		ret = __camera_check_attribute_value(handle, MMCAM_CAMERA_FPS_AUTO, is_auto);
+		if( ret == MM_ERROR_NONE )
+			ret = __camera_check_attribute_value(handle, MMCAM_CAMERA_FPS, fps);
+		if( ret != MM_ERROR_NONE )
+			return ret;
+		handle->deferred_fps_auto = is_auto;
+		handle->deferred_fps = fps;
+		handle->deferred_attributes |= _CAMERA_DEFERRED_FPS;
+		return MM_ERROR_NONE;
+	}
+	handle->deferred_attributes &= ~_CAMERA_DEFERRED_FPS;
+	return mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_FPS_AUTO, is_auto, MMCAM_CAMERA_FPS, fps, NULL);
+}
+
+/*
+ * The last value applied to the attributes below is kept, a set to that
+ * value again is dropped before it reaches the sensor. Zoom, brightness and
+ * contrast follow sliders, while the preview runs they reach the camcorder
+ * at most once a frame, together, and the last value set wins.
+ */
+static const char *g_cached_attribute_names[_CAMERA_CACHED_NUM] = {
+	MMCAM_CAMERA_DIGITAL_ZOOM,
+	MMCAM_FILTER_BRIGHTNESS,
+	MMCAM_FILTER_CONTRAST,
+	MMCAM_CAMERA_EXPOSURE_MODE,
+	MMCAM_CAMERA_EXPOSURE_VALUE,
+	MMCAM_CAMERA_ISO,
+	MMCAM_FILTER_WB,
+	MMCAM_FILTER_SCENE_MODE,
+	MMCAM_STROBE_MODE,
+};
+
+static bool __camera_is_cached(camera_s *handle, _camera_cached_attribute_e attribute, int value){
+	return (handle->attr_cache_valid & (1 << attribute)) && handle->attr_cache[attribute] == value;
+}
+
+static void __camera_update_cached_attribute(camera_s *handle, _camera_cached_attribute_e attribute, int value, bool applied){
+	if( !applied ){
+		handle->attr_cache_valid &= ~(1 << attribute);
+		return;
+	}
+	// a scene mode brings its own exposure, iso and white balance
+	if( attribute == _CAMERA_CACHED_SCENE_MODE )
+		handle->attr_cache_valid &= (1 << _CAMERA_CACHED_ZOOM) | (1 << _CAMERA_CACHED_FLASH_MODE);
+	handle->attr_cache[attribute] = value;
+	handle->attr_cache_valid |= 1 << attribute;
+}
+
+static int __camera_apply_cached_attribute(camera_s *handle, _camera_cached_attribute_e attribute, int value){
+	int ret;
+
+	if( __camera_is_cached(handle, attribute, value) )
+		return MM_ERROR_NONE;
+	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, g_cached_attribute_names[attribute], value, NULL);
+	__camera_update_cached_attribute(handle, attribute, value, ret == MM_ERROR_NONE);
+	return ret;
+}
+
+static int __camera_set_cached_attribute(camera_s *handle, _camera_cached_attribute_e attribute, int value){
+	int ret;
+
+	g_mutex_lock(&handle->attr_lock);
+	ret = __camera_apply_cached_attribute(handle, attribute, value);
+	g_mutex_unlock(&handle->attr_lock);
+	return ret;
+}
+
+/* the time between two preview frames in microseconds */
+static gint64 __camera_get_frame_interval(camera_s *handle){
+	int fps = 0;
+
+	mm_camcorder_get_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_FPS, &fps, NULL);
+	if( fps <= 0 )
+		fps = 30;
+	return G_USEC_PER_SEC / fps;
+}
+
+/*
+ * Applies the continuous attributes set during the last frame, in one call.
+ * The setters that recorded them have already returned, a refused set is
+ * kept and returned by the next continuous setter.
+ */
+static gboolean __camera_coalesce_cb(gpointer data){
+	camera_s *handle = (camera_s*)data;
+	const char *names[_CAMERA_CACHED_CONTINUOUS_NUM] = { NULL, NULL, NULL };
+	int values[_CAMERA_CACHED_CONTINUOUS_NUM] = { 0, 0, 0 };
+	int attributes[_CAMERA_CACHED_CONTINUOUS_NUM];
+	int count = 0;
+	char *error = NULL;
+	int ret;
+	int i;
+
+	g_mutex_lock(&handle->attr_lock);
+	handle->attr_coalesce_timer = 0;
+	for( i = 0 ; i < _CAMERA_CACHED_CONTINUOUS_NUM ; i++ ){
+		if( !(handle->attr_pending_mask & (1 << i)) || __camera_is_cached(handle, i, handle->attr_pending[i]) )
+			continue;
+		attributes[count] = i;
+		names[count] = g_cached_attribute_names[i];
+		values[count++] = handle->attr_pending[i];
+	}
+	handle->attr_pending_mask = 0;
+	if( count == 0 ){
+		g_mutex_unlock(&handle->attr_lock);
+		return FALSE;
+	}
+
+	handle->attr_applied_time = g_get_monotonic_time();
+	// the list ends at the first name left NULL
+	ret = mm_camcorder_set_attributes(handle->mm_handle, &error, names[0], values[0], names[1], values[1], names[2], values[2], NULL);
+	if( ret != MM_ERROR_NONE ){
+		LOGE("[%s] %d attributes fail(%x, %s)",__func__, count, ret, error ? error : "");
+		free(error);
+		handle->attr_coalesce_error = ret;
+	}
+	for( i = 0 ; i < count ; i++ )
+		__camera_update_cached_attribute(handle, attributes[i], values[i], ret == MM_ERROR_NONE);
+	g_mutex_unlock(&handle->attr_lock);
+	return FALSE;
+}
+
+static int __camera_queue_continuous_attribute(camera_s *handle, _camera_cached_attribute_e attribute, int value){
+	gint64 now;
+	gint64 interval;
+	gint64 elapsed;
+	gint64 delay = 0;
+	int ret;
+
+	if( handle->attr_coalesce_timer == 0 ){
+		if( __camera_is_cached(handle, attribute, value) )
+			return MM_ERROR_NONE;
+		now = g_get_monotonic_time();
+		interval = __camera_get_frame_interval(handle);
+		elapsed = now - handle->attr_applied_time;
+		if( handle->state != CAMERA_STATE_PREVIEW || elapsed >= interval ){
+			handle->attr_applied_time = now;
+			return __camera_apply_cached_attribute(handle, attribute, value);
+		}
+		delay = interval - elapsed;
+	}
+
+	// a value kept for the next frame is checked now, as the camcorder would
+	ret = __camera_check_attribute_value(handle, g_cached_attribute_names[attribute], value);
+	if( ret != MM_ERROR_NONE )
+		return ret;
+	if( handle->attr_coalesce_timer == 0 )
+		handle->attr_coalesce_timer = g_timeout_add((delay + 999) / 1000, __camera_coalesce_cb, handle);
+	handle->attr_pending[attribute] = value;
+	handle->attr_pending_mask |= 1 << attribute;
+	return MM_ERROR_NONE;
+}
+
+static int __camera_set_continuous_attribute(camera_s *handle, _camera_cached_attribute_e attribute, int value){
+	int ret;
+
+	g_mutex_lock(&handle->attr_lock);
+	ret = __camera_queue_continuous_attribute(handle, attribute, value);
+	// the values applied at the last frame were refused after their setters returned
+	if( ret == MM_ERROR_NONE )
+		ret = handle->attr_coalesce_error;
+	handle->attr_coalesce_error = MM_ERROR_NONE;
+	g_mutex_unlock(&handle->attr_lock);
+	return ret;
+}
+
+static bool __camera_get_pending_attribute(camera_s *handle, _camera_cached_attribute_e attribute, int *value){
+	bool pending;
+
+	g_mutex_lock(&handle->attr_lock);
+	pending = (handle->attr_pending_mask & (1 << attribute)) != 0;
+	if( pending )
+		*value = handle->attr_pending[attribute];
+	g_mutex_unlock(&handle->attr_lock);
+	return pending;
+}
+
+/* applies the rate the fps governor asked for, a rate the camcorder refuses leaves the governor where it was */
+static gboolean __camera_fps_change_cb(gpointer data){
+	camera_s *handle = (camera_s*)data;
+	camera_fps_governor_reason_e reason;
+	int previous;
+	int fps;
+	int ret;
+
+	g_atomic_int_set(&handle->fps_change_pending, 0);
+	if( !_camera_fps_governor_get_change(handle->fps_governor, &previous, &fps, &reason) )
+		return FALSE;
+	ret = __camera_set_preview_fps(handle, 0, fps);
+	_camera_fps_governor_set_applied(handle->fps_governor, ret == MM_ERROR_NONE);
+	if( ret != MM_ERROR_NONE ){
+		LOGE("[%s] rate change from %d to %d fail(%x)",__func__, previous, fps, ret);
+		return FALSE;
+	}
+	LOGI("[%s] rate changed from %d to %d, reason %d",__func__, previous, fps, reason);
+	if( handle->user_cb[_CAMERA_EVENT_TYPE_FPS_CHANGE] )
+		((camera_fps_changed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_FPS_CHANGE])(previous, fps, reason, handle->user_data[_CAMERA_EVENT_TYPE_FPS_CHANGE]);
+	return FALSE;
+}
+
+/* the rate camera_attr_set_preview_fps fixes an automatic rate at, the highest supported one up to 60 */
+static int __camera_get_auto_fps(camera_s *handle){
+	MMCamAttrsInfo info;
+	int fps = 0;
+	int i;
+
+	if( mm_camcorder_get_attribute_info(handle->mm_handle, MMCAM_CAMERA_FPS , &info) != MM_ERROR_NONE )
+		return 0;
+	for( i = 0 ; i < info.int_array.count ; i++ ){
+		if( info.int_array.array[i] > fps && info.int_array.array[i] <= 60 )
+			fps = info.int_array.array[i];
+	}
+	return fps;
+}
+
+/* the rate of a thermal level, a supported rate below the start rate for every level from hot */
+static int __camera_thermal_get_fps(camera_s *handle, camera_thermal_level_e level){
+	MMCamAttrsInfo info;
+	int steps = level - CAMERA_THERMAL_LEVEL_WARM;
+	int fps = handle->thermal_fps;
+	int lower;
+	int i;
+
+	if( steps <= 0 || mm_camcorder_get_attribute_info(handle->mm_handle, MMCAM_CAMERA_FPS , &info) != MM_ERROR_NONE )
+		return fps;
+	while( steps-- > 0 ){
+		lower = 0;
+		for( i = 0 ; i < info.int_array.count ; i++ ){
+			if( info.int_array.array[i] > lower && info.int_array.array[i] < fps )
+				lower = info.int_array.array[i];
+		}
+		if( lower == 0 )
+			break;
+		fps = lower;
+	}
+	return fps;
+}
+
+/*
+ * The preview size of a thermal level, the next smaller supported size when
+ * critical. A size of the same aspect ratio wins over a larger one of another.
+ */
+static void __camera_thermal_get_preview_size(camera_s *handle, camera_thermal_level_e level, int *width, int *height){
+	MMCamAttrsInfo widths;
+	MMCamAttrsInfo heights;
+	long long area = (long long)handle->thermal_width * handle->thermal_height;
+	long long best = 0;
+	bool best_same = false;
+	int i;
+
+	*width = handle->thermal_width;
+	*height = handle->thermal_height;
+	if( level < CAMERA_THERMAL_LEVEL_CRITICAL ||
+		mm_camcorder_get_attribute_info(handle->mm_handle, MMCAM_CAMERA_WIDTH , &widths) != MM_ERROR_NONE ||
+		mm_camcorder_get_attribute_info(handle->mm_handle, MMCAM_CAMERA_HEIGHT , &heights) != MM_ERROR_NONE )
+		return;
+	for( i = 0 ; i < widths.int_array.count && i < heights.int_array.count ; i++ ){
+		int w = widths.int_array.array[i];
+		int h = heights.int_array.array[i];
+		long long size = (long long)w * h;
+		bool same;
+		if( w <= 0 || h <= 0 || size >= area )
+			continue;
+		same = (long long)w * handle->thermal_height == (long long)h * handle->thermal_width;
+		if( (same && !best_same) || (same == best_same && size > best) ){
+			best = size;
+			best_same = same;
+			*width = w;
+			*height = h;
+		}
+	}
+}
+
+/*
+ * Brings a running preview to the size of a thermal level. The camcorder is
+ * stopped and started again under the application's feet, so the state
+ * messages of the restart are not reported. When the new size does not start,
+ * the preview runs on at the old one and the size waits for the next start.
+ */
+static int __camera_thermal_restart_preview(camera_s *handle, int width, int height){
+	int previous_width = 0;
+	int previous_height = 0;
+	int ret;
+
+	ret = mm_camcorder_get_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_WIDTH, &previous_width, MMCAM_CAMERA_HEIGHT, &previous_height, NULL);
+	if( ret != MM_ERROR_NONE )
+		return ret;
+
+	handle->thermal_restarting = true;
+	ret = mm_camcorder_stop(handle->mm_handle);
+	if( ret != MM_ERROR_NONE ){
+		handle->thermal_restarting = false;
+		return ret;
+	}
+	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_WIDTH, width, MMCAM_CAMERA_HEIGHT, height, NULL);
+	if( ret == MM_ERROR_NONE )
+		ret = mm_camcorder_start(handle->mm_handle);
+	if( ret == MM_ERROR_NONE )
+		return MM_ERROR_NONE;
+
+	LOGE("[%s] preview restart at %dx%d fail(%x)",__func__, width, height, ret);
+	if( mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_WIDTH, previous_width, MMCAM_CAMERA_HEIGHT, previous_height, NULL) == MM_ERROR_NONE &&
+		mm_camcorder_start(handle->mm_handle) == MM_ERROR_NONE )
+		return ret;
+
+	// the preview is lost, the application sees it stop as it would after camera_stop_preview()
+	handle->thermal_restarting = false;
+	camera_stop_face_detection((camera_h)handle);
+	mm_camcorder_unrealize(handle->mm_handle);
+	if( handle->user_cb[_CAMERA_EVENT_TYPE_ERROR] )
+		((camera_error_cb)handle->user_cb[_CAMERA_EVENT_TYPE_ERROR])(__convert_camera_error_code(__func__, ret), CAMERA_STATE_CREATED, handle->user_data[_CAMERA_EVENT_TYPE_ERROR]);
+	return ret;
+}
+
+/*
+ * Takes the settings of a thermal level. The rate goes through the fps
+ * governor when it runs, a running preview is restarted at the new size.
+ */
+static void __camera_thermal_apply(camera_s *handle, camera_thermal_level_e previous, camera_thermal_level_e level){
+	int fps = __camera_thermal_get_fps(handle, level);
+	int previous_width;
+	int previous_height;
+	int width;
+	int height;
+	int ret = MM_ERROR_NONE;
+
+	handle->thermal_level = level;
+	if( _camera_fps_governor_is_running(handle->fps_governor) ){
+		if( _camera_fps_governor_set_limit(handle->fps_governor, fps) && g_atomic_int_compare_and_exchange(&handle->fps_change_pending, 0, 1) )
+			g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __camera_fps_change_cb, handle, NULL);
+	}else if( fps != __camera_thermal_get_fps(handle, previous) ){
+		if( level < CAMERA_THERMAL_LEVEL_HOT )
+			ret = camera_attr_set_preview_fps((camera_h)handle, handle->thermal_restore_fps);
+		else
+			ret = __camera_set_preview_fps(handle, 0, fps);
+		if( ret != MM_ERROR_NONE )
+			LOGE("[%s] rate change to %d fail(%x)",__func__, fps, ret);
+	}
+
+	__camera_thermal_get_preview_size(handle, level, &width, &height);
+	__camera_thermal_get_preview_size(handle, previous, &previous_width, &previous_height);
+	if( width != previous_width || height != previous_height ){
+		MMCamcorderStateType state = MM_CAMCORDER_STATE_NONE;
+		mm_camcorder_get_state(handle->mm_handle, &state);
+		if( __camera_is_deferring(handle) ){
+			handle->deferred_width = width;
+			handle->deferred_height = height;
+			handle->deferred_attributes |= _CAMERA_DEFERRED_RESOLUTION;
+		}else if( state == MM_CAMCORDER_STATE_PREPARE && handle->state == CAMERA_STATE_PREVIEW && !handle->hdr_capturing ){
+			// a size that does not start is taken the next time the preview starts
+			handle->thermal_resize_pending = __camera_thermal_restart_preview(handle, width, height) != MM_ERROR_NONE;
+		}else
+			handle->thermal_resize_pending = true;
+	}
+	_camera_thermal_log_step(handle->thermal, previous, level, fps, width, height, __camera_get_jpeg_quality(handle));
+}
+
+static gboolean __camera_thermal_poll_cb(gpointer data){
+	camera_s *handle = (camera_s*)data;
+	camera_thermal_level_e previous;
+	camera_thermal_level_e level;
+
+	if( _camera_thermal_poll(handle->thermal, &previous, &level) ){
+		__camera_thermal_apply(handle, previous, level);
+		if( handle->user_cb[_CAMERA_EVENT_TYPE_THERMAL_CHANGE] )
+			((camera_thermal_level_changed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_THERMAL_CHANGE])(previous, level, handle->user_data[_CAMERA_EVENT_TYPE_THERMAL_CHANGE]);
+	}
+	return TRUE;
+}
+
 static gboolean __mm_videostream_callback(MMCamcorderVideoStreamDataType * stream, void *user_data){
 	if( user_data == NULL || stream == NULL)
 		return 0;
 
 	camera_s * handle = (camera_s*)user_data;
+	bool governed = _camera_fps_governor_is_running(handle->fps_governor);
+	gint64 started = governed ? g_get_monotonic_time() : 0;
+	int stream_format = stream->format;
+	if( stream_format == MM_PIXEL_FORMAT_ITLV_JPEG_UYVY )
+		stream_format = MM_PIXEL_FORMAT_UYVY;
+	camera_image_data_s frame = { stream->data, stream->length, stream->width, stream->height, stream_format };
+	// the paired preview, the peaking mask and the encoder go by the size and format of the frame, a short one is kept from them
+	bool valid = _camera_image_is_valid(&frame);
+	if( handle->frame_trace )
+		_camera_frame_trace_writer_append(handle->frame_trace, _CAMERA_FRAME_TRACE_PREVIEW, &frame, NULL, stream->timestamp);
+	if( handle->session && valid )
+		_camera_session_push(handle->session, handle->session_device, &frame);
+	if( handle->sw_face_detection )
+		_camera_face_detector_push(handle->face_detector, &frame);
+	// focus and exposure are measured on the frame as the sensor sees it, before any software processing
+	if( handle->metering && _camera_focus_is_supported_format(frame.format) )
+		_camera_metering_process(handle->metering, &frame);
+	if( handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS] && _camera_statistics_compute(&frame, handle->frame_statistics) == CAMERA_ERROR_NONE ){
+		handle->frame_statistics->frame++;
+		if( handle->frame_statistics->frame == 0 )
+			handle->frame_statistics->frame = 1;
+		((camera_preview_statistics_cb)handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS])(handle->frame_statistics, handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS]);
+	}
+	if( handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_METRIC] && _camera_focus_is_supported_format(frame.format) ){
+		unsigned int sharpness;
+		// an explicit focus metric area wins over the focus regions
+		if( handle->focus_metric_width > 0 || !_camera_metering_get_sharpness(handle->metering, &frame, &sharpness) )
+			sharpness = _camera_focus_get_sharpness(&frame, handle->focus_metric_x, handle->focus_metric_y, handle->focus_metric_width, handle->focus_metric_height);
+		((camera_focus_metric_cb)handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_METRIC])(sharpness, handle->user_data[_CAMERA_EVENT_TYPE_FOCUS_METRIC]);
+	}
+	// the mask buffer is sized from the frame, it is only grown for a frame that really is that large
+	if( handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_PEAKING] && _camera_focus_is_supported_format(frame.format) && valid &&
+		_camera_image_buffer_reserve(&handle->focus_peaking_buffer, frame.width * frame.height) == CAMERA_ERROR_NONE &&
+		_camera_focus_get_peaking_mask(&frame, handle->focus_peaking_buffer.data) == CAMERA_ERROR_NONE ){
+		((camera_focus_peaking_cb)handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_PEAKING])(handle->focus_peaking_buffer.data, frame.width, frame.height, handle->user_data[_CAMERA_EVENT_TYPE_FOCUS_PEAKING]);
+	}
+	// the encoder runs last, the callbacks above are not held up by it
+	if( handle->encoder_tap && valid )
+		_camera_encoder_tap_push(handle->encoder_tap, &frame);
 	if( handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW] ){
-		int stream_format = stream->format;
-		if( stream_format == MM_PIXEL_FORMAT_ITLV_JPEG_UYVY )
-			stream_format = MM_PIXEL_FORMAT_UYVY;
-		((camera_preview_cb)handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW])(stream->data, stream->length, stream->width, stream->height, stream_format, handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW]);
+		camera_image_data_s processed = { NULL, 0, 0, 0, 0 };
+		if( __camera_process_frame(handle, &handle->preview_frame_buffer, &frame, true, &processed) )
+			((camera_preview_cb)handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW])(processed.data, processed.size, processed.width, processed.height, processed.format, handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW]);
+		else
+			((camera_preview_cb)handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW])(stream->data, stream->length, stream->width, stream->height, stream_format, handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW]);
+	}
+	// the rate is changed from the main loop, the streaming thread only asks for it
+	if( governed ){
+		int queue_level = MAX(_camera_encoder_tap_get_queue_level(handle->encoder_tap), _camera_session_get_queue_level(handle->session));
+		if( _camera_fps_governor_push(handle->fps_governor, stream->timestamp, (int)(g_get_monotonic_time() - started), queue_level) &&
+			g_atomic_int_compare_and_exchange(&handle->fps_change_pending, 0, 1) )
+			g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __camera_fps_change_cb, handle, NULL);
 	}
 	return 1;
 }
+/*
+ * Bracket frames of a software HDR shot go to the fusion worker instead of the
+ * capturing callback. Every frame is a capture of its own, started once the
+ * exposure of its bracket is set. A frame whose exposure does not match its
+ * bracket, as read back from the camcorder or from the EXIF exposure bias of
+ * the frame, ends the bracket without fusion. Returns true when the frame
+ * should still be delivered, which is the case for the reference frame in
+ * CAMERA_ATTR_HDR_MODE_KEEP_ORIGINAL mode.
+ */
+static bool __camera_push_hdr_frame(camera_s *handle, MMCamcorderCaptureDataType *frame){
+	int index = handle->hdr_shot;
+	int exposure = handle->hdr_exposure[index];
+	int step = handle->hdr_exposure[index] - handle->hdr_exposure[0];
+	bool matched = true;
+	int bias;
+	int ret;
+
+	camera_image_data_s image = { frame->data, frame->length, frame->width, frame->height, frame->format };
+	ret = mm_camcorder_get_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_EXPOSURE_VALUE, &exposure, NULL);
+	if( ret == MM_ERROR_NONE && exposure != handle->hdr_exposure[index] )
+		matched = false;
+	// the bias has to move the same way the exposure was stepped from the reference
+	if( _camera_exif_get_exposure_bias(&image, &bias) ){
+		handle->hdr_bias[index] = bias;
+		if( index == 0 )
+			handle->hdr_bias_valid = true;
+		else if( handle->hdr_bias_valid && ((step < 0 && bias >= handle->hdr_bias[0]) || (step > 0 && bias <= handle->hdr_bias[0])) )
+			matched = false;
+	}else if( index == 0 ){
+		handle->hdr_bias_valid = false;
+	}
+
+	if( !matched ){
+		LOGE("[%s] bracket frame %d was not taken at exposure %d, fusion dropped",__func__, index, handle->hdr_exposure[index]);
+		_camera_hdr_cancel(handle->hdr);
+		handle->hdr_shots = index + 1;
+		return index == 0;
+	}
+
+	ret = _camera_hdr_push(handle->hdr, &image);
+	if( ret != CAMERA_ERROR_NONE )
+		LOGE("[%s] bracket frame %d push fail(0x%08x)",__func__, index, ret);
+
+	return index == 0 && handle->sw_hdr_mode == CAMERA_ATTR_HDR_MODE_KEEP_ORIGINAL;
+}
+
+static void __camera_finish_software_hdr(camera_s *handle){
+	int ret;
+
+	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_EXPOSURE_VALUE, handle->hdr_exposure_restore, NULL);
+	if( ret != MM_ERROR_NONE )
+		LOGE("[%s] exposure restore fail(%x)",__func__, ret);
+	handle->hdr_capturing = false;
+}
+
 static gboolean __mm_capture_callback(MMCamcorderCaptureDataType *frame, MMCamcorderCaptureDataType *thumbnail, void *user_data){
 	if( user_data == NULL || frame == NULL)
 		return 0;
 
 	camera_s * handle = (camera_s*)user_data;
+	if( handle->frame_trace ){
+		camera_image_data_s traced = { frame->data, frame->length, frame->width, frame->height, frame->format };
+		camera_image_data_s traced_thumbnail = { NULL, 0, 0, 0, 0 };
+		if( thumbnail ){
+			traced_thumbnail.data = thumbnail->data;
+			traced_thumbnail.size = thumbnail->length;
+			traced_thumbnail.width = thumbnail->width;
+			traced_thumbnail.height = thumbnail->height;
+			traced_thumbnail.format = thumbnail->format;
+		}
+		_camera_frame_trace_writer_append(handle->frame_trace, _CAMERA_FRAME_TRACE_CAPTURE, &traced, &traced_thumbnail, 0);
+	}
 	handle->current_capture_count++;
-	if( handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] ){
+	bool deliver = true;
+	if( handle->hdr_capturing )
+		deliver = __camera_push_hdr_frame(handle, frame);
+	if( deliver && handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] ){
 		MMCamcorderCaptureDataType *scrnl = NULL;
 		int size = 0;
 		camera_image_data_s image = { NULL, 0, 0, 0, 0 };
@@ -161,6 +792,18 @@ static gboolean __mm_capture_callback(MMCamcorderCaptureDataType *frame, MMCamco
 			image.format = frame->format;
 		}
 
+		camera_image_data_s exif_image = { NULL, 0, 0, 0, 0 };
+		camera_image_data_s processed = { NULL, 0, 0, 0, 0 };
+		if( image.format == CAMERA_PIXEL_FORMAT_JPEG ){
+			if( handle->sw_transform && (handle->sw_rotation != CAMERA_ROTATION_NONE || handle->sw_flip != CAMERA_FLIP_NONE) ){
+				camera_exif_info_s exif = { true, __camera_transform_orientation(handle->sw_rotation, handle->sw_flip), NULL, NULL, false, 0, 0, 0 };
+				if( camera_image_update_exif(&image, &exif, &exif_image) == CAMERA_ERROR_NONE )
+					image = exif_image;
+			}
+		}else if( __camera_process_frame(handle, &handle->capture_frame_buffer, &image, false, &processed) ){
+			image = processed;
+		}
+
 		if( thumbnail ){
 			thumb.data = thumbnail->data;
 			thumb.size = thumbnail->length;
@@ -168,7 +811,9 @@ static gboolean __mm_capture_callback(MMCamcorderCaptureDataType *frame, MMCamco
 			thumb.height = thumbnail->height;
 			thumb.format = thumbnail->format;
 		}
-		mm_camcorder_get_attributes( handle->mm_handle, NULL, "captured-screennail", &scrnl, &size,NULL );
+		// the screennail is a string keyed attribute lookup, skip it on burst shots nobody looks at
+		if( handle->postview_enabled && handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] != (void*)__capture_to_path_capturing_cb )
+			mm_camcorder_get_attributes( handle->mm_handle, NULL, "captured-screennail", &scrnl, &size,NULL );
 		if( scrnl ){
 			postview.data = scrnl->data;
 			postview.size = scrnl->length;
@@ -177,10 +822,25 @@ static gboolean __mm_capture_callback(MMCamcorderCaptureDataType *frame, MMCamco
 			postview.format = scrnl->format;
 		}
 
-		((camera_capturing_cb)handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE])(frame ? &image : NULL, thumbnail ? &thumb : NULL, scrnl ? &postview : NULL, handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE]);
+		bool encode = handle->jpeg_encoding && _camera_jpeg_is_supported_format(image.format);
+		bool make_thumbnail = handle->thumbnail_width > 0 && thumbnail == NULL && (image.format == CAMERA_PIXEL_FORMAT_JPEG || _camera_jpeg_is_supported_format(image.format));
+		if( handle->jpeg_encoder && (encode || make_thumbnail) ){
+			int ret = _camera_jpeg_encoder_push(handle->jpeg_encoder, &image, thumbnail ? &thumb : NULL, scrnl ? &postview : NULL, __camera_get_jpeg_quality(handle),
+																encode, make_thumbnail ? handle->thumbnail_width : 0, handle->thumbnail_height,
+																(camera_capturing_cb)handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE], handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE]);
+			if( ret != CAMERA_ERROR_NONE ){
+				LOGE("[%s] jpeg encoder push fail(0x%08x), delivering raw image",__func__, ret);
+				((camera_capturing_cb)handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE])(&image, thumbnail ? &thumb : NULL, scrnl ? &postview : NULL, handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE]);
+			}
+		}else
+			((camera_capturing_cb)handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE])(frame ? &image : NULL, thumbnail ? &thumb : NULL, scrnl ? &postview : NULL, handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE]);
+		free(exif_image.data);
 	}
-	// update captured state
-	if( handle->capture_count == 1 && handle->hdr_keep_mode ){
+	// update captured state, a software HDR bracket is captured with its last shot
+	if( handle->hdr_capturing ){
+		if( handle->hdr_shot + 1 >= handle->hdr_shots )
+			handle->is_capture_completed = true;
+	}else if( handle->capture_count == 1 && handle->hdr_keep_mode ){
 		if( handle->current_capture_count == 2 )
 			handle->is_capture_completed = true;
 	}else if( handle->capture_count == handle->current_capture_count || handle->is_continuous_shot_break)
@@ -188,6 +848,24 @@ static gboolean __mm_capture_callback(MMCamcorderCaptureDataType *frame, MMCamco
 	return 1;
 }
 
+static void __camera_capture_completed(camera_s *handle){
+	camera_capture_completed_cb callback = (camera_capture_completed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE];
+	void *user_data = handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE];
+
+	if( callback == NULL )
+		return;
+
+	// the fused HDR image is delivered from the fusion worker, completion waits for it
+	if( handle->hdr && _camera_hdr_set_done_cb(handle->hdr, callback, user_data, (camera_error_cb)handle->user_cb[_CAMERA_EVENT_TYPE_ERROR], handle->user_data[_CAMERA_EVENT_TYPE_ERROR]) )
+		return;
+
+	// software encoded shots are still in flight, the encoder notifies when the last one is delivered
+	if( handle->jpeg_encoder && _camera_jpeg_encoder_set_drain_cb(handle->jpeg_encoder, callback, user_data) )
+		return;
+
+	callback(user_data);
+}
+
 static camera_state_e __camera_state_convert(MMCamcorderStateType mm_state)
 {
 	camera_state_e state = CAMERA_STATE_NONE;
@@ -223,6 +901,102 @@ static camera_state_e __camera_state_convert(MMCamcorderStateType mm_state)
 }
 
 
+/*
+ * Tracked faces are delivered from the main loop. Detections that arrive
+ * before the delivery ran only update the tracker, so the callback gets at
+ * most one update per frame however the device batches its messages.
+ */
+static gboolean __camera_face_delivery_cb(gpointer data){
+	camera_s *handle = (camera_s*)data;
+	camera_detected_face_s face;
+
+	int capacity = handle->face_buffer.capacity / sizeof(camera_detected_face_s);
+	int count;
+
+	g_atomic_int_set(&handle->face_delivery_pending, 0);
+	// the faces are delivered in the pooled buffer, which only grows when a crowd is larger than any before
+	count = _camera_face_tracker_get_faces(handle->face_tracker, (camera_detected_face_s*)handle->face_buffer.data, capacity);
+	if( count > capacity ){
+		if( _camera_image_buffer_reserve(&handle->face_buffer, count * sizeof(camera_detected_face_s)) == CAMERA_ERROR_NONE )
+			capacity = count;
+		count = _camera_face_tracker_get_faces(handle->face_tracker, (camera_detected_face_s*)handle->face_buffer.data, capacity);
+		if( count > capacity )
+			count = capacity;
+	}
+	handle->num_of_faces = count;
+
+	// keep the face zoom on the smoothed box, small moves are left alone so the zoom does not wander
+	if( handle->face_zoom_id > 0 && _camera_face_tracker_get_face(handle->face_tracker, handle->face_zoom_id, &face) ){
+		int x = face.x + (face.width >> 1);
+		int y = face.y + (face.height >> 1);
+		int deadband = face.width >> 3;
+		if( abs(x - handle->face_zoom_x) > deadband || abs(y - handle->face_zoom_y) > deadband ){
+			if( mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_FACE_ZOOM_X, x, MMCAM_CAMERA_FACE_ZOOM_Y, y, NULL) == MM_ERROR_NONE ){
+				handle->face_zoom_x = x;
+				handle->face_zoom_y = y;
+			}
+		}
+	}
+
+	if( handle->user_cb[_CAMERA_EVENT_TYPE_FACE_DETECTION] )
+		((camera_face_detected_cb)handle->user_cb[_CAMERA_EVENT_TYPE_FACE_DETECTION])((camera_detected_face_s*)handle->face_buffer.data, handle->num_of_faces, handle->user_data[_CAMERA_EVENT_TYPE_FACE_DETECTION]);
+	return FALSE;
+}
+
+static void __camera_face_detected(camera_s *handle, const camera_detected_face_s *faces, int count){
+	if( handle->face_tracker == NULL || handle->user_cb[_CAMERA_EVENT_TYPE_FACE_DETECTION] == NULL )
+		return;
+	if( _camera_face_tracker_update(handle->face_tracker, faces, count) && g_atomic_int_compare_and_exchange(&handle->face_delivery_pending, 0, 1) )
+		g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __camera_face_delivery_cb, handle, NULL);
+}
+
+static void __camera_sw_face_detected(const camera_detected_face_s *faces, int count, void *user_data){
+	__camera_face_detected((camera_s*)user_data, faces, count);
+}
+
+/*
+ * Takes the next shot of a software HDR bracket. The camcorder only captures
+ * again from the preview, so it is stopped and restarted from the main loop
+ * rather than from the message callback of the previous shot.
+ */
+static gboolean __camera_hdr_next_shot_cb(gpointer data){
+	camera_s *handle = (camera_s*)data;
+	camera_state_e previous_state;
+	MMCamcorderStateType state;
+	int ret;
+
+	if( !handle->hdr_capturing )
+		return FALSE;
+
+	handle->hdr_shot++;
+	ret = mm_camcorder_capture_stop(handle->mm_handle);
+	if( ret == MM_ERROR_NONE )
+		ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_EXPOSURE_VALUE, handle->hdr_exposure[handle->hdr_shot], NULL);
+	if( ret == MM_ERROR_NONE )
+		ret = mm_camcorder_capture_start(handle->mm_handle);
+	if( ret == MM_ERROR_NONE )
+		return FALSE;
+
+	LOGE("[%s] bracket shot %d fail(%x)",__func__, handle->hdr_shot, ret);
+	_camera_hdr_cancel(handle->hdr);
+	__camera_finish_software_hdr(handle);
+
+	// the capture completes without the fused image, wherever the camcorder was left
+	previous_state = handle->state;
+	mm_camcorder_get_state(handle->mm_handle, &state);
+	handle->state = state == MM_CAMCORDER_STATE_CAPTURING ? CAMERA_STATE_CAPTURED : __camera_state_convert(state);
+	handle->is_capture_completed = true;
+	if( previous_state != handle->state && handle->user_cb[_CAMERA_EVENT_TYPE_STATE_CHANGE] ){
+		((camera_state_changed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_STATE_CHANGE])(previous_state, handle->state,  0 , handle->user_data[_CAMERA_EVENT_TYPE_STATE_CHANGE]);
+	}
+	__camera_capture_completed(handle);
+	handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
+	handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
+	handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] = NULL;
+	handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] = NULL;
+	return FALSE;
+}
+
 static int __mm_camera_message_callback(int message, void *param, void *user_data){
 	if( user_data == NULL || param == NULL )
 		return 0;
@@ -240,7 +1014,10 @@ static int __mm_camera_message_callback(int message, void *param, void *user_dat
 		case MM_MESSAGE_CAMCORDER_STATE_CHANGED:
 		case MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_ASM:
 		case MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_SECURITY:
-			if( message == MM_MESSAGE_CAMCORDER_STATE_CHANGED && (m->state.previous < MM_CAMCORDER_STATE_NONE ||  m->state.previous > MM_CAMCORDER_STATE_PAUSED || m->state.code != 0) ){
+			// policy messages carry states as well, a state out of range is dropped whoever sends it
+			if( m->state.previous < MM_CAMCORDER_STATE_NONE || m->state.previous > MM_CAMCORDER_STATE_PAUSED ||
+				m->state.current < MM_CAMCORDER_STATE_NONE || m->state.current > MM_CAMCORDER_STATE_PAUSED ||
+				(message == MM_MESSAGE_CAMCORDER_STATE_CHANGED && m->state.code != 0) ){
 				LOGI( "Invalid state changed message");
 				break;
 			}
@@ -252,18 +1029,41 @@ static int __mm_camera_message_callback(int message, void *param, void *user_dat
 				policy = CAMERA_POLICY_SOUND;
 			else if( message == MM_MESSAGE_CAMCORDER_STATE_CHANGED_BY_SECURITY )
 				policy = CAMERA_POLICY_SECURITY;
+			// the preview restarted between the shots of a software HDR bracket is not seen by the application
+			if( handle->hdr_capturing && handle->hdr_shot > 0 && policy == CAMERA_POLICY_NONE )
+				handle->state = CAMERA_STATE_CAPTURING;
+			// nor is the one restarted by the thermal policy, it ends when the preview is back
+			if( handle->thermal_restarting ){
+				if( policy == CAMERA_POLICY_NONE )
+					handle->state = CAMERA_STATE_PREVIEW;
+				if( policy != CAMERA_POLICY_NONE || m->state.current == MM_CAMCORDER_STATE_PREPARE )
+					handle->thermal_restarting = false;
+			}
 
 			if( previous_state != handle->state && handle->user_cb[_CAMERA_EVENT_TYPE_STATE_CHANGE] ){
 				((camera_state_changed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_STATE_CHANGE])(previous_state, handle->state, policy, handle->user_data[_CAMERA_EVENT_TYPE_STATE_CHANGE]);
 			}
 
 			// should change intermediate state MM_CAMCORDER_STATE_READY is not valid in capi , change to NULL state
+			// a policy may stop a capture as well as a preview, either way the device is left in READY
 			if( policy != CAMERA_POLICY_NONE ){
 				if( previous_state != handle->state && handle->user_cb[_CAMERA_EVENT_TYPE_INTERRUPTED] )
 					((camera_interrupted_cb)handle->user_cb[_CAMERA_EVENT_TYPE_INTERRUPTED])(policy, previous_state, handle->state, handle->user_data[_CAMERA_EVENT_TYPE_INTERRUPTED]);
-				if( m->state.previous == MM_CAMCORDER_STATE_PREPARE && m->state.current == MM_CAMCORDER_STATE_READY ){
+				if( m->state.previous != MM_CAMCORDER_STATE_NULL && m->state.current == MM_CAMCORDER_STATE_READY ){
 					mm_camcorder_unrealize(handle->mm_handle);
 				}
+				// an interrupted HDR bracket takes no more shots
+				if( handle->hdr_capturing && handle->state != CAMERA_STATE_CAPTURING ){
+					_camera_hdr_cancel(handle->hdr);
+					__camera_finish_software_hdr(handle);
+				}
+				// an interrupted capture never completes, it must not hold off the next one
+				if( (previous_state == CAMERA_STATE_CAPTURING || previous_state == CAMERA_STATE_CAPTURED) && handle->state != CAMERA_STATE_CAPTURING ){
+					handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
+					handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
+					handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] = NULL;
+					handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] = NULL;
+				}
 			}
 
 			break;
@@ -279,6 +1079,13 @@ static int __mm_camera_message_callback(int message, void *param, void *user_dat
 			 mm_camcorder_get_attributes(handle->mm_handle ,NULL,MMCAM_MODE, &mode, NULL);
 			 if( mode == MM_CAMCORDER_MODE_IMAGE ){
 				handle->current_capture_complete_count = m->code;
+				if( handle->hdr_capturing ){
+					if( handle->hdr_shot + 1 < handle->hdr_shots ){
+						g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __camera_hdr_next_shot_cb, handle, NULL);
+						break;
+					}
+					__camera_finish_software_hdr(handle);
+				}
 				if(  handle->capture_count == 1 || m->code == handle->capture_count ||(handle->is_continuous_shot_break && handle->state == CAMERA_STATE_CAPTURING) ){
 					//pseudo state change
 					previous_state = handle->state ;
@@ -286,9 +1093,7 @@ static int __mm_camera_message_callback(int message, void *param, void *user_dat
 					if( previous_state != handle->state && handle->user_cb[_CAMERA_EVENT_TYPE_STATE_CHANGE] ){
 						((camera_state_changed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_STATE_CHANGE])(previous_state, handle->state,  0 , handle->user_data[_CAMERA_EVENT_TYPE_STATE_CHANGE]);
 					}
-					if( handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] ){
-						((camera_capture_completed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE])(handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE]);
-					}
+					__camera_capture_completed(handle);
 					// reset capturing callback , capture completed callback
 					handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
 					handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
@@ -350,7 +1155,7 @@ static int __mm_camera_message_callback(int message, void *param, void *user_dat
 					break;
 			}
 			if( camera_error != 0 && handle->user_cb[_CAMERA_EVENT_TYPE_ERROR] )
-				((camera_error_cb)handle->user_cb[_CAMERA_EVENT_TYPE_ERROR])(errorcode, handle->state , handle->user_data[_CAMERA_EVENT_TYPE_ERROR]);
+				((camera_error_cb)handle->user_cb[_CAMERA_EVENT_TYPE_ERROR])(camera_error, handle->state , handle->user_data[_CAMERA_EVENT_TYPE_ERROR]);
 
 			break;
 		}
@@ -364,23 +1169,32 @@ static int __mm_camera_message_callback(int message, void *param, void *user_dat
 		case MM_MESSAGE_CAMCORDER_FACE_DETECT_INFO:
 		{
 			MMCamFaceDetectInfo *cam_fd_info = (MMCamFaceDetectInfo *)(m->data);
-			if ( cam_fd_info ) {
-				camera_detected_face_s faces[cam_fd_info->num_of_faces];
-				handle->num_of_faces = cam_fd_info->num_of_faces > MAX_DETECTED_FACE ? MAX_DETECTED_FACE : cam_fd_info->num_of_faces;
+			if ( cam_fd_info && cam_fd_info->num_of_faces > 0 && cam_fd_info->face_info && (unsigned int)cam_fd_info->num_of_faces <= UINT_MAX / sizeof(camera_detected_face_s) ) {
+				// converted in a buffer kept for the next message instead of on the stack
+				int count = cam_fd_info->num_of_faces;
+				int kept = 0;
 				int i;
-				for(i=0; i < handle->num_of_faces ; i++){
-					faces[i].id = cam_fd_info->face_info[i].id;
-					faces[i].score = cam_fd_info->face_info[i].score;
-					faces[i].x = cam_fd_info->face_info[i].rect.x;
-					faces[i].y = cam_fd_info->face_info[i].rect.y;
-					faces[i].width = cam_fd_info->face_info[i].rect.width;
-					faces[i].height = cam_fd_info->face_info[i].rect.height;
-					handle->faceinfo[i] = faces[i];	//cache face coordinate
+				if( _camera_image_buffer_reserve(&handle->face_input_buffer, count * sizeof(camera_detected_face_s)) != CAMERA_ERROR_NONE )
+					break;
+				camera_detected_face_s *faces = (camera_detected_face_s*)handle->face_input_buffer.data;
+				for(i=0; i < count ; i++){
+					MMRectType *rect = &cam_fd_info->face_info[i].rect;
+					// the tracker works in 1/256 pixels, a box it can not hold is dropped
+					if( rect->width <= 0 || rect->height <= 0 || rect->width > CAMERA_MAX_FACE_COORDINATE || rect->height > CAMERA_MAX_FACE_COORDINATE ||
+						rect->x < -CAMERA_MAX_FACE_COORDINATE || rect->x > CAMERA_MAX_FACE_COORDINATE ||
+						rect->y < -CAMERA_MAX_FACE_COORDINATE || rect->y > CAMERA_MAX_FACE_COORDINATE )
+						continue;
+					faces[kept].id = cam_fd_info->face_info[i].id;
+					faces[kept].score = cam_fd_info->face_info[i].score;
+					faces[kept].x = rect->x;
+					faces[kept].y = rect->y;
+					faces[kept].width = rect->width;
+					faces[kept].height = rect->height;
+					kept++;
 				}
-				if( handle->user_cb[_CAMERA_EVENT_TYPE_FACE_DETECTION] )
-					((camera_face_detected_cb)handle->user_cb[_CAMERA_EVENT_TYPE_FACE_DETECTION])(faces, handle->num_of_faces, handle->user_data[_CAMERA_EVENT_TYPE_FACE_DETECTION]);
+				__camera_face_detected(handle, faces, kept);
 			}else{
-				handle->num_of_faces = 0;
+				__camera_face_detected(handle, NULL, 0);
 			}
 			break;
 		}
@@ -391,16 +1205,15 @@ static int __mm_camera_message_callback(int message, void *param, void *user_dat
 
 static int __capture_completed_event_cb(void *data){
 	camera_s *handle = (camera_s*)data;
-	if( handle->current_capture_count > 0 && handle->current_capture_count == handle->current_capture_complete_count && handle->state == CAMERA_STATE_CAPTURING ){
+	// a continuous shot broken before its first shot completes with none, a single shot still waits for its frame
+	if( (handle->current_capture_count > 0 || handle->capture_count > 1) && handle->current_capture_count == handle->current_capture_complete_count && handle->state == CAMERA_STATE_CAPTURING ){
 		//pseudo state change
 		camera_state_e previous_state = handle->state;
 		handle->state = CAMERA_STATE_CAPTURED;
 		if( previous_state != handle->state && handle->user_cb[_CAMERA_EVENT_TYPE_STATE_CHANGE] ){
 			((camera_state_changed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_STATE_CHANGE])(previous_state, handle->state,  0 , handle->user_data[_CAMERA_EVENT_TYPE_STATE_CHANGE]);
 		}
-		if( handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] ){
-			((camera_capture_completed_cb)handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE])(handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE]);
-		}
+		__camera_capture_completed(handle);
 		// reset capturing callback , capture completed callback
 		handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
 		handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
@@ -410,6 +1223,69 @@ static int __capture_completed_event_cb(void *data){
 	return false;
 }
 
+/*
+ * Hands the recorded preview attributes to the camcorder, in one call and
+ * only those that differ from what the camcorder has. A size the thermal
+ * policy holds wins over the one recorded.
+ */
+static int __camera_flush_deferred_attributes(camera_s *handle){
+	const char *names[5] = { NULL, NULL, NULL, NULL, NULL };
+	int values[5] = { 0, 0, 0, 0, 0 };
+	int count = 0;
+	int width = -1;
+	int height = -1;
+	int format = -1;
+	int fps = -1;
+	int is_auto = -1;
+	char *error = NULL;
+	int ret;
+
+	if( handle->thermal_resize_pending ){
+		__camera_thermal_get_preview_size(handle, handle->thermal_level, &handle->deferred_width, &handle->deferred_height);
+		handle->deferred_attributes |= _CAMERA_DEFERRED_RESOLUTION;
+		handle->thermal_resize_pending = false;
+	}
+	if( handle->deferred_attributes == 0 )
+		return MM_ERROR_NONE;
+
+	// what can not be read back is set anyway
+	ret = mm_camcorder_get_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_WIDTH, &width, MMCAM_CAMERA_HEIGHT, &height,
+		MMCAM_CAMERA_FORMAT, &format, MMCAM_CAMERA_FPS, &fps, MMCAM_CAMERA_FPS_AUTO, &is_auto, NULL);
+	if( ret != MM_ERROR_NONE )
+		width = height = format = fps = is_auto = -1;
+	if( (handle->deferred_attributes & _CAMERA_DEFERRED_RESOLUTION) && (handle->deferred_width != width || handle->deferred_height != height) ){
+		names[count] = MMCAM_CAMERA_WIDTH;
+		values[count++] = handle->deferred_width;
+		names[count] = MMCAM_CAMERA_HEIGHT;
+		values[count++] = handle->deferred_height;
+	}
+	if( (handle->deferred_attributes & _CAMERA_DEFERRED_FORMAT) && handle->deferred_format != format ){
+		names[count] = MMCAM_CAMERA_FORMAT;
+		values[count++] = handle->deferred_format;
+	}
+	if( (handle->deferred_attributes & _CAMERA_DEFERRED_FPS) && (handle->deferred_fps_auto != is_auto || handle->deferred_fps != fps) ){
+		names[count] = MMCAM_CAMERA_FPS_AUTO;
+		values[count++] = handle->deferred_fps_auto;
+		names[count] = MMCAM_CAMERA_FPS;
+		values[count++] = handle->deferred_fps;
+	}
+	if( count == 0 ){
+		handle->deferred_attributes = 0;
+		return MM_ERROR_NONE;
+	}
+
+	// the list ends at the first name left NULL, what the camcorder refuses stays recorded
+	ret = mm_camcorder_set_attributes(handle->mm_handle, &error, names[0], values[0], names[1], values[1], names[2], values[2],
+		names[3], values[3], names[4], values[4], NULL);
+	if( ret != MM_ERROR_NONE ){
+		LOGE("[%s] %d preview attributes fail(%x, %s)",__func__, count, ret, error ? error : "");
+		free(error);
+		return ret;
+	}
+	handle->deferred_attributes = 0;
+	return ret;
+}
+
 int camera_create( camera_device_e device, camera_h* camera){
 
 	if( camera == NULL){
@@ -476,6 +1352,8 @@ int camera_create( camera_device_e device, camera_h* camera){
 	handle->capture_resolution_modified = false;
 	handle->hdr_keep_mode = false;
 	handle->focus_area_valid = false;
+	handle->file_sync_policy = CAMERA_FILE_SYNC_BURST;
+	g_mutex_init(&handle->attr_lock);
 	mm_camcorder_set_message_callback(handle->mm_handle, __mm_camera_message_callback, (void*)handle);
 
 
@@ -495,10 +1373,51 @@ int camera_create( camera_device_e device, camera_h* camera){
 	int ret;
 	camera_s *handle = (camera_s*)camera;
 
+	// a camera of a session goes with camera_session_destroy()
+	if( handle->session ){
+		LOGE( "[%s] INVALID_OPERATION(0x%08x) the camera belongs to a session",__func__,CAMERA_ERROR_INVALID_OPERATION);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	// the replay thread calls into the handle
+	_camera_frame_replay_stop(handle->frame_replay);
+	handle->frame_replay = NULL;
+	if( handle->thermal_timer ){
+		g_source_remove(handle->thermal_timer);
+		handle->thermal_timer = 0;
+	}
+	if( handle->attr_coalesce_timer ){
+		g_source_remove(handle->attr_coalesce_timer);
+		handle->attr_coalesce_timer = 0;
+	}
+
 	ret = mm_camcorder_destroy(handle->mm_handle);
 
-	if( ret == MM_ERROR_NONE)
+	if( ret == MM_ERROR_NONE){
+		_camera_jpeg_encoder_destroy(handle->jpeg_encoder);
+		_camera_file_writer_destroy(handle->file_writer);
+		_camera_hdr_destroy(handle->hdr);
+		_camera_eis_destroy(handle->eis);
+		_camera_wdr_destroy(handle->wdr);
+		_camera_face_detector_destroy(handle->face_detector);
+		// a face delivery and the completion of a stopped continuous shot may still be queued on the main loop
+		while( g_idle_remove_by_data(handle) )
+			;
+		_camera_face_tracker_destroy(handle->face_tracker);
+		_camera_metering_destroy(handle->metering);
+		_camera_encoder_tap_destroy(handle->encoder_tap);
+		_camera_frame_trace_writer_destroy(handle->frame_trace);
+		_camera_fps_governor_destroy(handle->fps_governor);
+		_camera_thermal_destroy(handle->thermal);
+		free(handle->frame_statistics);
+		_camera_image_buffer_release(&handle->preview_frame_buffer);
+		_camera_image_buffer_release(&handle->capture_frame_buffer);
+		_camera_image_buffer_release(&handle->face_input_buffer);
+		_camera_image_buffer_release(&handle->face_buffer);
+		_camera_image_buffer_release(&handle->focus_peaking_buffer);
+		g_mutex_clear(&handle->attr_lock);
 		free(handle);
+	}
 
 	return __convert_camera_error_code(__func__, ret);
 
@@ -528,10 +1447,12 @@ int camera_start_preview(camera_h camera){
 	//for receving MM_MESSAGE_CAMCORDER_CAPTURED evnet must be seted capture callback
 	mm_camcorder_set_video_capture_callback( handle->mm_handle, (mm_camcorder_video_capture_callback)__mm_capture_callback, (void*)handle);
 
-	if( handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW] )
-		mm_camcorder_set_video_stream_callback( handle->mm_handle, (mm_camcorder_video_stream_callback)__mm_videostream_callback, (void*)handle);
-	else
-		mm_camcorder_set_video_stream_callback( handle->mm_handle, (mm_camcorder_video_stream_callback)NULL, (void*)NULL);
+	__camera_update_video_stream_callback(handle);
+
+	// the preview attributes set so far reach the camcorder before it is realized
+	ret = __camera_flush_deferred_attributes(handle);
+	if( ret != MM_ERROR_NONE )
+		return __convert_camera_error_code(__func__, ret);
 
 	MMCamcorderStateType state ;
 	mm_camcorder_get_state(handle->mm_handle, &state);
@@ -573,6 +1494,64 @@ int camera_stop_preview(camera_h camera){
 	return __convert_camera_error_code(__func__, ret);
 }
 
+/*
+ * Software HDR : three single shots with the exposure stepped in between, the
+ * bracket is {current, darker, brighter}. Each shot is started only after the
+ * previous one completed and the next exposure is set, so no frame of the
+ * bracket is taken before its exposure applies. The fusion worker waits for
+ * the frames, the first one is the alignment reference.
+ */
+static int __camera_start_software_hdr(camera_s *handle, camera_capturing_cb capturing_cb, void *user_data){
+	int min = 0;
+	int max = 0;
+	int current = 0;
+	int step;
+	int ret;
+
+	// a bracket of one exposure would fuse three copies of the same shot
+	ret = camera_attr_get_exposure_range((camera_h)handle, &min, &max);
+	if( ret != CAMERA_ERROR_NONE )
+		return ret;
+	if( min >= max ){
+		LOGE("[%s] exposure range %d..%d can not bracket",__func__, min, max);
+		return __convert_camera_error_code(__func__, MM_ERROR_CAMCORDER_NOT_SUPPORTED);
+	}
+	ret = mm_camcorder_get_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_EXPOSURE_VALUE, &current, NULL);
+	if( ret != MM_ERROR_NONE )
+		return __convert_camera_error_code(__func__, ret);
+	step = (max - min) / 4;
+	if( step < 1 )
+		step = 1;
+	handle->hdr_exposure_restore = current;
+	// the bracket moves the exposure behind the cache
+	g_mutex_lock(&handle->attr_lock);
+	__camera_update_cached_attribute(handle, _CAMERA_CACHED_EXPOSURE, current, false);
+	g_mutex_unlock(&handle->attr_lock);
+	handle->hdr_exposure[0] = current;
+	handle->hdr_exposure[1] = current - step < min ? min : current - step;
+	handle->hdr_exposure[2] = current + step > max ? max : current + step;
+
+	ret = _camera_hdr_start(handle->hdr, 3, __camera_get_jpeg_quality(handle),
+											(camera_attr_hdr_progress_cb)handle->user_cb[_CAMERA_EVENT_TYPE_HDR_PROGRESS], handle->user_data[_CAMERA_EVENT_TYPE_HDR_PROGRESS],
+											capturing_cb, user_data);
+	if( ret != CAMERA_ERROR_NONE ){
+		LOGE("[%s] hdr start fail(0x%08x)",__func__, ret);
+		return ret;
+	}
+
+	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAPTURE_COUNT, 1, NULL);
+	if( ret != MM_ERROR_NONE ){
+		_camera_hdr_cancel(handle->hdr);
+		return __convert_camera_error_code(__func__, ret);
+	}
+
+	handle->capture_count = 1;
+	handle->hdr_shot = 0;
+	handle->hdr_shots = 3;
+	handle->hdr_capturing = true;
+	return CAMERA_ERROR_NONE;
+}
+
 int camera_start_capture(camera_h camera, camera_capturing_cb capturing_cb , camera_capture_completed_cb completed_cb , void *user_data){
 	if( camera == NULL){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
@@ -598,9 +1577,18 @@ int camera_start_capture(camera_h camera, camera_capturing_cb capturing_cb , cam
 															NULL);
 		handle->capture_resolution_modified = false;
 	}
-	mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAPTURE_COUNT , 1,NULL);
+	if( handle->sw_hdr_mode != CAMERA_ATTR_HDR_MODE_DISABLE && state == MM_CAMCORDER_STATE_PREPARE ){
+		ret = __camera_start_software_hdr(handle, capturing_cb, user_data);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}else{
+		// the count of an earlier continuous shot must not stay behind
+		ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAPTURE_COUNT , 1,NULL);
+		if( ret != MM_ERROR_NONE )
+			return __convert_camera_error_code(__func__, ret);
+		handle->capture_count = 1;
+	}
 
-	handle->capture_count = 1;
 	handle->is_continuous_shot_break = false;
 	handle->current_capture_count = 0;
 	handle->current_capture_complete_count = 0;
@@ -612,6 +1600,10 @@ int camera_start_capture(camera_h camera, camera_capturing_cb capturing_cb , cam
 	handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] = (void*)user_data;
 	ret = mm_camcorder_capture_start(handle->mm_handle);
 	if( ret != 0 ){
+		if( handle->hdr_capturing ){
+			_camera_hdr_cancel(handle->hdr);
+			__camera_finish_software_hdr(handle);
+		}
 		handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
 		handle->user_data[_CAMERA_EVENT_TYPE_CAPTURE] = NULL;
 		handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] = NULL;
@@ -656,7 +1648,7 @@ int camera_start_continuous_capture(camera_h camera, int count, int interval, ca
 																MMCAM_CAPTURE_INTERVAL, interval,
 																NULL);
 	if( ret != 0 ){
-		LOGE("[%s] (%x) error set continuous shot attribute", ret);
+		LOGE("[%s] (%x) error set continuous shot attribute",__func__, ret);
 		return __convert_camera_error_code(__func__, ret);
 	}
 	handle->capture_count = count;
@@ -670,7 +1662,7 @@ int camera_start_continuous_capture(camera_h camera, int count, int interval, ca
 		supported_ZSL = true;
 
 	if( ret != 0 ){
-		LOGE("[%s] (%x) error get continuous shot attribute", ret);
+		LOGE("[%s] (%x) error get continuous shot attribute",__func__, ret);
 	}
 
 	if( !supported_ZSL ){
@@ -723,7 +1715,7 @@ int camera_stop_continuous_capture(camera_h camera){
 	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, "capture-break-cont-shot", 1, NULL);
 	if( ret == 0){
 		handle->is_continuous_shot_break = true;
-		if( handle->current_capture_count > 0 )
+		if( handle->current_capture_count > 0 || handle->capture_count > 1 )
 			handle->is_capture_completed = true;
 		g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __capture_completed_event_cb, handle, NULL);
 	}
@@ -731,17 +1723,56 @@ int camera_stop_continuous_capture(camera_h camera){
 	return __convert_camera_error_code(__func__,ret);
 }
 
-bool camera_is_supported_face_detection(camera_h camera){
-	if( camera == NULL){
+static void __capture_to_path_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data){
+	camera_s *handle = (camera_s*)user_data;
+	int ret;
+
+	if( image == NULL )
+		return;
+	ret = _camera_file_writer_push(handle->file_writer, image);
+	if( ret != CAMERA_ERROR_NONE )
+		LOGE("[%s] file writer push fail(0x%08x)",__func__, ret);
+}
+
+static void __capture_to_path_completed_cb(void *user_data){
+	camera_s *handle = (camera_s*)user_data;
+	_camera_file_writer_finish(handle->file_writer);
+}
+
+int camera_start_capture_to_path(camera_h camera, const char *path_template, int count, int interval, camera_capture_file_saved_cb saved_cb, camera_capture_completed_cb completed_cb, void *user_data){
+	if( camera == NULL || count < 1 || interval < 0 || !_camera_file_writer_is_valid_template(path_template, count) ){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
-		return false;
+		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
-	int ret;
+
 	camera_s * handle = (camera_s*)camera;
+	int ret;
+
+	if( handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE] != NULL || handle->user_cb[_CAMERA_EVENT_TYPE_CAPTURE_COMPLETE] != NULL ){
+		LOGE( "[%s] INVALID_STATE(0x%08x)",__func__,CAMERA_ERROR_INVALID_STATE);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+
+	if( handle->file_writer == NULL ){
+		ret = _camera_file_writer_create(&handle->file_writer);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+	ret = _camera_file_writer_start(handle->file_writer, path_template, handle->file_sync_policy, handle->file_direct_io, saved_cb, completed_cb, user_data);
+	if( ret != CAMERA_ERROR_NONE )
+		return ret;
+
+	if( count == 1 )
+		return camera_start_capture(camera, __capture_to_path_capturing_cb, __capture_to_path_completed_cb, handle);
+	return camera_start_continuous_capture(camera, count, interval, __capture_to_path_capturing_cb, __capture_to_path_completed_cb, handle);
+}
+
+static bool __camera_is_hw_face_detection_supported(camera_s *handle){
+	int ret;
 	MMCamAttrsInfo info;
 	ret = mm_camcorder_get_attribute_info(handle->mm_handle, MMCAM_DETECT_MODE , &info);
 	int i=0;
-	if( info.validity_type == MM_CAM_ATTRS_VALID_TYPE_INT_ARRAY){
+	if( ret == MM_ERROR_NONE && info.validity_type == MM_CAM_ATTRS_VALID_TYPE_INT_ARRAY){
 		for( i =0; i < info.int_array.count ; i++){
 			if( info.int_array.array[i] == MM_CAMCORDER_DETECT_MODE_ON )
 				return true;
@@ -750,6 +1781,19 @@ bool camera_is_supported_face_detection(camera_h camera){
 	return false;
 }
 
+bool camera_is_supported_face_detection(camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return false;
+	}
+	camera_s * handle = (camera_s*)camera;
+	camera_pixel_format_e format;
+	if( __camera_is_hw_face_detection_supported(handle) )
+		return true;
+	// otherwise the preview stream is searched in software
+	return camera_get_preview_format(camera, &format) == CAMERA_ERROR_NONE && _camera_face_detector_is_supported_format(format);
+}
+
 int camera_start_face_detection(camera_h camera, camera_face_detected_cb callback, void * user_data){
 	if( camera == NULL){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
@@ -763,6 +1807,32 @@ int camera_start_face_detection(camera_h camera, camera_face_detected_cb callbac
 		LOGE( "[%s] INVALID_STATE(0x%08x)",__func__,CAMERA_ERROR_INVALID_STATE);
 		return CAMERA_ERROR_INVALID_STATE;
 	}
+	if( handle->face_tracker == NULL ){
+		ret = _camera_face_tracker_create(&handle->face_tracker);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+	_camera_face_tracker_reset(handle->face_tracker);
+	if( !__camera_is_hw_face_detection_supported(handle) ){
+		camera_pixel_format_e format;
+		if( camera_get_preview_format(camera, &format) != CAMERA_ERROR_NONE || !_camera_face_detector_is_supported_format(format) ){
+			LOGE( "[%s] INVALID_OPERATION(0x%08x)",__func__,CAMERA_ERROR_INVALID_OPERATION);
+			return CAMERA_ERROR_INVALID_OPERATION;
+		}
+		if( handle->face_detector == NULL ){
+			ret = _camera_face_detector_create(&handle->face_detector, __camera_sw_face_detected, handle);
+			if( ret != CAMERA_ERROR_NONE )
+				return ret;
+		}
+		handle->user_cb[_CAMERA_EVENT_TYPE_FACE_DETECTION] = (void*)callback;
+		handle->user_data[_CAMERA_EVENT_TYPE_FACE_DETECTION] = (void*)user_data;
+		handle->num_of_faces = 0;
+		// the preview frames are searched in software, they are needed without a preview callback too
+		handle->sw_face_detection = true;
+		__camera_update_video_stream_callback(handle);
+		LOGI("[%s] face detection done in software",__func__);
+		return CAMERA_ERROR_NONE;
+	}
 	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_DETECT_MODE, MM_CAMCORDER_DETECT_MODE_ON, NULL);
 	if( ret == 0 ){
 		handle->user_cb[_CAMERA_EVENT_TYPE_FACE_DETECTION] = (void*)callback;
@@ -778,11 +1848,20 @@ int camera_stop_face_detection(camera_h camera){
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
 	camera_s * handle = (camera_s*)camera;
-	int ret;
-	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_DETECT_MODE, MM_CAMCORDER_DETECT_MODE_OFF, NULL);
+	int ret = MM_ERROR_NONE;
+	if( handle->sw_face_detection ){
+		handle->sw_face_detection = false;
+		__camera_update_video_stream_callback(handle);
+		// no result of an earlier frame arrives after this
+		_camera_face_detector_reset(handle->face_detector);
+	}else{
+		ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_DETECT_MODE, MM_CAMCORDER_DETECT_MODE_OFF, NULL);
+	}
 	handle->user_cb[_CAMERA_EVENT_TYPE_FACE_DETECTION] = NULL;
 	handle->user_data[_CAMERA_EVENT_TYPE_FACE_DETECTION] = NULL;
 	handle->num_of_faces = 0;
+	handle->face_zoom_id = 0;
+	_camera_face_tracker_reset(handle->face_tracker);
 	return __convert_camera_error_code(__func__,ret);
 }
 
@@ -792,6 +1871,7 @@ int camera_face_zoom(camera_h camera, int face_id){
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
 	camera_s * handle = (camera_s*)camera;
+	camera_detected_face_s *faceinfo = (camera_detected_face_s*)handle->face_buffer.data;
 	int ret;
 	int find = -1;
 	int i;
@@ -803,7 +1883,7 @@ int camera_face_zoom(camera_h camera, int face_id){
 		return CAMERA_ERROR_INVALID_STATE;
 
 	for( i = 0 ; i < handle->num_of_faces ; i++){
-		if( handle->faceinfo[i].id == face_id ){
+		if( faceinfo[i].id == face_id ){
 			find = i;
 			break;
 		}
@@ -811,9 +1891,15 @@ int camera_face_zoom(camera_h camera, int face_id){
 	if( find == -1 )
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_FACE_ZOOM_MODE, MM_CAMCORDER_FACE_ZOOM_MODE_ON,
-                                 MMCAM_CAMERA_FACE_ZOOM_X, handle->faceinfo[find].x+(handle->faceinfo[find].width>>1),
-                                 MMCAM_CAMERA_FACE_ZOOM_Y, handle->faceinfo[find].y+(handle->faceinfo[find].height>>1),
+                                 MMCAM_CAMERA_FACE_ZOOM_X, faceinfo[find].x+(faceinfo[find].width>>1),
+                                 MMCAM_CAMERA_FACE_ZOOM_Y, faceinfo[find].y+(faceinfo[find].height>>1),
                                  NULL);
+	if( ret == 0 ){
+		// the face delivery keeps the zoom on this face while it is tracked
+		handle->face_zoom_id = face_id;
+		handle->face_zoom_x = faceinfo[find].x+(faceinfo[find].width>>1);
+		handle->face_zoom_y = faceinfo[find].y+(faceinfo[find].height>>1);
+	}
 
 	return __convert_camera_error_code(__func__,ret);
 }
@@ -826,6 +1912,7 @@ int camera_cancel_face_zoom(camera_h camera){
 	camera_s * handle = (camera_s*)camera;
 	int ret;
 	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_FACE_ZOOM_MODE, MM_CAMCORDER_FACE_ZOOM_MODE_OFF, NULL);
+	handle->face_zoom_id = 0;
 	return __convert_camera_error_code(__func__,ret);
 }
 
@@ -843,6 +1930,12 @@ int camera_get_state(camera_h camera, camera_state_e * state){
 
 	capi_state = __camera_state_convert(mmstate);
 
+	// the preview restarts between the shots of a software HDR bracket
+	if( handle->hdr_capturing && mmstate == MM_CAMCORDER_STATE_PREPARE )
+		capi_state = CAMERA_STATE_CAPTURING;
+	// and the thermal policy restarts it at another size
+	if( handle->thermal_restarting && mmstate == MM_CAMCORDER_STATE_READY )
+		capi_state = CAMERA_STATE_PREVIEW;
 	if( ( handle->state == CAMERA_STATE_CAPTURED || handle->is_capture_completed ) && mmstate == MM_CAMCORDER_STATE_CAPTURING )
 		capi_state = CAMERA_STATE_CAPTURED;
 
@@ -923,7 +2016,23 @@ int camera_set_preview_resolution(camera_h camera,  int width, int height){
 	}
 	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_WIDTH  , width ,MMCAM_CAMERA_HEIGHT ,height,  NULL);
+	if( __camera_is_deferring(handle) ){
+		ret = __camera_check_attribute_value(handle, MMCAM_CAMERA_WIDTH, width);
+		if( ret == MM_ERROR_NONE )
+			ret = __camera_check_attribute_value(handle, MMCAM_CAMERA_HEIGHT, height);
+		if( ret == MM_ERROR_NONE ){
+			handle->deferred_width = width;
+			handle->deferred_height = height;
+			handle->deferred_attributes |= _CAMERA_DEFERRED_RESOLUTION;
+		}
+	}else
+		ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_WIDTH  , width ,MMCAM_CAMERA_HEIGHT ,height,  NULL);
+	// the thermal policy scales down from, and restores, what the application asked for last
+	if( ret == MM_ERROR_NONE && (_camera_thermal_is_running(handle->thermal) || handle->thermal_resize_pending) ){
+		handle->thermal_width = width;
+		handle->thermal_height = height;
+		handle->thermal_resize_pending = handle->thermal_level == CAMERA_THERMAL_LEVEL_CRITICAL;
+	}
 	return __convert_camera_error_code(__func__, ret);
 }
 int camera_set_x11_display_rotation(camera_h camera,  camera_rotation_e rotation){
@@ -985,7 +2094,15 @@ int camera_set_preview_format(camera_h camera, camera_pixel_format_e format){
 			if( supported_format.int_array.array[i] == MM_PIXEL_FORMAT_ITLV_JPEG_UYVY )
 				supported_ITLV_UYVY = true;
 		}
-		ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FORMAT, supported_ITLV_UYVY ?  MM_PIXEL_FORMAT_ITLV_JPEG_UYVY : MM_PIXEL_FORMAT_UYVY , NULL);
+		format = supported_ITLV_UYVY ?  MM_PIXEL_FORMAT_ITLV_JPEG_UYVY : MM_PIXEL_FORMAT_UYVY;
+	}
+
+	if( __camera_is_deferring(handle) ){
+		ret = __camera_check_attribute_value(handle, MMCAM_CAMERA_FORMAT, format);
+		if( ret == MM_ERROR_NONE ){
+			handle->deferred_format = format;
+			handle->deferred_attributes |= _CAMERA_DEFERRED_FORMAT;
+		}
 	}else
 		ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FORMAT, format , NULL);
 
@@ -1000,6 +2117,11 @@ int camera_get_preview_resolution(camera_h camera,  int *width, int *height){
 
 	int ret;
 	camera_s * handle = (camera_s*)camera;
+	if( handle->deferred_attributes & _CAMERA_DEFERRED_RESOLUTION ){
+		*width = handle->deferred_width;
+		*height = handle->deferred_height;
+		return CAMERA_ERROR_NONE;
+	}
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_WIDTH , width,MMCAM_CAMERA_HEIGHT, height,  NULL);
 	return __convert_camera_error_code(__func__, ret);
 
@@ -1092,46 +2214,450 @@ int camera_get_capture_format(camera_h camera, camera_pixel_format_e *format){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
-
-	int ret;
+
+	int ret;
+	camera_s * handle = (camera_s*)camera;
+	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAPTURE_FORMAT, format , NULL);
+	return __convert_camera_error_code(__func__, ret);
+}
+
+int camera_get_preview_format(camera_h camera, camera_pixel_format_e *format){
+	if( camera == NULL || format == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	int ret;
+	camera_s * handle = (camera_s*)camera;
+	if( handle->deferred_attributes & _CAMERA_DEFERRED_FORMAT ){
+		*format = handle->deferred_format;
+		ret = MM_ERROR_NONE;
+	}else
+		ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FORMAT, format , NULL);
+	if( (MMPixelFormatType)*format == MM_PIXEL_FORMAT_ITLV_JPEG_UYVY )
+		*format = CAMERA_PIXEL_FORMAT_UYVY;
+	return __convert_camera_error_code(__func__, ret);	
+}
+
+int camera_set_preview_cb( camera_h camera, camera_preview_cb callback, void* user_data ){
+	if( camera == NULL || callback == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	camera_s * handle = (camera_s*)camera;
+	handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW] = (void*)callback;
+	handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW] = (void*)user_data;
+	return CAMERA_ERROR_NONE;
+}
+int camera_unset_preview_cb( camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW] = (void*)NULL;
+	handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW] = (void*)NULL;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_set_preview_statistics_cb(camera_h camera, camera_preview_statistics_cb callback, void *user_data){
+	if( camera == NULL || callback == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	if( handle->frame_statistics == NULL ){
+		handle->frame_statistics = (camera_frame_statistics_s*)calloc(1, sizeof(camera_frame_statistics_s));
+		if( handle->frame_statistics == NULL ){
+			LOGE("[%s] malloc fail",__func__);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS] = (void*)callback;
+	handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS] = (void*)user_data;
+	__camera_update_video_stream_callback(handle);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_unset_preview_statistics_cb(camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS] = (void*)NULL;
+	handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW_STATISTICS] = (void*)NULL;
+	__camera_update_video_stream_callback(handle);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_start_preview_encoder(camera_h camera, const camera_preview_encoder_s *encoder, void *user_data, int queue_size){
+	if( camera == NULL || encoder == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	int ret;
+
+	if( handle->encoder_tap == NULL ){
+		ret = _camera_encoder_tap_create(&handle->encoder_tap);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+	ret = _camera_encoder_tap_start(handle->encoder_tap, encoder, user_data, queue_size);
+	if( ret != CAMERA_ERROR_NONE ){
+		LOGE("[%s] encoder start fail(0x%08x)",__func__, ret);
+		return ret;
+	}
+	__camera_update_video_stream_callback(handle);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_stop_preview_encoder(camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	if( handle->encoder_tap == NULL )
+		return CAMERA_ERROR_NONE;
+	_camera_encoder_tap_stop(handle->encoder_tap);
+	__camera_update_video_stream_callback(handle);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_preview_encoder_poll(camera_h camera, int timeout, camera_encoded_unit_s *unit){
+	if( camera == NULL || unit == NULL || timeout < -1){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	if( handle->encoder_tap == NULL ){
+		memset(unit, 0, sizeof(camera_encoded_unit_s));
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	return _camera_encoder_tap_poll(handle->encoder_tap, timeout, unit);
+}
+
+int camera_preview_encoder_get_statistics(camera_h camera, camera_preview_encoder_statistics_s *statistics){
+	if( camera == NULL || statistics == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	return _camera_encoder_tap_get_statistics(handle->encoder_tap, statistics);
+}
+
+int camera_start_frame_trace(camera_h camera, const char *path){
+	if( camera == NULL || path == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	int ret;
+
+	if( handle->frame_trace == NULL ){
+		ret = _camera_frame_trace_writer_create(&handle->frame_trace);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+	ret = _camera_frame_trace_writer_open(handle->frame_trace, path);
+	if( ret != CAMERA_ERROR_NONE ){
+		LOGE("[%s] frame trace start fail(0x%08x)",__func__, ret);
+		return ret;
+	}
+	__camera_update_video_stream_callback(handle);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_stop_frame_trace(camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	int ret;
+
+	if( handle->frame_trace == NULL )
+		return CAMERA_ERROR_NONE;
+	ret = _camera_frame_trace_writer_close(handle->frame_trace);
+	__camera_update_video_stream_callback(handle);
+	return ret;
+}
+
+/* feeds a replayed frame through the same callbacks the camcorder calls */
+static void __camera_replay_frame(camera_frame_trace_record_s *frame, camera_frame_trace_record_s *thumbnail, void *user_data){
+	camera_s * handle = (camera_s*)user_data;
+
+	if( frame->type == _CAMERA_FRAME_TRACE_PREVIEW ){
+		MMCamcorderVideoStreamDataType stream;
+		memset(&stream, 0, sizeof(stream));
+		stream.data = frame->image.data;
+		stream.length = frame->image.size;
+		stream.format = frame->image.format;
+		stream.width = frame->image.width;
+		stream.height = frame->image.height;
+		stream.timestamp = frame->stream_timestamp;
+		__mm_videostream_callback(&stream, handle);
+	}else{
+		MMCamcorderCaptureDataType capture;
+		MMCamcorderCaptureDataType capture_thumbnail;
+		memset(&capture, 0, sizeof(capture));
+		capture.data = frame->image.data;
+		capture.length = frame->image.size;
+		capture.format = (MMPixelFormatType)frame->image.format;
+		capture.width = frame->image.width;
+		capture.height = frame->image.height;
+		if( thumbnail ){
+			memset(&capture_thumbnail, 0, sizeof(capture_thumbnail));
+			capture_thumbnail.data = thumbnail->image.data;
+			capture_thumbnail.length = thumbnail->image.size;
+			capture_thumbnail.format = (MMPixelFormatType)thumbnail->image.format;
+			capture_thumbnail.width = thumbnail->image.width;
+			capture_thumbnail.height = thumbnail->image.height;
+		}
+		__mm_capture_callback(&capture, thumbnail ? &capture_thumbnail : NULL, handle);
+	}
+}
+
+int camera_start_frame_replay(camera_h camera, const char *path, int speed, camera_frame_replay_completed_cb callback, void *user_data){
+	if( camera == NULL || path == NULL || speed < 0){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	int ret;
+
+	_camera_frame_replay_stop(handle->frame_replay);
+	handle->frame_replay = NULL;
+	ret = _camera_frame_replay_start(path, speed, __camera_replay_frame, handle, callback, user_data, &handle->frame_replay);
+	if( ret != CAMERA_ERROR_NONE )
+		LOGE("[%s] frame replay of %s fail(0x%08x)",__func__, path, ret);
+	return ret;
+}
+
+int camera_stop_frame_replay(camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	_camera_frame_replay_stop(handle->frame_replay);
+	handle->frame_replay = NULL;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_start_fps_governor(camera_h camera, camera_fps_changed_cb callback, void *user_data){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	camera_attr_fps_e current = CAMERA_ATTR_FPS_AUTO;
+	MMCamAttrsInfo info;
+	int fps = 0;
+	int ret;
+
+	if( _camera_fps_governor_is_running(handle->fps_governor) ){
+		LOGE("[%s] INVALID_STATE(0x%08x) governor already running",__func__,CAMERA_ERROR_INVALID_STATE);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	ret = mm_camcorder_get_attribute_info(handle->mm_handle, MMCAM_CAMERA_FPS , &info);
+	if( ret != MM_ERROR_NONE )
+		return __convert_camera_error_code(__func__, ret);
+	ret = camera_attr_get_preview_fps(camera, &current);
+	if( ret != CAMERA_ERROR_NONE )
+		return ret;
+
+	// an automatic rate is fixed the way camera_attr_set_preview_fps picks it, the governor needs to know where it is
+	fps = current == CAMERA_ATTR_FPS_AUTO ? __camera_get_auto_fps(handle) : current;
+	// under the thermal policy the governor starts from the rate the policy steps down from, and is capped below
+	if( _camera_thermal_is_running(handle->thermal) ){
+		current = handle->thermal_restore_fps;
+		fps = handle->thermal_fps;
+	}
+
+	if( handle->fps_governor == NULL ){
+		ret = _camera_fps_governor_create(&handle->fps_governor);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+	ret = _camera_fps_governor_start(handle->fps_governor, info.int_array.array, info.int_array.count, fps);
+	if( ret != CAMERA_ERROR_NONE ){
+		LOGE("[%s] no rate to step down to from %d fps(0x%08x)",__func__, fps, ret);
+		return ret;
+	}
+	if( current == CAMERA_ATTR_FPS_AUTO && handle->thermal_level < CAMERA_THERMAL_LEVEL_HOT ){
+		ret = __camera_set_preview_fps(handle, 0, fps);
+		if( ret != MM_ERROR_NONE ){
+			_camera_fps_governor_stop(handle->fps_governor);
+			return __convert_camera_error_code(__func__, ret);
+		}
+	}
+	if( _camera_thermal_is_running(handle->thermal) && _camera_fps_governor_set_limit(handle->fps_governor, __camera_thermal_get_fps(handle, handle->thermal_level)) &&
+		g_atomic_int_compare_and_exchange(&handle->fps_change_pending, 0, 1) )
+		g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __camera_fps_change_cb, handle, NULL);
+
+	handle->fps_governor_restore = current;
+	handle->user_cb[_CAMERA_EVENT_TYPE_FPS_CHANGE] = (void*)callback;
+	handle->user_data[_CAMERA_EVENT_TYPE_FPS_CHANGE] = (void*)user_data;
+	__camera_update_video_stream_callback(handle);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_stop_fps_governor(camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	camera_fps_governor_statistics_s statistics;
+	int fps;
+
+	if( !_camera_fps_governor_is_running(handle->fps_governor) )
+		return CAMERA_ERROR_NONE;
+	_camera_fps_governor_get_statistics(handle->fps_governor, &statistics);
+	fps = _camera_fps_governor_stop(handle->fps_governor);
+	handle->user_cb[_CAMERA_EVENT_TYPE_FPS_CHANGE] = (void*)NULL;
+	handle->user_data[_CAMERA_EVENT_TYPE_FPS_CHANGE] = (void*)NULL;
+	__camera_update_video_stream_callback(handle);
+
+	// the rate is only set back when the governor left it lowered, or when it was automatic
+	if( statistics.fps != fps || handle->fps_governor_restore == CAMERA_ATTR_FPS_AUTO )
+		return camera_attr_set_preview_fps(camera, handle->fps_governor_restore);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_fps_governor_get_statistics(camera_h camera, camera_fps_governor_statistics_s *statistics){
+	if( camera == NULL || statistics == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	return _camera_fps_governor_get_statistics(handle->fps_governor, statistics);
+}
+
+int camera_start_thermal_policy(camera_h camera, int warm, int hot, int critical, camera_thermal_level_changed_cb callback, void *user_data){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	camera_attr_fps_e current = CAMERA_ATTR_FPS_AUTO;
+	int ret;
+
+	if( _camera_thermal_is_running(handle->thermal) ){
+		LOGE("[%s] INVALID_STATE(0x%08x) policy already running",__func__,CAMERA_ERROR_INVALID_STATE);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	// with the fps governor running, the rate to step down from is the one it was started at
+	if( _camera_fps_governor_is_running(handle->fps_governor) )
+		current = handle->fps_governor_restore;
+	else{
+		ret = camera_attr_get_preview_fps(camera, &current);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+	// a size still to be restored from an earlier run is the one to scale from
+	if( !handle->thermal_resize_pending ){
+		ret = camera_get_preview_resolution(camera, &handle->thermal_width, &handle->thermal_height);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+
+	if( handle->thermal == NULL ){
+		ret = _camera_thermal_create(&handle->thermal);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+	ret = _camera_thermal_start(handle->thermal, warm, hot, critical);
+	if( ret != CAMERA_ERROR_NONE ){
+		LOGE("[%s] thermal policy start fail(0x%08x)",__func__, ret);
+		return ret;
+	}
+	handle->thermal_level = CAMERA_THERMAL_LEVEL_NORMAL;
+	handle->thermal_restore_fps = current;
+	handle->thermal_fps = current == CAMERA_ATTR_FPS_AUTO ? __camera_get_auto_fps(handle) : current;
+	handle->user_cb[_CAMERA_EVENT_TYPE_THERMAL_CHANGE] = (void*)callback;
+	handle->user_data[_CAMERA_EVENT_TYPE_THERMAL_CHANGE] = (void*)user_data;
+	handle->thermal_timer = g_timeout_add(CAMERA_THERMAL_POLL_INTERVAL, __camera_thermal_poll_cb, handle);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_stop_thermal_policy(camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+
+	if( !_camera_thermal_is_running(handle->thermal) )
+		return CAMERA_ERROR_NONE;
+	g_source_remove(handle->thermal_timer);
+	handle->thermal_timer = 0;
+	_camera_thermal_stop(handle->thermal);
+	handle->user_cb[_CAMERA_EVENT_TYPE_THERMAL_CHANGE] = (void*)NULL;
+	handle->user_data[_CAMERA_EVENT_TYPE_THERMAL_CHANGE] = (void*)NULL;
+	if( handle->thermal_level != CAMERA_THERMAL_LEVEL_NORMAL )
+		__camera_thermal_apply(handle, handle->thermal_level, CAMERA_THERMAL_LEVEL_NORMAL);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_thermal_policy_get_statistics(camera_h camera, camera_thermal_statistics_s *statistics){
+	if( camera == NULL || statistics == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	return _camera_thermal_get_statistics(handle->thermal, statistics);
+}
+
+int camera_set_focus_metric_cb(camera_h camera, camera_focus_metric_cb callback, void *user_data){
+	if( camera == NULL || callback == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAPTURE_FORMAT, format , NULL);
-	return __convert_camera_error_code(__func__, ret);
+	handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_METRIC] = (void*)callback;
+	handle->user_data[_CAMERA_EVENT_TYPE_FOCUS_METRIC] = (void*)user_data;
+	__camera_update_video_stream_callback(handle);
+	return CAMERA_ERROR_NONE;
 }
 
-int camera_get_preview_format(camera_h camera, camera_pixel_format_e *format){
-	if( camera == NULL || format == NULL){
+int camera_unset_focus_metric_cb(camera_h camera){
+	if( camera == NULL){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
-
-	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FORMAT, format , NULL);
-	if( (MMPixelFormatType)*format == MM_PIXEL_FORMAT_ITLV_JPEG_UYVY )
-		*format = CAMERA_PIXEL_FORMAT_UYVY;
-	return __convert_camera_error_code(__func__, ret);	
+	handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_METRIC] = (void*)NULL;
+	handle->user_data[_CAMERA_EVENT_TYPE_FOCUS_METRIC] = (void*)NULL;
+	__camera_update_video_stream_callback(handle);
+	return CAMERA_ERROR_NONE;
 }
 
-int camera_set_preview_cb( camera_h camera, camera_preview_cb callback, void* user_data ){
+int camera_set_focus_peaking_cb(camera_h camera, camera_focus_peaking_cb callback, void *user_data){
 	if( camera == NULL || callback == NULL){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
-
 	camera_s * handle = (camera_s*)camera;
-	handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW] = (void*)callback;
-	handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW] = (void*)user_data;
+	handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_PEAKING] = (void*)callback;
+	handle->user_data[_CAMERA_EVENT_TYPE_FOCUS_PEAKING] = (void*)user_data;
+	__camera_update_video_stream_callback(handle);
 	return CAMERA_ERROR_NONE;
 }
-int camera_unset_preview_cb( camera_h camera){
+
+int camera_unset_focus_peaking_cb(camera_h camera){
 	if( camera == NULL){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
 	camera_s * handle = (camera_s*)camera;
-	handle->user_cb[_CAMERA_EVENT_TYPE_PREVIEW] = (void*)NULL;
-	handle->user_data[_CAMERA_EVENT_TYPE_PREVIEW] = (void*)NULL;
+	handle->user_cb[_CAMERA_EVENT_TYPE_FOCUS_PEAKING] = (void*)NULL;
+	handle->user_data[_CAMERA_EVENT_TYPE_FOCUS_PEAKING] = (void*)NULL;
+	__camera_update_video_stream_callback(handle);
 	return CAMERA_ERROR_NONE;
 }
 
@@ -1430,10 +2956,10 @@ int camera_attr_set_preview_fps(camera_h camera,  camera_attr_fps_e fps){
 			if ( info.int_array.array[i] > maxfps && info.int_array.array[i] <= 60 )
 				maxfps = info.int_array.array[i];
 		}
-		ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FPS_AUTO  , 1, MMCAM_CAMERA_FPS, maxfps , NULL);
+		ret = __camera_set_preview_fps(handle, 1, maxfps);
 	}
 	else
-		ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FPS_AUTO  , 0, MMCAM_CAMERA_FPS  , fps, NULL);
+		ret = __camera_set_preview_fps(handle, 0, fps);
 
 	return __convert_camera_error_code(__func__, ret);
 
@@ -1450,6 +2976,8 @@ int camera_attr_set_image_quality(camera_h camera,  int quality){
 	int ret;
 	camera_s * handle = (camera_s*)camera;
 	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_IMAGE_ENCODER_QUALITY , quality, NULL);
+	if( ret == 0 )
+		handle->jpeg_quality = quality;
 	return __convert_camera_error_code(__func__, ret);
 
 }
@@ -1463,7 +2991,12 @@ int camera_attr_get_preview_fps(camera_h camera,  camera_attr_fps_e *fps){
 	int is_auto;
 	camera_s * handle = (camera_s*)camera;
 
-	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FPS , &mm_fps, MMCAM_CAMERA_FPS_AUTO , &is_auto, NULL);
+	if( handle->deferred_attributes & _CAMERA_DEFERRED_FPS ){
+		mm_fps = handle->deferred_fps;
+		is_auto = handle->deferred_fps_auto;
+		ret = MM_ERROR_NONE;
+	}else
+		ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FPS , &mm_fps, MMCAM_CAMERA_FPS_AUTO , &is_auto, NULL);
 	if( is_auto )
 		*fps = CAMERA_ATTR_FPS_AUTO;
 	else
@@ -1493,7 +3026,7 @@ int camera_attr_set_zoom(camera_h camera,  int zoom){
 	}
 	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_DIGITAL_ZOOM  , zoom, NULL);
+	ret = __camera_set_continuous_attribute(handle, _CAMERA_CACHED_ZOOM, zoom);
 	return __convert_camera_error_code(__func__, ret);
 
 }
@@ -1552,8 +3085,11 @@ int camera_attr_set_af_area(camera_h camera, int x, int y){
 	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_AF_TOUCH_X, x,
                                                                                                   MMCAM_CAMERA_AF_TOUCH_Y, y,
 																												NULL);
-	if( ret == 0 )
+	if( ret == 0 ){
 		handle->focus_area_valid = true;
+		// a single point replaces the focus regions
+		_camera_metering_set_focus_regions(handle->metering, NULL, 0);
+	}
 	return __convert_camera_error_code(__func__, ret);
 }
 
@@ -1568,9 +3104,121 @@ int camera_attr_clear_af_area(camera_h camera){
 		return CAMERA_ERROR_INVALID_OPERATION;
 	}
 	handle->focus_area_valid = false;
+	_camera_metering_set_focus_regions(handle->metering, NULL, 0);
 	return 0;
 }
 
+static int __camera_create_metering(camera_s *handle){
+	if( handle->metering == NULL )
+		return _camera_metering_create(&handle->metering);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_set_af_regions(camera_h camera, const camera_region_s *regions, int count){
+	if( camera == NULL || !_camera_metering_is_valid_regions(regions, count) ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	camera_attr_af_mode_e mode;
+	int x;
+	int y;
+	int ret;
+	if( count == 0 ){
+		handle->focus_area_valid = false;
+		_camera_metering_set_focus_regions(handle->metering, NULL, 0);
+		return CAMERA_ERROR_NONE;
+	}
+	camera_attr_get_af_mode(camera, &mode);
+	if( mode == CAMERA_ATTR_AF_NONE ){
+		LOGE( "[%s] INVALID_OPERATION(0x%08x) AF mode is CAMERA_ATTR_AF_NONE",__func__,CAMERA_ERROR_INVALID_OPERATION);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	ret = __camera_create_metering(handle);
+	if( ret != CAMERA_ERROR_NONE )
+		return ret;
+	ret = _camera_metering_set_focus_regions(handle->metering, regions, count);
+	if( ret != CAMERA_ERROR_NONE )
+		return ret;
+	// the device focuses on a single point, the center of the heaviest region
+	_camera_metering_get_focus_point(handle->metering, &x, &y);
+	ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_AF_TOUCH_X, x, MMCAM_CAMERA_AF_TOUCH_Y, y, NULL);
+	if( ret != MM_ERROR_NONE ){
+		_camera_metering_set_focus_regions(handle->metering, NULL, 0);
+		return __convert_camera_error_code(__func__, ret);
+	}
+	handle->focus_area_valid = true;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_set_ae_regions(camera_h camera, const camera_region_s *regions, int count){
+	if( camera == NULL || !_camera_metering_is_valid_regions(regions, count) ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	int ret = CAMERA_ERROR_NONE;
+	if( count > 0 )
+		ret = __camera_create_metering(handle);
+	if( ret == CAMERA_ERROR_NONE && handle->metering )
+		ret = _camera_metering_set_regions(handle->metering, regions, count);
+	if( ret == CAMERA_ERROR_NONE )
+		__camera_update_video_stream_callback(handle);
+	return ret;
+}
+
+int camera_attr_get_ae_region_statistics(camera_h camera, int index, camera_region_statistics_s *statistics){
+	if( camera == NULL || statistics == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	if( handle->metering == NULL ){
+		LOGE( "[%s] INVALID_OPERATION(0x%08x) no metering region",__func__,CAMERA_ERROR_INVALID_OPERATION);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	return _camera_metering_get_statistics(handle->metering, index, statistics);
+}
+
+int camera_attr_get_ae_weighted_mean(camera_h camera, int *mean){
+	if( camera == NULL || mean == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	if( handle->metering == NULL ){
+		LOGE( "[%s] INVALID_OPERATION(0x%08x) no metering region",__func__,CAMERA_ERROR_INVALID_OPERATION);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	return _camera_metering_get_weighted_mean(handle->metering, mean);
+}
+
+int camera_attr_set_focus_metric_area(camera_h camera, int x, int y, int width, int height){
+	if( camera == NULL || x < 0 || y < 0 || width <= 0 || height <= 0 ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	handle->focus_metric_x = x;
+	handle->focus_metric_y = y;
+	handle->focus_metric_width = width;
+	handle->focus_metric_height = height;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_clear_focus_metric_area(camera_h camera){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	handle->focus_metric_x = 0;
+	handle->focus_metric_y = 0;
+	handle->focus_metric_width = 0;
+	handle->focus_metric_height = 0;
+	return CAMERA_ERROR_NONE;
+}
+
 int camera_attr_set_exposure_mode(camera_h camera,  camera_attr_exposure_mode_e mode){
 	if( camera == NULL){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
@@ -1582,10 +3230,14 @@ int camera_attr_set_exposure_mode(camera_h camera,  camera_attr_exposure_mode_e
 									MM_CAMCORDER_AUTO_EXPOSURE_SPOT_1, //CAMCORDER_EXPOSURE_MODE_SPOT
 									MM_CAMCORDER_AUTO_EXPOSURE_CUSTOM_1,//CAMCORDER_EXPOSURE_MODE_CUSTOM
 		};
+	if( (unsigned int)mode >= sizeof(maptable)/sizeof(maptable[0]) ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
 
 	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_EXPOSURE_MODE  , maptable[abs(mode%5)], NULL);
+	ret = __camera_set_cached_attribute(handle, _CAMERA_CACHED_EXPOSURE_MODE, maptable[mode]);
 	return __convert_camera_error_code(__func__, ret);
 
 }
@@ -1598,7 +3250,7 @@ int camera_attr_set_exposure(camera_h camera, int value){
 	int ret;
 
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_EXPOSURE_VALUE  , value, NULL);
+	ret = __camera_set_cached_attribute(handle, _CAMERA_CACHED_EXPOSURE, value);
 	return __convert_camera_error_code(__func__, ret);
 
 }
@@ -1610,7 +3262,7 @@ int camera_attr_set_iso(camera_h camera,  camera_attr_iso_e iso){
 	}
 	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_ISO  , iso, NULL);
+	ret = __camera_set_cached_attribute(handle, _CAMERA_CACHED_ISO, iso);
 	return __convert_camera_error_code(__func__, ret);
 }
 int camera_attr_set_brightness(camera_h camera,  int level){
@@ -1621,7 +3273,7 @@ int camera_attr_set_brightness(camera_h camera,  int level){
 	int ret;
 
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_BRIGHTNESS  , level, NULL);
+	ret = __camera_set_continuous_attribute(handle, _CAMERA_CACHED_BRIGHTNESS, level);
 	return __convert_camera_error_code(__func__, ret);
 
 }
@@ -1634,7 +3286,7 @@ int camera_attr_set_contrast(camera_h camera,  int level){
 	int ret;
 
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_CONTRAST  , level, NULL);
+	ret = __camera_set_continuous_attribute(handle, _CAMERA_CACHED_CONTRAST, level);
 
 	return __convert_camera_error_code(__func__, ret);
 
@@ -1646,7 +3298,7 @@ int camera_attr_set_whitebalance(camera_h camera,  camera_attr_whitebalance_e wb
 	}
 	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_WB  , wb, NULL);
+	ret = __camera_set_cached_attribute(handle, _CAMERA_CACHED_WHITEBALANCE, wb);
 	return __convert_camera_error_code(__func__, ret);
 
 }
@@ -1680,8 +3332,23 @@ int camera_attr_set_effect(camera_h camera, camera_attr_effect_mode_e effect){
 	};
 	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_COLOR_TONE , maptable[abs(effect%20)], NULL);
-	return __convert_camera_error_code(__func__, ret);
+	if( effect < CAMERA_ATTR_EFFECT_NONE || effect > CAMERA_ATTR_EFFECT_SKETCH ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_COLOR_TONE , maptable[effect], NULL);
+	if( ret == 0 || effect == CAMERA_ATTR_EFFECT_NONE ){
+		handle->sw_effect = CAMERA_ATTR_EFFECT_NONE;
+		return __convert_camera_error_code(__func__, ret);
+	}
+	if( !__camera_is_not_supported_error(ret) )
+		return __convert_camera_error_code(__func__, ret);
+
+	// the ISP lacks this effect, apply it to the callback frames instead
+	mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_COLOR_TONE , MM_CAMCORDER_COLOR_TONE_NONE, NULL);
+	handle->sw_effect = effect;
+	LOGI("[%s] effect %d not supported by the sensor, using software effect",__func__, effect);
+	return CAMERA_ERROR_NONE;
 }
 int camera_attr_set_scene_mode(camera_h camera,  camera_attr_scene_mode_e mode){
 	if( camera == NULL){
@@ -1690,7 +3357,7 @@ int camera_attr_set_scene_mode(camera_h camera,  camera_attr_scene_mode_e mode){
 	}
 	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_SCENE_MODE  , mode, NULL);
+	ret = __camera_set_cached_attribute(handle, _CAMERA_CACHED_SCENE_MODE, mode);
 	return __convert_camera_error_code(__func__, ret);
 
 }
@@ -1777,7 +3444,7 @@ int camera_attr_set_flash_mode(camera_h camera,  camera_attr_flash_mode_e mode){
 	}
 	int ret;
 	camera_s * handle = (camera_s*)camera;
-	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_STROBE_MODE  , mode, NULL);
+	ret = __camera_set_cached_attribute(handle, _CAMERA_CACHED_FLASH_MODE, mode);
 	return __convert_camera_error_code(__func__, ret);
 }
 
@@ -1790,6 +3457,8 @@ int camera_attr_get_zoom(camera_h camera,  int *zoom){
 
 	int ret;
 	camera_s * handle = (camera_s*)camera;
+	if( __camera_get_pending_attribute(handle, _CAMERA_CACHED_ZOOM, zoom) )
+		return CAMERA_ERROR_NONE;
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_DIGITAL_ZOOM , zoom, NULL);
 	return __convert_camera_error_code(__func__, ret);
 
@@ -1937,6 +3606,8 @@ int camera_attr_get_brightness(camera_h camera,  int *level){
 	}
 	int ret;
 	camera_s * handle = (camera_s*)camera;
+	if( __camera_get_pending_attribute(handle, _CAMERA_CACHED_BRIGHTNESS, level) )
+		return CAMERA_ERROR_NONE;
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_BRIGHTNESS , level, NULL);
 	return __convert_camera_error_code(__func__, ret);
 
@@ -1970,6 +3641,8 @@ int camera_attr_get_contrast(camera_h camera,  int *level){
 
 	int ret;
 	camera_s * handle = (camera_s*)camera;
+	if( __camera_get_pending_attribute(handle, _CAMERA_CACHED_CONTRAST, level) )
+		return CAMERA_ERROR_NONE;
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_CONTRAST , level, NULL);
 	return __convert_camera_error_code(__func__, ret);
 }
@@ -2016,6 +3689,10 @@ int camera_attr_get_effect(camera_h camera, camera_attr_effect_mode_e *effect){
 	int ret;
 	camera_s * handle = (camera_s*)camera;
 	int tone;
+	if( handle->sw_effect != CAMERA_ATTR_EFFECT_NONE ){
+		*effect = handle->sw_effect;
+		return CAMERA_ERROR_NONE;
+	}
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_FILTER_COLOR_TONE , &tone, NULL);
 
 	if( ret != CAMERA_ERROR_NONE )
@@ -2283,6 +3960,7 @@ int camera_attr_foreach_supported_effect(camera_h camera, camera_attr_supported_
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
+
 	int maptable[] = {
 		CAMERA_ATTR_EFFECT_NONE, //MM_CAMCORDER_COLOR_TONE_NONE
 		CAMERA_ATTR_EFFECT_MONO, //MM_CAMCORDER_COLOR_TONE_MONO,
@@ -2311,10 +3989,12 @@ int camera_attr_foreach_supported_effect(camera_h camera, camera_attr_supported_
 		-1, //MM_CAMCORDER_COLOR_TONE_SKETCH_3
 		-1 //MM_CAMCORDER_COLOR_TONE_SKETCH_4
 	};
+	bool listed[CAMERA_ATTR_EFFECT_SKETCH + 1] = { false, };
 
 	int ret;
 	camera_s * handle = (camera_s*)camera;
 	MMCamAttrsInfo info;
+	camera_pixel_format_e format;
 	ret = mm_camcorder_get_attribute_info(handle->mm_handle, MMCAM_FILTER_COLOR_TONE , &info);
 	if( ret != CAMERA_ERROR_NONE )
 		return __convert_camera_error_code(__func__, ret);
@@ -2322,13 +4002,23 @@ int camera_attr_foreach_supported_effect(camera_h camera, camera_attr_supported_
 	int i;
 	for( i=0 ; i < info.int_array.count ; i++)
 	{
-		if( maptable[info.int_array.array[i]] != -1){
+		if( info.int_array.array[i] < 0 || info.int_array.array[i] >= (int)(sizeof(maptable)/sizeof(maptable[0])) )
+			continue;
+		if( maptable[info.int_array.array[i]] != -1 && !listed[maptable[info.int_array.array[i]]] ){
+			listed[maptable[info.int_array.array[i]]] = true;
 			if ( !foreach_cb(maptable[info.int_array.array[i]],user_data) )
-				break;
+				return CAMERA_ERROR_NONE;
 		}
 	}
-	return CAMERA_ERROR_NONE;
 
+	// the rest can be applied in software, to the callback frames of the formats it reads
+	if( camera_get_preview_format(camera, &format) != CAMERA_ERROR_NONE || !_camera_image_is_effect_supported(format) )
+		return CAMERA_ERROR_NONE;
+	for( i = CAMERA_ATTR_EFFECT_NONE ; i <= CAMERA_ATTR_EFFECT_SKETCH ; i++ ){
+		if( !listed[i] && !foreach_cb(i, user_data) )
+			break;
+	}
+	return CAMERA_ERROR_NONE;
 }
 int camera_attr_foreach_supported_scene_mode(camera_h camera, camera_attr_supported_scene_mode_cb foreach_cb , void *user_data){
 	if( camera == NULL || foreach_cb == NULL){
@@ -2398,6 +4088,46 @@ int camera_attr_foreach_supported_fps(camera_h camera, camera_attr_supported_fps
 
 }
 
+/*
+ * Hands the rotation and flip the sensor has over to the software transform,
+ * which applies both in the sensor's order (flip, then rotate). The sensor is
+ * left untransformed. Nothing changes when the sensor can not be reset, the
+ * camcorder error is returned.
+ */
+static int __camera_start_software_transform(camera_s *handle){
+	int rotation = CAMERA_ROTATION_NONE;
+	int hflip = 0;
+	int vflip = 0;
+	int ret;
+
+	ret = mm_camcorder_get_attributes(handle->mm_handle, NULL,
+															MMCAM_CAMERA_ROTATION, &rotation,
+															MMCAM_CAMERA_FLIP_HORIZONTAL, &hflip,
+															MMCAM_CAMERA_FLIP_VERTICAL, &vflip,
+															NULL);
+	if( ret != MM_ERROR_NONE )
+		return ret;
+	if( rotation != CAMERA_ROTATION_NONE ){
+		ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_ROTATION, CAMERA_ROTATION_NONE, NULL);
+		if( ret != MM_ERROR_NONE )
+			return ret;
+	}
+	if( hflip || vflip ){
+		ret = mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_FLIP_HORIZONTAL, 0, MMCAM_CAMERA_FLIP_VERTICAL, 0, NULL);
+		if( ret != MM_ERROR_NONE ){
+			if( rotation != CAMERA_ROTATION_NONE )
+				mm_camcorder_set_attributes(handle->mm_handle, NULL, MMCAM_CAMERA_ROTATION, rotation, NULL);
+			return ret;
+		}
+	}
+
+	handle->sw_transform = true;
+	handle->sw_rotation = rotation;
+	handle->sw_flip = (hflip ? CAMERA_FLIP_HORIZONTAL : CAMERA_FLIP_NONE) | (vflip ? CAMERA_FLIP_VERTICAL : CAMERA_FLIP_NONE);
+	LOGI("[%s] sensor rotation/flip not supported, using software transform",__func__);
+	return MM_ERROR_NONE;
+}
+
 int camera_attr_set_stream_rotation(camera_h camera , camera_rotation_e rotation){
 	if( camera == NULL){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
@@ -2410,7 +4140,17 @@ int camera_attr_set_stream_rotation(camera_h camera , camera_rotation_e rotation
 	int ret;
 	camera_s * handle = (camera_s*)camera;
 
+	if( handle->sw_transform ){
+		handle->sw_rotation = rotation;
+		return CAMERA_ERROR_NONE;
+	}
+
 	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_ROTATION , rotation, NULL);
+	if( ret != 0 && rotation != CAMERA_ROTATION_NONE && __camera_is_not_supported_error(ret) ){
+		ret = __camera_start_software_transform(handle);
+		if( ret == MM_ERROR_NONE )
+			handle->sw_rotation = rotation;
+	}
 	return __convert_camera_error_code(__func__, ret);
 }
 
@@ -2423,6 +4163,11 @@ int camera_attr_get_stream_rotation(camera_h camera , camera_rotation_e *rotatio
 	int ret;
 	camera_s * handle = (camera_s*)camera;
 
+	if( handle->sw_transform ){
+		*rotation = handle->sw_rotation;
+		return CAMERA_ERROR_NONE;
+	}
+
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_ROTATION , rotation, NULL);
 	return __convert_camera_error_code(__func__, ret);
 }
@@ -2440,9 +4185,18 @@ int camera_attr_set_stream_flip(camera_h camera , camera_flip_e flip){
 	camera_s * handle = (camera_s*)camera;
 	int vflip = 0;
 	int hflip = 0;
+	if( handle->sw_transform ){
+		handle->sw_flip = flip;
+		return CAMERA_ERROR_NONE;
+	}
 	vflip = (flip & CAMERA_FLIP_VERTICAL) == CAMERA_FLIP_VERTICAL;
 	hflip = (flip & CAMERA_FLIP_HORIZONTAL) == CAMERA_FLIP_HORIZONTAL;
 	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_FLIP_HORIZONTAL , hflip  , MMCAM_CAMERA_FLIP_VERTICAL, vflip , NULL);
+	if( ret != 0 && flip != CAMERA_FLIP_NONE && __camera_is_not_supported_error(ret) ){
+		ret = __camera_start_software_transform(handle);
+		if( ret == MM_ERROR_NONE )
+			handle->sw_flip = flip;
+	}
 	return __convert_camera_error_code(__func__, ret);
 }
 
@@ -2458,6 +4212,10 @@ int camera_attr_get_stream_flip(camera_h camera , camera_flip_e *flip){
 	int hflip = 0;
 	int result = 0;
 	char *error;
+	if( handle->sw_transform ){
+		*flip = handle->sw_flip;
+		return CAMERA_ERROR_NONE;
+	}
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,&error, MMCAM_CAMERA_FLIP_HORIZONTAL , &hflip  , MMCAM_CAMERA_FLIP_VERTICAL, &vflip , NULL);
 
 	if( ret == 0){
@@ -2478,6 +4236,11 @@ int _camera_get_mm_handle(camera_h camera , MMHandleType *handle){
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
 	camera_s *camera_handle = (camera_s*)camera;
+	// the recorder realizes the camcorder without camera_start_preview, it gets the recorded preview attributes now
+	camera_handle->mm_handle_shared = true;
+	int ret = __camera_flush_deferred_attributes(camera_handle);
+	if( ret != MM_ERROR_NONE )
+		return __convert_camera_error_code(__func__, ret);
 	*handle =  camera_handle->mm_handle;
 	return CAMERA_ERROR_NONE;
 }
@@ -2495,8 +4258,36 @@ int _camera_set_relay_mm_message_callback(camera_h camera, MMMessageCallback cal
 	return CAMERA_ERROR_NONE;
 }
 
+/* HDR capture the ISP does not do is fused in software from an exposure bracket */
+static int __camera_set_software_hdr(camera_s *handle, camera_attr_hdr_mode_e mode){
+	int min = 0;
+	int max = 0;
+
+	// only a software HDR that is on can be turned off here, otherwise the caller reports the device error
+	if( mode == CAMERA_ATTR_HDR_MODE_DISABLE ){
+		if( handle->sw_hdr_mode == CAMERA_ATTR_HDR_MODE_DISABLE )
+			return CAMERA_ERROR_INVALID_OPERATION;
+		handle->sw_hdr_mode = CAMERA_ATTR_HDR_MODE_DISABLE;
+		return CAMERA_ERROR_NONE;
+	}
+	if( camera_attr_get_exposure_range((camera_h)handle, &min, &max) != CAMERA_ERROR_NONE || min >= max ){
+		LOGE("[%s] no exposure range to bracket",__func__);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	if( handle->hdr == NULL ){
+		int ret = _camera_hdr_create(&handle->hdr);
+		if( ret != CAMERA_ERROR_NONE )
+			return ret;
+	}
+	if( handle->jpeg_quality <= 0 )
+		mm_camcorder_get_attributes(handle->mm_handle, NULL, MMCAM_IMAGE_ENCODER_QUALITY, &handle->jpeg_quality, NULL);
+	handle->sw_hdr_mode = mode;
+	LOGI("[%s] hdr mode %d done in software",__func__, mode);
+	return CAMERA_ERROR_NONE;
+}
+
 int camera_attr_set_hdr_mode(camera_h camera, camera_attr_hdr_mode_e mode){
-	if( camera == NULL){
+	if( camera == NULL || mode < CAMERA_ATTR_HDR_MODE_DISABLE || mode > CAMERA_ATTR_HDR_MODE_KEEP_ORIGINAL ){
 		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
 		return CAMERA_ERROR_INVALID_PARAMETER;
 	}
@@ -2508,6 +4299,10 @@ int camera_attr_set_hdr_mode(camera_h camera, camera_attr_hdr_mode_e mode){
 			handle->hdr_keep_mode = true;
 		else
 			handle->hdr_keep_mode = false;
+		handle->sw_hdr_mode = CAMERA_ATTR_HDR_MODE_DISABLE;
+	}else if( __camera_is_not_supported_error(ret) && __camera_set_software_hdr(handle, mode) == CAMERA_ERROR_NONE ){
+		handle->hdr_keep_mode = false;
+		return CAMERA_ERROR_NONE;
 	}
 	return __convert_camera_error_code(__func__, ret);
 }
@@ -2520,6 +4315,10 @@ int camera_attr_get_hdr_mode(camera_h camera, camera_attr_hdr_mode_e *mode){
 	int ret;
 	int result;
 	camera_s * handle = (camera_s*)camera;
+	if( handle->sw_hdr_mode != CAMERA_ATTR_HDR_MODE_DISABLE ){
+		*mode = handle->sw_hdr_mode;
+		return CAMERA_ERROR_NONE;
+	}
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_HDR_CAPTURE , &result, NULL);
 	if( ret == 0 ){
 		*mode = result;
@@ -2536,6 +4335,10 @@ int camera_attr_enable_hdr_capture(camera_h camera, bool enable){
 	int ret;
 	camera_s * handle = (camera_s*)camera;
 	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_HDR_CAPTURE , enable, NULL);
+	if( ret == 0 )
+		handle->sw_hdr_mode = CAMERA_ATTR_HDR_MODE_DISABLE;
+	else if( __camera_is_not_supported_error(ret) && __camera_set_software_hdr(handle, enable ? CAMERA_ATTR_HDR_MODE_ENABLE : CAMERA_ATTR_HDR_MODE_DISABLE) == CAMERA_ERROR_NONE )
+		return CAMERA_ERROR_NONE;
 	return __convert_camera_error_code(__func__, ret);
 }
 
@@ -2547,6 +4350,10 @@ int camera_attr_is_enabled_hdr_capture(camera_h camera, bool *enabled){
 	int ret;
 	int result;
 	camera_s * handle = (camera_s*)camera;
+	if( handle->sw_hdr_mode != CAMERA_ATTR_HDR_MODE_DISABLE ){
+		*enabled = true;
+		return CAMERA_ERROR_NONE;
+	}
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_HDR_CAPTURE , &result, NULL);
 	if( ret == 0 ){
 		if( result >= MM_CAMCORDER_HDR_ON )
@@ -2572,7 +4379,10 @@ bool camera_attr_is_supported_hdr_capture(camera_h camera){
 			return true;
 		}
 	}
-	return false;
+	// otherwise it is fused in software, which needs an exposure range to bracket
+	int min = 0;
+	int max = 0;
+	return camera_attr_get_exposure_range(camera, &min, &max) == CAMERA_ERROR_NONE && min < max;
 }
 
 int camera_attr_set_hdr_capture_progress_cb(camera_h camera, camera_attr_hdr_progress_cb callback, void* user_data){
@@ -2610,6 +4420,21 @@ int camera_attr_enable_anti_shake(camera_h camera, bool enable){
 
 	camera_s * handle = (camera_s*)camera;
 	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_ANTI_HANDSHAKE , mode, NULL);
+	if( ret != 0 && __camera_is_not_supported_error(ret) ){
+		// a device without anti-shake is not wrong to refuse turning it off
+		if( !enable ){
+			handle->sw_anti_shake = false;
+			return CAMERA_ERROR_NONE;
+		}
+		// stabilize the preview callback frames in software instead
+		if( handle->eis == NULL && _camera_eis_create(&handle->eis) != CAMERA_ERROR_NONE )
+			return __convert_camera_error_code(__func__, ret);
+		LOGI("[%s] anti-shake done in software",__func__);
+		handle->sw_anti_shake = true;
+		return CAMERA_ERROR_NONE;
+	}
+	if( ret == 0 )
+		handle->sw_anti_shake = false;
 	return __convert_camera_error_code(__func__, ret);
 }
 
@@ -2621,6 +4446,10 @@ int camera_attr_is_enabled_anti_shake(camera_h camera , bool *enabled){
 	int ret;
 	int mode = MM_CAMCORDER_AHS_OFF;
 	camera_s * handle = (camera_s*)camera;
+	if( handle->sw_anti_shake ){
+		*enabled = true;
+		return CAMERA_ERROR_NONE;
+	}
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_ANTI_HANDSHAKE , &mode, NULL);
 	if( ret == 0 )
 		*enabled = mode;
@@ -2642,7 +4471,11 @@ bool camera_attr_is_supported_anti_shake(camera_h camera){
 		if ( ash_info.int_array.array[i] == MM_CAMCORDER_AHS_ON)
 			return true;
 	}
-	return false;
+	// the software stage only stabilizes preview callback frames, in the formats it reads
+	camera_pixel_format_e format;
+	if( camera_get_preview_format(camera, &format) != CAMERA_ERROR_NONE )
+		return false;
+	return _camera_eis_is_supported_format(format);
 }
 
 int camera_attr_enable_auto_contrast(camera_h camera, bool enable){
@@ -2652,12 +4485,38 @@ int camera_attr_enable_auto_contrast(camera_h camera, bool enable){
 	}
 	int ret;
 	int mode = MM_CAMCORDER_WDR_OFF;
+	int i;
+	bool supported = false;
+	MMCamAttrsInfo wdr_info;
 	if( enable )
 		mode = MM_CAMCORDER_WDR_ON;
 
 	camera_s * handle = (camera_s*)camera;
 	ret = mm_camcorder_set_attributes(handle->mm_handle ,NULL,  MMCAM_CAMERA_WDR  , mode, NULL);
-	return __convert_camera_error_code(__func__, ret);
+	// devices without WDR may take the attribute and do nothing, check what they list
+	if( ret == 0 && mm_camcorder_get_attribute_info(handle->mm_handle, MMCAM_CAMERA_WDR, &wdr_info) == 0 ){
+		for( i = 0 ; i < wdr_info.int_array.count ; i++ ){
+			if( wdr_info.int_array.array[i] == MM_CAMCORDER_WDR_ON )
+				supported = true;
+		}
+	}
+	// a device without WDR is not wrong to refuse turning it off
+	if( !enable && (ret == 0 || __camera_is_not_supported_error(ret)) ){
+		handle->sw_wdr = false;
+		return CAMERA_ERROR_NONE;
+	}
+	if( (ret == 0 && supported) || (ret != 0 && !__camera_is_not_supported_error(ret)) ){
+		if( ret == 0 )
+			handle->sw_wdr = false;
+		return __convert_camera_error_code(__func__, ret);
+	}
+
+	// tone map the preview callback and raw capture frames in software instead
+	if( handle->wdr == NULL && _camera_wdr_create(&handle->wdr) != CAMERA_ERROR_NONE )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	LOGI("[%s] auto contrast done in software",__func__);
+	handle->sw_wdr = true;
+	return CAMERA_ERROR_NONE;
 }
 
 int camera_attr_is_enabled_auto_contrast(camera_h camera, bool *enabled){
@@ -2668,8 +4527,145 @@ int camera_attr_is_enabled_auto_contrast(camera_h camera, bool *enabled){
 	int ret;
 	int mode = MM_CAMCORDER_WDR_OFF;
 	camera_s * handle = (camera_s*)camera;
+	if( handle->sw_wdr ){
+		*enabled = true;
+		return CAMERA_ERROR_NONE;
+	}
 	ret = mm_camcorder_get_attributes(handle->mm_handle ,NULL, MMCAM_CAMERA_WDR , &mode, NULL);
 	if( ret == 0 )
 		*enabled = mode;
 	return __convert_camera_error_code(__func__, ret);
 }
+
+/* the worker pool is shared by software encoding and thumbnail generation */
+static int __camera_update_jpeg_encoder(camera_s *handle){
+	bool needed = handle->jpeg_encoding || handle->thumbnail_width > 0;
+	if( needed && handle->jpeg_encoder == NULL ){
+		mm_camcorder_get_attributes(handle->mm_handle, NULL, MMCAM_IMAGE_ENCODER_QUALITY, &handle->jpeg_quality, NULL);
+		return _camera_jpeg_encoder_create(&handle->jpeg_encoder);
+	}else if( !needed && handle->jpeg_encoder ){
+		_camera_jpeg_encoder_destroy(handle->jpeg_encoder);
+		handle->jpeg_encoder = NULL;
+	}
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_enable_software_jpeg_encoding(camera_h camera, bool enable){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	int ret;
+	camera_s * handle = (camera_s*)camera;
+	if( handle->state == CAMERA_STATE_CAPTURING ){
+		LOGE( "[%s] INVALID_STATE(0x%08x)",__func__,CAMERA_ERROR_INVALID_STATE);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	handle->jpeg_encoding = enable;
+	ret = __camera_update_jpeg_encoder(handle);
+	if( ret != CAMERA_ERROR_NONE )
+		handle->jpeg_encoding = false;
+	return ret;
+}
+
+int camera_attr_is_enabled_software_jpeg_encoding(camera_h camera, bool *enabled){
+	if( camera == NULL || enabled == NULL ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	*enabled = handle->jpeg_encoding;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_set_capture_file_sync_policy(camera_h camera, camera_file_sync_policy_e policy){
+	if( camera == NULL || policy < CAMERA_FILE_SYNC_NONE || policy > CAMERA_FILE_SYNC_EACH ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	handle->file_sync_policy = policy;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_get_capture_file_sync_policy(camera_h camera, camera_file_sync_policy_e *policy){
+	if( camera == NULL || policy == NULL ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	*policy = handle->file_sync_policy;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_enable_capture_file_direct_io(camera_h camera, bool enable){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	handle->file_direct_io = enable;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_is_enabled_capture_file_direct_io(camera_h camera, bool *enabled){
+	if( camera == NULL || enabled == NULL ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	*enabled = handle->file_direct_io;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_enable_capture_postview(camera_h camera, bool enable){
+	if( camera == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	handle->postview_enabled = enable;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_is_enabled_capture_postview(camera_h camera, bool *enabled){
+	if( camera == NULL || enabled == NULL ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	*enabled = handle->postview_enabled;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_attr_set_software_thumbnail_size(camera_h camera, int width, int height){
+	if( camera == NULL || width < 0 || height < 0 || (width == 0) != (height == 0) ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	int ret;
+	camera_s * handle = (camera_s*)camera;
+	if( handle->state == CAMERA_STATE_CAPTURING ){
+		LOGE( "[%s] INVALID_STATE(0x%08x)",__func__,CAMERA_ERROR_INVALID_STATE);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	handle->thumbnail_width = width;
+	handle->thumbnail_height = height;
+	ret = __camera_update_jpeg_encoder(handle);
+	if( ret != CAMERA_ERROR_NONE ){
+		handle->thumbnail_width = 0;
+		handle->thumbnail_height = 0;
+	}
+	return ret;
+}
+
+int camera_attr_get_software_thumbnail_size(camera_h camera, int *width, int *height){
+	if( camera == NULL || width == NULL || height == NULL ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_s * handle = (camera_s*)camera;
+	*width = handle->thumbnail_width;
+	*height = handle->thumbnail_height;
+	return CAMERA_ERROR_NONE;
+}
@@ -0,0 +1,410 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define EFFECT_USE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define EFFECT_USE_SSE2
+#endif
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/*
+ * Color effects are either point operations, done with one lookup table per
+ * component, or 3x3 luma convolutions (emboss, outline, sketch) that drop the chroma.
+ */
+typedef struct {
+	unsigned char y[256];
+	unsigned char u[256];
+	unsigned char v[256];
+} _camera_effect_lut_s;
+
+typedef struct {
+	int y_scale;	/* luma = y_offset + y * y_scale / 16 */
+	int y_offset;
+	int u;		/* fixed chroma, -1 keeps the source chroma */
+	int v;
+} _camera_effect_tone_s;
+
+/* indexed by camera_attr_effect_mode_e, tints are grey images with a fixed chroma */
+static const _camera_effect_tone_s __effect_tones[] = {
+	{ 16, 0, -1, -1 },	/* NONE */
+	{ 16, 0, 128, 128 },	/* MONO */
+	{ 16, 0, 108, 146 },	/* SEPIA */
+	{ -16, 255, -1, -1 },	/* NEGATIVE */
+	{ 16, 0, 162, 112 },	/* BLUE */
+	{ 16, 0, 100, 100 },	/* GREEN */
+	{ 16, 0, 150, 96 },	/* AQUA */
+	{ 16, 0, 156, 150 },	/* VIOLET */
+	{ 16, 0, 92, 164 },	/* ORANGE */
+	{ 12, 32, 128, 128 },	/* GRAY */
+	{ 16, 0, 108, 178 },	/* RED */
+	{ 13, 24, 118, 138 },	/* ANTIQUE */
+	{ 16, 0, -1, -1 },	/* WARM */
+	{ 16, 0, 138, 158 },	/* PINK */
+	{ 16, 0, 72, 140 },	/* YELLOW */
+	{ 16, 0, 150, 164 },	/* PURPLE */
+};
+
+static inline unsigned char __clip(int value){
+	return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+static void __effect_build_lut(camera_attr_effect_mode_e effect, _camera_effect_lut_s *lut){
+	const _camera_effect_tone_s *tone = &__effect_tones[effect < CAMERA_ATTR_EFFECT_EMBOSS ? effect : CAMERA_ATTR_EFFECT_NONE];
+	int i;
+
+	for( i = 0 ; i < 256 ; i++ ){
+		lut->y[i] = __clip(tone->y_offset + i * tone->y_scale / 16);
+		lut->u[i] = tone->u < 0 ? i : tone->u;
+		lut->v[i] = tone->v < 0 ? i : tone->v;
+	}
+
+	switch( effect ){
+		case CAMERA_ATTR_EFFECT_NEGATIVE:
+			for( i = 0 ; i < 256 ; i++ ){
+				lut->u[i] = 255 - i;
+				lut->v[i] = 255 - i;
+			}
+			break;
+		case CAMERA_ATTR_EFFECT_WARM:
+			for( i = 0 ; i < 256 ; i++ ){
+				lut->u[i] = __clip(i - 12);
+				lut->v[i] = __clip(i + 12);
+			}
+			break;
+		case CAMERA_ATTR_EFFECT_SOLARIZATION:
+			for( i = 128 ; i < 256 ; i++ )
+				lut->y[i] = 255 - i;
+			break;
+		default:
+			break;
+	}
+}
+
+static void __effect_lut_plane(const unsigned char *src, unsigned char *dst, unsigned int count, const unsigned char *lut){
+	unsigned int i;
+
+	for( i = 0 ; i + 4 <= count ; i += 4 ){
+		dst[i] = lut[src[i]];
+		dst[i + 1] = lut[src[i + 1]];
+		dst[i + 2] = lut[src[i + 2]];
+		dst[i + 3] = lut[src[i + 3]];
+	}
+	for( ; i < count ; i++ )
+		dst[i] = lut[src[i]];
+}
+
+static void __effect_lut_interleaved(const unsigned char *src, unsigned char *dst, unsigned int pairs, const unsigned char *lut0, const unsigned char *lut1){
+	unsigned int i;
+
+	for( i = 0 ; i < pairs ; i++ ){
+		dst[i * 2] = lut0[src[i * 2]];
+		dst[i * 2 + 1] = lut1[src[i * 2 + 1]];
+	}
+}
+
+static void __effect_lut_packed(const unsigned char *src, unsigned char *dst, unsigned int macro_pixels, const unsigned char *lut[4]){
+	unsigned int i;
+
+	for( i = 0 ; i < macro_pixels ; i++ ){
+		dst[i * 4] = lut[0][src[i * 4]];
+		dst[i * 4 + 1] = lut[1][src[i * 4 + 1]];
+		dst[i * 4 + 2] = lut[2][src[i * 4 + 2]];
+		dst[i * 4 + 3] = lut[3][src[i * 4 + 3]];
+	}
+}
+
+/* r0, r1, r2 are three padded luma lines, sample x of the row is at index x + 1 */
+static void __effect_convolve_row(const unsigned char *r0, const unsigned char *r1, const unsigned char *r2, unsigned char *out, int width, camera_attr_effect_mode_e effect){
+	int x = 0;
+
+#if defined(EFFECT_USE_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i mid = _mm_set1_epi16(128);
+	const __m128i ones = _mm_set1_epi8((char)0xff);
+	for( ; x + 16 <= width ; x += 16 ){
+		__m128i a0 = _mm_loadu_si128((const __m128i*)(r0 + x));
+		__m128i c2 = _mm_loadu_si128((const __m128i*)(r2 + x + 2));
+		__m128i res[2];
+		int half;
+		if( effect == CAMERA_ATTR_EFFECT_EMBOSS ){
+			__m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(c2, zero));
+			__m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(c2, zero));
+			lo = _mm_add_epi16(_mm_slli_epi16(lo, 1), mid);
+			hi = _mm_add_epi16(_mm_slli_epi16(hi, 1), mid);
+			_mm_storeu_si128((__m128i*)(out + x), _mm_packus_epi16(lo, hi));
+			continue;
+		}
+		__m128i a1 = _mm_loadu_si128((const __m128i*)(r0 + x + 1));
+		__m128i a2 = _mm_loadu_si128((const __m128i*)(r0 + x + 2));
+		__m128i b0 = _mm_loadu_si128((const __m128i*)(r1 + x));
+		__m128i b2 = _mm_loadu_si128((const __m128i*)(r1 + x + 2));
+		__m128i c0 = _mm_loadu_si128((const __m128i*)(r2 + x));
+		__m128i c1 = _mm_loadu_si128((const __m128i*)(r2 + x + 1));
+		for( half = 0 ; half < 2 ; half++ ){
+			#define EFFECT_WIDEN(v) (half ? _mm_unpackhi_epi8(v, zero) : _mm_unpacklo_epi8(v, zero))
+			__m128i left = _mm_add_epi16(_mm_add_epi16(EFFECT_WIDEN(a0), EFFECT_WIDEN(c0)), _mm_slli_epi16(EFFECT_WIDEN(b0), 1));
+			__m128i right = _mm_add_epi16(_mm_add_epi16(EFFECT_WIDEN(a2), EFFECT_WIDEN(c2)), _mm_slli_epi16(EFFECT_WIDEN(b2), 1));
+			__m128i top = _mm_add_epi16(_mm_add_epi16(EFFECT_WIDEN(a0), EFFECT_WIDEN(a2)), _mm_slli_epi16(EFFECT_WIDEN(a1), 1));
+			__m128i bottom = _mm_add_epi16(_mm_add_epi16(EFFECT_WIDEN(c0), EFFECT_WIDEN(c2)), _mm_slli_epi16(EFFECT_WIDEN(c1), 1));
+			#undef EFFECT_WIDEN
+			__m128i gx = _mm_sub_epi16(right, left);
+			__m128i gy = _mm_sub_epi16(bottom, top);
+			gx = _mm_max_epi16(gx, _mm_sub_epi16(zero, gx));
+			gy = _mm_max_epi16(gy, _mm_sub_epi16(zero, gy));
+			res[half] = _mm_add_epi16(gx, gy);
+			if( effect == CAMERA_ATTR_EFFECT_SKETCH )
+				res[half] = _mm_srli_epi16(res[half], 1);
+		}
+		if( effect == CAMERA_ATTR_EFFECT_SKETCH )
+			_mm_storeu_si128((__m128i*)(out + x), _mm_xor_si128(_mm_packus_epi16(res[0], res[1]), ones));
+		else
+			_mm_storeu_si128((__m128i*)(out + x), _mm_packus_epi16(res[0], res[1]));
+	}
+#elif defined(EFFECT_USE_NEON)
+	for( ; x + 16 <= width ; x += 16 ){
+		uint8x16_t a0 = vld1q_u8(r0 + x);
+		uint8x16_t c2 = vld1q_u8(r2 + x + 2);
+		int16x8_t res[2];
+		int half;
+		if( effect == CAMERA_ATTR_EFFECT_EMBOSS ){
+			int16x8_t lo = vreinterpretq_s16_u16(vsubl_u8(vget_low_u8(a0), vget_low_u8(c2)));
+			int16x8_t hi = vreinterpretq_s16_u16(vsubl_u8(vget_high_u8(a0), vget_high_u8(c2)));
+			lo = vaddq_s16(vshlq_n_s16(lo, 1), vdupq_n_s16(128));
+			hi = vaddq_s16(vshlq_n_s16(hi, 1), vdupq_n_s16(128));
+			vst1q_u8(out + x, vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+			continue;
+		}
+		uint8x16_t a1 = vld1q_u8(r0 + x + 1);
+		uint8x16_t a2 = vld1q_u8(r0 + x + 2);
+		uint8x16_t b0 = vld1q_u8(r1 + x);
+		uint8x16_t b2 = vld1q_u8(r1 + x + 2);
+		uint8x16_t c0 = vld1q_u8(r2 + x);
+		uint8x16_t c1 = vld1q_u8(r2 + x + 1);
+		for( half = 0 ; half < 2 ; half++ ){
+			#define EFFECT_WIDEN(v) vreinterpretq_s16_u16(vmovl_u8(half ? vget_high_u8(v) : vget_low_u8(v)))
+			int16x8_t left = vaddq_s16(vaddq_s16(EFFECT_WIDEN(a0), EFFECT_WIDEN(c0)), vshlq_n_s16(EFFECT_WIDEN(b0), 1));
+			int16x8_t right = vaddq_s16(vaddq_s16(EFFECT_WIDEN(a2), EFFECT_WIDEN(c2)), vshlq_n_s16(EFFECT_WIDEN(b2), 1));
+			int16x8_t top = vaddq_s16(vaddq_s16(EFFECT_WIDEN(a0), EFFECT_WIDEN(a2)), vshlq_n_s16(EFFECT_WIDEN(a1), 1));
+			int16x8_t bottom = vaddq_s16(vaddq_s16(EFFECT_WIDEN(c0), EFFECT_WIDEN(c2)), vshlq_n_s16(EFFECT_WIDEN(c1), 1));
+			#undef EFFECT_WIDEN
+			res[half] = vaddq_s16(vabdq_s16(right, left), vabdq_s16(bottom, top));
+			if( effect == CAMERA_ATTR_EFFECT_SKETCH )
+				res[half] = vshrq_n_s16(res[half], 1);
+		}
+		if( effect == CAMERA_ATTR_EFFECT_SKETCH )
+			vst1q_u8(out + x, vmvnq_u8(vcombine_u8(vqmovun_s16(res[0]), vqmovun_s16(res[1]))));
+		else
+			vst1q_u8(out + x, vcombine_u8(vqmovun_s16(res[0]), vqmovun_s16(res[1])));
+	}
+#endif
+	for( ; x < width ; x++ ){
+		int gx;
+		int gy;
+		if( effect == CAMERA_ATTR_EFFECT_EMBOSS ){
+			out[x] = __clip(128 + (r0[x] - r2[x + 2]) * 2);
+			continue;
+		}
+		gx = (r0[x + 2] + 2 * r1[x + 2] + r2[x + 2]) - (r0[x] + 2 * r1[x] + r2[x]);
+		gy = (r2[x] + 2 * r2[x + 1] + r2[x + 2]) - (r0[x] + 2 * r0[x + 1] + r0[x + 2]);
+		gx = abs(gx) + abs(gy);
+		out[x] = effect == CAMERA_ATTR_EFFECT_SKETCH ? 255 - __clip(gx >> 1) : __clip(gx);
+	}
+}
+
+/* copies luma row y into a line padded by one replicated sample on each side */
+static void __effect_fetch_row(const unsigned char *src, int width, int height, int y, int luma_step, int y_offset, unsigned char *line){
+	const unsigned char *row;
+	int x;
+
+	y = y < 0 ? 0 : (y >= height ? height - 1 : y);
+	row = src + (unsigned int)y * width * luma_step + y_offset;
+	if( luma_step == 1 ){
+		memcpy(line + 1, row, width);
+	}else{
+		for( x = 0 ; x < width ; x++ )
+			line[x + 1] = row[x * 2];
+	}
+	line[0] = line[1];
+	line[width + 1] = line[width];
+}
+
+static void __effect_convolve(camera_image_data_s *src, camera_attr_effect_mode_e effect, unsigned char *scratch, camera_image_data_s *dst){
+	int width = src->width;
+	int height = src->height;
+	bool packed = src->format == CAMERA_PIXEL_FORMAT_YUYV || src->format == CAMERA_PIXEL_FORMAT_UYVY;
+	int luma_step = packed ? 2 : 1;
+	int y_offset = src->format == CAMERA_PIXEL_FORMAT_UYVY ? 1 : 0;
+	unsigned char *lines[3] = { scratch, scratch + width + 2, scratch + (width + 2) * 2 };
+	unsigned char *out_line = scratch + (width + 2) * 3;
+	unsigned int luma_size = (unsigned int)width * height;
+	int x;
+	int y;
+
+	__effect_fetch_row(src->data, width, height, -1, luma_step, y_offset, lines[0]);
+	__effect_fetch_row(src->data, width, height, 0, luma_step, y_offset, lines[1]);
+	for( y = 0 ; y < height ; y++ ){
+		unsigned char *recycled = lines[0];
+		/* the next source row is read before this row is written, so src may be dst */
+		__effect_fetch_row(src->data, width, height, y + 1, luma_step, y_offset, lines[2]);
+		if( packed ){
+			unsigned char *d = dst->data + (unsigned int)y * width * 2;
+			__effect_convolve_row(lines[0], lines[1], lines[2], out_line, width, effect);
+			for( x = 0 ; x < width ; x++ ){
+				d[x * 2 + y_offset] = out_line[x];
+				d[x * 2 + 1 - y_offset] = 128;
+			}
+		}else{
+			__effect_convolve_row(lines[0], lines[1], lines[2], dst->data + (unsigned int)y * width, width, effect);
+		}
+		lines[0] = lines[1];
+		lines[1] = lines[2];
+		lines[2] = recycled;
+	}
+	if( !packed )
+		memset(dst->data + luma_size, 128, luma_size / 2);
+}
+
+static void __effect_point(camera_image_data_s *src, camera_attr_effect_mode_e effect, camera_image_data_s *dst){
+	_camera_effect_lut_s lut;
+	const unsigned char *packed[4];
+	unsigned int luma_size = (unsigned int)src->width * src->height;
+	unsigned int quarter = luma_size / 4;
+
+	__effect_build_lut(effect, &lut);
+	switch( src->format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+			__effect_lut_plane(src->data, dst->data, luma_size, lut.y);
+			__effect_lut_interleaved(src->data + luma_size, dst->data + luma_size, quarter, lut.u, lut.v);
+			break;
+		case CAMERA_PIXEL_FORMAT_NV21:
+			__effect_lut_plane(src->data, dst->data, luma_size, lut.y);
+			__effect_lut_interleaved(src->data + luma_size, dst->data + luma_size, quarter, lut.v, lut.u);
+			break;
+		case CAMERA_PIXEL_FORMAT_I420:
+			__effect_lut_plane(src->data, dst->data, luma_size, lut.y);
+			__effect_lut_plane(src->data + luma_size, dst->data + luma_size, quarter, lut.u);
+			__effect_lut_plane(src->data + luma_size + quarter, dst->data + luma_size + quarter, quarter, lut.v);
+			break;
+		case CAMERA_PIXEL_FORMAT_YV12:
+			__effect_lut_plane(src->data, dst->data, luma_size, lut.y);
+			__effect_lut_plane(src->data + luma_size, dst->data + luma_size, quarter, lut.v);
+			__effect_lut_plane(src->data + luma_size + quarter, dst->data + luma_size + quarter, quarter, lut.u);
+			break;
+		case CAMERA_PIXEL_FORMAT_YUYV:
+			packed[0] = lut.y;
+			packed[1] = lut.u;
+			packed[2] = lut.y;
+			packed[3] = lut.v;
+			__effect_lut_packed(src->data, dst->data, luma_size / 2, packed);
+			break;
+		case CAMERA_PIXEL_FORMAT_UYVY:
+		default:
+			packed[0] = lut.u;
+			packed[1] = lut.y;
+			packed[2] = lut.v;
+			packed[3] = lut.y;
+			__effect_lut_packed(src->data, dst->data, luma_size / 2, packed);
+			break;
+	}
+}
+
+bool _camera_image_is_effect_supported(camera_pixel_format_e format){
+	return _camera_image_is_transform_supported(format);
+}
+
+unsigned int _camera_image_effect_scratch_size(int width){
+	return (unsigned int)(width + 2) * 4;
+}
+
+int _camera_image_apply_effect(camera_image_data_s *src, camera_attr_effect_mode_e effect, unsigned char *scratch, camera_image_data_s *dst){
+	unsigned int size;
+
+	if( src == NULL || dst == NULL || dst->data == NULL || effect < CAMERA_ATTR_EFFECT_NONE || effect > CAMERA_ATTR_EFFECT_SKETCH )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( !_camera_image_is_effect_supported(src->format) || !_camera_image_is_valid(src) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	size = _camera_get_image_size(src->format, src->width, src->height);
+	if( dst->size < size )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	switch( effect ){
+		case CAMERA_ATTR_EFFECT_NONE:
+			if( dst->data != src->data )
+				memcpy(dst->data, src->data, size);
+			break;
+		case CAMERA_ATTR_EFFECT_EMBOSS:
+		case CAMERA_ATTR_EFFECT_OUTLINE:
+		case CAMERA_ATTR_EFFECT_SKETCH:
+			if( scratch == NULL )
+				return CAMERA_ERROR_INVALID_PARAMETER;
+			__effect_convolve(src, effect, scratch, dst);
+			break;
+		default:
+			__effect_point(src, effect, dst);
+			break;
+	}
+
+	dst->size = size;
+	dst->format = src->format;
+	dst->width = src->width;
+	dst->height = src->height;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_image_apply_effect(camera_image_data_s *image, camera_attr_effect_mode_e effect, camera_image_data_s *result){
+	camera_image_data_s dst;
+	unsigned int scratch_size;
+	int ret;
+
+	if( image == NULL || result == NULL || effect < CAMERA_ATTR_EFFECT_NONE || effect > CAMERA_ATTR_EFFECT_SKETCH ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	if( !_camera_image_is_effect_supported(image->format) || !_camera_image_is_valid(image) ){
+		LOGE( "[%s] unsupported image(format %d, %dx%d)",__func__, image->format, image->width, image->height);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	/* the line buffers live behind the image, one allocation per call */
+	dst.size = _camera_get_image_size(image->format, image->width, image->height);
+	scratch_size = _camera_image_effect_scratch_size(image->width);
+	dst.data = (unsigned char*)malloc(dst.size + scratch_size);
+	if( dst.data == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	ret = _camera_image_apply_effect(image, effect, dst.data + dst.size, &dst);
+	if( ret != CAMERA_ERROR_NONE ){
+		free(dst.data);
+		return ret;
+	}
+	*result = dst;
+	return CAMERA_ERROR_NONE;
+}
@@ -0,0 +1,494 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define EIS_USE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define EIS_USE_SSE2
+#endif
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+#define EIS_MAX_LEVELS 3
+#define EIS_MIN_LEVEL_SIZE 64
+#define EIS_BLOCK 16
+#define EIS_BLOCKS_X 8
+#define EIS_BLOCKS_Y 6
+/* search range at the coarsest level, +-2 around the upscaled estimate on the finer ones */
+#define EIS_SEARCH 6
+#define EIS_REFINE 2
+/* blocks with less gradient than this per pixel match anywhere and are left out */
+#define EIS_MIN_TEXTURE 3
+/* part of the frame kept in reserve on every side for the correction */
+#define EIS_MARGIN_PERCENT 8
+/* weight of the new position in the smoothed camera path, out of 256 */
+#define EIS_SMOOTHING 24
+/* the streaming thread waits this long for the motion estimate, then predicts it */
+#define EIS_DEADLINE_US 6000
+
+/*
+ * Software EIS : the global motion between consecutive preview frames is
+ * estimated by block matching on a half resolution luma pyramid, coarse to
+ * fine. The camera path is low pass filtered and every frame is cropped by
+ * the difference between the measured and the smoothed path, so the output
+ * is smaller than the stream by EIS_MARGIN_PERCENT on every side.
+ *
+ * The estimate runs on a worker thread. The streaming thread waits for it
+ * until EIS_DEADLINE_US and otherwise crops with the motion predicted from
+ * the last measured velocity, it does not queue frames behind a late one.
+ * Positions are in 1/256 pixels of the stream.
+ */
+struct _camera_eis_s {
+	GThreadPool *worker;
+	GMutex lock;
+	GCond cond;
+	bool busy;
+	int width;
+	int height;
+	camera_pixel_format_e format;
+	int levels;
+	int level_width[EIS_MAX_LEVELS];
+	int level_height[EIS_MAX_LEVELS];
+	unsigned char *pyramid[2][EIS_MAX_LEVELS];
+	unsigned char *pyramid_data;
+	int current;
+	bool has_previous;
+	unsigned int frame;
+	unsigned int previous_frame;
+	unsigned int job_frame;
+	int position_x;
+	int position_y;
+	int velocity_x;
+	int velocity_y;
+	int smooth_x;
+	int smooth_y;
+	unsigned int late;
+};
+
+bool _camera_eis_is_supported_format(camera_pixel_format_e format){
+	switch( format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV16:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+		case CAMERA_PIXEL_FORMAT_422P:
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/* size of the stabilized frame, the crop keeps 4:2:0 chroma aligned */
+void _camera_eis_get_output_size(int width, int height, int *out_width, int *out_height){
+	*out_width = (width - 2 * (width * EIS_MARGIN_PERCENT / 100)) & ~1;
+	*out_height = (height - 2 * (height * EIS_MARGIN_PERCENT / 100)) & ~1;
+}
+
+static int __clamp(int value, int min, int max){
+	return value < min ? min : value > max ? max : value;
+}
+
+/* 2x2 box average of the luma samples, step is 2 for packed 4:2:2 where every other byte is luma */
+static void __eis_reduce_row(const unsigned char *r0, const unsigned char *r1, int step, unsigned char *out, int width){
+	int x = 0;
+
+	if( step == 1 ){
+#if defined(EIS_USE_SSE2)
+		const __m128i mask = _mm_set1_epi16(0xff);
+		const __m128i two = _mm_set1_epi16(2);
+		for( ; x + 8 <= width ; x += 8 ){
+			__m128i a = _mm_loadu_si128((const __m128i*)(r0 + 2 * x));
+			__m128i b = _mm_loadu_si128((const __m128i*)(r1 + 2 * x));
+			__m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(a, mask), _mm_srli_epi16(a, 8)),
+										_mm_add_epi16(_mm_and_si128(b, mask), _mm_srli_epi16(b, 8)));
+			sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+			_mm_storel_epi64((__m128i*)(out + x), _mm_packus_epi16(sum, sum));
+		}
+#elif defined(EIS_USE_NEON)
+		for( ; x + 8 <= width ; x += 8 ){
+			uint16x8_t sum = vpaddlq_u8(vld1q_u8(r0 + 2 * x));
+			sum = vpadalq_u8(sum, vld1q_u8(r1 + 2 * x));
+			vst1_u8(out + x, vrshrn_n_u16(sum, 2));
+		}
+#endif
+	}
+	for( ; x < width ; x++ ){
+		int i = 2 * x * step;
+		out[x] = (r0[i] + r0[i + step] + r1[i] + r1[i + step] + 2) >> 2;
+	}
+}
+
+static void __eis_build_pyramid(camera_eis_s *eis, camera_image_data_s *frame, unsigned char *levels[]){
+	const unsigned char *luma = frame->data;
+	int stride = frame->width;
+	int step = 1;
+	int level;
+	int y;
+
+	if( frame->format == CAMERA_PIXEL_FORMAT_YUYV || frame->format == CAMERA_PIXEL_FORMAT_UYVY ){
+		step = 2;
+		stride = frame->width * 2;
+		if( frame->format == CAMERA_PIXEL_FORMAT_UYVY )
+			luma++;
+	}
+	for( level = 0 ; level < eis->levels ; level++ ){
+		int width = eis->level_width[level];
+		for( y = 0 ; y < eis->level_height[level] ; y++ )
+			__eis_reduce_row(luma + 2 * y * stride, luma + (2 * y + 1) * stride, step, levels[level] + y * width, width);
+		luma = levels[level];
+		stride = width;
+		step = 1;
+	}
+}
+
+static unsigned int __eis_sad16(const unsigned char *a, const unsigned char *b, int stride){
+	int y;
+#if defined(EIS_USE_SSE2)
+	__m128i acc = _mm_setzero_si128();
+	for( y = 0 ; y < EIS_BLOCK ; y++ ){
+		acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)a), _mm_loadu_si128((const __m128i*)b)));
+		a += stride;
+		b += stride;
+	}
+	return _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+#elif defined(EIS_USE_NEON)
+	uint16x8_t acc = vdupq_n_u16(0);
+	for( y = 0 ; y < EIS_BLOCK ; y++ ){
+		uint8x16_t va = vld1q_u8(a);
+		uint8x16_t vb = vld1q_u8(b);
+		acc = vabal_u8(acc, vget_low_u8(va), vget_low_u8(vb));
+		acc = vabal_u8(acc, vget_high_u8(va), vget_high_u8(vb));
+		a += stride;
+		b += stride;
+	}
+	uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(acc));
+	return (unsigned int)(vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1));
+#else
+	unsigned int sad = 0;
+	int x;
+	for( y = 0 ; y < EIS_BLOCK ; y++ ){
+		for( x = 0 ; x < EIS_BLOCK ; x++ )
+			sad += abs(a[x] - b[x]);
+		a += stride;
+		b += stride;
+	}
+	return sad;
+#endif
+}
+
+static bool __eis_is_textured(const unsigned char *block, int stride){
+	int gradient = 0;
+	int x;
+	int y;
+
+	for( y = 0 ; y < EIS_BLOCK - 1 ; y++ ){
+		const unsigned char *row = block + y * stride;
+		for( x = 0 ; x < EIS_BLOCK - 1 ; x++ )
+			gradient += abs(row[x + 1] - row[x]) + abs(row[x + stride] - row[x]);
+	}
+	return gradient >= EIS_MIN_TEXTURE * (EIS_BLOCK - 1) * (EIS_BLOCK - 1);
+}
+
+static int __eis_median(int *values, int count){
+	int i;
+	int j;
+
+	for( i = 1 ; i < count ; i++ ){
+		int v = values[i];
+		for( j = i ; j > 0 && values[j - 1] > v ; j-- )
+			values[j] = values[j - 1];
+		values[j] = v;
+	}
+	return values[count / 2];
+}
+
+/*
+ * Finds v so that cur(b) matches prev(b + v) for a grid of blocks around
+ * guess +- range, and returns the component wise median of the block vectors.
+ */
+static bool __eis_match_level(const unsigned char *cur, const unsigned char *prev, int width, int height, int range, int *vx, int *vy){
+	int found_x[EIS_BLOCKS_X * EIS_BLOCKS_Y];
+	int found_y[EIS_BLOCKS_X * EIS_BLOCKS_Y];
+	int reach_x = abs(*vx) + range;
+	int reach_y = abs(*vy) + range;
+	int columns = (width - 2 * reach_x) / EIS_BLOCK;
+	int rows = (height - 2 * reach_y) / EIS_BLOCK;
+	int count = 0;
+	int bx;
+	int by;
+
+	if( columns > EIS_BLOCKS_X )
+		columns = EIS_BLOCKS_X;
+	if( rows > EIS_BLOCKS_Y )
+		rows = EIS_BLOCKS_Y;
+	if( columns < 1 || rows < 1 )
+		return false;
+
+	for( by = 0 ; by < rows ; by++ ){
+		int y = reach_y + (height - 2 * reach_y - EIS_BLOCK) * (2 * by + 1) / (2 * rows);
+		for( bx = 0 ; bx < columns ; bx++ ){
+			int x = reach_x + (width - 2 * reach_x - EIS_BLOCK) * (2 * bx + 1) / (2 * columns);
+			const unsigned char *block = cur + y * width + x;
+			unsigned int best = 0xffffffff;
+			int best_x = 0;
+			int best_y = 0;
+			int dx;
+			int dy;
+
+			if( !__eis_is_textured(block, width) )
+				continue;
+			for( dy = *vy - range ; dy <= *vy + range ; dy++ ){
+				for( dx = *vx - range ; dx <= *vx + range ; dx++ ){
+					unsigned int sad = __eis_sad16(block, prev + (y + dy) * width + x + dx, width);
+					// prefer the smaller vector on ties, flat areas should not drift
+					if( sad < best || (sad == best && abs(dx) + abs(dy) < abs(best_x) + abs(best_y)) ){
+						best = sad;
+						best_x = dx;
+						best_y = dy;
+					}
+				}
+			}
+			found_x[count] = best_x;
+			found_y[count] = best_y;
+			count++;
+		}
+	}
+	if( count < 3 )
+		return false;
+	*vx = __eis_median(found_x, count);
+	*vy = __eis_median(found_y, count);
+	return true;
+}
+
+static void __eis_estimate(gpointer data, gpointer user_data){
+	camera_eis_s *eis = (camera_eis_s*)user_data;
+	unsigned char **cur = eis->pyramid[eis->current];
+	unsigned char **prev = eis->pyramid[!eis->current];
+	int level = eis->levels - 1;
+	int span;
+	bool found = true;
+	// the last velocity is the first guess, a steady pan stays inside the search range
+	int vx = -eis->velocity_x / (256 << eis->levels);
+	int vy = -eis->velocity_y / (256 << eis->levels);
+
+	for( ; level >= 0 ; level-- ){
+		int range = level == eis->levels - 1 ? EIS_SEARCH : EIS_REFINE;
+		if( !__eis_match_level(cur[level], prev[level], eis->level_width[level], eis->level_height[level], range, &vx, &vy) ){
+			found = false;
+			break;
+		}
+		if( level > 0 ){
+			vx *= 2;
+			vy *= 2;
+		}
+	}
+
+	g_mutex_lock(&eis->lock);
+	span = eis->job_frame - eis->previous_frame;
+	if( found ){
+		// level 0 is half resolution and content moves opposite to the match vector
+		eis->position_x += -vx * 2 * 256;
+		eis->position_y += -vy * 2 * 256;
+		eis->velocity_x = -vx * 2 * 256 / span;
+		eis->velocity_y = -vy * 2 * 256 / span;
+	}else{
+		// nothing to match against, keep the camera where the prediction puts it
+		eis->position_x += eis->velocity_x * span;
+		eis->position_y += eis->velocity_y * span;
+	}
+	eis->previous_frame = eis->job_frame;
+	eis->current = !eis->current;
+	eis->busy = false;
+	g_cond_broadcast(&eis->cond);
+	g_mutex_unlock(&eis->lock);
+}
+
+int _camera_eis_create(camera_eis_s **eis){
+	camera_eis_s *handle;
+
+	if( eis == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	handle = (camera_eis_s*)calloc(1, sizeof(camera_eis_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	g_mutex_init(&handle->lock);
+	g_cond_init(&handle->cond);
+	handle->worker = g_thread_pool_new(__eis_estimate, handle, 1, TRUE, NULL);
+	if( handle->worker == NULL ){
+		LOGE("[%s] thread pool creation fail",__func__);
+		g_cond_clear(&handle->cond);
+		g_mutex_clear(&handle->lock);
+		free(handle);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	*eis = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_eis_destroy(camera_eis_s *eis){
+	if( eis == NULL )
+		return;
+
+	// waits for a late estimate
+	g_thread_pool_free(eis->worker, FALSE, TRUE);
+	if( eis->frame > 0 )
+		LOGI("[%s] %u frames, %u estimated late",__func__, eis->frame, eis->late);
+	free(eis->pyramid_data);
+	g_cond_clear(&eis->cond);
+	g_mutex_clear(&eis->lock);
+	free(eis);
+}
+
+/* called with the lock held and no estimate running */
+static int __eis_reset(camera_eis_s *eis, camera_image_data_s *frame){
+	unsigned int size = 0;
+	unsigned char *data;
+	int width = frame->width / 2;
+	int height = frame->height / 2;
+	int level;
+	int i;
+
+	for( level = 0 ; level < EIS_MAX_LEVELS ; level++ ){
+		if( level > 0 && (width < EIS_MIN_LEVEL_SIZE || height < EIS_MIN_LEVEL_SIZE) )
+			break;
+		eis->level_width[level] = width;
+		eis->level_height[level] = height;
+		size += width * height;
+		width /= 2;
+		height /= 2;
+	}
+	eis->levels = level;
+
+	data = (unsigned char*)realloc(eis->pyramid_data, size * 2);
+	if( data == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	eis->pyramid_data = data;
+	for( i = 0 ; i < 2 ; i++ ){
+		for( level = 0 ; level < eis->levels ; level++ ){
+			eis->pyramid[i][level] = data;
+			data += eis->level_width[level] * eis->level_height[level];
+		}
+	}
+
+	eis->width = frame->width;
+	eis->height = frame->height;
+	eis->format = frame->format;
+	eis->has_previous = false;
+	eis->position_x = 0;
+	eis->position_y = 0;
+	eis->velocity_x = 0;
+	eis->velocity_y = 0;
+	eis->smooth_x = 0;
+	eis->smooth_y = 0;
+	return CAMERA_ERROR_NONE;
+}
+
+/*
+ * Stabilizes frame into dst, dst->data has to hold the output size given by
+ * _camera_eis_get_output_size. Runs on the streaming thread.
+ */
+int _camera_eis_process(camera_eis_s *eis, camera_image_data_s *frame, camera_image_data_s *dst){
+	int out_width;
+	int out_height;
+	int margin_x;
+	int margin_y;
+	int position_x;
+	int position_y;
+	int offset_x;
+	int offset_y;
+	bool launched = false;
+
+	if( eis == NULL || frame == NULL || dst == NULL || !_camera_eis_is_supported_format(frame->format) || !_camera_image_is_valid(frame) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( frame->width < 4 * EIS_MIN_LEVEL_SIZE || frame->height < 4 * EIS_MIN_LEVEL_SIZE )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&eis->lock);
+	if( frame->width != eis->width || frame->height != eis->height || frame->format != eis->format ){
+		while( eis->busy )
+			g_cond_wait(&eis->cond, &eis->lock);
+		if( __eis_reset(eis, frame) != CAMERA_ERROR_NONE ){
+			g_mutex_unlock(&eis->lock);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	eis->frame++;
+	if( !eis->busy ){
+		// the worker is idle, so the current pyramid is not in use
+		g_mutex_unlock(&eis->lock);
+		__eis_build_pyramid(eis, frame, eis->pyramid[eis->current]);
+		g_mutex_lock(&eis->lock);
+		if( eis->has_previous ){
+			eis->busy = true;
+			eis->job_frame = eis->frame;
+			g_thread_pool_push(eis->worker, eis, NULL);
+			launched = true;
+		}else{
+			eis->has_previous = true;
+			eis->previous_frame = eis->frame;
+			eis->current = !eis->current;
+		}
+	}
+	if( launched ){
+		gint64 deadline = g_get_monotonic_time() + EIS_DEADLINE_US;
+		while( eis->busy ){
+			if( !g_cond_wait_until(&eis->cond, &eis->lock, deadline) )
+				break;
+		}
+		if( eis->busy )
+			eis->late++;
+	}
+
+	position_x = eis->position_x + eis->velocity_x * (int)(eis->frame - eis->previous_frame);
+	position_y = eis->position_y + eis->velocity_y * (int)(eis->frame - eis->previous_frame);
+	eis->smooth_x += (position_x - eis->smooth_x) * EIS_SMOOTHING / 256;
+	eis->smooth_y += (position_y - eis->smooth_y) * EIS_SMOOTHING / 256;
+
+	_camera_eis_get_output_size(frame->width, frame->height, &out_width, &out_height);
+	margin_x = (frame->width - out_width) / 2;
+	margin_y = (frame->height - out_height) / 2;
+	// the smoothed path is dragged along when the correction runs out of margin
+	eis->smooth_x = __clamp(eis->smooth_x, position_x - margin_x * 256, position_x + margin_x * 256);
+	eis->smooth_y = __clamp(eis->smooth_y, position_y - margin_y * 256, position_y + margin_y * 256);
+	offset_x = (position_x - eis->smooth_x) / 256;
+	offset_y = (position_y - eis->smooth_y) / 256;
+	g_mutex_unlock(&eis->lock);
+
+	offset_x = (margin_x + offset_x) & ~1;
+	offset_y = (margin_y + offset_y) & ~1;
+	return _camera_image_crop(frame, __clamp(offset_x, 0, frame->width - out_width), __clamp(offset_y, 0, frame->height - out_height), out_width, out_height, dst);
+}
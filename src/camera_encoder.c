@@ -0,0 +1,394 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* largest number of access units waiting to be polled */
+#define ENCODER_MAX_QUEUE_SIZE 256
+
+/*
+ * Preview encoder tap : the preview frames are handed to the encoder on the
+ * streaming thread, straight from the camcorder buffer, so no frame is ever
+ * copied. The access units the encoder puts out are copied once into a ring
+ * of pooled slots, which the application drains with
+ * camera_preview_encoder_poll(). The slot just before the head of the ring
+ * is lent to the application until its next poll, the encoder never writes
+ * there. A full ring is emptied rather than wrapped : the units left would
+ * not decode without the dropped ones, so the following units are given up
+ * as well until the encoder puts out a key frame.
+ */
+typedef struct {
+	camera_image_buffer_s buffer;
+	camera_encoded_unit_s unit;
+} _camera_encoder_slot_s;
+
+struct _camera_encoder_tap_s {
+	GMutex encode_lock;
+	camera_preview_encoder_s encoder;
+	void *encoder_user_data;
+	void *instance;
+	int width;
+	int height;
+	camera_pixel_format_e format;
+	bool running;
+
+	GMutex lock;
+	GCond available;
+	_camera_encoder_slot_s *slots;
+	int slot_count;
+	int head;
+	int count;
+	bool waiting_key_frame;
+	bool key_frame_requested;
+	bool discontinuity;
+
+	camera_preview_encoder_statistics_s statistics;
+	long long total_lag;
+	long long total_encode_time;
+	long long total_queue_delay;
+	unsigned int polled_units;
+};
+
+static void __encoder_queue_clear(camera_encoder_tap_s *tap){
+	tap->statistics.dropped_units += tap->count;
+	tap->count = 0;
+}
+
+/* output function handed to the encoder, only called from within its encode and close functions */
+static void __encoder_output(const unsigned char *data, unsigned int size, long long pts, bool key_frame, void *context){
+	camera_encoder_tap_s *tap = (camera_encoder_tap_s*)context;
+	long long now = g_get_monotonic_time();
+	_camera_encoder_slot_s *slot;
+	int lag;
+
+	if( tap == NULL || data == NULL || size == 0 )
+		return;
+
+	g_mutex_lock(&tap->lock);
+	lag = (int)CLAMP(now - pts, 0, INT_MAX);
+	tap->statistics.units++;
+	tap->statistics.last_lag = lag;
+	tap->statistics.largest_lag = MAX(tap->statistics.largest_lag, lag);
+	tap->total_lag += lag;
+	tap->statistics.mean_lag = (int)(tap->total_lag / tap->statistics.units);
+
+	if( tap->count == tap->slot_count - 1 ){
+		// the poller stalls, whatever is queued is useless without the units given up
+		LOGE("[%s] queue overflow, %d units given up",__func__, tap->count);
+		__encoder_queue_clear(tap);
+		tap->discontinuity = true;
+		if( !key_frame ){
+			tap->waiting_key_frame = true;
+			tap->key_frame_requested = true;
+		}
+	}
+	if( tap->waiting_key_frame && !key_frame ){
+		tap->statistics.dropped_units++;
+		g_mutex_unlock(&tap->lock);
+		return;
+	}
+	tap->waiting_key_frame = false;
+	slot = &tap->slots[(tap->head + tap->count) % tap->slot_count];
+	g_mutex_unlock(&tap->lock);
+
+	// the slot is past the tail, the poller does not look at it yet
+	if( _camera_image_buffer_reserve(&slot->buffer, size) != CAMERA_ERROR_NONE ){
+		LOGE("[%s] malloc fail",__func__);
+		g_mutex_lock(&tap->lock);
+		tap->statistics.dropped_units++;
+		tap->waiting_key_frame = true;
+		tap->key_frame_requested = true;
+		tap->discontinuity = true;
+		g_mutex_unlock(&tap->lock);
+		return;
+	}
+	memcpy(slot->buffer.data, data, size);
+	slot->unit.data = slot->buffer.data;
+	slot->unit.size = size;
+	slot->unit.pts = pts;
+	slot->unit.queued = now;
+	slot->unit.key_frame = key_frame;
+
+	g_mutex_lock(&tap->lock);
+	slot->unit.discontinuity = tap->discontinuity;
+	tap->discontinuity = false;
+	tap->count++;
+	tap->statistics.queued_units = tap->count;
+	g_cond_signal(&tap->available);
+	g_mutex_unlock(&tap->lock);
+}
+
+/* drains and closes the encoder instance, called with encode_lock held */
+static void __encoder_close(camera_encoder_tap_s *tap){
+	void *instance = tap->instance;
+
+	if( instance == NULL )
+		return;
+	tap->encoder.close(instance, __encoder_output, tap);
+	tap->instance = NULL;
+}
+
+int _camera_encoder_tap_create(camera_encoder_tap_s **tap){
+	camera_encoder_tap_s *handle;
+
+	if( tap == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	handle = (camera_encoder_tap_s*)calloc(1, sizeof(camera_encoder_tap_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	g_mutex_init(&handle->encode_lock);
+	g_mutex_init(&handle->lock);
+	g_cond_init(&handle->available);
+	*tap = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_encoder_tap_destroy(camera_encoder_tap_s *tap){
+	int i;
+
+	if( tap == NULL )
+		return;
+
+	_camera_encoder_tap_stop(tap);
+	for( i = 0 ; i < tap->slot_count ; i++ )
+		_camera_image_buffer_release(&tap->slots[i].buffer);
+	free(tap->slots);
+	g_cond_clear(&tap->available);
+	g_mutex_clear(&tap->lock);
+	g_mutex_clear(&tap->encode_lock);
+	free(tap);
+}
+
+bool _camera_encoder_tap_is_running(camera_encoder_tap_s *tap){
+	bool running;
+
+	if( tap == NULL )
+		return false;
+	g_mutex_lock(&tap->lock);
+	running = tap->running;
+	g_mutex_unlock(&tap->lock);
+	return running;
+}
+
+int _camera_encoder_tap_start(camera_encoder_tap_s *tap, const camera_preview_encoder_s *encoder, void *user_data, int queue_size){
+	_camera_encoder_slot_s *slots = NULL;
+	int i;
+
+	if( tap == NULL || encoder == NULL || encoder->open == NULL || encoder->encode == NULL || encoder->close == NULL ||
+		queue_size < 1 || queue_size > ENCODER_MAX_QUEUE_SIZE )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&tap->encode_lock);
+	if( tap->running ){
+		g_mutex_unlock(&tap->encode_lock);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	// one more slot than units queued, for the unit lent to the poller
+	if( tap->slot_count != queue_size + 1 ){
+		slots = (_camera_encoder_slot_s*)calloc(queue_size + 1, sizeof(_camera_encoder_slot_s));
+		if( slots == NULL ){
+			LOGE("[%s] malloc fail",__func__);
+			g_mutex_unlock(&tap->encode_lock);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+	}
+
+	g_mutex_lock(&tap->lock);
+	if( slots ){
+		for( i = 0 ; i < tap->slot_count ; i++ )
+			_camera_image_buffer_release(&tap->slots[i].buffer);
+		free(tap->slots);
+		tap->slots = slots;
+		tap->slot_count = queue_size + 1;
+	}
+	tap->head = 0;
+	tap->count = 0;
+	tap->waiting_key_frame = false;
+	tap->key_frame_requested = false;
+	tap->discontinuity = false;
+	memset(&tap->statistics, 0, sizeof(tap->statistics));
+	tap->total_lag = 0;
+	tap->total_encode_time = 0;
+	tap->total_queue_delay = 0;
+	tap->polled_units = 0;
+	tap->running = true;
+	g_mutex_unlock(&tap->lock);
+
+	tap->encoder = *encoder;
+	tap->encoder_user_data = user_data;
+	tap->instance = NULL;
+	g_mutex_unlock(&tap->encode_lock);
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_encoder_tap_stop(camera_encoder_tap_s *tap){
+	if( tap == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	// waits for a frame being encoded, the units the encoder still holds are queued
+	g_mutex_lock(&tap->encode_lock);
+	__encoder_close(tap);
+	g_mutex_lock(&tap->lock);
+	tap->running = false;
+	g_cond_broadcast(&tap->available);
+	g_mutex_unlock(&tap->lock);
+	g_mutex_unlock(&tap->encode_lock);
+	return CAMERA_ERROR_NONE;
+}
+
+/*
+ * Encodes a preview frame in place. Runs on the streaming thread, the encoder
+ * is opened on the first frame and opened again when the frame size changes.
+ */
+int _camera_encoder_tap_push(camera_encoder_tap_s *tap, camera_image_data_s *frame){
+	long long pts = g_get_monotonic_time();
+	long long encoded;
+	bool request_key_frame;
+	int ret;
+
+	if( tap == NULL || frame == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&tap->encode_lock);
+	if( !tap->running ){
+		g_mutex_unlock(&tap->encode_lock);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	if( tap->instance && (tap->width != frame->width || tap->height != frame->height || tap->format != frame->format) ){
+		__encoder_close(tap);
+		g_mutex_lock(&tap->lock);
+		tap->discontinuity = true;
+		g_mutex_unlock(&tap->lock);
+	}
+	if( tap->instance == NULL ){
+		ret = tap->encoder.open(frame->width, frame->height, frame->format, tap->encoder_user_data, &tap->instance);
+		if( ret != CAMERA_ERROR_NONE || tap->instance == NULL ){
+			// the encoder does not take these frames, do not try on every frame
+			LOGE("[%s] encoder open fail(0x%08x) for %dx%d format %d",__func__, ret, frame->width, frame->height, frame->format);
+			tap->instance = NULL;
+			g_mutex_lock(&tap->lock);
+			tap->running = false;
+			g_cond_broadcast(&tap->available);
+			g_mutex_unlock(&tap->lock);
+			g_mutex_unlock(&tap->encode_lock);
+			return ret != CAMERA_ERROR_NONE ? ret : CAMERA_ERROR_INVALID_OPERATION;
+		}
+		tap->width = frame->width;
+		tap->height = frame->height;
+		tap->format = frame->format;
+	}
+
+	g_mutex_lock(&tap->lock);
+	request_key_frame = tap->key_frame_requested;
+	tap->key_frame_requested = false;
+	g_mutex_unlock(&tap->lock);
+	// the encoder is asked outside of its output function, which must not call back into it
+	if( request_key_frame && tap->encoder.request_key_frame )
+		tap->encoder.request_key_frame(tap->instance);
+
+	ret = tap->encoder.encode(tap->instance, frame, pts, __encoder_output, tap);
+	encoded = g_get_monotonic_time();
+
+	g_mutex_lock(&tap->lock);
+	tap->statistics.frames++;
+	tap->total_encode_time += encoded - pts;
+	tap->statistics.mean_encode_time = (int)(tap->total_encode_time / tap->statistics.frames);
+	if( ret != CAMERA_ERROR_NONE )
+		tap->statistics.failed_frames++;
+	g_mutex_unlock(&tap->lock);
+	g_mutex_unlock(&tap->encode_lock);
+	return ret;
+}
+
+int _camera_encoder_tap_poll(camera_encoder_tap_s *tap, int timeout, camera_encoded_unit_s *unit){
+	gint64 end_time = g_get_monotonic_time() + (gint64)timeout * 1000;
+	_camera_encoder_slot_s *slot;
+	int delay;
+
+	if( tap == NULL || unit == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&tap->lock);
+	// the slot lent on the last poll is behind the head now, the encoder may fill it again
+	while( tap->count == 0 && tap->running && timeout != 0 ){
+		if( timeout < 0 )
+			g_cond_wait(&tap->available, &tap->lock);
+		else if( !g_cond_wait_until(&tap->available, &tap->lock, end_time) )
+			break;
+	}
+	if( tap->count == 0 ){
+		bool running = tap->running;
+		g_mutex_unlock(&tap->lock);
+		memset(unit, 0, sizeof(camera_encoded_unit_s));
+		return running ? CAMERA_ERROR_NONE : CAMERA_ERROR_INVALID_STATE;
+	}
+
+	slot = &tap->slots[tap->head];
+	tap->head = (tap->head + 1) % tap->slot_count;
+	tap->count--;
+	tap->statistics.queued_units = tap->count;
+	delay = (int)CLAMP(g_get_monotonic_time() - slot->unit.queued, 0, INT_MAX);
+	tap->polled_units++;
+	tap->total_queue_delay += delay;
+	tap->statistics.last_queue_delay = delay;
+	tap->statistics.mean_queue_delay = (int)(tap->total_queue_delay / tap->polled_units);
+	*unit = slot->unit;
+	g_mutex_unlock(&tap->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_encoder_tap_get_statistics(camera_encoder_tap_s *tap, camera_preview_encoder_statistics_s *statistics){
+	if( statistics == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	if( tap == NULL ){
+		memset(statistics, 0, sizeof(camera_preview_encoder_statistics_s));
+		return CAMERA_ERROR_NONE;
+	}
+	g_mutex_lock(&tap->lock);
+	*statistics = tap->statistics;
+	g_mutex_unlock(&tap->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+/* how full the queue is in percent, 0 when the tap is not running */
+int _camera_encoder_tap_get_queue_level(camera_encoder_tap_s *tap){
+	int level = 0;
+
+	if( tap == NULL )
+		return 0;
+	g_mutex_lock(&tap->lock);
+	if( tap->running && tap->slot_count > 1 )
+		level = tap->count * 100 / (tap->slot_count - 1);
+	g_mutex_unlock(&tap->lock);
+	return level;
+}
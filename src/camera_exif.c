@@ -0,0 +1,478 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/*
+ * The EXIF block is updated without touching the existing TIFF data : the new
+ * IFD0 (and GPS IFD) are appended after it and the TIFF header is pointed at the
+ * new IFD0. Every offset already stored in the block stays valid, so maker notes,
+ * sub IFDs and the embedded thumbnail survive untouched, and the output JPEG is
+ * assembled with a single allocation (the IFD tables live on the stack).
+ */
+
+#define EXIF_HEADER_SIZE 6
+#define EXIF_MAX_SEGMENT 65535
+#define EXIF_MAX_ENTRIES 128
+#define EXIF_NEW_ENTRIES 8
+
+#define EXIF_TYPE_BYTE 1
+#define EXIF_TYPE_ASCII 2
+#define EXIF_TYPE_SHORT 3
+#define EXIF_TYPE_LONG 4
+#define EXIF_TYPE_RATIONAL 5
+#define EXIF_TYPE_SRATIONAL 10
+
+#define EXIF_TAG_IMAGE_DESCRIPTION 0x010e
+#define EXIF_TAG_ORIENTATION 0x0112
+#define EXIF_TAG_SOFTWARE 0x0131
+#define EXIF_TAG_EXIF_IFD 0x8769
+#define EXIF_TAG_GPS_IFD 0x8825
+#define EXIF_TAG_EXPOSURE_BIAS 0x9204
+#define EXIF_TAG_GPS_VERSION 0x0000
+#define EXIF_TAG_GPS_LATITUDE_REF 0x0001
+#define EXIF_TAG_GPS_LATITUDE 0x0002
+#define EXIF_TAG_GPS_LONGITUDE_REF 0x0003
+#define EXIF_TAG_GPS_LONGITUDE 0x0004
+#define EXIF_TAG_GPS_ALTITUDE_REF 0x0005
+#define EXIF_TAG_GPS_ALTITUDE 0x0006
+
+static const unsigned char __exif_header[EXIF_HEADER_SIZE] = { 'E', 'x', 'i', 'f', 0, 0 };
+
+typedef struct {
+	unsigned short tag;
+	unsigned short type;
+	unsigned int count;
+	const unsigned char *raw;		/* entry copied from the old IFD as is */
+	unsigned char value[24];		/* new entry value, already in file byte order */
+	const unsigned char *ext;		/* new entry value kept outside (strings) */
+	unsigned int size;
+} _camera_exif_entry_s;
+
+typedef struct {
+	_camera_exif_entry_s entries[EXIF_MAX_ENTRIES + EXIF_NEW_ENTRIES];
+	int count;
+	unsigned int next_ifd;
+} _camera_exif_ifd_s;
+
+typedef struct {
+	bool big_endian;
+	const unsigned char *tiff;
+	unsigned int tiff_size;
+} _camera_exif_tiff_s;
+
+
+static unsigned int __read16(const _camera_exif_tiff_s *t, const unsigned char *p){
+	return t->big_endian ? (p[0] << 8) | p[1] : p[0] | (p[1] << 8);
+}
+
+static unsigned int __read32(const _camera_exif_tiff_s *t, const unsigned char *p){
+	return t->big_endian ? ((unsigned int)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]
+		: p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static void __write16(const _camera_exif_tiff_s *t, unsigned char *p, unsigned int v){
+	if( t->big_endian ){
+		p[0] = v >> 8;
+		p[1] = v;
+	}else{
+		p[0] = v;
+		p[1] = v >> 8;
+	}
+}
+
+static void __write32(const _camera_exif_tiff_s *t, unsigned char *p, unsigned int v){
+	if( t->big_endian ){
+		p[0] = v >> 24;
+		p[1] = v >> 16;
+		p[2] = v >> 8;
+		p[3] = v;
+	}else{
+		p[0] = v;
+		p[1] = v >> 8;
+		p[2] = v >> 16;
+		p[3] = v >> 24;
+	}
+}
+
+static int __read_ifd(const _camera_exif_tiff_s *t, unsigned int offset, _camera_exif_ifd_s *ifd){
+	unsigned int count;
+	unsigned int i;
+
+	ifd->count = 0;
+	ifd->next_ifd = 0;
+	if( offset == 0 )
+		return 0;
+	if( offset < 8 || offset > t->tiff_size - 2 )
+		return -1;
+	count = __read16(t, t->tiff + offset);
+	if( count > EXIF_MAX_ENTRIES || offset + 2 + count * 12 + 4 > t->tiff_size )
+		return -1;
+	for( i = 0 ; i < count ; i++ ){
+		const unsigned char *raw = t->tiff + offset + 2 + i * 12;
+		_camera_exif_entry_s *entry = &ifd->entries[ifd->count++];
+		memset(entry, 0, sizeof(_camera_exif_entry_s));
+		entry->tag = __read16(t, raw);
+		entry->raw = raw;
+	}
+	ifd->next_ifd = __read32(t, t->tiff + offset + 2 + count * 12);
+	return 0;
+}
+
+static unsigned int __find_long(const _camera_exif_tiff_s *t, _camera_exif_ifd_s *ifd, unsigned short tag){
+	int i;
+	for( i = 0 ; i < ifd->count ; i++ ){
+		if( ifd->entries[i].tag == tag && ifd->entries[i].raw && __read16(t, ifd->entries[i].raw + 2) == EXIF_TYPE_LONG )
+			return __read32(t, ifd->entries[i].raw + 8);
+	}
+	return 0;
+}
+
+/* replaces the entry with the same tag or adds it, keeping the IFD sorted by tag */
+static _camera_exif_entry_s *__set_entry(_camera_exif_ifd_s *ifd, unsigned short tag, unsigned short type, unsigned int count){
+	_camera_exif_entry_s *entry = NULL;
+	int i;
+
+	for( i = 0 ; i < ifd->count ; i++ ){
+		if( ifd->entries[i].tag == tag ){
+			entry = &ifd->entries[i];
+			break;
+		}
+	}
+	if( entry == NULL ){
+		for( i = ifd->count ; i > 0 && ifd->entries[i - 1].tag > tag ; i-- )
+			ifd->entries[i] = ifd->entries[i - 1];
+		entry = &ifd->entries[i];
+		ifd->count++;
+	}
+	memset(entry, 0, sizeof(_camera_exif_entry_s));
+	entry->tag = tag;
+	entry->type = type;
+	entry->count = count;
+	return entry;
+}
+
+static void __set_ascii(_camera_exif_ifd_s *ifd, unsigned short tag, const char *value){
+	unsigned int size = strlen(value) + 1;
+	_camera_exif_entry_s *entry = __set_entry(ifd, tag, EXIF_TYPE_ASCII, size);
+	entry->size = size;
+	if( size <= 4 )
+		memcpy(entry->value, value, size);
+	else
+		entry->ext = (const unsigned char*)value;
+}
+
+static void __set_rationals(const _camera_exif_tiff_s *t, _camera_exif_ifd_s *ifd, unsigned short tag, const unsigned int *values, int count){
+	_camera_exif_entry_s *entry = __set_entry(ifd, tag, EXIF_TYPE_RATIONAL, count);
+	int i;
+	for( i = 0 ; i < count * 2 ; i++ )
+		__write32(t, entry->value + i * 4, values[i]);
+	entry->size = count * 8;
+}
+
+static void __set_degrees(const _camera_exif_tiff_s *t, _camera_exif_ifd_s *ifd, unsigned short tag, double degrees){
+	unsigned int values[6];
+	double minutes;
+
+	degrees = fabs(degrees);
+	values[0] = (unsigned int)degrees;
+	values[1] = 1;
+	minutes = (degrees - values[0]) * 60.0;
+	values[2] = (unsigned int)minutes;
+	values[3] = 1;
+	values[4] = (unsigned int)((minutes - values[2]) * 60.0 * 1000.0 + 0.5);
+	values[5] = 1000;
+	__set_rationals(t, ifd, tag, values, 3);
+}
+
+static unsigned int __ifd_size(_camera_exif_ifd_s *ifd){
+	unsigned int size = 2 + ifd->count * 12 + 4;
+	int i;
+	for( i = 0 ; i < ifd->count ; i++ ){
+		if( ifd->entries[i].raw == NULL && ifd->entries[i].size > 4 )
+			size += (ifd->entries[i].size + 1) & ~1;
+	}
+	return size;
+}
+
+/* writes the IFD at tiff + offset, out of line values follow the entries */
+static void __write_ifd(const _camera_exif_tiff_s *t, unsigned char *tiff, unsigned int offset, _camera_exif_ifd_s *ifd){
+	unsigned char *p = tiff + offset;
+	unsigned int data_offset = offset + 2 + ifd->count * 12 + 4;
+	int i;
+
+	__write16(t, p, ifd->count);
+	p += 2;
+	for( i = 0 ; i < ifd->count ; i++, p += 12 ){
+		_camera_exif_entry_s *entry = &ifd->entries[i];
+		if( entry->raw ){
+			memcpy(p, entry->raw, 12);
+			continue;
+		}
+		__write16(t, p, entry->tag);
+		__write16(t, p + 2, entry->type);
+		__write32(t, p + 4, entry->count);
+		memset(p + 8, 0, 4);
+		if( entry->size <= 4 ){
+			memcpy(p + 8, entry->value, entry->size);
+		}else{
+			__write32(t, p + 8, data_offset);
+			memcpy(tiff + data_offset, entry->ext ? entry->ext : entry->value, entry->size);
+			if( entry->size & 1 )
+				tiff[data_offset + entry->size] = 0;
+			data_offset += (entry->size + 1) & ~1;
+		}
+	}
+	__write32(t, p, ifd->next_ifd);
+}
+
+/* finds the Exif APP1 segment and the position a new one would be inserted at */
+static int __find_app1(const unsigned char *jpeg, unsigned int size, unsigned int *insert_pos, unsigned int *app1_pos, unsigned int *app1_size){
+	unsigned int pos = 2;
+
+	if( size < 4 || jpeg[0] != 0xff || jpeg[1] != 0xd8 )
+		return -1;
+
+	*insert_pos = 2;
+	*app1_pos = 0;
+	*app1_size = 0;
+	while( pos + 4 <= size ){
+		unsigned char marker;
+		unsigned int length;
+
+		if( jpeg[pos] != 0xff )
+			return -1;
+		marker = jpeg[pos + 1];
+		if( marker == 0xff ){
+			pos++;
+			continue;
+		}
+		/* image data starts, no more metadata segments */
+		if( marker == 0xda || marker == 0xd9 )
+			break;
+		length = (jpeg[pos + 2] << 8) | jpeg[pos + 3];
+		if( length < 2 || pos + 2 + length > size )
+			return -1;
+		if( marker == 0xe1 && length >= 2 + EXIF_HEADER_SIZE + 8 && memcmp(jpeg + pos + 4, __exif_header, EXIF_HEADER_SIZE) == 0 ){
+			*app1_pos = pos;
+			*app1_size = 2 + length;
+			return 0;
+		}
+		/* keep JFIF APP0 first */
+		if( marker == 0xe0 && pos == *insert_pos )
+			*insert_pos = pos + 2 + length;
+		pos += 2 + length;
+	}
+	return 0;
+}
+
+int camera_image_update_exif(camera_image_data_s *image, const camera_exif_info_s *info, camera_image_data_s *updated){
+	/* empty little endian TIFF used when the JPEG has no EXIF yet */
+	static const unsigned char empty_tiff[8] = { 'I', 'I', 0x2a, 0, 0, 0, 0, 0 };
+	_camera_exif_ifd_s ifd0_data;
+	_camera_exif_ifd_s gps_data;
+	_camera_exif_ifd_s *ifd0 = &ifd0_data;
+	_camera_exif_ifd_s *gps = &gps_data;
+	_camera_exif_tiff_s t;
+	unsigned int insert_pos = 0;
+	unsigned int app1_pos = 0;
+	unsigned int app1_size = 0;
+	unsigned int gps_offset = 0;
+	unsigned int ifd0_offset;
+	unsigned int tiff_size;
+	unsigned int segment_size;
+	unsigned int out_size;
+	unsigned int head;
+	unsigned char *out;
+	unsigned char *p;
+
+	if( image == NULL || image->data == NULL || info == NULL || updated == NULL || image->format != CAMERA_PIXEL_FORMAT_JPEG ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	if( info->set_orientation && (info->orientation < CAMERA_ATTR_TAG_ORIENTATION_TOP_LEFT || info->orientation > CAMERA_ATTR_TAG_ORIENTATION_LEFT_BOTTOM) ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	if( __find_app1(image->data, image->size, &insert_pos, &app1_pos, &app1_size) != 0 ){
+		LOGE("[%s] not a valid JPEG stream",__func__);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	if( app1_size ){
+		t.tiff = image->data + app1_pos + 4 + EXIF_HEADER_SIZE;
+		t.tiff_size = app1_size - 4 - EXIF_HEADER_SIZE;
+	}else{
+		t.tiff = empty_tiff;
+		t.tiff_size = sizeof(empty_tiff);
+	}
+	if( t.tiff[0] == 'I' && t.tiff[1] == 'I' )
+		t.big_endian = false;
+	else if( t.tiff[0] == 'M' && t.tiff[1] == 'M' )
+		t.big_endian = true;
+	else
+		return CAMERA_ERROR_INVALID_OPERATION;
+	if( __read16(&t, t.tiff + 2) != 0x2a )
+		return CAMERA_ERROR_INVALID_OPERATION;
+
+	if( __read_ifd(&t, __read32(&t, t.tiff + 4), ifd0) != 0 ){
+		LOGE("[%s] corrupted IFD0",__func__);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	if( info->set_orientation ){
+		_camera_exif_entry_s *entry = __set_entry(ifd0, EXIF_TAG_ORIENTATION, EXIF_TYPE_SHORT, 1);
+		__write16(&t, entry->value, info->orientation);
+		entry->size = 2;
+	}
+	if( info->software )
+		__set_ascii(ifd0, EXIF_TAG_SOFTWARE, info->software);
+	if( info->image_description )
+		__set_ascii(ifd0, EXIF_TAG_IMAGE_DESCRIPTION, info->image_description);
+
+	/* the GPS IFD is placed right after the old TIFF data, IFD0 after it */
+	tiff_size = (t.tiff_size + 1) & ~1;
+	if( info->set_geotag ){
+		unsigned int altitude[2];
+		_camera_exif_entry_s *entry;
+
+		if( __read_ifd(&t, __find_long(&t, ifd0, EXIF_TAG_GPS_IFD), gps) != 0 )
+			gps->count = 0;
+		gps->next_ifd = 0;
+		entry = __set_entry(gps, EXIF_TAG_GPS_VERSION, EXIF_TYPE_BYTE, 4);
+		entry->value[0] = 2;
+		entry->value[1] = 2;
+		entry->size = 4;
+		__set_ascii(gps, EXIF_TAG_GPS_LATITUDE_REF, info->latitude < 0 ? "S" : "N");
+		__set_degrees(&t, gps, EXIF_TAG_GPS_LATITUDE, info->latitude);
+		__set_ascii(gps, EXIF_TAG_GPS_LONGITUDE_REF, info->longitude < 0 ? "W" : "E");
+		__set_degrees(&t, gps, EXIF_TAG_GPS_LONGITUDE, info->longitude);
+		entry = __set_entry(gps, EXIF_TAG_GPS_ALTITUDE_REF, EXIF_TYPE_BYTE, 1);
+		entry->value[0] = info->altitude < 0 ? 1 : 0;
+		entry->size = 1;
+		altitude[0] = (unsigned int)(fabs(info->altitude) * 100.0 + 0.5);
+		altitude[1] = 100;
+		__set_rationals(&t, gps, EXIF_TAG_GPS_ALTITUDE, altitude, 1);
+
+		gps_offset = tiff_size;
+		tiff_size += __ifd_size(gps);
+		entry = __set_entry(ifd0, EXIF_TAG_GPS_IFD, EXIF_TYPE_LONG, 1);
+		__write32(&t, entry->value, gps_offset);
+		entry->size = 4;
+	}
+	ifd0_offset = tiff_size;
+	tiff_size += __ifd_size(ifd0);
+
+	segment_size = 4 + EXIF_HEADER_SIZE + tiff_size;
+	if( segment_size - 2 > EXIF_MAX_SEGMENT ){
+		LOGE("[%s] EXIF segment too large(%u)",__func__, segment_size);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	head = app1_size ? app1_pos : insert_pos;
+	out_size = image->size - app1_size + segment_size;
+	out = (unsigned char*)malloc(out_size);
+	if( out == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+
+	memcpy(out, image->data, head);
+	p = out + head;
+	p[0] = 0xff;
+	p[1] = 0xe1;
+	p[2] = (segment_size - 2) >> 8;
+	p[3] = (segment_size - 2) & 0xff;
+	memcpy(p + 4, __exif_header, EXIF_HEADER_SIZE);
+	p += 4 + EXIF_HEADER_SIZE;
+	memcpy(p, t.tiff, t.tiff_size);
+	if( t.tiff_size & 1 )
+		p[t.tiff_size] = 0;
+	if( gps_offset )
+		__write_ifd(&t, p, gps_offset, gps);
+	__write_ifd(&t, p, ifd0_offset, ifd0);
+	__write32(&t, p + 4, ifd0_offset);
+	memcpy(out + head + segment_size, image->data + head + app1_size, image->size - head - app1_size);
+
+	*updated = *image;
+	updated->data = out;
+	updated->size = out_size;
+	return CAMERA_ERROR_NONE;
+}
+
+/* the exposure bias the sensor recorded for the shot, in 1/100 EV */
+bool _camera_exif_get_exposure_bias(const camera_image_data_s *image, int *bias){
+	_camera_exif_ifd_s ifd_data;
+	_camera_exif_ifd_s *ifd = &ifd_data;
+	_camera_exif_tiff_s t;
+	unsigned int insert_pos = 0;
+	unsigned int app1_pos = 0;
+	unsigned int app1_size = 0;
+	int i;
+
+	if( image == NULL || image->data == NULL || bias == NULL || image->format != CAMERA_PIXEL_FORMAT_JPEG )
+		return false;
+	if( __find_app1(image->data, image->size, &insert_pos, &app1_pos, &app1_size) != 0 || app1_size == 0 )
+		return false;
+
+	t.tiff = image->data + app1_pos + 4 + EXIF_HEADER_SIZE;
+	t.tiff_size = app1_size - 4 - EXIF_HEADER_SIZE;
+	if( t.tiff[0] == 'I' && t.tiff[1] == 'I' )
+		t.big_endian = false;
+	else if( t.tiff[0] == 'M' && t.tiff[1] == 'M' )
+		t.big_endian = true;
+	else
+		return false;
+	if( __read16(&t, t.tiff + 2) != 0x2a )
+		return false;
+
+	if( __read_ifd(&t, __read32(&t, t.tiff + 4), ifd) != 0 )
+		return false;
+	if( __read_ifd(&t, __find_long(&t, ifd, EXIF_TAG_EXIF_IFD), ifd) != 0 )
+		return false;
+	for( i = 0 ; i < ifd->count ; i++ ){
+		const unsigned char *raw = ifd->entries[i].raw;
+		unsigned int offset;
+		int numerator;
+		int denominator;
+
+		if( ifd->entries[i].tag != EXIF_TAG_EXPOSURE_BIAS || __read16(&t, raw + 2) != EXIF_TYPE_SRATIONAL )
+			continue;
+		offset = __read32(&t, raw + 8);
+		if( offset < 8 || offset > t.tiff_size - 8 )
+			return false;
+		numerator = (int)__read32(&t, t.tiff + offset);
+		denominator = (int)__read32(&t, t.tiff + offset + 4);
+		if( denominator <= 0 )
+			return false;
+		*bias = (int)((long long)numerator * 100 / denominator);
+		return true;
+	}
+	return false;
+}
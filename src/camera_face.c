@@ -0,0 +1,318 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* a detection continues a track when their boxes overlap at least this much, out of 256 */
+#define FACE_MIN_IOU 77
+/* a new track is reported from its second detection on, single false positives are not */
+#define FACE_MIN_HITS 2
+/* a track keeps being reported at its last place for this many updates without a detection */
+#define FACE_MAX_COAST 3
+/* and is dropped after this many */
+#define FACE_MAX_MISSES 8
+/* weight of the detection in the smoothed box, out of 256, for a perfect and for no overlap */
+#define FACE_SMOOTHING_STILL 80
+#define FACE_SMOOTHING_MOVING 208
+
+/*
+ * Face tracker : the detections of a frame are associated to the tracks of
+ * the previous ones by box overlap (IoU), best pairs first. Matched tracks
+ * move their box towards the detection with an exponential moving average
+ * whose weight grows with the motion, so still faces do not jitter and
+ * moving ones do not lag. Tracks hand out their own ids, which stay the
+ * same as long as the face is followed, whatever the device reports.
+ * Boxes are kept in 1/256 pixels.
+ */
+typedef struct {
+	int id;
+	int x;
+	int y;
+	int width;
+	int height;
+	int score;
+	int hits;
+	int misses;
+	bool reported;
+} _camera_face_track_s;
+
+typedef struct {
+	int iou;
+	int track;
+	int detection;
+} _camera_face_pair_s;
+
+struct _camera_face_tracker_s {
+	GMutex lock;
+	_camera_face_track_s *tracks;
+	int count;
+	int capacity;
+	_camera_face_pair_s *pairs;
+	int pair_capacity;
+	bool *matched;
+	int matched_capacity;
+	int next_id;
+	bool changed;
+};
+
+int _camera_face_tracker_create(camera_face_tracker_s **tracker){
+	camera_face_tracker_s *handle;
+
+	if( tracker == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	handle = (camera_face_tracker_s*)calloc(1, sizeof(camera_face_tracker_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	g_mutex_init(&handle->lock);
+	handle->next_id = 1;
+	*tracker = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_face_tracker_destroy(camera_face_tracker_s *tracker){
+	if( tracker == NULL )
+		return;
+	g_mutex_clear(&tracker->lock);
+	free(tracker->tracks);
+	free(tracker->pairs);
+	free(tracker->matched);
+	free(tracker);
+}
+
+/* ids keep counting up across resets, a stale id never names a new face */
+void _camera_face_tracker_reset(camera_face_tracker_s *tracker){
+	if( tracker == NULL )
+		return;
+	g_mutex_lock(&tracker->lock);
+	tracker->count = 0;
+	tracker->changed = false;
+	g_mutex_unlock(&tracker->lock);
+}
+
+static int __face_iou(const _camera_face_track_s *track, const camera_detected_face_s *face){
+	long long x0 = MAX(track->x, face->x * 256);
+	long long y0 = MAX(track->y, face->y * 256);
+	long long x1 = MIN(track->x + track->width, (face->x + face->width) * 256);
+	long long y1 = MIN(track->y + track->height, (face->y + face->height) * 256);
+	long long overlap;
+	long long total;
+
+	if( x1 <= x0 || y1 <= y0 )
+		return 0;
+	overlap = (x1 - x0) * (y1 - y0);
+	total = (long long)track->width * track->height + (long long)face->width * face->height * 65536 - overlap;
+	if( total <= 0 )
+		return 0;
+	return (int)(overlap * 256 / total);
+}
+
+static int __face_pair_compare(const void *a, const void *b){
+	return ((const _camera_face_pair_s*)b)->iou - ((const _camera_face_pair_s*)a)->iou;
+}
+
+static bool __face_reserve(void **data, int *capacity, int count, size_t size){
+	void *grown;
+	int new_capacity;
+
+	if( count <= *capacity )
+		return true;
+	if( count > INT_MAX / 2 ){
+		LOGE("[%s] %d entries are too many",__func__, count);
+		return false;
+	}
+	new_capacity = *capacity > 0 ? *capacity : 16;
+	while( new_capacity < count )
+		new_capacity *= 2;
+	grown = realloc(*data, new_capacity * size);
+	if( grown == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return false;
+	}
+	*data = grown;
+	*capacity = new_capacity;
+	return true;
+}
+
+static void __face_smooth(_camera_face_track_s *track, const camera_detected_face_s *face, int iou){
+	int weight = FACE_SMOOTHING_MOVING - (FACE_SMOOTHING_MOVING - FACE_SMOOTHING_STILL) * iou / 256;
+
+	track->x += (int)(((long long)face->x * 256 - track->x) * weight / 256);
+	track->y += (int)(((long long)face->y * 256 - track->y) * weight / 256);
+	track->width += (int)(((long long)face->width * 256 - track->width) * weight / 256);
+	track->height += (int)(((long long)face->height * 256 - track->height) * weight / 256);
+	track->score += (int)(((long long)face->score - track->score) * weight / 256);
+}
+
+/*
+ * Feeds the detections of one frame. Returns true when the reported faces
+ * changed, the caller delivers them with _camera_face_tracker_get_faces.
+ */
+bool _camera_face_tracker_update(camera_face_tracker_s *tracker, const camera_detected_face_s *faces, int count){
+	bool *matched = NULL;
+	int pairs = 0;
+	int tracks;
+	bool changed;
+	int i;
+	int j;
+
+	if( tracker == NULL || (faces == NULL && count > 0) || count < 0 )
+		return false;
+
+	g_mutex_lock(&tracker->lock);
+	tracks = tracker->count;
+	if( count > 0 ){
+		// the buffers are kept from one update to the next, they only grow with the crowd
+		if( count > INT_MAX - tracks || !__face_reserve((void**)&tracker->matched, &tracker->matched_capacity, count + tracks, sizeof(bool)) ||
+			!__face_reserve((void**)&tracker->tracks, &tracker->capacity, tracks + count, sizeof(_camera_face_track_s)) ){
+			g_mutex_unlock(&tracker->lock);
+			return false;
+		}
+		matched = tracker->matched;
+		memset(matched, 0, (count + tracks) * sizeof(bool));
+		for( i = 0 ; i < tracks ; i++ ){
+			for( j = 0 ; j < count ; j++ ){
+				int iou = __face_iou(&tracker->tracks[i], &faces[j]);
+				// only overlapping pairs are kept, a face rarely overlaps more than one track
+				if( iou >= FACE_MIN_IOU && __face_reserve((void**)&tracker->pairs, &tracker->pair_capacity, pairs + 1, sizeof(_camera_face_pair_s)) ){
+					tracker->pairs[pairs].iou = iou;
+					tracker->pairs[pairs].track = i;
+					tracker->pairs[pairs].detection = j;
+					pairs++;
+				}
+			}
+		}
+		if( pairs > 1 )
+			qsort(tracker->pairs, pairs, sizeof(_camera_face_pair_s), __face_pair_compare);
+	}
+
+	// greedy association, the best overlapping pairs are taken first
+	for( i = 0 ; i < pairs ; i++ ){
+		_camera_face_pair_s *pair = &tracker->pairs[i];
+		if( matched[count + pair->track] || matched[pair->detection] )
+			continue;
+		matched[count + pair->track] = true;
+		matched[pair->detection] = true;
+		__face_smooth(&tracker->tracks[pair->track], &faces[pair->detection], pair->iou);
+		tracker->tracks[pair->track].hits++;
+		tracker->tracks[pair->track].misses = 0;
+	}
+
+	changed = pairs > 0;
+	for( i = 0 ; i < tracks ; i++ ){
+		if( matched == NULL || !matched[count + i] ){
+			tracker->tracks[i].misses++;
+			if( tracker->tracks[i].reported && tracker->tracks[i].misses == FACE_MAX_COAST + 1 )
+				changed = true;
+		}
+	}
+	for( j = 0 ; j < count ; j++ ){
+		_camera_face_track_s *track;
+		if( matched[j] )
+			continue;
+		track = &tracker->tracks[tracker->count++];
+		track->id = tracker->next_id++;
+		if( tracker->next_id <= 0 )
+			tracker->next_id = 1;
+		track->x = faces[j].x * 256;
+		track->y = faces[j].y * 256;
+		track->width = faces[j].width * 256;
+		track->height = faces[j].height * 256;
+		track->score = faces[j].score;
+		track->hits = 1;
+		track->misses = 0;
+		track->reported = false;
+	}
+
+	// drop lost tracks, keeping the order so that ids are reported in a stable order
+	for( i = 0, j = 0 ; i < tracker->count ; i++ ){
+		if( tracker->tracks[i].misses > FACE_MAX_MISSES )
+			continue;
+		if( tracker->tracks[i].hits >= FACE_MIN_HITS && tracker->tracks[i].misses <= FACE_MAX_COAST && !tracker->tracks[i].reported ){
+			tracker->tracks[i].reported = true;
+			changed = true;
+		}
+		tracker->tracks[j++] = tracker->tracks[i];
+	}
+	tracker->count = j;
+	tracker->changed |= changed;
+	changed = tracker->changed;
+	g_mutex_unlock(&tracker->lock);
+	return changed;
+}
+
+static void __face_to_detected(const _camera_face_track_s *track, camera_detected_face_s *face){
+	face->id = track->id;
+	face->score = track->score;
+	face->x = (track->x + 128) >> 8;
+	face->y = (track->y + 128) >> 8;
+	face->width = (track->width + 128) >> 8;
+	face->height = (track->height + 128) >> 8;
+}
+
+/* copies up to max of the reported faces, returns how many there are */
+int _camera_face_tracker_get_faces(camera_face_tracker_s *tracker, camera_detected_face_s *faces, int max){
+	int count = 0;
+	int i;
+
+	if( tracker == NULL )
+		return 0;
+	g_mutex_lock(&tracker->lock);
+	for( i = 0 ; i < tracker->count ; i++ ){
+		const _camera_face_track_s *track = &tracker->tracks[i];
+		if( !track->reported || track->misses > FACE_MAX_COAST )
+			continue;
+		if( count < max )
+			__face_to_detected(track, &faces[count]);
+		count++;
+	}
+	tracker->changed = false;
+	g_mutex_unlock(&tracker->lock);
+	return count;
+}
+
+/* the smoothed box of a followed face, also while it is briefly not detected */
+bool _camera_face_tracker_get_face(camera_face_tracker_s *tracker, int id, camera_detected_face_s *face){
+	bool found = false;
+	int i;
+
+	if( tracker == NULL || face == NULL )
+		return false;
+	g_mutex_lock(&tracker->lock);
+	for( i = 0 ; i < tracker->count ; i++ ){
+		if( tracker->tracks[i].id == id && tracker->tracks[i].reported ){
+			__face_to_detected(&tracker->tracks[i], face);
+			found = true;
+			break;
+		}
+	}
+	g_mutex_unlock(&tracker->lock);
+	return found;
+}
@@ -0,0 +1,2240 @@
+/*
+*    Stump-based 20x20 gentle adaboost frontal face detector.
+*    Created by Rainer Lienhart.
+*
+*  IMPORTANT: READ BEFORE DOWNLOADING, COPYING, INSTALLING OR USING.
+*
+*  By downloading, copying, installing or using the software you agree to this license.
+*  If you do not agree to this license, do not download, install,
+*  copy or use the software.
+*
+*                        Intel License Agreement
+*                For Open Source Computer Vision Library
+*
+* Copyright (C) 2000, Intel Corporation, all rights reserved.
+* Third party copyrights are property of their respective owners.
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistribution's of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*
+*   * Redistribution's in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer in the documentation
+*     and/or other materials provided with the distribution.
+*
+*   * The name of Intel Corporation may not be used to endorse or promote products
+*     derived from this software without specific prior written permission.
+*
+* This software is provided by the copyright holders and contributors "as is" and
+* any express or implied warranties, including, but not limited to, the implied
+* warranties of merchantability and fitness for a particular purpose are disclaimed.
+* In no event shall the Intel Corporation or contributors be liable for any direct,
+* indirect, incidental, special, exemplary, or consequential damages
+* (including, but not limited to, procurement of substitute goods or services;
+* loss of use, data, or profits; or business interruption) however caused
+* and on any theory of liability, whether in contract, strict liability,
+* or tort (including negligence or otherwise) arising in any way out of
+* the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#include <camera.h>
+#include <camera_private.h>
+
+/*
+ * The trained frontal face cascade of OpenCV, haarcascade_frontalface_alt.xml :
+ * a stump based 20x20 gentle adaboost cascade by Rainer Lienhart. The stumps of
+ * every stage follow each other, a stump carries its feature with the weight of
+ * every rectangle, the threshold on the normalized feature value and the value
+ * it adds to the stage sum below and above the threshold.
+ */
+
+const _camera_face_stage_s _camera_face_stages[] = {
+	{ 3, 0.822689414f },
+	{ 16, 6.95660877f },
+	{ 21, 9.49854279f },
+	{ 39, 18.4129696f },
+	{ 33, 15.3241396f },
+	{ 44, 21.0106392f },
+	{ 50, 23.9187908f },
+	{ 51, 24.5278797f },
+	{ 56, 27.1533508f },
+	{ 71, 34.5541115f },
+	{ 80, 39.1072884f },
+	{ 103, 50.6104813f },
+	{ 111, 54.6200714f },
+	{ 102, 50.1697311f },
+	{ 135, 66.6691208f },
+	{ 137, 67.6989212f },
+	{ 140, 69.2298737f },
+	{ 160, 79.2490768f },
+	{ 177, 87.6960297f },
+	{ 182, 90.2533493f },
+	{ 211, 104.749199f },
+	{ 213, 105.761101f },
+};
+
+const _camera_face_stump_s _camera_face_stumps[] = {
+	/* stage 0 */
+	{ { { 3, 7, 14, 4, -1 }, { 3, 9, 14, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00401419587f, 0.0337941907f, 0.837810695f },
+	{ { { 1, 2, 18, 4, -1 }, { 7, 2, 6, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0151513396f, 0.151413202f, 0.748881221f },
+	{ { { 1, 7, 15, 9, -1 }, { 1, 10, 15, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00421099318f, 0.0900492817f, 0.637481987f },
+	/* stage 1 */
+	{ { { 5, 6, 2, 6, -1 }, { 5, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00162271096f, 0.0693085864f, 0.711094618f },
+	{ { { 7, 5, 6, 3, -1 }, { 9, 5, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00229066494f, 0.179580301f, 0.666869223f },
+	{ { { 4, 0, 12, 9, -1 }, { 4, 3, 12, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0050025708f, 0.169367298f, 0.655400693f },
+	{ { { 6, 9, 10, 8, -1 }, { 6, 13, 10, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00796598941f, 0.586633205f, 0.0914145187f },
+	{ { { 3, 6, 14, 8, -1 }, { 3, 10, 14, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0035227011f, 0.141316697f, 0.603189588f },
+	{ { { 14, 1, 6, 10, -1 }, { 14, 1, 3, 10, 2 }, { 0, 0, 0, 0, 0 } }, 0.0366676897f, 0.367567211f, 0.792031825f },
+	{ { { 7, 8, 5, 12, -1 }, { 7, 12, 5, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00933614746f, 0.616138577f, 0.208850995f },
+	{ { { 1, 1, 18, 3, -1 }, { 7, 1, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00869613141f, 0.283623099f, 0.636027396f },
+	{ { { 1, 8, 17, 2, -1 }, { 1, 9, 17, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00114888803f, 0.222358093f, 0.580070078f },
+	{ { { 16, 6, 4, 2, -1 }, { 16, 7, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00214846898f, 0.240646407f, 0.57870549f },
+	{ { { 5, 17, 2, 2, -1 }, { 5, 18, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00212190603f, 0.555965483f, 0.136223704f },
+	{ { { 14, 2, 6, 12, -1 }, { 14, 2, 3, 12, 2 }, { 0, 0, 0, 0, 0 } }, -0.0939491466f, 0.850273728f, 0.471774012f },
+	{ { { 4, 0, 4, 12, -1 }, { 4, 0, 2, 6, 2 }, { 6, 6, 2, 6, 2 } }, 0.00137777894f, 0.59936738f, 0.283452988f },
+	{ { { 2, 11, 18, 8, -1 }, { 8, 11, 6, 8, 3 }, { 0, 0, 0, 0, 0 } }, 0.0730631575f, 0.434188604f, 0.706003428f },
+	{ { { 5, 7, 10, 2, -1 }, { 5, 8, 10, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0003676739f, 0.302788794f, 0.605157495f },
+	{ { { 15, 11, 5, 3, -1 }, { 15, 12, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00604797108f, 0.179843396f, 0.567525685f },
+	/* stage 2 */
+	{ { { 5, 3, 10, 9, -1 }, { 5, 6, 10, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0165106896f, 0.664422512f, 0.142485797f },
+	{ { { 9, 4, 2, 14, -1 }, { 9, 11, 2, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.00270524994f, 0.632535219f, 0.128847703f },
+	{ { { 3, 5, 4, 12, -1 }, { 3, 9, 4, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00280698691f, 0.124028802f, 0.61931932f },
+	{ { { 4, 5, 12, 5, -1 }, { 8, 5, 4, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00154024002f, 0.1432143f, 0.567001581f },
+	{ { { 5, 6, 10, 8, -1 }, { 5, 10, 10, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000563862792f, 0.165743306f, 0.590520799f },
+	{ { { 8, 0, 6, 9, -1 }, { 8, 3, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00192537298f, 0.269550711f, 0.573882401f },
+	{ { { 9, 12, 1, 8, -1 }, { 9, 16, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0050214841f, 0.189353898f, 0.578277409f },
+	{ { { 0, 7, 20, 6, -1 }, { 0, 9, 20, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00263654208f, 0.230932906f, 0.569542587f },
+	{ { { 7, 0, 6, 17, -1 }, { 9, 0, 2, 17, 3 }, { 0, 0, 0, 0, 0 } }, -0.00151277694f, 0.275960207f, 0.595664203f },
+	{ { { 9, 0, 6, 4, -1 }, { 11, 0, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0101574399f, 0.173253804f, 0.552204728f },
+	{ { { 5, 1, 6, 4, -1 }, { 7, 1, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0119536603f, 0.133940995f, 0.555901408f },
+	{ { { 12, 1, 6, 16, -1 }, { 14, 1, 2, 16, 3 }, { 0, 0, 0, 0, 0 } }, 0.00488594919f, 0.362870395f, 0.618884921f },
+	{ { { 0, 5, 18, 8, -1 }, { 0, 5, 9, 4, 2 }, { 9, 9, 9, 4, 2 } }, -0.0801329166f, 0.0912110507f, 0.547594488f },
+	{ { { 8, 15, 10, 4, -1 }, { 13, 15, 5, 2, 2 }, { 8, 17, 5, 2, 2 } }, 0.00106432801f, 0.371514291f, 0.571139991f },
+	{ { { 3, 1, 4, 8, -1 }, { 3, 1, 2, 4, 2 }, { 5, 5, 2, 4, 2 } }, -0.00134194503f, 0.595331371f, 0.331809789f },
+	{ { { 3, 6, 14, 10, -1 }, { 10, 6, 7, 5, 2 }, { 3, 11, 7, 5, 2 } }, -0.0546011403f, 0.184406593f, 0.560284615f },
+	{ { { 2, 1, 6, 16, -1 }, { 4, 1, 2, 16, 3 }, { 0, 0, 0, 0, 0 } }, 0.00290716905f, 0.359424412f, 0.613171518f },
+	{ { { 0, 18, 20, 2, -1 }, { 0, 19, 20, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00074718718f, 0.599435329f, 0.345956296f },
+	{ { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00430138083f, 0.417265207f, 0.69908452f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00450175721f, 0.450971514f, 0.780145705f },
+	{ { { 0, 12, 9, 6, -1 }, { 0, 14, 9, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0241385009f, 0.543821275f, 0.131982699f },
+	/* stage 3 */
+	{ { { 5, 7, 3, 4, -1 }, { 5, 9, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00192122301f, 0.141526699f, 0.619987071f },
+	{ { { 9, 3, 2, 16, -1 }, { 9, 11, 2, 8, 2 }, { 0, 0, 0, 0, 0 } }, -0.000127486695f, 0.619107425f, 0.188492894f },
+	{ { { 3, 6, 13, 8, -1 }, { 3, 10, 13, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000514099316f, 0.148739696f, 0.58579278f },
+	{ { { 12, 3, 8, 2, -1 }, { 12, 3, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00418786099f, 0.274690986f, 0.635923982f },
+	{ { { 8, 8, 4, 12, -1 }, { 8, 12, 4, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00510157179f, 0.587085128f, 0.217562899f },
+	{ { { 11, 3, 8, 6, -1 }, { 15, 3, 4, 3, 2 }, { 11, 6, 4, 3, 2 } }, -0.00214484404f, 0.588094473f, 0.297959089f },
+	{ { { 7, 1, 6, 19, -1 }, { 9, 1, 2, 19, 3 }, { 0, 0, 0, 0, 0 } }, -0.00289771194f, 0.237332702f, 0.587664723f },
+	{ { { 9, 0, 6, 4, -1 }, { 11, 0, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0216106791f, 0.122065499f, 0.519420207f },
+	{ { { 3, 1, 9, 3, -1 }, { 6, 1, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00462993188f, 0.263123095f, 0.581740916f },
+	{ { { 8, 15, 10, 4, -1 }, { 13, 15, 5, 2, 2 }, { 8, 17, 5, 2, 2 } }, 0.000593937119f, 0.363862008f, 0.569854498f },
+	{ { { 0, 3, 6, 10, -1 }, { 3, 3, 3, 10, 2 }, { 0, 0, 0, 0, 0 } }, 0.0538786612f, 0.430353105f, 0.755936623f },
+	{ { { 3, 4, 15, 15, -1 }, { 3, 9, 15, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.00188873499f, 0.212260306f, 0.561342716f },
+	{ { { 6, 5, 8, 6, -1 }, { 6, 7, 8, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00236353395f, 0.563184917f, 0.264276713f },
+	{ { { 4, 4, 12, 10, -1 }, { 10, 4, 6, 5, 2 }, { 4, 9, 6, 5, 2 } }, 0.0240177996f, 0.579710782f, 0.275170594f },
+	{ { { 6, 4, 4, 4, -1 }, { 8, 4, 2, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000205430304f, 0.270524204f, 0.575256884f },
+	{ { { 15, 11, 1, 2, -1 }, { 15, 12, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000847901974f, 0.543562472f, 0.233487695f },
+	{ { { 3, 11, 2, 2, -1 }, { 3, 12, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00140913296f, 0.531942487f, 0.206315503f },
+	{ { { 16, 11, 1, 3, -1 }, { 16, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00146426295f, 0.541898072f, 0.306886107f },
+	{ { { 3, 15, 6, 4, -1 }, { 3, 15, 3, 2, 2 }, { 6, 17, 3, 2, 2 } }, 0.00163525494f, 0.369537294f, 0.611286819f },
+	{ { { 6, 7, 8, 2, -1 }, { 6, 8, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000831727521f, 0.356503695f, 0.602523625f },
+	{ { { 3, 11, 1, 3, -1 }, { 3, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0020998891f, 0.191398203f, 0.536282718f },
+	{ { { 6, 0, 12, 2, -1 }, { 6, 1, 12, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000742139819f, 0.383555502f, 0.552931011f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00326550496f, 0.431289613f, 0.710189581f },
+	{ { { 7, 15, 6, 2, -1 }, { 7, 16, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000891349919f, 0.398483098f, 0.639196396f },
+	{ { { 0, 5, 4, 6, -1 }, { 0, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0152841797f, 0.236673295f, 0.543371379f },
+	{ { { 4, 12, 12, 2, -1 }, { 8, 12, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00483814115f, 0.581750095f, 0.323918909f },
+	{ { { 6, 3, 1, 9, -1 }, { 6, 6, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.000910931791f, 0.554059386f, 0.291186899f },
+	{ { { 10, 17, 3, 2, -1 }, { 11, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00612750603f, 0.177525505f, 0.519662917f },
+	{ { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000445762591f, 0.30241701f, 0.553359389f },
+	{ { { 7, 6, 6, 4, -1 }, { 9, 6, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0226465408f, 0.441493094f, 0.69753772f },
+	{ { { 7, 17, 3, 2, -1 }, { 8, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00188049604f, 0.279139489f, 0.54979521f },
+	{ { { 10, 17, 3, 3, -1 }, { 11, 17, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00708891079f, 0.526319921f, 0.238554701f },
+	{ { { 8, 12, 3, 2, -1 }, { 8, 13, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00173180504f, 0.431937903f, 0.698360085f },
+	{ { { 9, 3, 6, 2, -1 }, { 11, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00684827007f, 0.308204293f, 0.539092004f },
+	{ { { 3, 11, 14, 4, -1 }, { 3, 13, 14, 2, 2 }, { 0, 0, 0, 0, 0 } }, -1.50625301e-05f, 0.552192211f, 0.312036604f },
+	{ { { 1, 10, 18, 4, -1 }, { 10, 10, 9, 2, 2 }, { 1, 12, 9, 2, 2 } }, 0.0294755697f, 0.540132284f, 0.177060306f },
+	{ { { 0, 10, 3, 3, -1 }, { 0, 11, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00813873298f, 0.517861784f, 0.121101901f },
+	{ { { 9, 1, 6, 6, -1 }, { 11, 1, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.0209429506f, 0.529029429f, 0.33112219f },
+	{ { { 8, 7, 3, 6, -1 }, { 9, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.00956655294f, 0.747199416f, 0.445196897f },
+	/* stage 4 */
+	{ { { 1, 0, 18, 9, -1 }, { 1, 3, 18, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00028206961f, 0.206408605f, 0.607673228f },
+	{ { { 12, 10, 2, 6, -1 }, { 12, 13, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00167906005f, 0.585199714f, 0.125538394f },
+	{ { { 0, 5, 19, 8, -1 }, { 0, 9, 19, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000698279124f, 0.0940184295f, 0.572896123f },
+	{ { { 7, 0, 6, 9, -1 }, { 9, 0, 2, 9, 3 }, { 0, 0, 0, 0, 0 } }, 0.000789590122f, 0.178198799f, 0.569430888f },
+	{ { { 5, 3, 6, 1, -1 }, { 7, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00285604992f, 0.163839906f, 0.578866482f },
+	{ { { 11, 3, 6, 1, -1 }, { 13, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00381224696f, 0.208544001f, 0.550856471f },
+	{ { { 5, 10, 4, 6, -1 }, { 5, 13, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00158966205f, 0.570276082f, 0.185721502f },
+	{ { { 11, 3, 6, 1, -1 }, { 13, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0100783398f, 0.511694312f, 0.218977004f },
+	{ { { 4, 4, 12, 6, -1 }, { 4, 6, 12, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0635263026f, 0.713137984f, 0.404381305f },
+	{ { { 15, 12, 2, 6, -1 }, { 15, 14, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00910314918f, 0.256718189f, 0.546397328f },
+	{ { { 9, 3, 2, 2, -1 }, { 10, 3, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00240350002f, 0.170066595f, 0.559097409f },
+	{ { { 9, 3, 3, 1, -1 }, { 10, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00152263604f, 0.541055679f, 0.261905402f },
+	{ { { 1, 1, 4, 14, -1 }, { 3, 1, 2, 14, 2 }, { 0, 0, 0, 0, 0 } }, 0.01799744f, 0.37324369f, 0.653522074f },
+	{ { { 9, 0, 4, 4, -1 }, { 11, 0, 2, 2, 2 }, { 9, 2, 2, 2, 2 } }, -0.00645381911f, 0.262648195f, 0.553744614f },
+	{ { { 7, 5, 1, 14, -1 }, { 7, 12, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0118807601f, 0.200375393f, 0.554474592f },
+	{ { { 19, 0, 1, 4, -1 }, { 19, 2, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00127136603f, 0.559190273f, 0.303197592f },
+	{ { { 5, 5, 6, 4, -1 }, { 8, 5, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00113761099f, 0.273040712f, 0.564650893f },
+	{ { { 9, 18, 3, 2, -1 }, { 10, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00426519988f, 0.140590906f, 0.546182096f },
+	{ { { 8, 18, 3, 2, -1 }, { 9, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0029602861f, 0.1795035f, 0.545929015f },
+	{ { { 4, 5, 12, 6, -1 }, { 4, 7, 12, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00884482265f, 0.573678315f, 0.280921996f },
+	{ { { 3, 12, 2, 6, -1 }, { 3, 14, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00664306898f, 0.237067595f, 0.550382614f },
+	{ { { 10, 8, 2, 12, -1 }, { 10, 12, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00399978086f, 0.560819983f, 0.330428213f },
+	{ { { 7, 18, 3, 2, -1 }, { 8, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00412217202f, 0.164010599f, 0.537899315f },
+	{ { { 9, 0, 6, 2, -1 }, { 11, 0, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0156249097f, 0.522764921f, 0.228860393f },
+	{ { { 5, 11, 9, 3, -1 }, { 5, 12, 9, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0103564197f, 0.701619387f, 0.42529279f },
+	{ { { 9, 0, 6, 2, -1 }, { 11, 0, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00879608095f, 0.27673471f, 0.535583019f },
+	{ { { 1, 1, 18, 5, -1 }, { 7, 1, 6, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.162269399f, 0.43422401f, 0.744257927f },
+	{ { { 8, 0, 4, 4, -1 }, { 10, 0, 2, 2, 2 }, { 8, 2, 2, 2, 2 } }, 0.00455425307f, 0.572648585f, 0.258212507f },
+	{ { { 3, 12, 1, 3, -1 }, { 3, 13, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.002130921f, 0.210684806f, 0.536101878f },
+	{ { { 8, 14, 5, 3, -1 }, { 8, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.01320842f, 0.759379089f, 0.455246806f },
+	{ { { 5, 4, 10, 12, -1 }, { 5, 4, 5, 6, 2 }, { 10, 10, 5, 6, 2 } }, -0.0659966767f, 0.125247598f, 0.53440398f },
+	{ { { 9, 6, 9, 12, -1 }, { 9, 10, 9, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00791426562f, 0.331538409f, 0.560104311f },
+	{ { { 2, 2, 12, 14, -1 }, { 2, 2, 6, 7, 2 }, { 8, 9, 6, 7, 2 } }, 0.0208942797f, 0.550604999f, 0.276883811f },
+	/* stage 5 */
+	{ { { 4, 7, 12, 2, -1 }, { 8, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00119611598f, 0.176269099f, 0.61562413f },
+	{ { { 7, 4, 6, 4, -1 }, { 7, 6, 6, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00186798302f, 0.611810684f, 0.183239996f },
+	{ { { 4, 5, 11, 8, -1 }, { 4, 9, 11, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000195797998f, 0.0990442634f, 0.572381616f },
+	{ { { 3, 10, 16, 4, -1 }, { 3, 12, 16, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000802556577f, 0.557987988f, 0.237728298f },
+	{ { { 0, 0, 16, 2, -1 }, { 0, 1, 16, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00245108106f, 0.223145798f, 0.585893512f },
+	{ { { 7, 5, 6, 2, -1 }, { 9, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000503618503f, 0.265399396f, 0.579410374f },
+	{ { { 3, 2, 6, 10, -1 }, { 3, 2, 3, 5, 2 }, { 6, 7, 3, 5, 2 } }, 0.00402933499f, 0.580382705f, 0.248486504f },
+	{ { { 10, 5, 8, 15, -1 }, { 10, 10, 8, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0144517096f, 0.183035195f, 0.548420489f },
+	{ { { 3, 14, 8, 6, -1 }, { 3, 14, 4, 3, 2 }, { 7, 17, 4, 3, 2 } }, 0.00203809794f, 0.336355895f, 0.605109274f },
+	{ { { 14, 2, 2, 2, -1 }, { 14, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00161551905f, 0.228664204f, 0.544124603f },
+	{ { { 1, 10, 7, 6, -1 }, { 1, 13, 7, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00334583409f, 0.562591314f, 0.239233807f },
+	{ { { 15, 4, 4, 3, -1 }, { 15, 4, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00163795799f, 0.390699387f, 0.59646219f },
+	{ { { 2, 9, 14, 6, -1 }, { 2, 9, 7, 3, 2 }, { 9, 12, 7, 3, 2 } }, 0.0302512106f, 0.524848223f, 0.157574698f },
+	{ { { 5, 7, 10, 4, -1 }, { 5, 9, 10, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.0372519903f, 0.41943109f, 0.674841881f },
+	{ { { 6, 9, 8, 8, -1 }, { 6, 9, 4, 4, 2 }, { 10, 13, 4, 4, 2 } }, -0.0251097903f, 0.188254997f, 0.547345102f },
+	{ { { 14, 1, 3, 2, -1 }, { 14, 2, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00530990586f, 0.133997306f, 0.522711098f },
+	{ { { 1, 4, 4, 2, -1 }, { 3, 4, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00120864797f, 0.376208812f, 0.610963583f },
+	{ { { 11, 10, 2, 8, -1 }, { 11, 14, 2, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0219076797f, 0.266314298f, 0.540400684f },
+	{ { { 0, 0, 5, 3, -1 }, { 0, 1, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00541165797f, 0.53635788f, 0.223227307f },
+	{ { { 2, 5, 18, 8, -1 }, { 11, 5, 9, 4, 2 }, { 2, 9, 9, 4, 2 } }, 0.0699463263f, 0.535823286f, 0.245369807f },
+	{ { { 6, 6, 1, 6, -1 }, { 6, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000345200213f, 0.240967199f, 0.537693024f },
+	{ { { 19, 1, 1, 3, -1 }, { 19, 2, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00126277097f, 0.542585671f, 0.315569311f },
+	{ { { 7, 6, 6, 6, -1 }, { 9, 6, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.0227195099f, 0.415840596f, 0.659786522f },
+	{ { { 19, 1, 1, 3, -1 }, { 19, 2, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00181110005f, 0.281125307f, 0.550524473f },
+	{ { { 3, 13, 2, 3, -1 }, { 3, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00334696705f, 0.526002824f, 0.189146504f },
+	{ { { 8, 4, 8, 12, -1 }, { 12, 4, 4, 6, 2 }, { 8, 10, 4, 6, 2 } }, 0.000407917512f, 0.567350924f, 0.334421009f },
+	{ { { 5, 2, 6, 3, -1 }, { 7, 2, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0127347996f, 0.534359217f, 0.2395612f },
+	{ { { 6, 1, 9, 10, -1 }, { 6, 6, 9, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00731197279f, 0.601089001f, 0.402220786f },
+	{ { { 0, 4, 6, 12, -1 }, { 2, 4, 2, 12, 3 }, { 0, 0, 0, 0, 0 } }, -0.0569487512f, 0.819915116f, 0.45431909f },
+	{ { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00501165912f, 0.220028102f, 0.535771072f },
+	{ { { 7, 14, 5, 3, -1 }, { 7, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00603343686f, 0.441308111f, 0.718175113f },
+	{ { { 15, 13, 3, 3, -1 }, { 15, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00394374412f, 0.547886074f, 0.279173315f },
+	{ { { 6, 14, 8, 3, -1 }, { 6, 15, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00365911191f, 0.635786772f, 0.398972392f },
+	{ { { 15, 13, 3, 3, -1 }, { 15, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00384561811f, 0.349368602f, 0.53006649f },
+	{ { { 2, 13, 3, 3, -1 }, { 2, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00719262613f, 0.111961499f, 0.522967279f },
+	{ { { 4, 7, 12, 12, -1 }, { 10, 7, 6, 6, 2 }, { 4, 13, 6, 6, 2 } }, -0.0527989417f, 0.238710299f, 0.545345128f },
+	{ { { 9, 7, 2, 6, -1 }, { 10, 7, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.00795376673f, 0.758691788f, 0.443937689f },
+	{ { { 8, 9, 5, 2, -1 }, { 8, 10, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00273441803f, 0.256547689f, 0.548932195f },
+	{ { { 8, 6, 3, 4, -1 }, { 9, 6, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00185079395f, 0.673434794f, 0.42524749f },
+	{ { { 9, 6, 2, 8, -1 }, { 9, 10, 2, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0159189198f, 0.548835278f, 0.229266196f },
+	{ { { 7, 7, 3, 6, -1 }, { 8, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.00126876798f, 0.610433102f, 0.402238995f },
+	{ { { 11, 3, 3, 3, -1 }, { 12, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00628839107f, 0.531085312f, 0.153619304f },
+	{ { { 5, 4, 6, 1, -1 }, { 7, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0062259892f, 0.172911197f, 0.524160624f },
+	{ { { 5, 6, 10, 3, -1 }, { 5, 7, 10, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0121325999f, 0.659775972f, 0.432518214f },
+	/* stage 6 */
+	{ { { 7, 3, 6, 9, -1 }, { 7, 6, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00391849084f, 0.610343516f, 0.146933094f },
+	{ { { 6, 7, 9, 1, -1 }, { 9, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00159712997f, 0.263236314f, 0.589646697f },
+	{ { { 2, 8, 16, 8, -1 }, { 2, 12, 16, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0177801102f, 0.587287426f, 0.176036194f },
+	{ { { 14, 6, 2, 6, -1 }, { 14, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000653347699f, 0.156780198f, 0.559606612f },
+	{ { { 1, 5, 6, 15, -1 }, { 1, 10, 6, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.000283530913f, 0.191315398f, 0.573203623f },
+	{ { { 10, 0, 6, 9, -1 }, { 10, 3, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00161046896f, 0.291491389f, 0.562308073f },
+	{ { { 6, 6, 7, 14, -1 }, { 6, 13, 7, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0977506191f, 0.194347695f, 0.564823329f },
+	{ { { 13, 7, 3, 6, -1 }, { 13, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000551823585f, 0.313461691f, 0.550463974f },
+	{ { { 1, 8, 15, 4, -1 }, { 6, 8, 5, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0128582204f, 0.253648192f, 0.57601428f },
+	{ { { 11, 2, 3, 10, -1 }, { 11, 7, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00415302394f, 0.576772213f, 0.365977407f },
+	{ { { 3, 7, 4, 6, -1 }, { 3, 9, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00170924596f, 0.284319103f, 0.591893911f },
+	{ { { 13, 3, 6, 10, -1 }, { 15, 3, 2, 10, 3 }, { 0, 0, 0, 0, 0 } }, 0.00752173597f, 0.405242711f, 0.618310928f },
+	{ { { 5, 7, 8, 10, -1 }, { 5, 7, 4, 5, 2 }, { 9, 12, 4, 5, 2 } }, 0.00224798103f, 0.578375518f, 0.313540101f },
+	{ { { 4, 4, 12, 12, -1 }, { 10, 4, 6, 6, 2 }, { 4, 10, 6, 6, 2 } }, 0.0520062111f, 0.55413121f, 0.191663697f },
+	{ { { 1, 4, 6, 9, -1 }, { 3, 4, 2, 9, 3 }, { 0, 0, 0, 0, 0 } }, 0.01208553f, 0.403265595f, 0.664459109f },
+	{ { { 11, 3, 2, 5, -1 }, { 11, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 1.46878201e-05f, 0.35359779f, 0.570938289f },
+	{ { { 7, 3, 2, 5, -1 }, { 8, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 7.13951886e-06f, 0.303744495f, 0.56102699f },
+	{ { { 10, 14, 2, 3, -1 }, { 10, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00460016401f, 0.718108714f, 0.458032608f },
+	{ { { 5, 12, 6, 2, -1 }, { 8, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.0020058949f, 0.562195182f, 0.295368403f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00450502709f, 0.461538792f, 0.761901796f },
+	{ { { 4, 11, 12, 6, -1 }, { 4, 14, 12, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0117468303f, 0.534383714f, 0.177252904f },
+	{ { { 11, 11, 5, 9, -1 }, { 11, 14, 5, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0583163388f, 0.168624595f, 0.534077227f },
+	{ { { 6, 15, 3, 2, -1 }, { 6, 16, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000236293796f, 0.379205614f, 0.602680385f },
+	{ { { 11, 0, 3, 5, -1 }, { 12, 0, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00781561807f, 0.151286706f, 0.532432377f },
+	{ { { 5, 5, 6, 7, -1 }, { 8, 5, 3, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0108761601f, 0.208182201f, 0.531994522f },
+	{ { { 13, 0, 1, 9, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00277455198f, 0.409824699f, 0.52103281f },
+	{ { { 3, 2, 4, 8, -1 }, { 3, 2, 2, 4, 2 }, { 5, 6, 2, 4, 2 } }, -0.000782763818f, 0.569327414f, 0.347884208f },
+	{ { { 13, 12, 4, 6, -1 }, { 13, 14, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0138704097f, 0.532675087f, 0.225769803f },
+	{ { { 3, 12, 4, 6, -1 }, { 3, 14, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0236749109f, 0.155130506f, 0.520070791f },
+	{ { { 13, 11, 3, 4, -1 }, { 13, 13, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -1.48794097e-05f, 0.550056696f, 0.382017612f },
+	{ { { 4, 4, 4, 3, -1 }, { 4, 5, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00361906411f, 0.423868388f, 0.663974822f },
+	{ { { 7, 5, 11, 8, -1 }, { 7, 9, 11, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0198171102f, 0.215003803f, 0.538235784f },
+	{ { { 7, 8, 3, 4, -1 }, { 8, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00381540391f, 0.667571127f, 0.42152971f },
+	{ { { 9, 1, 6, 1, -1 }, { 11, 1, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00497758295f, 0.226728901f, 0.53863281f },
+	{ { { 5, 5, 3, 3, -1 }, { 5, 6, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00224410207f, 0.430869102f, 0.685573578f },
+	{ { { 0, 9, 20, 6, -1 }, { 10, 9, 10, 3, 2 }, { 0, 12, 10, 3, 2 } }, 0.01228246f, 0.583661497f, 0.346747905f },
+	{ { { 8, 6, 3, 5, -1 }, { 9, 6, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00285486993f, 0.701694489f, 0.4311454f },
+	{ { { 11, 0, 1, 3, -1 }, { 11, 1, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00378756691f, 0.289534509f, 0.522494614f },
+	{ { { 4, 2, 4, 2, -1 }, { 4, 3, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00122012303f, 0.297557086f, 0.548164487f },
+	{ { { 12, 6, 4, 3, -1 }, { 12, 7, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0101605998f, 0.488881797f, 0.818269789f },
+	{ { { 5, 0, 6, 4, -1 }, { 7, 0, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0161745697f, 0.148149297f, 0.523999274f },
+	{ { { 9, 7, 3, 8, -1 }, { 10, 7, 1, 8, 3 }, { 0, 0, 0, 0, 0 } }, 0.0192924608f, 0.47863099f, 0.737819076f },
+	{ { { 9, 7, 2, 2, -1 }, { 10, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00324795395f, 0.737422287f, 0.4470644f },
+	{ { { 6, 7, 14, 4, -1 }, { 13, 7, 7, 2, 2 }, { 6, 9, 7, 2, 2 } }, -0.00938034803f, 0.348915488f, 0.553799629f },
+	{ { { 0, 5, 3, 6, -1 }, { 0, 7, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.01260613f, 0.237968698f, 0.531544328f },
+	{ { { 13, 11, 3, 4, -1 }, { 13, 13, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0256219301f, 0.1964688f, 0.513876975f },
+	{ { { 4, 11, 3, 4, -1 }, { 4, 13, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -7.57414964e-05f, 0.559052289f, 0.336585313f },
+	{ { { 5, 9, 12, 8, -1 }, { 11, 9, 6, 4, 2 }, { 5, 13, 6, 4, 2 } }, -0.0892108828f, 0.0634046569f, 0.516263485f },
+	{ { { 9, 12, 1, 3, -1 }, { 9, 13, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00276704808f, 0.732346773f, 0.449070603f },
+	{ { { 10, 15, 2, 4, -1 }, { 10, 17, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000271525787f, 0.411483496f, 0.59855181f },
+	/* stage 7 */
+	{ { { 7, 7, 6, 1, -1 }, { 9, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00147862197f, 0.266354501f, 0.664331675f },
+	{ { { 12, 3, 6, 6, -1 }, { 15, 3, 3, 3, 2 }, { 12, 6, 3, 3, 2 } }, -0.00187416596f, 0.61438489f, 0.25185129f },
+	{ { { 0, 4, 10, 6, -1 }, { 0, 6, 10, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00171510095f, 0.576634109f, 0.239746302f },
+	{ { { 8, 3, 8, 14, -1 }, { 12, 3, 4, 7, 2 }, { 8, 10, 4, 7, 2 } }, -0.00189392699f, 0.568204582f, 0.252914488f },
+	{ { { 4, 4, 7, 15, -1 }, { 4, 9, 7, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0053006052f, 0.164067596f, 0.555607975f },
+	{ { { 12, 2, 6, 8, -1 }, { 15, 2, 3, 4, 2 }, { 12, 6, 3, 4, 2 } }, -0.0466625318f, 0.612315416f, 0.476283014f },
+	{ { { 2, 2, 6, 8, -1 }, { 2, 2, 3, 4, 2 }, { 5, 6, 3, 4, 2 } }, -0.000794313324f, 0.57078588f, 0.283940405f },
+	{ { { 2, 13, 18, 7, -1 }, { 8, 13, 6, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.0148916701f, 0.408967286f, 0.600636721f },
+	{ { { 4, 3, 8, 14, -1 }, { 4, 3, 4, 7, 2 }, { 8, 10, 4, 7, 2 } }, -0.00120465294f, 0.571245074f, 0.270528913f },
+	{ { { 18, 1, 2, 6, -1 }, { 18, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00606193813f, 0.526250422f, 0.326222599f },
+	{ { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00252866489f, 0.685383081f, 0.41992569f },
+	{ { { 18, 1, 2, 6, -1 }, { 18, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00590102188f, 0.326628208f, 0.54348129f },
+	{ { { 0, 1, 2, 6, -1 }, { 0, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.005670276f, 0.546841085f, 0.231900394f },
+	{ { { 1, 5, 18, 6, -1 }, { 1, 7, 18, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00303041004f, 0.557066798f, 0.270823807f },
+	{ { { 0, 2, 6, 7, -1 }, { 3, 2, 3, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.00298036495f, 0.370056897f, 0.589062572f },
+	{ { { 7, 3, 6, 14, -1 }, { 7, 10, 6, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0758405104f, 0.214007005f, 0.54199481f },
+	{ { { 3, 7, 13, 10, -1 }, { 3, 12, 13, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.0192625392f, 0.552677214f, 0.272659004f },
+	{ { { 11, 15, 2, 2, -1 }, { 11, 16, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000188882594f, 0.395801187f, 0.601720989f },
+	{ { { 2, 11, 16, 4, -1 }, { 2, 11, 8, 2, 2 }, { 10, 13, 8, 2, 2 } }, 0.0293695498f, 0.524137378f, 0.143575802f },
+	{ { { 13, 7, 6, 4, -1 }, { 16, 7, 3, 2, 2 }, { 13, 9, 3, 2, 2 } }, 0.00104176195f, 0.338540912f, 0.592998326f },
+	{ { { 6, 10, 3, 9, -1 }, { 6, 13, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00261256401f, 0.548537791f, 0.302159786f },
+	{ { { 14, 6, 1, 6, -1 }, { 14, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000969774672f, 0.337527603f, 0.553203285f },
+	{ { { 5, 10, 4, 1, -1 }, { 7, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000595126592f, 0.563174307f, 0.335939914f },
+	{ { { 3, 8, 15, 5, -1 }, { 8, 8, 5, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.101565599f, 0.063735038f, 0.5230425f },
+	{ { { 1, 6, 5, 4, -1 }, { 1, 8, 5, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.0361566991f, 0.513696313f, 0.102952898f },
+	{ { { 3, 1, 17, 6, -1 }, { 3, 3, 17, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00346241402f, 0.387932003f, 0.555828929f },
+	{ { { 6, 7, 8, 2, -1 }, { 10, 7, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.0195549801f, 0.525008678f, 0.187585995f },
+	{ { { 9, 7, 3, 2, -1 }, { 10, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00231214403f, 0.66720289f, 0.467964113f },
+	{ { { 8, 7, 3, 2, -1 }, { 9, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00186052895f, 0.716337919f, 0.43346709f },
+	{ { { 8, 9, 4, 2, -1 }, { 8, 10, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000940263621f, 0.302136093f, 0.565020323f },
+	{ { { 8, 8, 4, 3, -1 }, { 8, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00524183316f, 0.182000905f, 0.525025606f },
+	{ { { 9, 5, 6, 4, -1 }, { 9, 5, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000117290198f, 0.338918805f, 0.544597328f },
+	{ { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00118788402f, 0.408534914f, 0.625356317f },
+	{ { { 4, 7, 12, 6, -1 }, { 10, 7, 6, 3, 2 }, { 4, 10, 6, 3, 2 } }, -0.0108813597f, 0.337839901f, 0.570008278f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00173548597f, 0.420463592f, 0.652303874f },
+	{ { { 9, 7, 3, 3, -1 }, { 9, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00651190523f, 0.259521604f, 0.542814374f },
+	{ { { 7, 4, 3, 8, -1 }, { 8, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.001213643f, 0.616514385f, 0.397789389f },
+	{ { { 10, 0, 3, 6, -1 }, { 11, 0, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0103542404f, 0.162802801f, 0.521950483f },
+	{ { { 6, 3, 4, 8, -1 }, { 8, 3, 2, 8, 2 }, { 0, 0, 0, 0, 0 } }, 0.000558588305f, 0.319965094f, 0.550357401f },
+	{ { { 14, 3, 6, 13, -1 }, { 14, 3, 3, 13, 2 }, { 0, 0, 0, 0, 0 } }, 0.0152996499f, 0.410399407f, 0.612238824f },
+	{ { { 8, 13, 3, 6, -1 }, { 8, 16, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.02158821f, 0.103491299f, 0.519738495f },
+	{ { { 14, 3, 6, 13, -1 }, { 14, 3, 3, 13, 2 }, { 0, 0, 0, 0, 0 } }, -0.128346294f, 0.849386513f, 0.489310294f },
+	{ { { 0, 7, 10, 4, -1 }, { 0, 7, 5, 2, 2 }, { 5, 9, 5, 2, 2 } }, -0.00229271897f, 0.313015789f, 0.547157526f },
+	{ { { 14, 3, 6, 13, -1 }, { 14, 3, 3, 13, 2 }, { 0, 0, 0, 0, 0 } }, 0.0799151063f, 0.485632092f, 0.607398927f },
+	{ { { 0, 3, 6, 13, -1 }, { 3, 3, 3, 13, 2 }, { 0, 0, 0, 0, 0 } }, -0.0794410929f, 0.839467406f, 0.462453306f },
+	{ { { 9, 1, 4, 1, -1 }, { 9, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00528000109f, 0.188169599f, 0.530669808f },
+	{ { { 8, 0, 2, 1, -1 }, { 9, 0, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00104631099f, 0.527122915f, 0.258306593f },
+	{ { { 10, 16, 4, 4, -1 }, { 12, 16, 2, 2, 2 }, { 10, 18, 2, 2, 2 } }, 0.000263172988f, 0.423530489f, 0.573544085f },
+	{ { { 9, 6, 2, 3, -1 }, { 10, 6, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00361731602f, 0.693439603f, 0.449544489f },
+	{ { { 4, 5, 12, 2, -1 }, { 8, 5, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0114218798f, 0.590092123f, 0.413819313f },
+	{ { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00199632789f, 0.646638274f, 0.432723999f },
+	/* stage 8 */
+	{ { { 6, 4, 8, 6, -1 }, { 6, 6, 8, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00996912457f, 0.614232421f, 0.248221204f },
+	{ { { 9, 5, 2, 12, -1 }, { 9, 11, 2, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.000730730593f, 0.570495188f, 0.232196599f },
+	{ { { 4, 6, 6, 8, -1 }, { 4, 10, 6, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000640453014f, 0.211225197f, 0.581493318f },
+	{ { { 12, 2, 8, 5, -1 }, { 12, 2, 4, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00454240199f, 0.295048207f, 0.586631179f },
+	{ { { 0, 8, 18, 3, -1 }, { 0, 9, 18, 1, 3 }, { 0, 0, 0, 0, 0 } }, 9.24774431e-05f, 0.299099088f, 0.579132676f },
+	{ { { 8, 12, 4, 8, -1 }, { 8, 16, 4, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0086603146f, 0.281302989f, 0.563554227f },
+	{ { { 0, 2, 8, 5, -1 }, { 4, 2, 4, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00805158168f, 0.353536904f, 0.605475724f },
+	{ { { 13, 11, 3, 4, -1 }, { 13, 13, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000438352406f, 0.559653223f, 0.2731511f },
+	{ { { 5, 11, 6, 1, -1 }, { 7, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -9.81689736e-05f, 0.597803175f, 0.363856107f },
+	{ { { 11, 3, 3, 1, -1 }, { 12, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00112987903f, 0.275525212f, 0.543272913f },
+	{ { { 7, 13, 5, 3, -1 }, { 7, 14, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00643561501f, 0.430564195f, 0.706983328f },
+	{ { { 11, 11, 7, 6, -1 }, { 11, 14, 7, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0568293296f, 0.249524295f, 0.52949971f },
+	{ { { 2, 11, 7, 6, -1 }, { 2, 14, 7, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.004066817f, 0.547855318f, 0.2497724f },
+	{ { { 12, 14, 2, 6, -1 }, { 12, 16, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 4.81647985e-05f, 0.393860102f, 0.570635617f },
+	{ { { 8, 14, 3, 3, -1 }, { 8, 15, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00617950177f, 0.440760612f, 0.739476681f },
+	{ { { 11, 0, 3, 5, -1 }, { 12, 0, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.00649857521f, 0.544524312f, 0.247915298f },
+	{ { { 6, 1, 4, 9, -1 }, { 8, 1, 2, 9, 2 }, { 0, 0, 0, 0, 0 } }, -0.00102110906f, 0.254476696f, 0.533897102f },
+	{ { { 10, 3, 6, 1, -1 }, { 12, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00542475283f, 0.271885812f, 0.532406926f },
+	{ { { 8, 8, 3, 4, -1 }, { 8, 10, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00105599f, 0.317828804f, 0.553450882f },
+	{ { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000664658088f, 0.428421915f, 0.655819416f },
+	{ { { 5, 18, 4, 2, -1 }, { 5, 19, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000275241095f, 0.590286076f, 0.381026298f },
+	{ { { 2, 1, 18, 6, -1 }, { 2, 3, 18, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00422932021f, 0.381648988f, 0.570938587f },
+	{ { { 6, 0, 3, 2, -1 }, { 7, 0, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00328682107f, 0.174774393f, 0.525954425f },
+	{ { { 13, 8, 6, 2, -1 }, { 16, 8, 3, 1, 2 }, { 13, 9, 3, 1, 2 } }, 0.000156118796f, 0.360172212f, 0.572561204f },
+	{ { { 6, 10, 3, 6, -1 }, { 6, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, -7.36213815e-06f, 0.540185809f, 0.304449707f },
+	{ { { 0, 13, 20, 4, -1 }, { 10, 13, 10, 2, 2 }, { 0, 15, 10, 2, 2 } }, -0.01476725f, 0.322077006f, 0.557343483f },
+	{ { { 7, 7, 6, 5, -1 }, { 9, 7, 2, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0244895909f, 0.430152804f, 0.651881278f },
+	{ { { 11, 0, 2, 2, -1 }, { 11, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000376520911f, 0.356458306f, 0.559823692f },
+	{ { { 1, 8, 6, 2, -1 }, { 1, 8, 3, 1, 2 }, { 4, 9, 3, 1, 2 } }, 7.36576885e-06f, 0.349078298f, 0.556189775f },
+	{ { { 0, 2, 20, 2, -1 }, { 10, 2, 10, 1, 2 }, { 0, 3, 10, 1, 2 } }, -0.0150999399f, 0.177627206f, 0.533529997f },
+	{ { { 7, 14, 5, 3, -1 }, { 7, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00383166503f, 0.614968777f, 0.422139406f },
+	{ { { 7, 13, 6, 6, -1 }, { 10, 13, 3, 3, 2 }, { 7, 16, 3, 3, 2 } }, 0.0169254001f, 0.541301489f, 0.216658503f },
+	{ { { 9, 12, 2, 3, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00304778502f, 0.644949079f, 0.435461789f },
+	{ { { 16, 11, 1, 6, -1 }, { 16, 13, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00321405893f, 0.540015519f, 0.352321714f },
+	{ { { 3, 11, 1, 6, -1 }, { 3, 13, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00400232011f, 0.277452409f, 0.533841729f },
+	{ { { 4, 4, 14, 12, -1 }, { 11, 4, 7, 6, 2 }, { 4, 10, 7, 6, 2 } }, 0.00741821295f, 0.567673922f, 0.370281786f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00887645874f, 0.774922192f, 0.458368897f },
+	{ { { 12, 3, 3, 3, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.002731174f, 0.533872187f, 0.399666101f },
+	{ { { 6, 6, 8, 3, -1 }, { 6, 7, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00250823796f, 0.561196327f, 0.37774989f },
+	{ { { 12, 3, 3, 3, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00805410743f, 0.29152289f, 0.517918289f },
+	{ { { 3, 1, 4, 10, -1 }, { 3, 1, 2, 5, 2 }, { 5, 6, 2, 5, 2 } }, -0.000979388133f, 0.553643286f, 0.370019287f },
+	{ { { 5, 7, 10, 2, -1 }, { 5, 7, 5, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00587459095f, 0.375439107f, 0.567937613f },
+	{ { { 8, 7, 3, 3, -1 }, { 9, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00449367194f, 0.701969922f, 0.448094994f },
+	{ { { 15, 12, 2, 3, -1 }, { 15, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0054389229f, 0.231036499f, 0.531338692f },
+	{ { { 7, 8, 3, 4, -1 }, { 8, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.000750946405f, 0.586486876f, 0.412934303f },
+	{ { { 13, 4, 1, 12, -1 }, { 13, 10, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, 1.45288004e-05f, 0.373240709f, 0.561962128f },
+	{ { { 4, 5, 12, 12, -1 }, { 4, 5, 6, 6, 2 }, { 10, 11, 6, 6, 2 } }, 0.0407580696f, 0.531209111f, 0.272052199f },
+	{ { { 7, 14, 7, 3, -1 }, { 7, 15, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00665059313f, 0.471001595f, 0.669349372f },
+	{ { { 3, 12, 2, 3, -1 }, { 3, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00457593519f, 0.516781926f, 0.163727596f },
+	{ { { 3, 2, 14, 2, -1 }, { 10, 2, 7, 1, 2 }, { 3, 3, 7, 1, 2 } }, 0.00652693119f, 0.539760888f, 0.293853194f },
+	{ { { 0, 1, 3, 10, -1 }, { 1, 1, 1, 10, 3 }, { 0, 0, 0, 0, 0 } }, -0.0136603797f, 0.708648801f, 0.45322001f },
+	{ { { 9, 0, 6, 5, -1 }, { 11, 0, 2, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0273588691f, 0.520648122f, 0.358923197f },
+	{ { { 5, 7, 6, 2, -1 }, { 8, 7, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000621975516f, 0.350707591f, 0.544112325f },
+	{ { { 7, 1, 6, 10, -1 }, { 7, 6, 6, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00330770807f, 0.585952282f, 0.402489185f },
+	{ { { 1, 1, 18, 3, -1 }, { 7, 1, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0106311096f, 0.674326718f, 0.442260295f },
+	{ { { 16, 3, 3, 6, -1 }, { 16, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0194416493f, 0.528271616f, 0.179790497f },
+	/* stage 9 */
+	{ { { 6, 3, 7, 6, -1 }, { 6, 6, 7, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00550521677f, 0.591473103f, 0.262655914f },
+	{ { { 4, 7, 12, 2, -1 }, { 8, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00195622793f, 0.231258199f, 0.574162722f },
+	{ { { 0, 4, 17, 10, -1 }, { 0, 9, 17, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00889247842f, 0.165653005f, 0.562665403f },
+	{ { { 3, 4, 15, 16, -1 }, { 3, 12, 15, 8, 2 }, { 0, 0, 0, 0, 0 } }, 0.0836383775f, 0.542344987f, 0.195729494f },
+	{ { { 7, 15, 6, 4, -1 }, { 7, 17, 6, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00122822705f, 0.341790408f, 0.599250376f },
+	{ { { 15, 2, 4, 9, -1 }, { 15, 2, 2, 9, 2 }, { 0, 0, 0, 0, 0 } }, 0.00576291699f, 0.371958196f, 0.607990384f },
+	{ { { 2, 3, 3, 2, -1 }, { 2, 4, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00164174102f, 0.257748604f, 0.557691574f },
+	{ { { 13, 6, 7, 9, -1 }, { 13, 9, 7, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00341131492f, 0.29507491f, 0.551417172f },
+	{ { { 8, 11, 4, 3, -1 }, { 8, 12, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0110693201f, 0.756935894f, 0.447707891f },
+	{ { { 0, 2, 20, 6, -1 }, { 10, 2, 10, 3, 2 }, { 0, 5, 10, 3, 2 } }, 0.0348659717f, 0.558370888f, 0.266962111f },
+	{ { { 3, 2, 6, 10, -1 }, { 3, 2, 3, 5, 2 }, { 6, 7, 3, 5, 2 } }, 0.000657010998f, 0.562731326f, 0.298889011f },
+	{ { { 13, 10, 3, 4, -1 }, { 13, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0243391301f, 0.277118504f, 0.510886312f },
+	{ { { 4, 10, 3, 4, -1 }, { 4, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000594352023f, 0.558065176f, 0.31203419f },
+	{ { { 7, 5, 6, 3, -1 }, { 9, 5, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0022971509f, 0.333025008f, 0.567907572f },
+	{ { { 7, 6, 6, 8, -1 }, { 7, 10, 6, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.00378018292f, 0.29905349f, 0.53448081f },
+	{ { { 0, 11, 20, 6, -1 }, { 0, 14, 20, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.134206697f, 0.146385893f, 0.539256811f },
+	{ { { 4, 13, 4, 6, -1 }, { 4, 13, 2, 3, 2 }, { 6, 16, 2, 3, 2 } }, 0.000752245483f, 0.37469539f, 0.569273472f },
+	{ { { 6, 0, 8, 12, -1 }, { 10, 0, 4, 6, 2 }, { 6, 6, 4, 6, 2 } }, -0.0405455418f, 0.275474787f, 0.548429787f },
+	{ { { 2, 0, 15, 2, -1 }, { 2, 1, 15, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.001257297f, 0.374458402f, 0.575607598f },
+	{ { { 9, 12, 2, 3, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00742499484f, 0.751385927f, 0.472823113f },
+	{ { { 3, 12, 1, 2, -1 }, { 3, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000509081292f, 0.540489674f, 0.293232113f },
+	{ { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00128084503f, 0.61697799f, 0.427334905f },
+	{ { { 7, 3, 3, 1, -1 }, { 8, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00183488603f, 0.204849601f, 0.520647228f },
+	{ { { 17, 7, 3, 6, -1 }, { 17, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0274848696f, 0.525298476f, 0.167552203f },
+	{ { { 7, 2, 3, 2, -1 }, { 8, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00223724195f, 0.526778281f, 0.27776581f },
+	{ { { 11, 4, 5, 3, -1 }, { 11, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00886352919f, 0.69545579f, 0.481204897f },
+	{ { { 4, 4, 5, 3, -1 }, { 4, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0041753971f, 0.429188788f, 0.634919584f },
+	{ { { 19, 3, 1, 2, -1 }, { 19, 4, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00170981896f, 0.293053687f, 0.536124885f },
+	{ { { 5, 5, 4, 3, -1 }, { 5, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00653285487f, 0.449532509f, 0.740969419f },
+	{ { { 17, 7, 3, 6, -1 }, { 17, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00953729078f, 0.314911991f, 0.541650176f },
+	{ { { 0, 7, 3, 6, -1 }, { 0, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0253109895f, 0.512189209f, 0.131170794f },
+	{ { { 14, 2, 6, 9, -1 }, { 14, 5, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0364609696f, 0.517591178f, 0.259133995f },
+	{ { { 0, 4, 5, 6, -1 }, { 0, 6, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0208543297f, 0.513714015f, 0.158231601f },
+	{ { { 10, 5, 6, 2, -1 }, { 12, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000872077479f, 0.557430983f, 0.439897895f },
+	{ { { 4, 5, 6, 2, -1 }, { 6, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -1.52270004e-05f, 0.55489409f, 0.370806992f },
+	{ { { 8, 1, 4, 6, -1 }, { 8, 3, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000843165093f, 0.338741988f, 0.555421114f },
+	{ { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.003603786f, 0.535806179f, 0.341117114f },
+	{ { { 6, 6, 8, 3, -1 }, { 6, 7, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00680578919f, 0.612520278f, 0.434586287f },
+	{ { { 0, 1, 5, 9, -1 }, { 0, 4, 5, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.047021661f, 0.235816598f, 0.519373894f },
+	{ { { 16, 0, 4, 15, -1 }, { 16, 0, 2, 15, 2 }, { 0, 0, 0, 0, 0 } }, -0.0369541086f, 0.73231113f, 0.476094395f },
+	{ { { 1, 10, 3, 2, -1 }, { 1, 11, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.001043948f, 0.541945517f, 0.341133088f },
+	{ { { 14, 4, 1, 10, -1 }, { 14, 9, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.0002105069f, 0.282169402f, 0.555494726f },
+	{ { { 0, 1, 4, 12, -1 }, { 2, 1, 2, 12, 2 }, { 0, 0, 0, 0, 0 } }, -0.0808315873f, 0.912993014f, 0.46974349f },
+	{ { { 11, 11, 4, 2, -1 }, { 11, 11, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000365790591f, 0.602267027f, 0.397829294f },
+	{ { { 5, 11, 4, 2, -1 }, { 7, 11, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000125459206f, 0.561321318f, 0.384553999f },
+	{ { { 3, 8, 15, 5, -1 }, { 8, 8, 5, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.068786487f, 0.226161197f, 0.530049682f },
+	{ { { 0, 0, 6, 10, -1 }, { 3, 0, 3, 10, 2 }, { 0, 0, 0, 0, 0 } }, 0.01241579f, 0.4075692f, 0.582881212f },
+	{ { { 11, 4, 3, 2, -1 }, { 12, 4, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00471748179f, 0.282725394f, 0.526775777f },
+	{ { { 8, 12, 3, 8, -1 }, { 8, 16, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0381368585f, 0.507474124f, 0.102361597f },
+	{ { { 8, 14, 5, 3, -1 }, { 8, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00281680492f, 0.616900682f, 0.435969293f },
+	{ { { 7, 14, 4, 3, -1 }, { 7, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00813036039f, 0.452443302f, 0.760609508f },
+	{ { { 11, 4, 3, 2, -1 }, { 12, 4, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00600560196f, 0.524040878f, 0.1859712f },
+	{ { { 3, 15, 14, 4, -1 }, { 3, 15, 7, 2, 2 }, { 10, 17, 7, 2, 2 } }, 0.0191393197f, 0.52093792f, 0.233207196f },
+	{ { { 2, 2, 16, 4, -1 }, { 10, 2, 8, 2, 2 }, { 2, 4, 8, 2, 2 } }, 0.0164457597f, 0.545070291f, 0.326423496f },
+	{ { { 0, 8, 6, 12, -1 }, { 3, 8, 3, 12, 2 }, { 0, 0, 0, 0, 0 } }, -0.0373568907f, 0.69990468f, 0.453324199f },
+	{ { { 5, 7, 10, 2, -1 }, { 5, 7, 5, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0197279006f, 0.265366495f, 0.541280985f },
+	{ { { 9, 7, 2, 5, -1 }, { 10, 7, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00669725798f, 0.448056608f, 0.713865221f },
+	{ { { 13, 7, 6, 4, -1 }, { 16, 7, 3, 2, 2 }, { 13, 9, 3, 2, 2 } }, 0.000744575285f, 0.423135012f, 0.547132015f },
+	{ { { 0, 13, 8, 2, -1 }, { 0, 14, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00117906404f, 0.53417021f, 0.313045502f },
+	{ { { 13, 7, 6, 4, -1 }, { 16, 7, 3, 2, 2 }, { 13, 9, 3, 2, 2 } }, 0.03498061f, 0.511865973f, 0.343053013f },
+	{ { { 1, 7, 6, 4, -1 }, { 1, 7, 3, 2, 2 }, { 4, 9, 3, 2, 2 } }, 0.000568597927f, 0.353218704f, 0.546863973f },
+	{ { { 12, 6, 1, 12, -1 }, { 12, 12, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.0113406498f, 0.284235388f, 0.534870088f },
+	{ { { 9, 5, 2, 6, -1 }, { 10, 5, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.00662281085f, 0.688364029f, 0.449266493f },
+	{ { { 14, 12, 2, 3, -1 }, { 14, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0080160331f, 0.170989394f, 0.522430897f },
+	{ { { 4, 12, 2, 3, -1 }, { 4, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00142068195f, 0.529084623f, 0.299338311f },
+	{ { { 8, 12, 4, 3, -1 }, { 8, 13, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00278017111f, 0.649885416f, 0.446049988f },
+	{ { { 5, 2, 2, 4, -1 }, { 5, 2, 1, 2, 2 }, { 6, 4, 1, 2, 2 } }, -0.00147475896f, 0.326043814f, 0.538811326f },
+	{ { { 5, 5, 11, 3, -1 }, { 5, 6, 11, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0238303393f, 0.752894104f, 0.480122f },
+	{ { { 7, 6, 4, 12, -1 }, { 7, 12, 4, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00693697901f, 0.533516586f, 0.326142788f },
+	{ { { 12, 13, 8, 5, -1 }, { 12, 13, 4, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00828062557f, 0.458039403f, 0.57378298f },
+	{ { { 7, 6, 1, 12, -1 }, { 7, 12, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.0104395002f, 0.259232014f, 0.523382783f },
+	/* stage 10 */
+	{ { { 1, 2, 6, 3, -1 }, { 4, 2, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00720065879f, 0.325888604f, 0.68498081f },
+	{ { { 9, 5, 6, 10, -1 }, { 12, 5, 3, 5, 2 }, { 9, 10, 3, 5, 2 } }, -0.00285935891f, 0.583888113f, 0.253782988f },
+	{ { { 5, 5, 8, 12, -1 }, { 5, 5, 4, 6, 2 }, { 9, 11, 4, 6, 2 } }, 0.00068580528f, 0.570808172f, 0.2812424f },
+	{ { { 0, 7, 20, 6, -1 }, { 0, 9, 20, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00795801915f, 0.250105113f, 0.554426074f },
+	{ { { 4, 2, 2, 2, -1 }, { 4, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00121241505f, 0.238536805f, 0.543335021f },
+	{ { { 4, 18, 12, 2, -1 }, { 8, 18, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00794261321f, 0.395507097f, 0.622075796f },
+	{ { { 7, 4, 4, 16, -1 }, { 7, 12, 4, 8, 2 }, { 0, 0, 0, 0, 0 } }, 0.00246305903f, 0.563970804f, 0.299235791f },
+	{ { { 7, 6, 7, 8, -1 }, { 7, 10, 7, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.00603965996f, 0.218651295f, 0.541167676f },
+	{ { { 6, 3, 3, 1, -1 }, { 7, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00129883399f, 0.235070601f, 0.536458492f },
+	{ { { 11, 15, 2, 4, -1 }, { 11, 17, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000222993694f, 0.380411297f, 0.572960615f },
+	{ { { 3, 5, 4, 8, -1 }, { 3, 9, 4, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00146542804f, 0.251016796f, 0.525826871f },
+	{ { { 7, 1, 6, 12, -1 }, { 7, 7, 6, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.000812100421f, 0.599282384f, 0.385115892f },
+	{ { { 4, 6, 6, 2, -1 }, { 6, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00138360204f, 0.568139613f, 0.363658696f },
+	{ { { 16, 4, 4, 6, -1 }, { 16, 6, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0279364493f, 0.1491317f, 0.537756026f },
+	{ { { 3, 3, 5, 2, -1 }, { 3, 4, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000469195511f, 0.369242996f, 0.557248473f },
+	{ { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.004982966f, 0.675850928f, 0.453250408f },
+	{ { { 2, 16, 4, 2, -1 }, { 2, 17, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00188153097f, 0.536802292f, 0.293253988f },
+	{ { { 7, 13, 6, 6, -1 }, { 10, 13, 3, 3, 2 }, { 7, 16, 3, 3, 2 } }, -0.0190675501f, 0.164937705f, 0.533006728f },
+	{ { { 7, 0, 3, 4, -1 }, { 8, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00469065597f, 0.196392596f, 0.511936188f },
+	{ { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00597771397f, 0.46711719f, 0.700839818f },
+	{ { { 0, 4, 4, 6, -1 }, { 0, 6, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0333031304f, 0.115541697f, 0.51041621f },
+	{ { { 5, 6, 12, 3, -1 }, { 9, 6, 4, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.090744108f, 0.514966011f, 0.130617306f },
+	{ { { 7, 6, 6, 14, -1 }, { 9, 6, 2, 14, 3 }, { 0, 0, 0, 0, 0 } }, 0.000935558986f, 0.360548109f, 0.543985903f },
+	{ { { 9, 7, 3, 3, -1 }, { 10, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0149016501f, 0.488621205f, 0.768756986f },
+	{ { { 6, 12, 2, 4, -1 }, { 6, 14, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000615941186f, 0.535681307f, 0.324093908f },
+	{ { { 10, 12, 7, 6, -1 }, { 10, 14, 7, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0506709889f, 0.184862196f, 0.523040414f },
+	{ { { 1, 0, 15, 2, -1 }, { 1, 1, 15, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000686657499f, 0.384057999f, 0.551794589f },
+	{ { { 14, 0, 6, 6, -1 }, { 14, 0, 3, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00837124325f, 0.428856403f, 0.613175392f },
+	{ { { 5, 3, 3, 1, -1 }, { 6, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00129530695f, 0.291367412f, 0.528073788f },
+	{ { { 14, 0, 6, 6, -1 }, { 14, 0, 3, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.04194168f, 0.755479991f, 0.485603094f },
+	{ { { 0, 3, 20, 10, -1 }, { 0, 8, 20, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.0235293806f, 0.28382799f, 0.525608122f },
+	{ { { 14, 0, 6, 6, -1 }, { 14, 0, 3, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.0408574492f, 0.487093508f, 0.627729714f },
+	{ { { 0, 0, 6, 6, -1 }, { 3, 0, 3, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.0254068691f, 0.709970772f, 0.457502902f },
+	{ { { 19, 15, 1, 2, -1 }, { 19, 16, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000414154405f, 0.403088689f, 0.546941221f },
+	{ { { 0, 2, 4, 8, -1 }, { 2, 2, 2, 8, 2 }, { 0, 0, 0, 0, 0 } }, 0.0218241196f, 0.450202405f, 0.676870108f },
+	{ { { 2, 1, 18, 4, -1 }, { 11, 1, 9, 2, 2 }, { 2, 3, 9, 2, 2 } }, 0.01411404f, 0.544286072f, 0.379170001f },
+	{ { { 8, 12, 1, 2, -1 }, { 8, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 6.72145907e-05f, 0.420046389f, 0.587347627f },
+	{ { { 5, 2, 10, 6, -1 }, { 10, 2, 5, 3, 2 }, { 5, 5, 5, 3, 2 } }, -0.00794176385f, 0.379256189f, 0.558526576f },
+	{ { { 9, 7, 2, 4, -1 }, { 10, 7, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.00721444096f, 0.725310385f, 0.460354894f },
+	{ { { 9, 7, 3, 3, -1 }, { 10, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00258173398f, 0.469330192f, 0.590023875f },
+	{ { { 4, 5, 12, 8, -1 }, { 8, 5, 4, 8, 3 }, { 0, 0, 0, 0, 0 } }, 0.134093195f, 0.514921308f, 0.180884495f },
+	{ { { 15, 15, 4, 3, -1 }, { 15, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00229627104f, 0.539974391f, 0.371786714f },
+	{ { { 8, 18, 3, 1, -1 }, { 9, 18, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.002157585f, 0.240849599f, 0.514886379f },
+	{ { { 9, 13, 4, 3, -1 }, { 9, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00491961883f, 0.657358825f, 0.473874003f },
+	{ { { 7, 13, 4, 3, -1 }, { 7, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00162674696f, 0.419282198f, 0.63031143f },
+	{ { { 19, 15, 1, 2, -1 }, { 19, 16, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000334133889f, 0.554029822f, 0.370210111f },
+	{ { { 0, 15, 8, 4, -1 }, { 0, 17, 8, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0266980808f, 0.171091795f, 0.510141075f },
+	{ { { 9, 3, 6, 4, -1 }, { 11, 3, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0305618793f, 0.190421805f, 0.51687938f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00285115489f, 0.444750696f, 0.631385386f },
+	{ { { 3, 14, 14, 6, -1 }, { 3, 16, 14, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0362114795f, 0.249072701f, 0.537734926f },
+	{ { { 6, 3, 6, 6, -1 }, { 6, 6, 6, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00241151894f, 0.538124323f, 0.366423696f },
+	{ { { 5, 11, 10, 6, -1 }, { 5, 14, 10, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000772532017f, 0.553023219f, 0.354155004f },
+	{ { { 3, 10, 3, 4, -1 }, { 4, 10, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.000294817291f, 0.413269907f, 0.5667243f },
+	{ { { 13, 9, 2, 2, -1 }, { 13, 9, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00623345608f, 0.0987872332f, 0.519866884f },
+	{ { { 5, 3, 6, 4, -1 }, { 7, 3, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0262747295f, 0.0911274925f, 0.502810717f },
+	{ { { 9, 7, 3, 3, -1 }, { 10, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00532122608f, 0.472664893f, 0.622272074f },
+	{ { { 2, 12, 2, 3, -1 }, { 2, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00411290582f, 0.215745702f, 0.513780475f },
+	{ { { 9, 8, 3, 12, -1 }, { 9, 12, 3, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00324578094f, 0.541077077f, 0.37217769f },
+	{ { { 3, 14, 4, 6, -1 }, { 3, 14, 2, 3, 2 }, { 5, 17, 2, 3, 2 } }, -0.0163597092f, 0.778787494f, 0.468529195f },
+	{ { { 16, 15, 2, 2, -1 }, { 16, 16, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000321661093f, 0.54789871f, 0.424037397f },
+	{ { { 2, 15, 2, 2, -1 }, { 2, 16, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000644524407f, 0.53305608f, 0.350132495f },
+	{ { { 8, 12, 4, 3, -1 }, { 8, 13, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00789097324f, 0.692352116f, 0.472656906f },
+	{ { { 0, 7, 20, 1, -1 }, { 10, 7, 10, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0483362116f, 0.505590022f, 0.0757492036f },
+	{ { { 7, 6, 8, 3, -1 }, { 7, 6, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000751781277f, 0.378374189f, 0.553857386f },
+	{ { { 5, 7, 8, 2, -1 }, { 9, 7, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00249539106f, 0.308165103f, 0.535961211f },
+	{ { { 9, 7, 3, 5, -1 }, { 10, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0022385011f, 0.663395882f, 0.464934289f },
+	{ { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00179884303f, 0.659684479f, 0.434718788f },
+	{ { { 11, 1, 3, 5, -1 }, { 12, 1, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.00878609158f, 0.523183286f, 0.231557995f },
+	{ { { 6, 2, 3, 6, -1 }, { 7, 2, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.00367153808f, 0.520425022f, 0.297737688f },
+	{ { { 14, 14, 6, 5, -1 }, { 14, 14, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.0353364497f, 0.723887801f, 0.486150503f },
+	{ { { 9, 8, 2, 2, -1 }, { 9, 9, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000691892405f, 0.310502201f, 0.522982478f },
+	{ { { 10, 7, 1, 3, -1 }, { 10, 8, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00339461095f, 0.313896805f, 0.521017373f },
+	{ { { 6, 6, 2, 2, -1 }, { 6, 6, 1, 1, 2 }, { 7, 7, 1, 1, 2 } }, 0.000985692837f, 0.453658015f, 0.658509791f },
+	{ { { 2, 11, 18, 4, -1 }, { 11, 11, 9, 2, 2 }, { 2, 13, 9, 2, 2 } }, -0.0501631014f, 0.180445403f, 0.519891679f },
+	{ { { 6, 6, 2, 2, -1 }, { 6, 6, 1, 1, 2 }, { 7, 7, 1, 1, 2 } }, -0.002236726f, 0.725570202f, 0.465135902f },
+	{ { { 0, 15, 20, 2, -1 }, { 0, 16, 20, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000743262877f, 0.441292107f, 0.589854598f },
+	{ { { 4, 14, 2, 3, -1 }, { 4, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000934851822f, 0.350005299f, 0.536601782f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.01749794f, 0.491219491f, 0.831528485f },
+	{ { { 8, 7, 2, 3, -1 }, { 8, 8, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00152000005f, 0.35702759f, 0.537056029f },
+	{ { { 9, 10, 2, 3, -1 }, { 9, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000780039409f, 0.43537721f, 0.59673351f },
+	/* stage 11 */
+	{ { { 5, 4, 10, 4, -1 }, { 5, 6, 10, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00999455526f, 0.616258323f, 0.3054533f },
+	{ { { 9, 7, 6, 4, -1 }, { 12, 7, 3, 2, 2 }, { 9, 9, 3, 2, 2 } }, -0.00110852299f, 0.581829488f, 0.315557808f },
+	{ { { 4, 7, 3, 6, -1 }, { 4, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00103643804f, 0.255205214f, 0.569291174f },
+	{ { { 11, 15, 4, 4, -1 }, { 13, 15, 2, 2, 2 }, { 11, 17, 2, 2, 2 } }, 0.00068211311f, 0.368508995f, 0.593493104f },
+	{ { { 7, 8, 4, 2, -1 }, { 7, 9, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000680573401f, 0.233239204f, 0.547479212f },
+	{ { { 13, 1, 4, 3, -1 }, { 13, 1, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000260687899f, 0.325745702f, 0.56675458f },
+	{ { { 5, 15, 4, 4, -1 }, { 5, 15, 2, 2, 2 }, { 7, 17, 2, 2, 2 } }, 0.00051607372f, 0.374471694f, 0.584547281f },
+	{ { { 9, 5, 4, 7, -1 }, { 9, 5, 2, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.000850075216f, 0.342037112f, 0.552280724f },
+	{ { { 5, 6, 8, 3, -1 }, { 9, 6, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00186078297f, 0.280441999f, 0.537542403f },
+	{ { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00150339701f, 0.257905096f, 0.549895227f },
+	{ { { 7, 15, 5, 3, -1 }, { 7, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00234789099f, 0.417515606f, 0.631371081f },
+	{ { { 11, 10, 4, 3, -1 }, { 11, 10, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000288802403f, 0.586516976f, 0.405266613f },
+	{ { { 6, 9, 8, 10, -1 }, { 6, 14, 8, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.0089405477f, 0.521114111f, 0.231865406f },
+	{ { { 10, 11, 6, 2, -1 }, { 10, 11, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0193277393f, 0.275343299f, 0.524152577f },
+	{ { { 4, 11, 6, 2, -1 }, { 7, 11, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000202020601f, 0.572297871f, 0.367719591f },
+	{ { { 11, 3, 8, 1, -1 }, { 11, 3, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00211790693f, 0.446610808f, 0.554243088f },
+	{ { { 6, 3, 3, 2, -1 }, { 7, 3, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00177437603f, 0.28132531f, 0.530095994f },
+	{ { { 14, 5, 6, 5, -1 }, { 14, 5, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.0042234459f, 0.439971f, 0.579542816f },
+	{ { { 7, 5, 2, 12, -1 }, { 7, 11, 2, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.0143752201f, 0.298111796f, 0.529205918f },
+	{ { { 8, 11, 4, 3, -1 }, { 8, 12, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0153491804f, 0.770521522f, 0.474817187f },
+	{ { { 4, 1, 2, 3, -1 }, { 5, 1, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 1.515228e-05f, 0.371884406f, 0.557689726f },
+	{ { { 18, 3, 2, 6, -1 }, { 18, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00912939198f, 0.361519605f, 0.528676689f },
+	{ { { 0, 3, 2, 6, -1 }, { 0, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00225121598f, 0.536470473f, 0.348629802f },
+	{ { { 9, 12, 2, 3, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00496969186f, 0.692765176f, 0.467683613f },
+	{ { { 7, 13, 4, 3, -1 }, { 7, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0128290104f, 0.771215379f, 0.466073513f },
+	{ { { 18, 0, 2, 6, -1 }, { 18, 2, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00936600659f, 0.337498397f, 0.535128772f },
+	{ { { 0, 0, 2, 6, -1 }, { 0, 2, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00324523193f, 0.532518983f, 0.328961015f },
+	{ { { 8, 14, 6, 3, -1 }, { 8, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0117235603f, 0.683765292f, 0.475430012f },
+	{ { { 7, 4, 2, 4, -1 }, { 8, 4, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, 2.92579407e-05f, 0.357208788f, 0.5360502f },
+	{ { { 8, 5, 4, 6, -1 }, { 8, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -2.22442195e-05f, 0.554142714f, 0.3552064f },
+	{ { { 6, 4, 2, 2, -1 }, { 7, 4, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00508815097f, 0.507084429f, 0.125646204f },
+	{ { { 3, 14, 14, 4, -1 }, { 10, 14, 7, 2, 2 }, { 3, 16, 7, 2, 2 } }, 0.0274296794f, 0.526956022f, 0.162581801f },
+	{ { { 6, 15, 6, 2, -1 }, { 6, 15, 3, 1, 2 }, { 9, 16, 3, 1, 2 } }, -0.00641428679f, 0.714558899f, 0.45841971f },
+	{ { { 14, 15, 6, 2, -1 }, { 14, 16, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00334799592f, 0.539861202f, 0.349469692f },
+	{ { { 2, 12, 12, 8, -1 }, { 2, 16, 12, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0826354921f, 0.243919298f, 0.516022623f },
+	{ { { 7, 7, 7, 2, -1 }, { 7, 8, 7, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00102617405f, 0.38868919f, 0.57679081f },
+	{ { { 0, 2, 18, 2, -1 }, { 0, 3, 18, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00163070904f, 0.338945806f, 0.534770072f },
+	{ { { 9, 6, 2, 5, -1 }, { 9, 6, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00245466805f, 0.460141391f, 0.638724685f },
+	{ { { 7, 5, 3, 8, -1 }, { 8, 5, 1, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.0009947652f, 0.576987922f, 0.412039608f },
+	{ { { 9, 6, 3, 4, -1 }, { 10, 6, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0154091902f, 0.487870902f, 0.708982229f },
+	{ { { 4, 13, 3, 2, -1 }, { 4, 14, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00117844006f, 0.526355326f, 0.289524496f },
+	{ { { 9, 4, 6, 3, -1 }, { 11, 4, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0277019199f, 0.149882898f, 0.521960676f },
+	{ { { 5, 4, 6, 3, -1 }, { 7, 4, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0295054f, 0.0248933192f, 0.499981612f },
+	{ { { 14, 11, 5, 2, -1 }, { 14, 12, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0004515943f, 0.546462297f, 0.402966291f },
+	{ { { 1, 2, 6, 9, -1 }, { 3, 2, 2, 9, 3 }, { 0, 0, 0, 0, 0 } }, 0.00717726396f, 0.427105695f, 0.586629689f },
+	{ { { 14, 6, 6, 13, -1 }, { 14, 6, 3, 13, 2 }, { 0, 0, 0, 0, 0 } }, -0.0741820484f, 0.687417924f, 0.491902798f },
+	{ { { 3, 6, 14, 8, -1 }, { 3, 6, 7, 4, 2 }, { 10, 10, 7, 4, 2 } }, -0.0172541607f, 0.337067604f, 0.534873903f },
+	{ { { 16, 0, 4, 11, -1 }, { 16, 0, 2, 11, 2 }, { 0, 0, 0, 0, 0 } }, 0.0148515599f, 0.462679297f, 0.612990499f },
+	{ { { 3, 4, 12, 12, -1 }, { 3, 4, 6, 6, 2 }, { 9, 10, 6, 6, 2 } }, 0.0100020003f, 0.534612298f, 0.342345387f },
+	{ { { 11, 4, 5, 3, -1 }, { 11, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00201381207f, 0.464383006f, 0.582430422f },
+	{ { { 4, 11, 4, 2, -1 }, { 4, 12, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00151354703f, 0.519639611f, 0.285614997f },
+	{ { { 10, 7, 2, 2, -1 }, { 10, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.0031381431f, 0.483816296f, 0.595852971f },
+	{ { { 8, 7, 2, 2, -1 }, { 9, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00514504407f, 0.892030299f, 0.47414121f },
+	{ { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00447367085f, 0.203394294f, 0.533727884f },
+	{ { { 5, 6, 3, 3, -1 }, { 5, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00196284708f, 0.457163393f, 0.672586322f },
+	{ { { 10, 0, 3, 3, -1 }, { 11, 0, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00542604504f, 0.527110815f, 0.284567088f },
+	{ { { 5, 6, 6, 2, -1 }, { 5, 6, 3, 1, 2 }, { 8, 7, 3, 1, 2 } }, 0.000496114604f, 0.413831294f, 0.571859777f },
+	{ { { 12, 16, 4, 3, -1 }, { 12, 17, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00937287882f, 0.522515118f, 0.280484706f },
+	{ { { 3, 12, 3, 2, -1 }, { 3, 13, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000605008972f, 0.523676872f, 0.331452399f },
+	{ { { 9, 12, 3, 2, -1 }, { 9, 13, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000567925512f, 0.453105986f, 0.62769711f },
+	{ { { 1, 11, 16, 4, -1 }, { 1, 11, 8, 2, 2 }, { 9, 13, 8, 2, 2 } }, 0.0246443395f, 0.513085186f, 0.201714396f },
+	{ { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0102904504f, 0.778659523f, 0.487664104f },
+	{ { { 4, 4, 5, 3, -1 }, { 4, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0020629419f, 0.42885989f, 0.588126421f },
+	{ { { 12, 16, 4, 3, -1 }, { 12, 17, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00505194813f, 0.352397799f, 0.528600872f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00576926209f, 0.684108615f, 0.458809406f },
+	{ { { 9, 0, 2, 2, -1 }, { 9, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000457899412f, 0.356552005f, 0.548597813f },
+	{ { { 8, 9, 4, 2, -1 }, { 8, 10, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000759188377f, 0.336879313f, 0.525419712f },
+	{ { { 8, 8, 4, 3, -1 }, { 8, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00177372596f, 0.342216104f, 0.545401514f },
+	{ { { 0, 13, 6, 3, -1 }, { 2, 13, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00856104679f, 0.653361201f, 0.448585689f },
+	{ { { 16, 14, 3, 2, -1 }, { 16, 15, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00172772701f, 0.530758023f, 0.392535299f },
+	{ { { 1, 18, 18, 2, -1 }, { 7, 18, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0281996094f, 0.685745895f, 0.458858401f },
+	{ { { 16, 14, 3, 2, -1 }, { 16, 15, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00177811098f, 0.40378511f, 0.536985695f },
+	{ { { 1, 14, 3, 2, -1 }, { 1, 15, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000331771414f, 0.539979875f, 0.370575011f },
+	{ { { 7, 14, 6, 3, -1 }, { 7, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00263854f, 0.466543704f, 0.645273089f },
+	{ { { 5, 14, 8, 3, -1 }, { 5, 15, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00211830693f, 0.591478109f, 0.406467706f },
+	{ { { 10, 6, 4, 14, -1 }, { 10, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } }, -0.0147732897f, 0.364203811f, 0.529476285f },
+	{ { { 6, 6, 4, 14, -1 }, { 8, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } }, -0.0168154407f, 0.266423196f, 0.51449728f },
+	{ { { 13, 5, 2, 3, -1 }, { 13, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00633701403f, 0.677953124f, 0.485209793f },
+	{ { { 7, 16, 6, 1, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -4.4560049e-05f, 0.56139648f, 0.415305406f },
+	{ { { 9, 12, 3, 3, -1 }, { 9, 13, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00102406205f, 0.596447825f, 0.456630409f },
+	{ { { 7, 0, 3, 3, -1 }, { 8, 0, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00231616898f, 0.297611505f, 0.518815994f },
+	{ { { 4, 0, 16, 18, -1 }, { 4, 9, 16, 9, 2 }, { 0, 0, 0, 0, 0 } }, 0.53217572f, 0.518783927f, 0.220263198f },
+	{ { { 1, 1, 16, 14, -1 }, { 1, 8, 16, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.166430503f, 0.186602294f, 0.506034315f },
+	{ { { 3, 9, 15, 4, -1 }, { 8, 9, 5, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.112535298f, 0.521212518f, 0.118502297f },
+	{ { { 6, 12, 7, 3, -1 }, { 6, 13, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00930468645f, 0.458993703f, 0.682614923f },
+	{ { { 14, 15, 2, 3, -1 }, { 14, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00462550996f, 0.307994097f, 0.522500873f },
+	{ { { 2, 3, 16, 14, -1 }, { 2, 3, 8, 7, 2 }, { 10, 10, 8, 7, 2 } }, -0.111164697f, 0.210104406f, 0.508080184f },
+	{ { { 16, 2, 4, 18, -1 }, { 18, 2, 2, 9, 2 }, { 16, 11, 2, 9, 2 } }, -0.0108884396f, 0.576535523f, 0.479046404f },
+	{ { { 4, 15, 2, 3, -1 }, { 4, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00585643016f, 0.506510019f, 0.156359896f },
+	{ { { 16, 2, 4, 18, -1 }, { 18, 2, 2, 9, 2 }, { 16, 11, 2, 9, 2 } }, 0.0548543893f, 0.496691495f, 0.723051071f },
+	{ { { 1, 1, 8, 3, -1 }, { 1, 2, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0111973397f, 0.219497904f, 0.509879827f },
+	{ { { 8, 11, 4, 3, -1 }, { 8, 12, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00440690713f, 0.477840185f, 0.677090287f },
+	{ { { 5, 11, 5, 9, -1 }, { 5, 14, 5, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0636652932f, 0.193636298f, 0.508102417f },
+	{ { { 16, 0, 4, 11, -1 }, { 16, 0, 2, 11, 2 }, { 0, 0, 0, 0, 0 } }, -0.00980814919f, 0.599906325f, 0.4810341f },
+	{ { { 7, 0, 6, 1, -1 }, { 9, 0, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0021717099f, 0.333833396f, 0.523547292f },
+	{ { { 16, 3, 3, 7, -1 }, { 17, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.0133155202f, 0.661706984f, 0.491921306f },
+	{ { { 1, 3, 3, 7, -1 }, { 2, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.00254420796f, 0.448874414f, 0.608218491f },
+	{ { { 7, 8, 6, 12, -1 }, { 7, 12, 6, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0120378397f, 0.540939212f, 0.329243213f },
+	{ { { 0, 0, 4, 11, -1 }, { 2, 0, 2, 11, 2 }, { 0, 0, 0, 0, 0 } }, -0.0207010508f, 0.681912005f, 0.459499598f },
+	{ { { 14, 0, 6, 20, -1 }, { 14, 0, 3, 20, 2 }, { 0, 0, 0, 0, 0 } }, 0.0276082791f, 0.463079214f, 0.576728284f },
+	{ { { 0, 3, 1, 2, -1 }, { 0, 4, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00123706204f, 0.516537905f, 0.263501614f },
+	{ { { 5, 5, 10, 8, -1 }, { 10, 5, 5, 4, 2 }, { 5, 9, 5, 4, 2 } }, -0.0376693383f, 0.253639311f, 0.527898014f },
+	{ { { 4, 7, 12, 4, -1 }, { 4, 7, 6, 2, 2 }, { 10, 9, 6, 2, 2 } }, -0.00180572597f, 0.398515612f, 0.551750004f },
+	/* stage 12 */
+	{ { { 2, 1, 6, 4, -1 }, { 5, 1, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00442990288f, 0.289101809f, 0.63352263f },
+	{ { { 9, 7, 6, 4, -1 }, { 12, 7, 3, 2, 2 }, { 9, 9, 3, 2, 2 } }, -0.00238133199f, 0.621178925f, 0.347748786f },
+	{ { { 5, 6, 2, 6, -1 }, { 5, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00229157112f, 0.225441203f, 0.558211803f },
+	{ { { 9, 16, 6, 4, -1 }, { 12, 16, 3, 2, 2 }, { 9, 18, 3, 2, 2 } }, 0.000994579401f, 0.371171087f, 0.593007088f },
+	{ { { 9, 4, 2, 12, -1 }, { 9, 10, 2, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.000771646679f, 0.565172017f, 0.334799588f },
+	{ { { 7, 1, 6, 18, -1 }, { 9, 1, 2, 18, 3 }, { 0, 0, 0, 0, 0 } }, -0.00113864103f, 0.306912601f, 0.550863087f },
+	{ { { 4, 12, 12, 2, -1 }, { 8, 12, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000164030396f, 0.576282799f, 0.369904786f },
+	{ { { 8, 8, 6, 2, -1 }, { 8, 9, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 2.97935294e-05f, 0.264424413f, 0.543791115f },
+	{ { { 8, 0, 3, 6, -1 }, { 9, 0, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.00857749023f, 0.5051139f, 0.179572493f },
+	{ { { 11, 18, 3, 2, -1 }, { 11, 19, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000260326895f, 0.582696915f, 0.444682688f },
+	{ { { 1, 1, 17, 4, -1 }, { 1, 3, 17, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00614046305f, 0.311385214f, 0.534697175f },
+	{ { { 11, 8, 4, 12, -1 }, { 11, 8, 2, 12, 2 }, { 0, 0, 0, 0, 0 } }, -0.0230869502f, 0.327794611f, 0.533119798f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0142436503f, 0.738170981f, 0.458806306f },
+	{ { { 12, 3, 2, 17, -1 }, { 12, 3, 1, 17, 2 }, { 0, 0, 0, 0, 0 } }, 0.0194871295f, 0.525663078f, 0.227447197f },
+	{ { { 4, 7, 6, 1, -1 }, { 6, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000966811087f, 0.551123083f, 0.381500691f },
+	{ { { 18, 3, 2, 3, -1 }, { 18, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.003147471f, 0.542563677f, 0.254372686f },
+	{ { { 8, 4, 3, 4, -1 }, { 8, 6, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0001802607f, 0.53801918f, 0.340630412f },
+	{ { { 4, 5, 12, 10, -1 }, { 4, 10, 12, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.0060266261f, 0.303580195f, 0.542057216f },
+	{ { { 5, 18, 4, 2, -1 }, { 7, 18, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000444629608f, 0.399099708f, 0.566011012f },
+	{ { { 17, 2, 3, 6, -1 }, { 17, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00226097601f, 0.556280673f, 0.394068807f },
+	{ { { 7, 7, 6, 6, -1 }, { 9, 7, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.051133059f, 0.460965395f, 0.711856186f },
+	{ { { 17, 2, 3, 6, -1 }, { 17, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0177863091f, 0.231616601f, 0.532214403f },
+	{ { { 8, 0, 3, 4, -1 }, { 9, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00496796286f, 0.233077198f, 0.512202919f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00206676894f, 0.465744406f, 0.64554882f },
+	{ { { 0, 12, 6, 3, -1 }, { 0, 13, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0074413768f, 0.515439212f, 0.236163393f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00362772797f, 0.621977329f, 0.447666109f },
+	{ { { 3, 12, 2, 3, -1 }, { 3, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00535307592f, 0.183735505f, 0.510220826f },
+	{ { { 5, 6, 12, 7, -1 }, { 9, 6, 4, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.145309195f, 0.514598727f, 0.153593093f },
+	{ { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00243944908f, 0.534366012f, 0.362466186f },
+	{ { { 14, 6, 1, 3, -1 }, { 14, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00312833907f, 0.62150079f, 0.484559208f },
+	{ { { 2, 0, 3, 14, -1 }, { 3, 0, 1, 14, 3 }, { 0, 0, 0, 0, 0 } }, 0.001794026f, 0.429926187f, 0.582419813f },
+	{ { { 12, 14, 5, 6, -1 }, { 12, 16, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0362538211f, 0.526033401f, 0.143946797f },
+	{ { { 4, 14, 5, 6, -1 }, { 4, 16, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00517467223f, 0.350653887f, 0.528704524f },
+	{ { { 11, 10, 2, 2, -1 }, { 12, 10, 1, 1, 2 }, { 11, 11, 1, 1, 2 } }, 0.000653832976f, 0.480964094f, 0.612204015f },
+	{ { { 5, 0, 3, 14, -1 }, { 6, 0, 1, 14, 3 }, { 0, 0, 0, 0, 0 } }, -0.0264802296f, 0.113936201f, 0.504558623f },
+	{ { { 10, 15, 2, 3, -1 }, { 10, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00304406602f, 0.635209501f, 0.479473412f },
+	{ { { 0, 2, 2, 3, -1 }, { 0, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00369935203f, 0.51311183f, 0.249851093f },
+	{ { { 5, 11, 12, 6, -1 }, { 5, 14, 12, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000367629313f, 0.542139471f, 0.370953202f },
+	{ { { 6, 11, 3, 9, -1 }, { 6, 14, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0413822606f, 0.189495996f, 0.508169174f },
+	{ { { 11, 10, 2, 2, -1 }, { 12, 10, 1, 1, 2 }, { 11, 11, 1, 1, 2 } }, -0.00105327298f, 0.645436704f, 0.478360891f },
+	{ { { 5, 6, 1, 3, -1 }, { 5, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00216486002f, 0.621503115f, 0.449982613f },
+	{ { { 4, 9, 13, 3, -1 }, { 4, 10, 13, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000567477487f, 0.37126109f, 0.541933477f },
+	{ { { 1, 7, 15, 6, -1 }, { 6, 7, 5, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.173758402f, 0.502364397f, 0.121574201f },
+	{ { { 4, 5, 12, 6, -1 }, { 8, 5, 4, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.00290496997f, 0.324026793f, 0.538188398f },
+	{ { { 8, 10, 4, 3, -1 }, { 8, 11, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00122995395f, 0.416550785f, 0.57034862f },
+	{ { { 15, 14, 1, 3, -1 }, { 15, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000543292379f, 0.385404289f, 0.554754913f },
+	{ { { 1, 11, 5, 3, -1 }, { 1, 12, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00832972582f, 0.220449403f, 0.509708285f },
+	{ { { 7, 1, 7, 12, -1 }, { 7, 7, 7, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.000104176303f, 0.560706615f, 0.430303603f },
+	{ { { 0, 1, 6, 10, -1 }, { 0, 1, 3, 5, 2 }, { 3, 6, 3, 5, 2 } }, 0.0312047005f, 0.462165713f, 0.698200405f },
+	{ { { 16, 1, 4, 3, -1 }, { 16, 2, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00789435022f, 0.526959419f, 0.226906806f },
+	{ { { 5, 5, 2, 3, -1 }, { 5, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00436453102f, 0.635922313f, 0.453795612f },
+	{ { { 12, 2, 3, 5, -1 }, { 13, 2, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.00767930597f, 0.527476788f, 0.274048388f },
+	{ { { 0, 3, 4, 6, -1 }, { 0, 5, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0254311394f, 0.203851998f, 0.5071733f },
+	{ { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000820006011f, 0.458745509f, 0.611986816f },
+	{ { { 8, 18, 3, 1, -1 }, { 9, 18, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00292846002f, 0.507127404f, 0.202820495f },
+	{ { { 11, 10, 2, 2, -1 }, { 12, 10, 1, 1, 2 }, { 11, 11, 1, 1, 2 } }, 4.52564709e-05f, 0.481210411f, 0.543082178f },
+	{ { { 7, 10, 2, 2, -1 }, { 7, 10, 1, 1, 2 }, { 8, 11, 1, 1, 2 } }, 0.00131583097f, 0.462581396f, 0.677932322f },
+	{ { { 11, 11, 4, 4, -1 }, { 11, 13, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00158703898f, 0.538629174f, 0.343146503f },
+	{ { { 8, 12, 3, 8, -1 }, { 9, 12, 1, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.0215396602f, 0.0259425007f, 0.500322282f },
+	{ { { 13, 0, 6, 3, -1 }, { 13, 1, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0143344803f, 0.520284474f, 0.159063295f },
+	{ { { 8, 8, 3, 4, -1 }, { 9, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00838813838f, 0.728248119f, 0.464804411f },
+	{ { { 5, 7, 10, 10, -1 }, { 10, 7, 5, 5, 2 }, { 5, 12, 5, 5, 2 } }, 0.00919068418f, 0.556235671f, 0.392319113f },
+	{ { { 3, 18, 8, 2, -1 }, { 3, 18, 4, 1, 2 }, { 7, 19, 4, 1, 2 } }, -0.00584530598f, 0.680339277f, 0.462912798f },
+	{ { { 10, 2, 6, 8, -1 }, { 12, 2, 2, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.0547077991f, 0.256167114f, 0.520612597f },
+	{ { { 4, 2, 6, 8, -1 }, { 6, 2, 2, 8, 3 }, { 0, 0, 0, 0, 0 } }, 0.00911427755f, 0.518962026f, 0.305387706f },
+	{ { { 11, 0, 3, 7, -1 }, { 12, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.0155750001f, 0.129507497f, 0.51690948f },
+	{ { { 7, 11, 2, 1, -1 }, { 8, 11, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000120506003f, 0.573509812f, 0.423082501f },
+	{ { { 15, 14, 1, 3, -1 }, { 15, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00122739701f, 0.528987825f, 0.40797919f },
+	{ { { 7, 15, 2, 2, -1 }, { 7, 15, 1, 1, 2 }, { 8, 16, 1, 1, 2 } }, -0.00121866004f, 0.657563984f, 0.457440913f },
+	{ { { 15, 14, 1, 3, -1 }, { 15, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0033256649f, 0.362804711f, 0.519501984f },
+	{ { { 6, 0, 3, 7, -1 }, { 7, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.0132883098f, 0.128426597f, 0.504348874f },
+	{ { { 18, 1, 2, 7, -1 }, { 18, 1, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.00338397711f, 0.629224002f, 0.475750595f },
+	{ { { 2, 0, 8, 20, -1 }, { 2, 10, 8, 10, 2 }, { 0, 0, 0, 0, 0 } }, -0.219542205f, 0.148773193f, 0.506501377f },
+	{ { { 3, 0, 15, 6, -1 }, { 3, 2, 15, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00491117081f, 0.425610214f, 0.566583872f },
+	{ { { 4, 3, 12, 2, -1 }, { 4, 4, 12, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000187449506f, 0.400414407f, 0.55868572f },
+	{ { { 16, 0, 4, 5, -1 }, { 16, 0, 2, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00521786418f, 0.600911617f, 0.481270611f },
+	{ { { 7, 0, 3, 4, -1 }, { 8, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.001111152f, 0.351493388f, 0.528708994f },
+	{ { { 16, 0, 4, 5, -1 }, { 16, 0, 2, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00440364005f, 0.464227587f, 0.592408597f },
+	{ { { 1, 7, 6, 13, -1 }, { 3, 7, 2, 13, 3 }, { 0, 0, 0, 0, 0 } }, 0.122994997f, 0.502552927f, 0.0691524819f },
+	{ { { 16, 0, 4, 5, -1 }, { 16, 0, 2, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.0123135103f, 0.588459194f, 0.493401289f },
+	{ { { 0, 0, 4, 5, -1 }, { 2, 0, 2, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00414710399f, 0.437223911f, 0.58934778f },
+	{ { { 14, 12, 3, 6, -1 }, { 14, 14, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00355026498f, 0.432755113f, 0.539627016f },
+	{ { { 3, 12, 3, 6, -1 }, { 3, 14, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0192242693f, 0.191313401f, 0.506833076f },
+	{ { { 16, 1, 4, 3, -1 }, { 16, 2, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00143950596f, 0.530817807f, 0.424353302f },
+	{ { { 8, 7, 2, 10, -1 }, { 8, 7, 1, 5, 2 }, { 9, 12, 1, 5, 2 } }, -0.0067751999f, 0.636539578f, 0.454008609f },
+	{ { { 11, 11, 4, 4, -1 }, { 11, 13, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00701196305f, 0.518983424f, 0.302619994f },
+	{ { { 0, 1, 4, 3, -1 }, { 0, 2, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00540146511f, 0.510506213f, 0.255768299f },
+	{ { { 13, 4, 1, 3, -1 }, { 13, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000902749889f, 0.469691485f, 0.586182773f },
+	{ { { 7, 15, 3, 5, -1 }, { 8, 15, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0114744501f, 0.505364597f, 0.152717799f },
+	{ { { 9, 7, 3, 5, -1 }, { 10, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.006702343f, 0.650898099f, 0.489060402f },
+	{ { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00204629591f, 0.624181688f, 0.451460004f },
+	{ { { 10, 6, 4, 14, -1 }, { 10, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } }, -0.0099951569f, 0.34327811f, 0.540095389f },
+	{ { { 0, 5, 5, 6, -1 }, { 0, 7, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0357007086f, 0.187805906f, 0.507407784f },
+	{ { { 9, 5, 6, 4, -1 }, { 9, 5, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000455845613f, 0.380527705f, 0.540256977f },
+	{ { { 0, 0, 18, 10, -1 }, { 6, 0, 6, 10, 3 }, { 0, 0, 0, 0, 0 } }, -0.0542606004f, 0.684371471f, 0.459509701f },
+	{ { { 10, 6, 4, 14, -1 }, { 10, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } }, 0.00606004614f, 0.550290525f, 0.450052798f },
+	{ { { 6, 6, 4, 14, -1 }, { 8, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } }, -0.00647918321f, 0.33688581f, 0.531075716f },
+	{ { { 13, 4, 1, 3, -1 }, { 13, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.001493947f, 0.648764014f, 0.475617588f },
+	{ { { 5, 1, 2, 3, -1 }, { 6, 1, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 1.46105303e-05f, 0.40345791f, 0.545106411f },
+	{ { { 18, 1, 2, 18, -1 }, { 19, 1, 1, 9, 2 }, { 18, 10, 1, 9, 2 } }, -0.00723219384f, 0.638687372f, 0.482473999f },
+	{ { { 2, 1, 4, 3, -1 }, { 2, 2, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00406458182f, 0.298642188f, 0.5157336f },
+	{ { { 18, 1, 2, 18, -1 }, { 19, 1, 1, 9, 2 }, { 18, 10, 1, 9, 2 } }, 0.0304630809f, 0.502219975f, 0.71599561f },
+	{ { { 1, 14, 4, 6, -1 }, { 1, 14, 2, 3, 2 }, { 3, 17, 2, 3, 2 } }, -0.00805449113f, 0.649245203f, 0.461927503f },
+	{ { { 10, 11, 7, 6, -1 }, { 10, 13, 7, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.039505139f, 0.515057087f, 0.245061398f },
+	{ { { 0, 10, 6, 10, -1 }, { 0, 10, 3, 5, 2 }, { 3, 15, 3, 5, 2 } }, 0.00845302083f, 0.457366914f, 0.639403701f },
+	{ { { 11, 0, 3, 4, -1 }, { 12, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00116881204f, 0.386551201f, 0.548366129f },
+	{ { { 5, 10, 5, 6, -1 }, { 5, 13, 5, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00280706701f, 0.512857914f, 0.270148009f },
+	{ { { 14, 6, 1, 8, -1 }, { 14, 10, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000473652093f, 0.405158192f, 0.538746119f },
+	{ { { 1, 7, 18, 6, -1 }, { 1, 7, 9, 3, 2 }, { 10, 10, 9, 3, 2 } }, 0.0117410803f, 0.529595017f, 0.371941388f },
+	{ { { 9, 7, 2, 2, -1 }, { 9, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00318332389f, 0.478940696f, 0.68951261f },
+	{ { { 5, 9, 4, 5, -1 }, { 7, 9, 2, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.000702415011f, 0.53844893f, 0.391808093f },
+	/* stage 13 */
+	{ { { 7, 6, 6, 3, -1 }, { 9, 6, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0170599297f, 0.394852787f, 0.714253485f },
+	{ { { 1, 0, 18, 4, -1 }, { 7, 0, 6, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0218408406f, 0.337031603f, 0.609001696f },
+	{ { { 7, 15, 2, 4, -1 }, { 7, 17, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000245200499f, 0.350057602f, 0.598790228f },
+	{ { { 1, 0, 19, 9, -1 }, { 1, 3, 19, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00832726061f, 0.326752812f, 0.569724083f },
+	{ { { 3, 7, 3, 6, -1 }, { 3, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000571482989f, 0.304459989f, 0.553165674f },
+	{ { { 13, 7, 4, 4, -1 }, { 15, 7, 2, 2, 2 }, { 13, 9, 2, 2, 2 } }, 0.00067373988f, 0.365001202f, 0.567263126f },
+	{ { { 3, 7, 4, 4, -1 }, { 3, 7, 2, 2, 2 }, { 5, 9, 2, 2, 2 } }, 3.46815905e-05f, 0.331354111f, 0.538872719f },
+	{ { { 9, 6, 10, 8, -1 }, { 9, 10, 10, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.00585633982f, 0.269794285f, 0.549877882f },
+	{ { { 3, 8, 14, 12, -1 }, { 3, 14, 14, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00851022732f, 0.526935816f, 0.276287913f },
+	{ { { 6, 5, 10, 12, -1 }, { 11, 5, 5, 6, 2 }, { 6, 11, 5, 6, 2 } }, -0.0698172078f, 0.290960312f, 0.525924683f },
+	{ { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000861136708f, 0.589257717f, 0.407369792f },
+	{ { { 9, 5, 6, 5, -1 }, { 9, 5, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.000971492496f, 0.352356404f, 0.54158622f },
+	{ { { 9, 4, 2, 4, -1 }, { 9, 6, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -1.47274905e-05f, 0.542301774f, 0.350315601f },
+	{ { { 9, 5, 6, 5, -1 }, { 9, 5, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.0484202914f, 0.519394577f, 0.341119587f },
+	{ { { 5, 5, 6, 5, -1 }, { 8, 5, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00132571405f, 0.315776914f, 0.533537626f },
+	{ { { 11, 2, 6, 1, -1 }, { 13, 2, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 1.49221496e-05f, 0.445129991f, 0.553655386f },
+	{ { { 3, 2, 6, 1, -1 }, { 5, 2, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0027173399f, 0.303174198f, 0.524808884f },
+	{ { { 13, 5, 2, 3, -1 }, { 13, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00292195007f, 0.478145301f, 0.660604179f },
+	{ { { 0, 10, 1, 4, -1 }, { 0, 12, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0019804989f, 0.318630815f, 0.528762519f },
+	{ { { 13, 5, 2, 3, -1 }, { 13, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00400121091f, 0.641359687f, 0.474992812f },
+	{ { { 8, 18, 3, 2, -1 }, { 9, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00434919912f, 0.150749803f, 0.509899676f },
+	{ { { 6, 15, 9, 2, -1 }, { 6, 16, 9, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00134908897f, 0.431615889f, 0.588116705f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0185970701f, 0.473555386f, 0.908979416f },
+	{ { { 18, 4, 2, 4, -1 }, { 18, 6, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.001856238f, 0.355318904f, 0.557783723f },
+	{ { { 5, 5, 2, 3, -1 }, { 5, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00229404308f, 0.450009495f, 0.65808779f },
+	{ { { 15, 16, 3, 2, -1 }, { 15, 17, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000299828505f, 0.562924206f, 0.397587895f },
+	{ { { 0, 0, 3, 9, -1 }, { 0, 3, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00354554597f, 0.538154721f, 0.360548586f },
+	{ { { 9, 7, 3, 3, -1 }, { 9, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00961047225f, 0.525599718f, 0.179674596f },
+	{ { { 8, 7, 3, 3, -1 }, { 8, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00627832208f, 0.227285698f, 0.511403024f },
+	{ { { 9, 5, 2, 6, -1 }, { 9, 5, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.003459848f, 0.462630808f, 0.660821915f },
+	{ { { 8, 6, 3, 4, -1 }, { 9, 6, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00131120195f, 0.631753981f, 0.4436858f },
+	{ { { 7, 6, 8, 12, -1 }, { 11, 6, 4, 6, 2 }, { 7, 12, 4, 6, 2 } }, 0.0026876179f, 0.54211098f, 0.405402213f },
+	{ { { 5, 6, 8, 12, -1 }, { 5, 6, 4, 6, 2 }, { 9, 12, 4, 6, 2 } }, 0.00391181698f, 0.535847783f, 0.32734549f },
+	{ { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0142064504f, 0.779357672f, 0.497578114f },
+	{ { { 2, 16, 3, 2, -1 }, { 2, 17, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000717055285f, 0.529731989f, 0.356090397f },
+	{ { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00166350196f, 0.467809409f, 0.581648171f },
+	{ { { 2, 12, 6, 6, -1 }, { 2, 14, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0033686189f, 0.527673423f, 0.344642013f },
+	{ { { 7, 13, 6, 3, -1 }, { 7, 14, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0127995303f, 0.483467996f, 0.747215927f },
+	{ { { 6, 14, 6, 3, -1 }, { 6, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00339012011f, 0.451185912f, 0.640172124f },
+	{ { { 14, 15, 5, 3, -1 }, { 14, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00470707798f, 0.533565879f, 0.355522096f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00148193398f, 0.425070703f, 0.577272415f },
+	{ { { 14, 15, 5, 3, -1 }, { 14, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.006999576f, 0.30033201f, 0.52929002f },
+	{ { { 5, 3, 6, 2, -1 }, { 7, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0159390103f, 0.506731927f, 0.167558193f },
+	{ { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00763773499f, 0.479506999f, 0.708560109f },
+	{ { { 1, 15, 5, 3, -1 }, { 1, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00673340401f, 0.513311327f, 0.216247007f },
+	{ { { 8, 13, 4, 6, -1 }, { 10, 13, 2, 3, 2 }, { 8, 16, 2, 3, 2 } }, -0.0128588099f, 0.193884194f, 0.525137186f },
+	{ { { 7, 8, 3, 3, -1 }, { 8, 8, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.000622708001f, 0.568653822f, 0.419786811f },
+	{ { { 12, 0, 5, 4, -1 }, { 12, 2, 5, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000526516815f, 0.422416896f, 0.542969584f },
+	{ { { 0, 2, 20, 2, -1 }, { 0, 2, 10, 1, 2 }, { 10, 3, 10, 1, 2 } }, 0.0110750999f, 0.511377513f, 0.25145179f },
+	{ { { 1, 0, 18, 4, -1 }, { 7, 0, 6, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0367282517f, 0.719466209f, 0.484961897f },
+	{ { { 4, 3, 6, 1, -1 }, { 6, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000282071094f, 0.3840262f, 0.539444625f },
+	{ { { 4, 18, 13, 2, -1 }, { 4, 19, 13, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00274896901f, 0.593708873f, 0.45691821f },
+	{ { { 2, 10, 3, 6, -1 }, { 2, 12, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0100475196f, 0.513857603f, 0.280229807f },
+	{ { { 14, 12, 6, 8, -1 }, { 17, 12, 3, 4, 2 }, { 14, 16, 3, 4, 2 } }, -0.00814978406f, 0.609003723f, 0.463612109f },
+	{ { { 4, 13, 10, 6, -1 }, { 4, 13, 5, 3, 2 }, { 9, 16, 5, 3, 2 } }, -0.00688338885f, 0.345861107f, 0.525466025f },
+	{ { { 14, 12, 1, 2, -1 }, { 14, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -1.40393604e-05f, 0.569310427f, 0.408208311f },
+	{ { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00154984195f, 0.435053706f, 0.5806517f },
+	{ { { 14, 12, 2, 2, -1 }, { 14, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00678414991f, 0.146887302f, 0.518277526f },
+	{ { { 4, 12, 2, 2, -1 }, { 4, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000217056295f, 0.529352427f, 0.345617414f },
+	{ { { 8, 12, 9, 2, -1 }, { 8, 13, 9, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000311988988f, 0.465245098f, 0.594241381f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00545075303f, 0.465350896f, 0.702484608f },
+	{ { { 11, 10, 3, 6, -1 }, { 11, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00025818689f, 0.549729526f, 0.376896709f },
+	{ { { 5, 6, 9, 12, -1 }, { 5, 12, 9, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.0174425393f, 0.391908795f, 0.545749784f },
+	{ { { 11, 10, 3, 6, -1 }, { 11, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0453435294f, 0.163135707f, 0.51549089f },
+	{ { { 6, 10, 3, 6, -1 }, { 6, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00191906898f, 0.514589787f, 0.279189587f },
+	{ { { 5, 4, 11, 3, -1 }, { 5, 5, 11, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00601778692f, 0.651763618f, 0.475633293f },
+	{ { { 7, 1, 5, 10, -1 }, { 7, 6, 5, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00407207385f, 0.551465273f, 0.409268588f },
+	{ { { 2, 8, 18, 2, -1 }, { 2, 9, 18, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00039855059f, 0.316524088f, 0.528555095f },
+	{ { { 7, 17, 5, 3, -1 }, { 7, 18, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00654185703f, 0.685337782f, 0.46528089f },
+	{ { { 5, 9, 12, 1, -1 }, { 9, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00348450895f, 0.548458815f, 0.450275987f },
+	{ { { 0, 14, 6, 6, -1 }, { 0, 14, 3, 3, 2 }, { 3, 17, 3, 3, 2 } }, -0.0136967804f, 0.639577985f, 0.457255512f },
+	{ { { 5, 9, 12, 1, -1 }, { 9, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0173471402f, 0.275107294f, 0.518161476f },
+	{ { { 3, 9, 12, 1, -1 }, { 7, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00408854289f, 0.332563609f, 0.519498408f },
+	{ { { 14, 10, 6, 7, -1 }, { 14, 10, 3, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.00946879014f, 0.594228089f, 0.485181987f },
+	{ { { 1, 0, 16, 2, -1 }, { 1, 1, 16, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00170848402f, 0.416711092f, 0.551980615f },
+	{ { { 10, 9, 10, 9, -1 }, { 10, 12, 10, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00948090944f, 0.543389499f, 0.420851499f },
+	{ { { 0, 1, 10, 2, -1 }, { 5, 1, 5, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00473896507f, 0.640718997f, 0.456065506f },
+	{ { { 17, 3, 2, 3, -1 }, { 17, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00657610502f, 0.521455526f, 0.225822702f },
+	{ { { 1, 3, 2, 3, -1 }, { 1, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00216905493f, 0.315152794f, 0.515670478f },
+	{ { { 9, 7, 3, 6, -1 }, { 10, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.0146601703f, 0.487083703f, 0.668994129f },
+	{ { { 6, 5, 4, 3, -1 }, { 8, 5, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000172319997f, 0.3569749f, 0.525107801f },
+	{ { { 7, 5, 6, 6, -1 }, { 9, 5, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0218037609f, 0.882592082f, 0.496632993f },
+	{ { { 3, 4, 12, 12, -1 }, { 3, 4, 6, 6, 2 }, { 9, 10, 6, 6, 2 } }, -0.0947361067f, 0.144616202f, 0.506111383f },
+	{ { { 9, 2, 6, 15, -1 }, { 11, 2, 2, 15, 3 }, { 0, 0, 0, 0, 0 } }, 0.0055825552f, 0.539647877f, 0.423806608f },
+	{ { { 2, 2, 6, 17, -1 }, { 4, 2, 2, 17, 3 }, { 0, 0, 0, 0, 0 } }, 0.00195170904f, 0.417041093f, 0.5497787f },
+	{ { { 14, 10, 6, 7, -1 }, { 14, 10, 3, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.0121499002f, 0.469836712f, 0.56642741f },
+	{ { { 0, 10, 6, 7, -1 }, { 3, 10, 3, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.00751696201f, 0.626777291f, 0.44631359f },
+	{ { { 9, 2, 6, 15, -1 }, { 11, 2, 2, 15, 3 }, { 0, 0, 0, 0, 0 } }, -0.0716679096f, 0.309701115f, 0.522100329f },
+	{ { { 5, 2, 6, 15, -1 }, { 7, 2, 2, 15, 3 }, { 0, 0, 0, 0, 0 } }, -0.0882924199f, 0.0811238885f, 0.500636518f },
+	{ { { 17, 9, 3, 6, -1 }, { 17, 11, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0310630798f, 0.515550375f, 0.128225595f },
+	{ { { 6, 7, 6, 6, -1 }, { 8, 7, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.0466218404f, 0.469977796f, 0.736396074f },
+	{ { { 1, 10, 18, 6, -1 }, { 10, 10, 9, 3, 2 }, { 1, 13, 9, 3, 2 } }, -0.0121894898f, 0.392053008f, 0.551899672f },
+	{ { { 0, 9, 10, 9, -1 }, { 0, 12, 10, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0130161103f, 0.526065826f, 0.368513614f },
+	{ { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00349528994f, 0.633929491f, 0.4716281f },
+	{ { { 5, 12, 3, 4, -1 }, { 5, 14, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -4.40150397e-05f, 0.533302724f, 0.377618492f },
+	{ { { 3, 3, 16, 12, -1 }, { 3, 9, 16, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.109664902f, 0.176534206f, 0.519834697f },
+	{ { { 1, 1, 12, 12, -1 }, { 1, 1, 6, 6, 2 }, { 7, 7, 6, 6, 2 } }, -0.000902795582f, 0.532415986f, 0.383890808f },
+	{ { { 10, 4, 2, 4, -1 }, { 11, 4, 1, 2, 2 }, { 10, 6, 1, 2, 2 } }, 0.000711266417f, 0.464792997f, 0.575522423f },
+	{ { { 0, 9, 10, 2, -1 }, { 0, 9, 5, 1, 2 }, { 5, 10, 5, 1, 2 } }, -0.00312502799f, 0.323670894f, 0.516677082f },
+	{ { { 9, 11, 3, 3, -1 }, { 9, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00241446798f, 0.478743911f, 0.645971775f },
+	{ { { 3, 12, 9, 2, -1 }, { 3, 13, 9, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000443912402f, 0.440930814f, 0.601025581f },
+	{ { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000226111893f, 0.403811395f, 0.549325585f },
+	/* stage 14 */
+	{ { { 3, 4, 13, 6, -1 }, { 3, 6, 13, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0469012894f, 0.660017192f, 0.374380112f },
+	{ { { 9, 7, 6, 4, -1 }, { 12, 7, 3, 2, 2 }, { 9, 9, 3, 2, 2 } }, -0.00145683496f, 0.578399122f, 0.343779713f },
+	{ { { 1, 0, 6, 8, -1 }, { 4, 0, 3, 8, 2 }, { 0, 0, 0, 0, 0 } }, 0.00555983698f, 0.362226695f, 0.590821624f },
+	{ { { 9, 5, 2, 12, -1 }, { 9, 11, 2, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.000731704873f, 0.550041914f, 0.28735581f },
+	{ { { 4, 4, 3, 10, -1 }, { 4, 9, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00133180094f, 0.267316997f, 0.543101907f },
+	{ { { 6, 17, 8, 3, -1 }, { 6, 18, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000243470597f, 0.385502785f, 0.57413888f },
+	{ { { 0, 5, 10, 6, -1 }, { 0, 7, 10, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00305124698f, 0.550320983f, 0.346284509f },
+	{ { { 13, 2, 3, 2, -1 }, { 13, 3, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000686571992f, 0.329122186f, 0.542950928f },
+	{ { { 7, 5, 4, 5, -1 }, { 9, 5, 2, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00146682002f, 0.358838201f, 0.535181105f },
+	{ { { 12, 14, 3, 6, -1 }, { 12, 16, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000320218707f, 0.429684192f, 0.570023417f },
+	{ { { 1, 11, 8, 2, -1 }, { 1, 12, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000741221884f, 0.528216481f, 0.336687088f },
+	{ { { 7, 13, 6, 3, -1 }, { 7, 14, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00383302988f, 0.455956787f, 0.625733614f },
+	{ { { 0, 5, 3, 6, -1 }, { 0, 7, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0154564399f, 0.235011697f, 0.512945294f },
+	{ { { 13, 2, 3, 2, -1 }, { 13, 3, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00267967791f, 0.53294152f, 0.415506214f },
+	{ { { 4, 14, 4, 6, -1 }, { 4, 14, 2, 3, 2 }, { 6, 17, 2, 3, 2 } }, 0.00282965694f, 0.427308798f, 0.580453813f },
+	{ { { 13, 2, 3, 2, -1 }, { 13, 3, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00394442491f, 0.291261196f, 0.520268619f },
+	{ { { 8, 2, 4, 12, -1 }, { 8, 6, 4, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00271795597f, 0.530768812f, 0.358567715f },
+	{ { { 14, 0, 6, 8, -1 }, { 17, 0, 3, 4, 2 }, { 14, 4, 3, 4, 2 } }, 0.0059077628f, 0.470377505f, 0.59415859f },
+	{ { { 7, 17, 3, 2, -1 }, { 8, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00422403496f, 0.214156702f, 0.508879602f },
+	{ { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00407258887f, 0.476641387f, 0.684106112f },
+	{ { { 6, 0, 8, 12, -1 }, { 6, 0, 4, 6, 2 }, { 10, 6, 4, 6, 2 } }, 0.0101495301f, 0.536079884f, 0.374849707f },
+	{ { { 14, 0, 2, 10, -1 }, { 15, 0, 1, 5, 2 }, { 14, 5, 1, 5, 2 } }, -0.000188649996f, 0.572013021f, 0.385380507f },
+	{ { { 5, 3, 8, 6, -1 }, { 5, 3, 4, 3, 2 }, { 9, 6, 4, 3, 2 } }, -0.00488643581f, 0.369312286f, 0.534095883f },
+	{ { { 14, 0, 6, 10, -1 }, { 17, 0, 3, 5, 2 }, { 14, 5, 3, 5, 2 } }, 0.02615848f, 0.496237487f, 0.605998993f },
+	{ { { 9, 14, 1, 2, -1 }, { 9, 15, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000485607598f, 0.443894595f, 0.601246893f },
+	{ { { 15, 10, 4, 3, -1 }, { 15, 11, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0112687098f, 0.52442503f, 0.184038803f },
+	{ { { 8, 14, 2, 3, -1 }, { 8, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00281146192f, 0.606028378f, 0.440989703f },
+	{ { { 3, 13, 14, 4, -1 }, { 10, 13, 7, 2, 2 }, { 3, 15, 7, 2, 2 } }, -0.00561127299f, 0.389117092f, 0.558923721f },
+	{ { { 1, 10, 4, 3, -1 }, { 1, 11, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00856800936f, 0.506934583f, 0.206261903f },
+	{ { { 9, 11, 6, 1, -1 }, { 11, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00038172779f, 0.588220179f, 0.419261098f },
+	{ { { 5, 11, 6, 1, -1 }, { 7, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000176802903f, 0.553360581f, 0.400336891f },
+	{ { { 3, 5, 16, 15, -1 }, { 3, 10, 16, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.00651125377f, 0.331014693f, 0.54441911f },
+	{ { { 6, 12, 4, 2, -1 }, { 8, 12, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -6.59486832e-05f, 0.543383181f, 0.3944906f },
+	{ { { 4, 4, 12, 10, -1 }, { 10, 4, 6, 5, 2 }, { 4, 9, 6, 5, 2 } }, 0.00699390518f, 0.560035825f, 0.41927141f },
+	{ { { 8, 6, 3, 4, -1 }, { 9, 6, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00467444398f, 0.668546677f, 0.460496098f },
+	{ { { 8, 12, 4, 8, -1 }, { 10, 12, 2, 4, 2 }, { 8, 16, 2, 4, 2 } }, 0.0115898503f, 0.535712123f, 0.292683005f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0130078401f, 0.467981786f, 0.730746329f },
+	{ { { 12, 2, 3, 2, -1 }, { 13, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00110085797f, 0.393750101f, 0.541506529f },
+	{ { { 8, 15, 3, 2, -1 }, { 8, 16, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000604726491f, 0.424237609f, 0.560404122f },
+	{ { { 6, 0, 9, 14, -1 }, { 9, 0, 3, 14, 3 }, { 0, 0, 0, 0, 0 } }, -0.0144948401f, 0.363121003f, 0.529318273f },
+	{ { { 9, 6, 2, 3, -1 }, { 10, 6, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00530569488f, 0.686045229f, 0.462182105f },
+	{ { { 10, 8, 2, 3, -1 }, { 10, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000818291272f, 0.394409686f, 0.542043924f },
+	{ { { 0, 9, 4, 6, -1 }, { 0, 11, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0190775208f, 0.196262196f, 0.503789186f },
+	{ { { 6, 0, 8, 2, -1 }, { 6, 1, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000355494703f, 0.408625901f, 0.561397314f },
+	{ { { 6, 14, 7, 3, -1 }, { 6, 15, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00196797308f, 0.448912114f, 0.592612326f },
+	{ { { 8, 10, 8, 9, -1 }, { 8, 13, 8, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00691891415f, 0.533592582f, 0.372838587f },
+	{ { { 5, 2, 3, 2, -1 }, { 6, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00298727793f, 0.511132121f, 0.297564387f },
+	{ { { 14, 1, 6, 8, -1 }, { 17, 1, 3, 4, 2 }, { 14, 5, 3, 4, 2 } }, -0.00622646185f, 0.554148972f, 0.482453793f },
+	{ { { 0, 1, 6, 8, -1 }, { 0, 1, 3, 4, 2 }, { 3, 5, 3, 4, 2 } }, 0.0133533003f, 0.458642393f, 0.64147979f },
+	{ { { 1, 2, 18, 6, -1 }, { 10, 2, 9, 3, 2 }, { 1, 5, 9, 3, 2 } }, 0.0335052386f, 0.539242506f, 0.342999488f },
+	{ { { 9, 3, 2, 1, -1 }, { 10, 3, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00252944604f, 0.170371398f, 0.501331508f },
+	{ { { 13, 2, 4, 6, -1 }, { 15, 2, 2, 3, 2 }, { 13, 5, 2, 3, 2 } }, -0.00128016295f, 0.530546188f, 0.46974051f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00706873881f, 0.461554587f, 0.643650472f },
+	{ { { 13, 5, 1, 3, -1 }, { 13, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00096880499f, 0.483359903f, 0.604389429f },
+	{ { { 2, 16, 5, 3, -1 }, { 2, 17, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00396476593f, 0.518763721f, 0.323181689f },
+	{ { { 13, 2, 4, 6, -1 }, { 15, 2, 2, 3, 2 }, { 13, 5, 2, 3, 2 } }, -0.0220577307f, 0.407925695f, 0.52009809f },
+	{ { { 3, 2, 4, 6, -1 }, { 3, 2, 2, 3, 2 }, { 5, 5, 2, 3, 2 } }, -0.000669063127f, 0.533160925f, 0.381560087f },
+	{ { { 13, 5, 1, 2, -1 }, { 13, 6, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000670093286f, 0.565542221f, 0.46889019f },
+	{ { { 5, 5, 2, 2, -1 }, { 5, 6, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000742845528f, 0.453438103f, 0.628740013f },
+	{ { { 13, 9, 2, 2, -1 }, { 13, 9, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00222278107f, 0.535063326f, 0.330365598f },
+	{ { { 5, 9, 2, 2, -1 }, { 6, 9, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00541305216f, 0.111368701f, 0.500543475f },
+	{ { { 13, 17, 3, 2, -1 }, { 13, 18, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -1.45200402e-05f, 0.562873781f, 0.432513386f },
+	{ { { 6, 16, 4, 4, -1 }, { 6, 16, 2, 2, 2 }, { 8, 18, 2, 2, 2 } }, 0.000233691695f, 0.416583508f, 0.544779122f },
+	{ { { 9, 16, 2, 3, -1 }, { 9, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00428945478f, 0.486039102f, 0.677864909f },
+	{ { { 0, 13, 9, 6, -1 }, { 0, 15, 9, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00591031509f, 0.526230514f, 0.361211389f },
+	{ { { 9, 14, 2, 6, -1 }, { 9, 17, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0129005397f, 0.531937718f, 0.325028807f },
+	{ { { 9, 15, 2, 3, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00469829794f, 0.461824507f, 0.666592598f },
+	{ { { 1, 10, 18, 6, -1 }, { 1, 12, 18, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0104398597f, 0.550567091f, 0.388360411f },
+	{ { { 8, 11, 4, 2, -1 }, { 8, 12, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00304431911f, 0.469785303f, 0.730184495f },
+	{ { { 7, 9, 6, 2, -1 }, { 7, 10, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000615937519f, 0.38308391f, 0.546498418f },
+	{ { { 8, 8, 2, 3, -1 }, { 8, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00342471595f, 0.256630003f, 0.508953094f },
+	{ { { 17, 5, 3, 4, -1 }, { 18, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00935385656f, 0.646996617f, 0.49407959f },
+	{ { { 1, 19, 18, 1, -1 }, { 7, 19, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0523389988f, 0.474598289f, 0.787877083f },
+	{ { { 9, 0, 3, 2, -1 }, { 10, 0, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00357656204f, 0.530666471f, 0.274849802f },
+	{ { { 1, 8, 1, 6, -1 }, { 1, 10, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000715553178f, 0.541312575f, 0.404190898f },
+	{ { { 12, 17, 8, 3, -1 }, { 12, 17, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0105166798f, 0.615851223f, 0.481528312f },
+	{ { { 0, 5, 3, 4, -1 }, { 1, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00773479277f, 0.469580591f, 0.702898085f },
+	{ { { 9, 7, 2, 3, -1 }, { 9, 8, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00432267785f, 0.284956604f, 0.530468404f },
+	{ { { 7, 11, 2, 2, -1 }, { 7, 11, 1, 1, 2 }, { 8, 12, 1, 1, 2 } }, -0.00255343993f, 0.70569849f, 0.468889207f },
+	{ { { 11, 3, 2, 5, -1 }, { 11, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.000102685102f, 0.390293211f, 0.557346404f },
+	{ { { 7, 3, 2, 5, -1 }, { 8, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 7.13951886e-06f, 0.368423194f, 0.526398778f },
+	{ { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00167119899f, 0.384917587f, 0.538727105f },
+	{ { { 5, 6, 2, 3, -1 }, { 5, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00492604496f, 0.472977191f, 0.744725108f },
+	{ { { 4, 19, 15, 1, -1 }, { 9, 19, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00439087022f, 0.480918109f, 0.559192181f },
+	{ { { 1, 19, 15, 1, -1 }, { 6, 19, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0177936293f, 0.690367818f, 0.467692703f },
+	{ { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00204696693f, 0.537069023f, 0.330816209f },
+	{ { { 5, 0, 4, 15, -1 }, { 7, 0, 2, 15, 2 }, { 0, 0, 0, 0, 0 } }, 0.0298914891f, 0.513986528f, 0.330905914f },
+	{ { { 9, 6, 2, 5, -1 }, { 9, 6, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00154949003f, 0.466023713f, 0.60783428f },
+	{ { { 9, 5, 2, 7, -1 }, { 10, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.00149569695f, 0.4404836f, 0.586391985f },
+	{ { { 16, 11, 3, 3, -1 }, { 16, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00095885928f, 0.543597102f, 0.420852304f },
+	{ { { 1, 11, 3, 3, -1 }, { 1, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000496437016f, 0.537057817f, 0.400062203f },
+	{ { { 6, 6, 8, 3, -1 }, { 6, 7, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00272808108f, 0.565941274f, 0.425964296f },
+	{ { { 0, 15, 6, 2, -1 }, { 0, 16, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00230264803f, 0.516165793f, 0.335086912f },
+	{ { { 1, 0, 18, 6, -1 }, { 7, 0, 6, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.251516312f, 0.486966193f, 0.714730978f },
+	{ { { 6, 0, 3, 4, -1 }, { 7, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00463280221f, 0.272744894f, 0.508378983f },
+	{ { { 14, 10, 4, 10, -1 }, { 16, 10, 2, 5, 2 }, { 14, 15, 2, 5, 2 } }, -0.0404344909f, 0.685143888f, 0.502176702f },
+	{ { { 3, 2, 3, 2, -1 }, { 4, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 1.497222e-05f, 0.428446501f, 0.552255511f },
+	{ { { 11, 2, 2, 2, -1 }, { 11, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000240503097f, 0.422611892f, 0.539007485f },
+	{ { { 2, 10, 4, 10, -1 }, { 2, 10, 2, 5, 2 }, { 4, 15, 2, 5, 2 } }, 0.0236578397f, 0.474463195f, 0.750436604f },
+	{ { { 0, 13, 20, 6, -1 }, { 10, 13, 10, 3, 2 }, { 0, 16, 10, 3, 2 } }, -0.00814491045f, 0.424505889f, 0.553836286f },
+	{ { { 0, 5, 2, 15, -1 }, { 1, 5, 1, 15, 2 }, { 0, 0, 0, 0, 0 } }, -0.00369921303f, 0.595235705f, 0.452971309f },
+	{ { { 1, 7, 18, 4, -1 }, { 10, 7, 9, 2, 2 }, { 1, 9, 9, 2, 2 } }, -0.00677186018f, 0.413779408f, 0.547339976f },
+	{ { { 0, 0, 2, 17, -1 }, { 1, 0, 1, 17, 2 }, { 0, 0, 0, 0, 0 } }, 0.0042669531f, 0.448411494f, 0.579799414f },
+	{ { { 2, 6, 16, 6, -1 }, { 10, 6, 8, 3, 2 }, { 2, 9, 8, 3, 2 } }, 0.001779199f, 0.562485874f, 0.443244487f },
+	{ { { 8, 14, 1, 3, -1 }, { 8, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00167747703f, 0.463775188f, 0.636424184f },
+	{ { { 8, 15, 4, 2, -1 }, { 8, 16, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00117326295f, 0.454450309f, 0.591441572f },
+	{ { { 5, 2, 8, 2, -1 }, { 5, 2, 4, 1, 2 }, { 9, 3, 4, 1, 2 } }, 0.000869981712f, 0.53347528f, 0.388591796f },
+	{ { { 6, 11, 8, 6, -1 }, { 6, 14, 8, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000763783406f, 0.53985852f, 0.374494195f },
+	{ { { 9, 13, 2, 2, -1 }, { 9, 14, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000156845694f, 0.431787312f, 0.561461627f },
+	{ { { 18, 4, 2, 6, -1 }, { 18, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0215113703f, 0.178592503f, 0.51855427f },
+	{ { { 9, 12, 2, 2, -1 }, { 9, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0001308137f, 0.434249908f, 0.568284988f },
+	{ { { 18, 4, 2, 6, -1 }, { 18, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0219920408f, 0.516171694f, 0.237939402f },
+	{ { { 9, 13, 1, 3, -1 }, { 9, 14, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000801365008f, 0.598676324f, 0.446642697f },
+	{ { { 18, 4, 2, 6, -1 }, { 18, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00827360991f, 0.410821795f, 0.525105715f },
+	{ { { 0, 4, 2, 6, -1 }, { 0, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00368317892f, 0.51738143f, 0.33975181f },
+	{ { { 9, 12, 3, 3, -1 }, { 9, 13, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00795256812f, 0.688898325f, 0.484592408f },
+	{ { { 3, 13, 2, 3, -1 }, { 3, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00153822999f, 0.517856717f, 0.34541139f },
+	{ { { 13, 13, 4, 3, -1 }, { 13, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0140435304f, 0.167842105f, 0.518866777f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00143158901f, 0.436825693f, 0.565577388f },
+	{ { { 5, 2, 10, 6, -1 }, { 5, 4, 10, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0340142287f, 0.780229628f, 0.495921701f },
+	{ { { 3, 13, 4, 3, -1 }, { 3, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0120273f, 0.158510104f, 0.503223181f },
+	{ { { 3, 7, 15, 5, -1 }, { 8, 7, 5, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.133166194f, 0.516330481f, 0.275512815f },
+	{ { { 3, 7, 12, 2, -1 }, { 7, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00152219494f, 0.372831792f, 0.521455228f },
+	{ { { 10, 3, 3, 9, -1 }, { 11, 3, 1, 9, 3 }, { 0, 0, 0, 0, 0 } }, -0.000939292717f, 0.583837926f, 0.451116502f },
+	{ { { 8, 6, 4, 6, -1 }, { 10, 6, 2, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.0277197398f, 0.472828686f, 0.733154476f },
+	{ { { 9, 7, 4, 3, -1 }, { 9, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00310301501f, 0.530220211f, 0.41015631f },
+	{ { { 0, 9, 4, 9, -1 }, { 2, 9, 2, 9, 2 }, { 0, 0, 0, 0, 0 } }, 0.0778612196f, 0.499833405f, 0.127296194f },
+	{ { { 9, 13, 3, 5, -1 }, { 10, 13, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0158549398f, 0.0508333594f, 0.516565621f },
+	{ { { 7, 7, 6, 3, -1 }, { 9, 7, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00497253006f, 0.679813385f, 0.468423188f },
+	{ { { 9, 7, 3, 5, -1 }, { 10, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.000976765063f, 0.601077199f, 0.478893191f },
+	{ { { 5, 7, 8, 2, -1 }, { 9, 7, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00246477104f, 0.339339793f, 0.522050381f },
+	{ { { 5, 9, 12, 2, -1 }, { 9, 9, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00679377001f, 0.436513692f, 0.523966312f },
+	{ { { 5, 6, 10, 3, -1 }, { 10, 6, 5, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0326080211f, 0.505272388f, 0.242521495f },
+	{ { { 10, 12, 3, 1, -1 }, { 11, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000585144211f, 0.573397398f, 0.475857407f },
+	{ { { 0, 1, 11, 15, -1 }, { 0, 6, 11, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0296326f, 0.38922891f, 0.526359797f },
+	/* stage 15 */
+	{ { { 1, 0, 18, 6, -1 }, { 7, 0, 6, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.0465508513f, 0.327695012f, 0.624052286f },
+	{ { { 7, 7, 6, 1, -1 }, { 9, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00795371272f, 0.42564851f, 0.694293916f },
+	{ { { 5, 16, 6, 4, -1 }, { 5, 16, 3, 2, 2 }, { 8, 18, 3, 2, 2 } }, 0.000682215614f, 0.371148705f, 0.590073287f },
+	{ { { 6, 5, 9, 8, -1 }, { 6, 9, 9, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000193482498f, 0.204113394f, 0.53005451f },
+	{ { { 5, 10, 2, 6, -1 }, { 5, 13, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00026710509f, 0.541612625f, 0.310317904f },
+	{ { { 7, 6, 8, 10, -1 }, { 11, 6, 4, 5, 2 }, { 7, 11, 4, 5, 2 } }, 0.00278180605f, 0.527783275f, 0.346706986f },
+	{ { { 5, 6, 8, 10, -1 }, { 5, 6, 4, 5, 2 }, { 9, 11, 4, 5, 2 } }, -0.000467790785f, 0.530823112f, 0.329449207f },
+	{ { { 9, 5, 2, 2, -1 }, { 9, 6, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -3.03351608e-05f, 0.577387273f, 0.385209709f },
+	{ { { 5, 12, 8, 2, -1 }, { 5, 13, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000780380098f, 0.43174389f, 0.615005791f },
+	{ { { 10, 2, 8, 2, -1 }, { 10, 3, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00425538514f, 0.293390393f, 0.532429278f },
+	{ { { 4, 0, 2, 10, -1 }, { 4, 0, 1, 5, 2 }, { 5, 5, 1, 5, 2 } }, -0.000247356104f, 0.546884477f, 0.384303004f },
+	{ { { 9, 10, 2, 2, -1 }, { 9, 11, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000147242594f, 0.42815429f, 0.575558722f },
+	{ { { 2, 8, 15, 3, -1 }, { 2, 9, 15, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00118647702f, 0.37473011f, 0.547146618f },
+	{ { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00239365804f, 0.453778386f, 0.611152887f },
+	{ { { 7, 2, 3, 2, -1 }, { 8, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00153905398f, 0.297134191f, 0.5189538f },
+	{ { { 7, 13, 6, 3, -1 }, { 7, 14, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00719687901f, 0.669906676f, 0.472647697f },
+	{ { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000414997892f, 0.338495404f, 0.526031792f },
+	{ { { 17, 2, 3, 6, -1 }, { 17, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00443598302f, 0.539912224f, 0.392014086f },
+	{ { { 1, 5, 3, 4, -1 }, { 2, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00266062003f, 0.448257804f, 0.611961782f },
+	{ { { 14, 8, 4, 6, -1 }, { 14, 10, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00152872002f, 0.371123791f, 0.534026623f },
+	{ { { 1, 4, 3, 8, -1 }, { 2, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.00473972503f, 0.603108823f, 0.4455145f },
+	{ { { 8, 13, 4, 6, -1 }, { 8, 16, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0148291299f, 0.283875406f, 0.534186184f },
+	{ { { 3, 14, 2, 2, -1 }, { 3, 15, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000922755571f, 0.520954728f, 0.336165398f },
+	{ { { 14, 8, 4, 6, -1 }, { 14, 10, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0835298076f, 0.511996984f, 0.0811644495f },
+	{ { { 2, 8, 4, 6, -1 }, { 2, 10, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000756331487f, 0.331712008f, 0.518983126f },
+	{ { { 10, 14, 1, 6, -1 }, { 10, 17, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00984038599f, 0.524759829f, 0.233495906f },
+	{ { { 7, 5, 3, 6, -1 }, { 8, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.00159538304f, 0.575009406f, 0.429562211f },
+	{ { { 11, 2, 2, 6, -1 }, { 12, 2, 1, 3, 2 }, { 11, 5, 1, 3, 2 } }, 3.47660207e-05f, 0.434244514f, 0.556402922f },
+	{ { { 6, 6, 6, 5, -1 }, { 8, 6, 2, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0298629105f, 0.45791471f, 0.657918811f },
+	{ { { 17, 1, 3, 6, -1 }, { 17, 3, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0113255903f, 0.52743119f, 0.367388815f },
+	{ { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00878286455f, 0.710036874f, 0.464216709f },
+	{ { { 9, 18, 3, 2, -1 }, { 10, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00436399598f, 0.527921617f, 0.270587713f },
+	{ { { 8, 18, 3, 2, -1 }, { 9, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00418047281f, 0.507252514f, 0.244908303f },
+	{ { { 12, 3, 5, 2, -1 }, { 12, 4, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000456685113f, 0.428310513f, 0.554869115f },
+	{ { { 7, 1, 5, 12, -1 }, { 7, 7, 5, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.00371403689f, 0.551938772f, 0.410365313f },
+	{ { { 1, 0, 18, 4, -1 }, { 7, 0, 6, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0253042895f, 0.686700225f, 0.486988902f },
+	{ { { 4, 2, 2, 2, -1 }, { 4, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000344540807f, 0.372887403f, 0.528769314f },
+	{ { { 11, 14, 4, 2, -1 }, { 13, 14, 2, 1, 2 }, { 11, 15, 2, 1, 2 } }, -0.000839352317f, 0.606015205f, 0.461606205f },
+	{ { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0172800496f, 0.504963577f, 0.181982398f },
+	{ { { 9, 7, 2, 3, -1 }, { 9, 8, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0063595078f, 0.163123995f, 0.523277879f },
+	{ { { 5, 5, 1, 3, -1 }, { 5, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00102981098f, 0.446327806f, 0.61765492f },
+	{ { { 10, 10, 6, 1, -1 }, { 10, 10, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00101171096f, 0.547338486f, 0.430069894f },
+	{ { { 4, 10, 6, 1, -1 }, { 7, 10, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.0103088003f, 0.116698503f, 0.500086725f },
+	{ { { 9, 17, 3, 3, -1 }, { 9, 18, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00546820182f, 0.476928711f, 0.671921372f },
+	{ { { 4, 14, 1, 3, -1 }, { 4, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000916964607f, 0.34710899f, 0.517816484f },
+	{ { { 12, 5, 3, 3, -1 }, { 12, 6, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00239228201f, 0.478523612f, 0.621631086f },
+	{ { { 4, 5, 12, 3, -1 }, { 4, 6, 12, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00755738188f, 0.581479609f, 0.441008508f },
+	{ { { 9, 8, 2, 3, -1 }, { 9, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000770240324f, 0.387800008f, 0.546572208f },
+	{ { { 4, 9, 3, 3, -1 }, { 5, 9, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00871259905f, 0.166005105f, 0.499583602f },
+	{ { { 6, 0, 9, 17, -1 }, { 9, 0, 3, 17, 3 }, { 0, 0, 0, 0, 0 } }, -0.0103063202f, 0.4093391f, 0.527423382f },
+	{ { { 9, 12, 1, 3, -1 }, { 9, 13, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0020940979f, 0.620619476f, 0.457228005f },
+	{ { { 9, 5, 2, 15, -1 }, { 9, 10, 2, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.00680990517f, 0.556775928f, 0.415560007f },
+	{ { { 8, 14, 2, 3, -1 }, { 8, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00107460597f, 0.563892782f, 0.435302496f },
+	{ { { 10, 14, 1, 3, -1 }, { 10, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00215502898f, 0.482626587f, 0.674975812f },
+	{ { { 7, 1, 6, 5, -1 }, { 9, 1, 2, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0317423195f, 0.50483799f, 0.188324898f },
+	{ { { 0, 0, 20, 2, -1 }, { 0, 0, 10, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.078382723f, 0.236954898f, 0.526015818f },
+	{ { { 2, 13, 5, 3, -1 }, { 2, 14, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00574151194f, 0.504882872f, 0.277646989f },
+	{ { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00290146004f, 0.623860478f, 0.469331712f },
+	{ { { 2, 5, 9, 15, -1 }, { 2, 10, 9, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00264279312f, 0.331414193f, 0.516977727f },
+	{ { { 5, 0, 12, 10, -1 }, { 11, 0, 6, 5, 2 }, { 5, 5, 6, 5, 2 } }, -0.109496601f, 0.238004506f, 0.518344104f },
+	{ { { 5, 1, 2, 3, -1 }, { 6, 1, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 7.40759133e-05f, 0.406963587f, 0.536215007f },
+	{ { { 10, 7, 6, 1, -1 }, { 12, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00050593802f, 0.550670624f, 0.437459409f },
+	{ { { 3, 1, 2, 10, -1 }, { 3, 1, 1, 5, 2 }, { 4, 6, 1, 5, 2 } }, -0.000821317779f, 0.552570999f, 0.420937598f },
+	{ { { 13, 7, 2, 1, -1 }, { 13, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -6.02765394e-05f, 0.545547485f, 0.474826604f },
+	{ { { 4, 13, 4, 6, -1 }, { 4, 15, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00680651423f, 0.515799582f, 0.342457712f },
+	{ { { 13, 7, 2, 1, -1 }, { 13, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00172027899f, 0.501320779f, 0.633126378f },
+	{ { { 5, 7, 2, 1, -1 }, { 6, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000130169297f, 0.553971827f, 0.422686994f },
+	{ { { 2, 12, 18, 4, -1 }, { 11, 12, 9, 2, 2 }, { 2, 14, 9, 2, 2 } }, -0.00480163889f, 0.442509502f, 0.543078005f },
+	{ { { 5, 7, 2, 2, -1 }, { 5, 7, 1, 1, 2 }, { 6, 8, 1, 1, 2 } }, -0.0025399311f, 0.714578211f, 0.469760507f },
+	{ { { 16, 3, 4, 2, -1 }, { 16, 4, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00142789294f, 0.4070445f, 0.539960504f },
+	{ { { 0, 2, 2, 18, -1 }, { 0, 2, 1, 9, 2 }, { 1, 11, 1, 9, 2 } }, -0.0251425505f, 0.788469076f, 0.4747352f },
+	{ { { 1, 2, 18, 4, -1 }, { 10, 2, 9, 2, 2 }, { 1, 4, 9, 2, 2 } }, -0.00388996094f, 0.429619193f, 0.557711005f },
+	{ { { 9, 14, 1, 3, -1 }, { 9, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00439474592f, 0.469316214f, 0.702394426f },
+	{ { { 2, 12, 18, 4, -1 }, { 11, 12, 9, 2, 2 }, { 2, 14, 9, 2, 2 } }, 0.0246784203f, 0.524232209f, 0.381251007f },
+	{ { { 0, 12, 18, 4, -1 }, { 0, 12, 9, 2, 2 }, { 9, 14, 9, 2, 2 } }, 0.0380476788f, 0.501173973f, 0.1687828f },
+	{ { { 11, 4, 5, 3, -1 }, { 11, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00794248655f, 0.482858211f, 0.636956811f },
+	{ { { 6, 4, 7, 3, -1 }, { 6, 5, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00151100499f, 0.590648592f, 0.448766798f },
+	{ { { 13, 17, 3, 3, -1 }, { 13, 18, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00642017415f, 0.524109781f, 0.299057007f },
+	{ { { 8, 1, 3, 4, -1 }, { 9, 1, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00298021594f, 0.304146588f, 0.507848978f },
+	{ { { 11, 4, 2, 4, -1 }, { 11, 4, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000745800789f, 0.412813902f, 0.525682628f },
+	{ { { 0, 17, 9, 3, -1 }, { 3, 17, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.01047095f, 0.580839515f, 0.449429601f },
+	{ { { 11, 0, 2, 8, -1 }, { 12, 0, 1, 4, 2 }, { 11, 4, 1, 4, 2 } }, 0.00933692046f, 0.524655282f, 0.26589489f },
+	{ { { 0, 8, 6, 12, -1 }, { 0, 8, 3, 6, 2 }, { 3, 14, 3, 6, 2 } }, 0.0279369f, 0.467495501f, 0.708725691f },
+	{ { { 10, 7, 4, 12, -1 }, { 10, 13, 4, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00742776785f, 0.540948689f, 0.37585181f },
+	{ { { 5, 3, 8, 14, -1 }, { 5, 10, 8, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0235845093f, 0.375863999f, 0.52385509f },
+	{ { { 14, 10, 6, 1, -1 }, { 14, 10, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00114526402f, 0.432957888f, 0.580424726f },
+	{ { { 0, 4, 10, 4, -1 }, { 0, 6, 10, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000434686604f, 0.528061807f, 0.387306988f },
+	{ { { 10, 0, 5, 8, -1 }, { 10, 4, 5, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0106485402f, 0.490211308f, 0.568125188f },
+	{ { { 8, 1, 4, 8, -1 }, { 8, 1, 2, 4, 2 }, { 10, 5, 2, 4, 2 } }, -0.000394180504f, 0.557088017f, 0.431825101f },
+	{ { { 9, 11, 6, 1, -1 }, { 11, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000132704794f, 0.565843999f, 0.434355497f },
+	{ { { 8, 9, 3, 4, -1 }, { 9, 9, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00201255106f, 0.605673909f, 0.453752398f },
+	{ { { 18, 4, 2, 6, -1 }, { 18, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00248543196f, 0.539047718f, 0.413801014f },
+	{ { { 8, 8, 3, 4, -1 }, { 9, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00182378804f, 0.435482889f, 0.571718872f },
+	{ { { 7, 1, 13, 3, -1 }, { 7, 2, 13, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0166566595f, 0.301091313f, 0.521612287f },
+	{ { { 7, 13, 6, 1, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000803495583f, 0.530015111f, 0.381839693f },
+	{ { { 12, 11, 3, 6, -1 }, { 12, 13, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00341703789f, 0.53280288f, 0.424140006f },
+	{ { { 5, 11, 6, 1, -1 }, { 7, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000362227292f, 0.549172819f, 0.418697715f },
+	{ { { 1, 4, 18, 10, -1 }, { 10, 4, 9, 5, 2 }, { 1, 9, 9, 5, 2 } }, -0.116300203f, 0.144072205f, 0.522645116f },
+	{ { { 8, 6, 4, 9, -1 }, { 8, 9, 4, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0146950101f, 0.774772525f, 0.471571714f },
+	{ { { 8, 6, 4, 3, -1 }, { 8, 7, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00219721301f, 0.535543382f, 0.331564486f },
+	{ { { 8, 7, 3, 3, -1 }, { 9, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.000469652092f, 0.576723516f, 0.445813686f },
+	{ { { 14, 15, 4, 3, -1 }, { 14, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0065144999f, 0.521567404f, 0.36478889f },
+	{ { { 5, 10, 3, 10, -1 }, { 6, 10, 1, 10, 3 }, { 0, 0, 0, 0, 0 } }, 0.0213000607f, 0.499420494f, 0.156795099f },
+	{ { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00318814092f, 0.474220008f, 0.628727019f },
+	{ { { 0, 8, 1, 6, -1 }, { 0, 10, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000900197774f, 0.534795403f, 0.394375205f },
+	{ { { 10, 15, 1, 3, -1 }, { 10, 16, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00517722778f, 0.672719181f, 0.501313806f },
+	{ { { 2, 15, 4, 3, -1 }, { 2, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00437646499f, 0.310667515f, 0.512879312f },
+	{ { { 18, 3, 2, 8, -1 }, { 19, 3, 1, 4, 2 }, { 18, 7, 1, 4, 2 } }, 0.00262999604f, 0.48863101f, 0.575521588f },
+	{ { { 0, 3, 2, 8, -1 }, { 0, 3, 1, 4, 2 }, { 1, 7, 1, 4, 2 } }, -0.0020458689f, 0.602579415f, 0.455807686f },
+	{ { { 3, 7, 14, 10, -1 }, { 10, 7, 7, 5, 2 }, { 3, 12, 7, 5, 2 } }, 0.0694827065f, 0.524074793f, 0.218525901f },
+	{ { { 0, 7, 19, 3, -1 }, { 0, 8, 19, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0240489393f, 0.501186728f, 0.209062204f },
+	{ { { 12, 6, 3, 3, -1 }, { 12, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00310953404f, 0.486671209f, 0.710854828f },
+	{ { { 0, 6, 1, 3, -1 }, { 0, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00125032605f, 0.340789109f, 0.515619516f },
+	{ { { 12, 6, 3, 3, -1 }, { 12, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.001028119f, 0.557557225f, 0.443943202f },
+	{ { { 5, 6, 3, 3, -1 }, { 5, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00888936222f, 0.640200078f, 0.462044209f },
+	{ { { 8, 2, 4, 2, -1 }, { 8, 3, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000610948016f, 0.376644194f, 0.544889987f },
+	{ { { 6, 3, 4, 12, -1 }, { 8, 3, 2, 12, 2 }, { 0, 0, 0, 0, 0 } }, -0.00576863578f, 0.331864893f, 0.513367712f },
+	{ { { 13, 6, 2, 3, -1 }, { 13, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00185064902f, 0.490357012f, 0.640693486f },
+	{ { { 0, 10, 20, 4, -1 }, { 0, 12, 20, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0997994691f, 0.153605103f, 0.501556218f },
+	{ { { 2, 0, 17, 14, -1 }, { 2, 7, 17, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.351283491f, 0.058823131f, 0.517437875f },
+	{ { { 0, 0, 6, 10, -1 }, { 0, 0, 3, 5, 2 }, { 3, 5, 3, 5, 2 } }, -0.0452445708f, 0.696148872f, 0.467787296f },
+	{ { { 14, 6, 6, 4, -1 }, { 14, 6, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0714815781f, 0.516798615f, 0.103809297f },
+	{ { { 0, 6, 6, 4, -1 }, { 3, 6, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00218957802f, 0.427307814f, 0.553206086f },
+	{ { { 13, 2, 7, 2, -1 }, { 13, 3, 7, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000592426513f, 0.463894397f, 0.527638912f },
+	{ { { 0, 2, 7, 2, -1 }, { 0, 3, 7, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00167883898f, 0.530164897f, 0.393203497f },
+	{ { { 6, 11, 14, 2, -1 }, { 13, 11, 7, 1, 2 }, { 6, 12, 7, 1, 2 } }, -0.00221634889f, 0.563069403f, 0.475703388f },
+	{ { { 8, 5, 2, 2, -1 }, { 8, 5, 1, 1, 2 }, { 9, 6, 1, 1, 2 } }, 0.000115686998f, 0.430753589f, 0.553570271f },
+	{ { { 13, 9, 2, 3, -1 }, { 13, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00720172888f, 0.144488201f, 0.519306421f },
+	{ { { 1, 1, 3, 12, -1 }, { 2, 1, 1, 12, 3 }, { 0, 0, 0, 0, 0 } }, 0.00089081272f, 0.438443214f, 0.559362113f },
+	{ { { 17, 4, 1, 3, -1 }, { 17, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000196050096f, 0.534041584f, 0.470595688f },
+	{ { { 2, 4, 1, 3, -1 }, { 2, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000520221423f, 0.52138561f, 0.38100791f },
+	{ { { 14, 5, 1, 3, -1 }, { 14, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000945885724f, 0.476941496f, 0.613073885f },
+	{ { { 7, 16, 2, 3, -1 }, { 7, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 9.16984718e-05f, 0.424500912f, 0.542936325f },
+	{ { { 8, 13, 4, 6, -1 }, { 10, 13, 2, 3, 2 }, { 8, 16, 2, 3, 2 } }, 0.00218332f, 0.545773089f, 0.419107586f },
+	{ { { 5, 5, 1, 3, -1 }, { 5, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000860396714f, 0.576458871f, 0.447165996f },
+	{ { { 16, 0, 4, 20, -1 }, { 16, 0, 2, 20, 2 }, { 0, 0, 0, 0, 0 } }, -0.0132362396f, 0.637282312f, 0.469500989f },
+	{ { { 5, 1, 2, 6, -1 }, { 5, 1, 1, 3, 2 }, { 6, 4, 1, 3, 2 } }, 0.000433767011f, 0.531787395f, 0.394582987f },
+	/* stage 16 */
+	{ { { 5, 4, 10, 4, -1 }, { 5, 6, 10, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0248471498f, 0.655551672f, 0.387331188f },
+	{ { { 15, 2, 4, 12, -1 }, { 15, 2, 2, 12, 2 }, { 0, 0, 0, 0, 0 } }, 0.00613486115f, 0.374807209f, 0.597399771f },
+	{ { { 7, 6, 4, 12, -1 }, { 7, 12, 4, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00644984981f, 0.542549193f, 0.254881114f },
+	{ { { 14, 5, 1, 8, -1 }, { 14, 9, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00063491211f, 0.246244207f, 0.538725376f },
+	{ { { 1, 4, 14, 10, -1 }, { 1, 4, 7, 5, 2 }, { 8, 9, 7, 5, 2 } }, 0.00140238903f, 0.559432209f, 0.352865785f },
+	{ { { 11, 6, 6, 14, -1 }, { 14, 6, 3, 7, 2 }, { 11, 13, 3, 7, 2 } }, 0.000300440006f, 0.39585039f, 0.576593816f },
+	{ { { 3, 6, 6, 14, -1 }, { 3, 6, 3, 7, 2 }, { 6, 13, 3, 7, 2 } }, 0.000100424098f, 0.36989969f, 0.553499818f },
+	{ { { 4, 9, 15, 2, -1 }, { 9, 9, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00508414907f, 0.371109098f, 0.554780006f },
+	{ { { 7, 14, 6, 3, -1 }, { 7, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0195372608f, 0.749275506f, 0.457929701f },
+	{ { { 6, 3, 14, 4, -1 }, { 13, 3, 7, 2, 2 }, { 6, 5, 7, 2, 2 } }, -7.45327407e-06f, 0.564978719f, 0.390406996f },
+	{ { { 1, 9, 15, 2, -1 }, { 6, 9, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00360794598f, 0.338108808f, 0.526780128f },
+	{ { { 6, 11, 8, 9, -1 }, { 6, 14, 8, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0020697501f, 0.551929116f, 0.371438891f },
+	{ { { 7, 4, 3, 8, -1 }, { 8, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.000464638404f, 0.560821474f, 0.411356688f },
+	{ { { 14, 6, 2, 6, -1 }, { 14, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000754904526f, 0.355920613f, 0.532935619f },
+	{ { { 5, 7, 6, 4, -1 }, { 5, 7, 3, 2, 2 }, { 8, 9, 3, 2, 2 } }, -0.000983222388f, 0.541479588f, 0.376320511f },
+	{ { { 1, 1, 18, 19, -1 }, { 7, 1, 6, 19, 3 }, { 0, 0, 0, 0, 0 } }, -0.0199406408f, 0.634790301f, 0.470529914f },
+	{ { { 1, 2, 6, 5, -1 }, { 4, 2, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00376803009f, 0.391348988f, 0.556371629f },
+	{ { { 12, 17, 6, 2, -1 }, { 12, 18, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00945285056f, 0.25548929f, 0.521511674f },
+	{ { { 2, 17, 6, 2, -1 }, { 2, 18, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00295608491f, 0.517467916f, 0.306392014f },
+	{ { { 17, 3, 3, 6, -1 }, { 17, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00910787378f, 0.538844824f, 0.288596302f },
+	{ { { 8, 17, 3, 3, -1 }, { 8, 18, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00182192295f, 0.4336043f, 0.585219681f },
+	{ { { 10, 13, 2, 6, -1 }, { 10, 16, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0146887396f, 0.528736174f, 0.287000597f },
+	{ { { 7, 13, 6, 3, -1 }, { 7, 14, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0143879903f, 0.701944888f, 0.464737087f },
+	{ { { 17, 3, 3, 6, -1 }, { 17, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0189866498f, 0.298655212f, 0.524701178f },
+	{ { { 8, 13, 2, 3, -1 }, { 8, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00115276396f, 0.432347387f, 0.593166173f },
+	{ { { 9, 3, 6, 2, -1 }, { 11, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0109336702f, 0.528686404f, 0.313031912f },
+	{ { { 0, 3, 3, 6, -1 }, { 0, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0149327302f, 0.265841901f, 0.508407712f },
+	{ { { 8, 5, 4, 6, -1 }, { 8, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000299705396f, 0.546352684f, 0.374072403f },
+	{ { { 5, 5, 3, 2, -1 }, { 5, 6, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00416776212f, 0.470349699f, 0.743572176f },
+	{ { { 10, 1, 3, 4, -1 }, { 11, 1, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00639053201f, 0.206925899f, 0.52805382f },
+	{ { { 1, 2, 5, 9, -1 }, { 1, 5, 5, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00450296095f, 0.51826489f, 0.34835431f },
+	{ { { 13, 6, 2, 3, -1 }, { 13, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00920403656f, 0.680377722f, 0.493236005f },
+	{ { { 0, 6, 14, 3, -1 }, { 7, 6, 7, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0813272595f, 0.505839884f, 0.2253052f },
+	{ { { 2, 11, 18, 8, -1 }, { 2, 15, 18, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.150792807f, 0.296342492f, 0.526467979f },
+	{ { { 5, 6, 2, 3, -1 }, { 5, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00331790093f, 0.465549588f, 0.707293212f },
+	{ { { 10, 6, 4, 2, -1 }, { 12, 6, 2, 1, 2 }, { 10, 7, 2, 1, 2 } }, 0.000774028013f, 0.478034794f, 0.566823781f },
+	{ { { 6, 6, 4, 2, -1 }, { 6, 6, 2, 1, 2 }, { 8, 7, 2, 1, 2 } }, 0.000681995414f, 0.428699613f, 0.572215676f },
+	{ { { 10, 1, 3, 4, -1 }, { 11, 1, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00536715705f, 0.529930711f, 0.311462194f },
+	{ { { 7, 1, 2, 7, -1 }, { 8, 1, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, 9.70186666e-05f, 0.367463887f, 0.526946187f },
+	{ { { 4, 2, 15, 14, -1 }, { 4, 9, 15, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.125340894f, 0.235149205f, 0.524579108f },
+	{ { { 8, 7, 3, 2, -1 }, { 9, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00525162695f, 0.711593688f, 0.469376713f },
+	{ { { 2, 3, 18, 4, -1 }, { 11, 3, 9, 2, 2 }, { 2, 5, 9, 2, 2 } }, -0.00783421099f, 0.446265101f, 0.540908575f },
+	{ { { 9, 7, 2, 2, -1 }, { 10, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00113100698f, 0.594561875f, 0.441766202f },
+	{ { { 13, 9, 2, 3, -1 }, { 13, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00176011201f, 0.535324991f, 0.397345304f },
+	{ { { 5, 2, 6, 2, -1 }, { 7, 2, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000815812498f, 0.376026809f, 0.526472688f },
+	{ { { 9, 5, 2, 7, -1 }, { 9, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.00386875891f, 0.63099128f, 0.474981993f },
+	{ { { 5, 9, 2, 3, -1 }, { 6, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00152071298f, 0.523018181f, 0.336122394f },
+	{ { { 6, 0, 14, 18, -1 }, { 6, 9, 14, 9, 2 }, { 0, 0, 0, 0, 0 } }, 0.545867383f, 0.516713977f, 0.117263503f },
+	{ { { 2, 16, 6, 3, -1 }, { 2, 17, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0156501904f, 0.497943908f, 0.139329493f },
+	{ { { 9, 7, 3, 6, -1 }, { 10, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0117318602f, 0.712965071f, 0.49211961f },
+	{ { { 7, 8, 4, 3, -1 }, { 7, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00617651222f, 0.228810295f, 0.504970193f },
+	{ { { 7, 12, 6, 3, -1 }, { 7, 13, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00224576611f, 0.463243395f, 0.604872584f },
+	{ { { 9, 12, 2, 3, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00519158691f, 0.646742105f, 0.460219294f },
+	{ { { 7, 12, 6, 2, -1 }, { 9, 12, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0238278806f, 0.148200095f, 0.522607923f },
+	{ { { 5, 11, 4, 6, -1 }, { 5, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00102845801f, 0.513548911f, 0.337595701f },
+	{ { { 11, 12, 7, 2, -1 }, { 11, 13, 7, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.0100788502f, 0.274056107f, 0.530356705f },
+	{ { { 6, 10, 8, 6, -1 }, { 6, 10, 4, 3, 2 }, { 10, 13, 4, 3, 2 } }, 0.00261689303f, 0.533267081f, 0.397245407f },
+	{ { { 11, 10, 3, 4, -1 }, { 11, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000543853675f, 0.536560416f, 0.406341195f },
+	{ { { 9, 16, 2, 3, -1 }, { 9, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00535105122f, 0.4653759f, 0.688904583f },
+	{ { { 13, 3, 1, 9, -1 }, { 13, 6, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00152747903f, 0.544950128f, 0.362472385f },
+	{ { { 1, 13, 14, 6, -1 }, { 1, 15, 14, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0806244165f, 0.165608704f, 0.500028729f },
+	{ { { 13, 6, 1, 6, -1 }, { 13, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0221920293f, 0.51327312f, 0.2002808f },
+	{ { { 0, 4, 3, 8, -1 }, { 1, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } }, 0.00731006311f, 0.461794794f, 0.636653602f },
+	{ { { 18, 0, 2, 18, -1 }, { 18, 0, 1, 18, 2 }, { 0, 0, 0, 0, 0 } }, -0.00640630722f, 0.591625094f, 0.486786097f },
+	{ { { 2, 3, 6, 2, -1 }, { 2, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000764150405f, 0.388840914f, 0.531579792f },
+	{ { { 9, 0, 8, 6, -1 }, { 9, 2, 8, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0007673449f, 0.415906489f, 0.56052798f },
+	{ { { 6, 6, 1, 6, -1 }, { 6, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000614745019f, 0.308902204f, 0.512014806f },
+	{ { { 14, 8, 6, 3, -1 }, { 14, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00501052709f, 0.397219986f, 0.520730615f },
+	{ { { 0, 0, 2, 18, -1 }, { 1, 0, 1, 18, 2 }, { 0, 0, 0, 0, 0 } }, -0.00869091321f, 0.625740826f, 0.4608576f },
+	{ { { 1, 18, 18, 2, -1 }, { 10, 18, 9, 1, 2 }, { 1, 19, 9, 1, 2 } }, -0.0163914599f, 0.208520994f, 0.524226606f },
+	{ { { 3, 15, 2, 2, -1 }, { 3, 16, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000409739092f, 0.522242725f, 0.378032088f },
+	{ { { 8, 14, 5, 3, -1 }, { 8, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.002524229f, 0.580392718f, 0.461189002f },
+	{ { { 8, 14, 2, 3, -1 }, { 8, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000509453123f, 0.440127194f, 0.584601581f },
+	{ { { 12, 3, 3, 3, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00196564198f, 0.532232523f, 0.418459088f },
+	{ { { 7, 5, 6, 2, -1 }, { 9, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000562988978f, 0.374184489f, 0.523456573f },
+	{ { { 15, 5, 5, 2, -1 }, { 15, 6, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000679467979f, 0.463104188f, 0.53564781f },
+	{ { { 0, 5, 5, 2, -1 }, { 0, 6, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00728563499f, 0.50446701f, 0.237756401f },
+	{ { { 17, 14, 1, 6, -1 }, { 17, 17, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0174594894f, 0.728912115f, 0.505043507f },
+	{ { { 2, 9, 9, 3, -1 }, { 5, 9, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0254217498f, 0.666713476f, 0.467810005f },
+	{ { { 12, 3, 3, 3, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00156476395f, 0.439175904f, 0.5323627f },
+	{ { { 0, 0, 4, 18, -1 }, { 2, 0, 2, 18, 2 }, { 0, 0, 0, 0, 0 } }, 0.01144436f, 0.434644014f, 0.568001211f },
+	{ { { 17, 6, 1, 3, -1 }, { 17, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000673525501f, 0.44771409f, 0.529681206f },
+	{ { { 2, 14, 1, 6, -1 }, { 2, 17, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0093194209f, 0.474020004f, 0.746260703f },
+	{ { { 19, 8, 1, 2, -1 }, { 19, 9, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000133284906f, 0.536506176f, 0.475213498f },
+	{ { { 5, 3, 3, 3, -1 }, { 6, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00788157992f, 0.175221905f, 0.501525521f },
+	{ { { 9, 16, 2, 3, -1 }, { 9, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00579856802f, 0.727123678f, 0.48962009f },
+	{ { { 2, 6, 1, 3, -1 }, { 2, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000389224995f, 0.400390893f, 0.534494102f },
+	{ { { 12, 4, 8, 2, -1 }, { 16, 4, 4, 1, 2 }, { 12, 5, 4, 1, 2 } }, -0.00192886102f, 0.560561299f, 0.480395585f },
+	{ { { 0, 4, 8, 2, -1 }, { 0, 4, 4, 1, 2 }, { 4, 5, 4, 1, 2 } }, 0.00842141546f, 0.47532469f, 0.762360871f },
+	{ { { 2, 16, 18, 4, -1 }, { 2, 18, 18, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00816558767f, 0.539326191f, 0.419164389f },
+	{ { { 7, 15, 2, 4, -1 }, { 7, 17, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00048280551f, 0.424080014f, 0.5399822f },
+	{ { { 4, 0, 14, 3, -1 }, { 4, 1, 14, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00271866308f, 0.424459994f, 0.54249239f },
+	{ { { 0, 0, 4, 20, -1 }, { 2, 0, 2, 20, 2 }, { 0, 0, 0, 0, 0 } }, -0.01250723f, 0.589584172f, 0.455041111f },
+	{ { { 12, 4, 4, 8, -1 }, { 14, 4, 2, 4, 2 }, { 12, 8, 2, 4, 2 } }, -0.0242865197f, 0.264713496f, 0.518917978f },
+	{ { { 6, 7, 2, 2, -1 }, { 6, 7, 1, 1, 2 }, { 7, 8, 1, 1, 2 } }, -0.00296763307f, 0.734768271f, 0.47497499f },
+	{ { { 10, 6, 2, 3, -1 }, { 10, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0125289997f, 0.275604993f, 0.517759979f },
+	{ { { 8, 7, 3, 2, -1 }, { 8, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00101040001f, 0.351056099f, 0.514472425f },
+	{ { { 8, 2, 6, 12, -1 }, { 8, 8, 6, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.00213485304f, 0.563792586f, 0.466731995f },
+	{ { { 4, 0, 11, 12, -1 }, { 4, 4, 11, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0195642598f, 0.461457312f, 0.613763988f },
+	{ { { 14, 9, 6, 11, -1 }, { 16, 9, 2, 11, 3 }, { 0, 0, 0, 0, 0 } }, -0.0971463472f, 0.299837887f, 0.519355595f },
+	{ { { 0, 14, 4, 3, -1 }, { 0, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00450145686f, 0.507788479f, 0.304575592f },
+	{ { { 9, 10, 2, 3, -1 }, { 9, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00637069717f, 0.486101896f, 0.688750088f },
+	{ { { 5, 11, 3, 2, -1 }, { 5, 12, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.0090721529f, 0.167339593f, 0.50175631f },
+	{ { { 9, 15, 3, 3, -1 }, { 10, 15, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00535372086f, 0.269275695f, 0.524263322f },
+	{ { { 8, 8, 3, 4, -1 }, { 9, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0109328404f, 0.718386412f, 0.473602891f },
+	{ { { 9, 15, 3, 3, -1 }, { 10, 15, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0082356073f, 0.522396684f, 0.238986298f },
+	{ { { 7, 7, 3, 2, -1 }, { 8, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00100381603f, 0.571935594f, 0.443394303f },
+	{ { { 2, 10, 16, 4, -1 }, { 10, 10, 8, 2, 2 }, { 2, 12, 8, 2, 2 } }, 0.00408591283f, 0.547284186f, 0.414883614f },
+	{ { { 2, 3, 4, 17, -1 }, { 4, 3, 2, 17, 2 }, { 0, 0, 0, 0, 0 } }, 0.154854193f, 0.49738121f, 0.0610615984f },
+	{ { { 15, 13, 2, 7, -1 }, { 15, 13, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.000208974598f, 0.470917404f, 0.542388916f },
+	{ { { 2, 2, 6, 1, -1 }, { 5, 2, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000333169912f, 0.408962697f, 0.530099213f },
+	{ { { 5, 2, 12, 4, -1 }, { 9, 2, 4, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0108134001f, 0.610436976f, 0.49573341f },
+	{ { { 6, 0, 8, 12, -1 }, { 6, 0, 4, 6, 2 }, { 10, 6, 4, 6, 2 } }, 0.0456560105f, 0.506968915f, 0.286666006f },
+	{ { { 13, 7, 2, 2, -1 }, { 14, 7, 1, 1, 2 }, { 13, 8, 1, 1, 2 } }, 0.00125695497f, 0.484691709f, 0.631817102f },
+	{ { { 0, 12, 20, 6, -1 }, { 0, 14, 20, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.1201507f, 0.06052614f, 0.498095989f },
+	{ { { 14, 7, 2, 3, -1 }, { 14, 7, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000105337997f, 0.536310971f, 0.470804214f },
+	{ { { 0, 8, 9, 12, -1 }, { 3, 8, 3, 12, 3 }, { 0, 0, 0, 0, 0 } }, -0.207031906f, 0.0596603304f, 0.497909814f },
+	{ { { 3, 0, 16, 2, -1 }, { 3, 0, 8, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000129091801f, 0.471297711f, 0.537799776f },
+	{ { { 6, 15, 3, 3, -1 }, { 6, 16, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00038818529f, 0.436353803f, 0.553419113f },
+	{ { { 8, 15, 6, 3, -1 }, { 8, 16, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00292436103f, 0.581118584f, 0.482521594f },
+	{ { { 0, 10, 1, 6, -1 }, { 0, 12, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000838823325f, 0.531170011f, 0.403813899f },
+	{ { { 10, 9, 4, 3, -1 }, { 10, 10, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00190615503f, 0.377070189f, 0.526001513f },
+	{ { { 9, 15, 2, 3, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00895143487f, 0.4766168f, 0.768218398f },
+	{ { { 5, 7, 10, 1, -1 }, { 5, 7, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0130834598f, 0.526446283f, 0.3062222f },
+	{ { { 4, 0, 12, 19, -1 }, { 10, 0, 6, 19, 2 }, { 0, 0, 0, 0, 0 } }, -0.2115933f, 0.673719823f, 0.469581008f },
+	{ { { 0, 6, 20, 6, -1 }, { 10, 6, 10, 3, 2 }, { 0, 9, 10, 3, 2 } }, 0.00314932503f, 0.564483523f, 0.438695312f },
+	{ { { 3, 6, 2, 2, -1 }, { 3, 6, 1, 1, 2 }, { 4, 7, 1, 1, 2 } }, 0.000397541007f, 0.452606112f, 0.589563012f },
+	{ { { 15, 6, 2, 2, -1 }, { 16, 6, 1, 1, 2 }, { 15, 7, 1, 1, 2 } }, -0.001381448f, 0.607058227f, 0.494241387f },
+	{ { { 3, 6, 2, 2, -1 }, { 3, 6, 1, 1, 2 }, { 4, 7, 1, 1, 2 } }, -0.000581221888f, 0.599821329f, 0.450825214f },
+	{ { { 14, 4, 1, 12, -1 }, { 14, 10, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.00239053299f, 0.4205589f, 0.522384822f },
+	{ { { 2, 5, 16, 10, -1 }, { 2, 5, 8, 5, 2 }, { 10, 10, 8, 5, 2 } }, 0.0272689294f, 0.520644724f, 0.356330186f },
+	{ { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00376583589f, 0.31447041f, 0.521881402f },
+	{ { { 1, 4, 2, 2, -1 }, { 1, 5, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00149034895f, 0.338019609f, 0.512443721f },
+	{ { { 5, 0, 15, 5, -1 }, { 10, 0, 5, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0174282305f, 0.58299607f, 0.491972595f },
+	{ { { 0, 0, 15, 5, -1 }, { 5, 0, 5, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0152780302f, 0.616314471f, 0.461788714f },
+	{ { { 11, 2, 2, 17, -1 }, { 11, 2, 1, 17, 2 }, { 0, 0, 0, 0, 0 } }, 0.0319956094f, 0.516635716f, 0.171276405f },
+	{ { { 7, 2, 2, 17, -1 }, { 8, 2, 1, 17, 2 }, { 0, 0, 0, 0, 0 } }, -0.00382567104f, 0.340801209f, 0.513138771f },
+	{ { { 15, 11, 2, 9, -1 }, { 15, 11, 1, 9, 2 }, { 0, 0, 0, 0, 0 } }, -0.00851864368f, 0.610551894f, 0.499794185f },
+	{ { { 3, 11, 2, 9, -1 }, { 4, 11, 1, 9, 2 }, { 0, 0, 0, 0, 0 } }, 0.000906416215f, 0.432727098f, 0.558231115f },
+	{ { { 5, 16, 14, 4, -1 }, { 5, 16, 7, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0103448499f, 0.485565305f, 0.545242012f },
+	/* stage 17 */
+	{ { { 1, 4, 18, 1, -1 }, { 7, 4, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00789818261f, 0.33325249f, 0.594646215f },
+	{ { { 13, 7, 6, 4, -1 }, { 16, 7, 3, 2, 2 }, { 13, 9, 3, 2, 2 } }, 0.00161701604f, 0.349064112f, 0.557786882f },
+	{ { { 9, 8, 2, 12, -1 }, { 9, 12, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.000554497412f, 0.554256618f, 0.329153001f },
+	{ { { 12, 1, 6, 6, -1 }, { 12, 3, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00154289801f, 0.361257911f, 0.554597914f },
+	{ { { 5, 2, 6, 6, -1 }, { 5, 2, 3, 3, 2 }, { 8, 5, 3, 3, 2 } }, -0.001032945f, 0.353013903f, 0.557614028f },
+	{ { { 9, 16, 6, 4, -1 }, { 12, 16, 3, 2, 2 }, { 9, 18, 3, 2, 2 } }, 0.000776981586f, 0.391677886f, 0.564532101f },
+	{ { { 1, 2, 18, 3, -1 }, { 7, 2, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.143203005f, 0.466748208f, 0.702363312f },
+	{ { { 7, 4, 9, 10, -1 }, { 7, 9, 9, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00738664903f, 0.307368487f, 0.528925776f },
+	{ { { 5, 9, 4, 4, -1 }, { 7, 9, 2, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000629367423f, 0.562211812f, 0.403704911f },
+	{ { { 11, 10, 3, 6, -1 }, { 11, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000788935286f, 0.526766121f, 0.355787486f },
+	{ { { 7, 11, 5, 3, -1 }, { 7, 12, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0122280503f, 0.666832089f, 0.462554991f },
+	{ { { 7, 11, 6, 6, -1 }, { 10, 11, 3, 3, 2 }, { 7, 14, 3, 3, 2 } }, 0.00354202394f, 0.552143812f, 0.386967301f },
+	{ { { 0, 0, 10, 9, -1 }, { 0, 3, 10, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00105853204f, 0.362867802f, 0.53209269f },
+	{ { { 13, 14, 1, 6, -1 }, { 13, 16, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 1.49356601e-05f, 0.463244498f, 0.536332309f },
+	{ { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00525377085f, 0.513223171f, 0.326570898f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00823380239f, 0.669368982f, 0.477414012f },
+	{ { { 6, 14, 1, 6, -1 }, { 6, 16, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 2.18668101e-05f, 0.405386209f, 0.545793116f },
+	{ { { 9, 15, 2, 3, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.003815023f, 0.645499587f, 0.479317814f },
+	{ { { 6, 4, 3, 3, -1 }, { 7, 4, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00111058797f, 0.52704072f, 0.352967888f },
+	{ { { 9, 0, 11, 3, -1 }, { 9, 1, 11, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00577076897f, 0.380354702f, 0.535295784f },
+	{ { { 0, 6, 20, 3, -1 }, { 0, 7, 20, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00301583391f, 0.533940315f, 0.3887133f },
+	{ { { 10, 1, 1, 2, -1 }, { 10, 2, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000854536891f, 0.356461614f, 0.52736038f },
+	{ { { 9, 6, 2, 6, -1 }, { 10, 6, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.0110505102f, 0.467190713f, 0.684973776f },
+	{ { { 5, 8, 12, 1, -1 }, { 9, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0426058397f, 0.515147328f, 0.0702200904f },
+	{ { { 3, 8, 12, 1, -1 }, { 7, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00307817501f, 0.304166108f, 0.51526022f },
+	{ { { 9, 7, 3, 5, -1 }, { 10, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00548157282f, 0.643029571f, 0.489722997f },
+	{ { { 3, 9, 6, 2, -1 }, { 6, 9, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00318818609f, 0.530749321f, 0.38262099f },
+	{ { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0003594718f, 0.465004712f, 0.542190492f },
+	{ { { 7, 0, 6, 1, -1 }, { 9, 0, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00407050317f, 0.284967989f, 0.507911623f },
+	{ { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0145941703f, 0.297164589f, 0.512846172f },
+	{ { { 7, 10, 2, 1, -1 }, { 8, 10, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000119476899f, 0.563109815f, 0.434308201f },
+	{ { { 6, 4, 9, 13, -1 }, { 9, 4, 3, 13, 3 }, { 0, 0, 0, 0, 0 } }, -0.000693446491f, 0.440357804f, 0.535995901f },
+	{ { { 6, 8, 4, 2, -1 }, { 6, 9, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 1.48347999e-05f, 0.342100888f, 0.516469777f },
+	{ { { 16, 2, 4, 6, -1 }, { 16, 2, 2, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00902969856f, 0.463934302f, 0.611407518f },
+	{ { { 0, 17, 6, 3, -1 }, { 0, 18, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00806408189f, 0.28201589f, 0.507549405f },
+	{ { { 10, 10, 3, 10, -1 }, { 10, 15, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.0260621198f, 0.520890594f, 0.268877804f },
+	{ { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0173146594f, 0.466371387f, 0.673853993f },
+	{ { { 10, 4, 4, 3, -1 }, { 10, 4, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0226666406f, 0.520934999f, 0.221272394f },
+	{ { { 8, 4, 3, 8, -1 }, { 9, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.00219659298f, 0.606310129f, 0.453819007f },
+	{ { { 6, 6, 9, 13, -1 }, { 9, 6, 3, 13, 3 }, { 0, 0, 0, 0, 0 } }, -0.00952824764f, 0.463520497f, 0.52474308f },
+	{ { { 6, 0, 8, 12, -1 }, { 6, 0, 4, 6, 2 }, { 10, 6, 4, 6, 2 } }, 0.00809436198f, 0.528944016f, 0.391388208f },
+	{ { { 14, 2, 6, 8, -1 }, { 16, 2, 2, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.0728773326f, 0.775200188f, 0.499023497f },
+	{ { { 6, 0, 3, 6, -1 }, { 7, 0, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0069009522f, 0.242803901f, 0.504809022f },
+	{ { { 14, 2, 6, 8, -1 }, { 16, 2, 2, 8, 3 }, { 0, 0, 0, 0, 0 } }, -0.0113082398f, 0.573436499f, 0.484237611f },
+	{ { { 0, 5, 6, 6, -1 }, { 0, 8, 6, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0596132018f, 0.50298363f, 0.252497703f },
+	{ { { 9, 12, 6, 2, -1 }, { 12, 12, 3, 1, 2 }, { 9, 13, 3, 1, 2 } }, -0.00286246208f, 0.607304513f, 0.489845991f },
+	{ { { 8, 17, 3, 2, -1 }, { 9, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00447814493f, 0.501528919f, 0.222031698f },
+	{ { { 11, 6, 2, 2, -1 }, { 12, 6, 1, 1, 2 }, { 11, 7, 1, 1, 2 } }, -0.00175132405f, 0.661442876f, 0.493386894f },
+	{ { { 1, 9, 18, 2, -1 }, { 7, 9, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0401634201f, 0.518087804f, 0.3741045f },
+	{ { { 11, 6, 2, 2, -1 }, { 12, 6, 1, 1, 2 }, { 11, 7, 1, 1, 2 } }, 0.000347689493f, 0.472041696f, 0.581803203f },
+	{ { { 3, 4, 12, 8, -1 }, { 7, 4, 4, 8, 3 }, { 0, 0, 0, 0, 0 } }, 0.00265516504f, 0.380501091f, 0.522133589f },
+	{ { { 13, 11, 5, 3, -1 }, { 13, 12, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0087706279f, 0.294416606f, 0.523129523f },
+	{ { { 9, 10, 2, 3, -1 }, { 9, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00551220914f, 0.73461771f, 0.472281694f },
+	{ { { 14, 7, 2, 3, -1 }, { 14, 7, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000686720421f, 0.545287609f, 0.424241304f },
+	{ { { 5, 4, 1, 3, -1 }, { 5, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000560196699f, 0.439886212f, 0.56012851f },
+	{ { { 13, 4, 2, 3, -1 }, { 13, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00241437694f, 0.474168688f, 0.613662183f },
+	{ { { 5, 4, 2, 3, -1 }, { 5, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00156809005f, 0.604455292f, 0.451640993f },
+	{ { { 9, 8, 2, 3, -1 }, { 9, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00368274911f, 0.245245904f, 0.529498219f },
+	{ { { 8, 9, 2, 2, -1 }, { 8, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000294091908f, 0.373283803f, 0.525145113f },
+	{ { { 15, 14, 1, 4, -1 }, { 15, 16, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000428477593f, 0.549880981f, 0.406553507f },
+	{ { { 3, 12, 2, 2, -1 }, { 3, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00488170702f, 0.213990897f, 0.499995708f },
+	{ { { 12, 15, 2, 2, -1 }, { 13, 15, 1, 1, 2 }, { 12, 16, 1, 1, 2 } }, 0.000272720208f, 0.465028703f, 0.581342876f },
+	{ { { 9, 13, 2, 2, -1 }, { 9, 14, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000209471997f, 0.438748688f, 0.557279289f },
+	{ { { 4, 11, 14, 9, -1 }, { 4, 14, 14, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0485011898f, 0.524497271f, 0.321288913f },
+	{ { { 7, 13, 4, 3, -1 }, { 7, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00451664114f, 0.6056813f, 0.454588205f },
+	{ { { 15, 14, 1, 4, -1 }, { 15, 16, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0122916801f, 0.204092905f, 0.515221417f },
+	{ { { 4, 14, 1, 4, -1 }, { 4, 16, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000485496799f, 0.523760498f, 0.373950303f },
+	{ { { 14, 0, 6, 13, -1 }, { 16, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } }, 0.0305560492f, 0.496053398f, 0.593824625f },
+	{ { { 4, 1, 2, 12, -1 }, { 4, 1, 1, 6, 2 }, { 5, 7, 1, 6, 2 } }, -0.000151053202f, 0.535130382f, 0.414520413f },
+	{ { { 11, 14, 6, 6, -1 }, { 14, 14, 3, 3, 2 }, { 11, 17, 3, 3, 2 } }, 0.00249374402f, 0.469336689f, 0.551494122f },
+	{ { { 3, 14, 6, 6, -1 }, { 3, 14, 3, 3, 2 }, { 6, 17, 3, 3, 2 } }, -0.0123821301f, 0.679139674f, 0.468166798f },
+	{ { { 14, 17, 3, 2, -1 }, { 14, 18, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00513334619f, 0.360873908f, 0.522916019f },
+	{ { { 3, 17, 3, 2, -1 }, { 3, 18, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000519192778f, 0.530007303f, 0.363361388f },
+	{ { { 14, 0, 6, 13, -1 }, { 16, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } }, 0.150604203f, 0.515731692f, 0.221178204f },
+	{ { { 0, 0, 6, 13, -1 }, { 2, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } }, 0.00771441497f, 0.441049695f, 0.577660918f },
+	{ { { 10, 10, 7, 6, -1 }, { 10, 12, 7, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00944435224f, 0.540185511f, 0.375665009f },
+	{ { { 6, 15, 2, 2, -1 }, { 6, 15, 1, 1, 2 }, { 7, 16, 1, 1, 2 } }, 0.000250062498f, 0.436827093f, 0.560737491f },
+	{ { { 6, 11, 8, 6, -1 }, { 10, 11, 4, 3, 2 }, { 6, 14, 4, 3, 2 } }, -0.00330771506f, 0.424479902f, 0.55182308f },
+	{ { { 7, 6, 2, 2, -1 }, { 7, 6, 1, 1, 2 }, { 8, 7, 1, 1, 2 } }, 0.000740489108f, 0.449696213f, 0.590057671f },
+	{ { { 2, 2, 16, 6, -1 }, { 10, 2, 8, 3, 2 }, { 2, 5, 8, 3, 2 } }, 0.0440920517f, 0.529349327f, 0.315635502f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00336399092f, 0.448329687f, 0.584866226f },
+	{ { { 11, 7, 3, 10, -1 }, { 11, 12, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00397600792f, 0.455950707f, 0.548363924f },
+	{ { { 6, 7, 3, 10, -1 }, { 6, 12, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00277169305f, 0.534178615f, 0.37924841f },
+	{ { { 10, 7, 3, 2, -1 }, { 11, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000241230198f, 0.566718876f, 0.457697302f },
+	{ { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000494256674f, 0.442124486f, 0.562878728f },
+	{ { { 10, 1, 1, 3, -1 }, { 10, 2, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000388764689f, 0.428837091f, 0.539106309f },
+	{ { { 1, 2, 4, 18, -1 }, { 1, 2, 2, 9, 2 }, { 3, 11, 2, 9, 2 } }, -0.0500488989f, 0.689951301f, 0.470374286f },
+	{ { { 12, 4, 4, 12, -1 }, { 12, 10, 4, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.0366354808f, 0.221777901f, 0.519182622f },
+	{ { { 0, 0, 1, 6, -1 }, { 0, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00242735795f, 0.513622403f, 0.34973979f },
+	{ { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00195580302f, 0.482619286f, 0.640838087f },
+	{ { { 8, 7, 4, 3, -1 }, { 8, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00174946105f, 0.392283589f, 0.527268529f },
+	{ { { 10, 7, 3, 2, -1 }, { 11, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.01395508f, 0.507820189f, 0.841650486f },
+	{ { { 7, 7, 3, 2, -1 }, { 8, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000218967398f, 0.552048981f, 0.431423485f },
+	{ { { 9, 4, 6, 1, -1 }, { 11, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00151313096f, 0.393460512f, 0.538257122f },
+	{ { { 8, 7, 2, 3, -1 }, { 9, 7, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00436228001f, 0.737062871f, 0.473647594f },
+	{ { { 12, 7, 8, 6, -1 }, { 16, 7, 4, 3, 2 }, { 12, 10, 4, 3, 2 } }, 0.0651605874f, 0.51592797f, 0.328159511f },
+	{ { { 0, 7, 8, 6, -1 }, { 0, 7, 4, 3, 2 }, { 4, 10, 4, 3, 2 } }, -0.00235673995f, 0.367282689f, 0.517288625f },
+	{ { { 18, 2, 2, 10, -1 }, { 19, 2, 1, 5, 2 }, { 18, 7, 1, 5, 2 } }, 0.0151466597f, 0.50314939f, 0.668760419f },
+	{ { { 0, 2, 6, 4, -1 }, { 3, 2, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0228509605f, 0.676751971f, 0.470959693f },
+	{ { { 9, 4, 6, 1, -1 }, { 11, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00488676503f, 0.525799811f, 0.405987889f },
+	{ { { 7, 15, 2, 2, -1 }, { 7, 15, 1, 1, 2 }, { 8, 16, 1, 1, 2 } }, 0.00176195998f, 0.469627291f, 0.668827891f },
+	{ { { 11, 13, 1, 6, -1 }, { 11, 16, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.001294252f, 0.432071298f, 0.534428179f },
+	{ { { 8, 13, 1, 6, -1 }, { 8, 16, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0109299496f, 0.499770612f, 0.163748607f },
+	{ { { 14, 3, 2, 1, -1 }, { 14, 3, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 2.99584899e-05f, 0.428241789f, 0.563322425f },
+	{ { { 8, 15, 2, 3, -1 }, { 8, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0065884362f, 0.677212119f, 0.470052689f },
+	{ { { 12, 15, 7, 4, -1 }, { 12, 17, 7, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00325277797f, 0.531339705f, 0.453614891f },
+	{ { { 4, 14, 12, 3, -1 }, { 4, 15, 12, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00404357398f, 0.566006184f, 0.441338897f },
+	{ { { 10, 3, 3, 2, -1 }, { 11, 3, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00125235401f, 0.373191386f, 0.535645187f },
+	{ { { 4, 12, 2, 2, -1 }, { 4, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000192467196f, 0.518998623f, 0.373881102f },
+	{ { { 10, 11, 4, 6, -1 }, { 10, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0385896713f, 0.295637399f, 0.518881083f },
+	{ { { 7, 13, 2, 2, -1 }, { 7, 13, 1, 1, 2 }, { 8, 14, 1, 1, 2 } }, 0.000154898706f, 0.434713513f, 0.550953329f },
+	{ { { 4, 11, 14, 4, -1 }, { 11, 11, 7, 2, 2 }, { 4, 13, 7, 2, 2 } }, -0.0337638482f, 0.323033005f, 0.519547582f },
+	{ { { 1, 18, 18, 2, -1 }, { 7, 18, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00826570671f, 0.597548902f, 0.455211401f },
+	{ { { 11, 18, 2, 2, -1 }, { 12, 18, 1, 1, 2 }, { 11, 19, 1, 1, 2 } }, 1.44814403e-05f, 0.474567801f, 0.549742699f },
+	{ { { 7, 18, 2, 2, -1 }, { 7, 18, 1, 1, 2 }, { 8, 19, 1, 1, 2 } }, 1.49512998e-05f, 0.432447314f, 0.548064411f },
+	{ { { 12, 18, 8, 2, -1 }, { 12, 19, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.0187417995f, 0.158005297f, 0.51785332f },
+	{ { { 7, 14, 6, 2, -1 }, { 7, 15, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00175722397f, 0.45176369f, 0.577376425f },
+	{ { { 8, 12, 4, 8, -1 }, { 10, 12, 2, 4, 2 }, { 8, 16, 2, 4, 2 } }, -0.00313911191f, 0.414964795f, 0.546084225f },
+	{ { { 4, 9, 3, 3, -1 }, { 4, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 6.66567794e-05f, 0.403909087f, 0.529308498f },
+	{ { { 7, 10, 6, 2, -1 }, { 9, 10, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00677434215f, 0.476765186f, 0.612195611f },
+	{ { { 5, 0, 4, 15, -1 }, { 7, 0, 2, 15, 2 }, { 0, 0, 0, 0, 0 } }, -0.0073868162f, 0.358625889f, 0.518728077f },
+	{ { { 8, 6, 12, 14, -1 }, { 12, 6, 4, 14, 3 }, { 0, 0, 0, 0, 0 } }, 0.0140409302f, 0.471213996f, 0.557615578f },
+	{ { { 5, 16, 3, 3, -1 }, { 5, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.005525833f, 0.266102701f, 0.503928125f },
+	{ { { 8, 1, 12, 19, -1 }, { 12, 1, 4, 19, 3 }, { 0, 0, 0, 0, 0 } }, 0.3868424f, 0.51443398f, 0.252589911f },
+	{ { { 3, 0, 3, 2, -1 }, { 3, 1, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000114592403f, 0.42849949f, 0.54233712f },
+	{ { { 10, 12, 4, 5, -1 }, { 10, 12, 2, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.0184675697f, 0.388583511f, 0.521306217f },
+	{ { { 6, 12, 4, 5, -1 }, { 8, 12, 2, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.000459070114f, 0.541256309f, 0.423590988f },
+	{ { { 11, 11, 2, 2, -1 }, { 12, 11, 1, 1, 2 }, { 11, 12, 1, 1, 2 } }, 0.00125275401f, 0.489930511f, 0.662409127f },
+	{ { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00149106095f, 0.528677821f, 0.4040052f },
+	{ { { 11, 11, 2, 2, -1 }, { 12, 11, 1, 1, 2 }, { 11, 12, 1, 1, 2 } }, -0.000754355628f, 0.603299022f, 0.479512006f },
+	{ { { 7, 6, 4, 10, -1 }, { 7, 11, 4, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00694788387f, 0.408440113f, 0.537350416f },
+	{ { { 11, 11, 2, 2, -1 }, { 12, 11, 1, 1, 2 }, { 11, 12, 1, 1, 2 } }, 0.000280929205f, 0.484606296f, 0.575938225f },
+	{ { { 2, 13, 5, 2, -1 }, { 2, 14, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000960737176f, 0.516474128f, 0.355497986f },
+	{ { { 11, 11, 2, 2, -1 }, { 12, 11, 1, 1, 2 }, { 11, 12, 1, 1, 2 } }, -0.0002688393f, 0.567758203f, 0.473176599f },
+	{ { { 7, 11, 2, 2, -1 }, { 7, 11, 1, 1, 2 }, { 8, 12, 1, 1, 2 } }, 0.00215993705f, 0.473148704f, 0.707056701f },
+	{ { { 14, 13, 3, 3, -1 }, { 14, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00562353013f, 0.524024308f, 0.278179199f },
+	{ { { 3, 13, 3, 3, -1 }, { 3, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00502439914f, 0.28370139f, 0.506230414f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00976116396f, 0.740071774f, 0.4934569f },
+	{ { { 8, 7, 3, 3, -1 }, { 8, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00415151007f, 0.511913121f, 0.340700805f },
+	{ { { 13, 5, 3, 3, -1 }, { 13, 6, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0062465081f, 0.492378801f, 0.657905877f },
+	{ { { 0, 9, 5, 3, -1 }, { 0, 10, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00705974782f, 0.243471101f, 0.503284216f },
+	{ { { 13, 5, 3, 3, -1 }, { 13, 6, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00205877097f, 0.590031087f, 0.469508708f },
+	{ { { 9, 12, 2, 8, -1 }, { 9, 12, 1, 4, 2 }, { 10, 16, 1, 4, 2 } }, -0.00241460605f, 0.364731789f, 0.518920183f },
+	{ { { 11, 7, 2, 2, -1 }, { 12, 7, 1, 1, 2 }, { 11, 8, 1, 1, 2 } }, -0.00148176099f, 0.603494823f, 0.494012803f },
+	{ { { 0, 16, 6, 4, -1 }, { 3, 16, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.00630164007f, 0.581898987f, 0.456042796f },
+	{ { { 10, 6, 2, 3, -1 }, { 10, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00347634288f, 0.521747589f, 0.348399311f },
+	{ { { 9, 5, 2, 6, -1 }, { 9, 7, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0222508702f, 0.236070007f, 0.50320828f },
+	{ { { 12, 15, 8, 4, -1 }, { 12, 15, 4, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0306125507f, 0.649918675f, 0.491491914f },
+	{ { { 0, 14, 8, 6, -1 }, { 4, 14, 4, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.0130574796f, 0.44133231f, 0.568376422f },
+	{ { { 9, 0, 3, 2, -1 }, { 10, 0, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000600957428f, 0.435973108f, 0.533348322f },
+	{ { { 4, 15, 4, 2, -1 }, { 6, 15, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000415142509f, 0.550406277f, 0.432606012f },
+	{ { { 12, 7, 3, 13, -1 }, { 13, 7, 1, 13, 3 }, { 0, 0, 0, 0, 0 } }, -0.0137762902f, 0.40641129f, 0.520154893f },
+	{ { { 5, 7, 3, 13, -1 }, { 6, 7, 1, 13, 3 }, { 0, 0, 0, 0, 0 } }, -0.0322965086f, 0.0473519713f, 0.497719496f },
+	{ { { 9, 6, 3, 9, -1 }, { 9, 9, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0535569787f, 0.488173306f, 0.666693926f },
+	{ { { 4, 4, 7, 12, -1 }, { 4, 10, 7, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00818895455f, 0.540003717f, 0.424082011f },
+	{ { { 12, 12, 2, 2, -1 }, { 13, 12, 1, 1, 2 }, { 12, 13, 1, 1, 2 } }, 0.000210553204f, 0.480204791f, 0.556385279f },
+	{ { { 6, 12, 2, 2, -1 }, { 6, 12, 1, 1, 2 }, { 7, 13, 1, 1, 2 } }, -0.00243827305f, 0.738779306f, 0.477368504f },
+	{ { { 8, 9, 4, 2, -1 }, { 10, 9, 2, 1, 2 }, { 8, 10, 2, 1, 2 } }, 0.00328355702f, 0.528854609f, 0.317129195f },
+	{ { { 3, 6, 2, 2, -1 }, { 3, 6, 1, 1, 2 }, { 4, 7, 1, 1, 2 } }, 0.00237295707f, 0.475081295f, 0.706017077f },
+	{ { { 16, 6, 3, 2, -1 }, { 16, 7, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00145416998f, 0.381173015f, 0.533073902f },
+	/* stage 18 */
+	{ { { 0, 7, 19, 4, -1 }, { 0, 9, 19, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.055755239f, 0.401915699f, 0.680603683f },
+	{ { { 10, 2, 10, 1, -1 }, { 10, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00247302488f, 0.335114896f, 0.596571982f },
+	{ { { 9, 4, 2, 12, -1 }, { 9, 10, 2, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.000350316986f, 0.555770814f, 0.348228693f },
+	{ { { 12, 18, 4, 1, -1 }, { 12, 18, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000541676302f, 0.426085889f, 0.569338083f },
+	{ { { 1, 7, 6, 4, -1 }, { 1, 7, 3, 2, 2 }, { 4, 9, 3, 2, 2 } }, 0.000771936786f, 0.349424005f, 0.543368876f },
+	{ { { 12, 0, 6, 13, -1 }, { 14, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } }, -0.00159992196f, 0.402849913f, 0.548435926f },
+	{ { { 2, 0, 6, 13, -1 }, { 4, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } }, -0.000118320801f, 0.380690187f, 0.542546511f },
+	{ { { 10, 5, 8, 8, -1 }, { 10, 9, 8, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000329090311f, 0.262010008f, 0.54295218f },
+	{ { { 8, 3, 2, 5, -1 }, { 9, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.000295181089f, 0.379976898f, 0.53992641f },
+	{ { { 8, 4, 9, 1, -1 }, { 11, 4, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 9.04667104e-05f, 0.443364501f, 0.54402262f },
+	{ { { 3, 4, 9, 1, -1 }, { 6, 4, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 1.50071901e-05f, 0.371965498f, 0.540911973f },
+	{ { { 1, 0, 18, 10, -1 }, { 7, 0, 6, 10, 3 }, { 0, 0, 0, 0, 0 } }, 0.139356107f, 0.552539587f, 0.447904289f },
+	{ { { 7, 17, 5, 3, -1 }, { 7, 18, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00164619903f, 0.426450104f, 0.577216983f },
+	{ { { 7, 11, 6, 1, -1 }, { 9, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000499844318f, 0.435952604f, 0.568587124f },
+	{ { { 2, 2, 3, 2, -1 }, { 2, 3, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00109712803f, 0.339013696f, 0.520540893f },
+	{ { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000669198926f, 0.455745608f, 0.598065972f },
+	{ { { 6, 10, 3, 6, -1 }, { 6, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000864710426f, 0.51348412f, 0.294403315f },
+	{ { { 11, 4, 2, 4, -1 }, { 11, 4, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000271825993f, 0.390657812f, 0.537718117f },
+	{ { { 7, 4, 2, 4, -1 }, { 8, 4, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, 3.02494991e-05f, 0.367960989f, 0.522568882f },
+	{ { { 9, 6, 2, 4, -1 }, { 9, 6, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.00852258969f, 0.729310215f, 0.489236504f },
+	{ { { 6, 13, 8, 3, -1 }, { 6, 14, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00167055603f, 0.434532493f, 0.569613814f },
+	{ { { 9, 15, 3, 4, -1 }, { 10, 15, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00714338385f, 0.259128004f, 0.522562385f },
+	{ { { 9, 2, 2, 17, -1 }, { 10, 2, 1, 17, 2 }, { 0, 0, 0, 0, 0 } }, -0.0163193699f, 0.6922279f, 0.465157598f },
+	{ { { 7, 0, 6, 1, -1 }, { 9, 0, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0048034261f, 0.535226285f, 0.328630298f },
+	{ { { 8, 15, 3, 4, -1 }, { 9, 15, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00754219294f, 0.2040544f, 0.503454626f },
+	{ { { 7, 13, 7, 3, -1 }, { 7, 14, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0143631101f, 0.680488884f, 0.488905907f },
+	{ { { 8, 16, 3, 3, -1 }, { 9, 16, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.000890635885f, 0.531069577f, 0.389548093f },
+	{ { { 6, 2, 8, 10, -1 }, { 6, 7, 8, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00440601911f, 0.574156284f, 0.437242687f },
+	{ { { 2, 5, 8, 8, -1 }, { 2, 9, 8, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000188625403f, 0.283178598f, 0.509820521f },
+	{ { { 14, 16, 2, 2, -1 }, { 14, 17, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.0037979281f, 0.337250799f, 0.524658024f },
+	{ { { 4, 16, 2, 2, -1 }, { 4, 17, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000146270497f, 0.530667424f, 0.391171008f },
+	{ { { 10, 11, 4, 6, -1 }, { 10, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -4.91646388e-05f, 0.546249628f, 0.394272089f },
+	{ { { 6, 11, 4, 6, -1 }, { 6, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0335825011f, 0.215782404f, 0.504821181f },
+	{ { { 10, 14, 1, 3, -1 }, { 10, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00353393098f, 0.646531224f, 0.4872697f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00501441117f, 0.461766809f, 0.624807477f },
+	{ { { 10, 0, 4, 6, -1 }, { 12, 0, 2, 3, 2 }, { 10, 3, 2, 3, 2 } }, 0.0188173708f, 0.522068918f, 0.200005203f },
+	{ { { 0, 3, 20, 2, -1 }, { 0, 4, 20, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00134343398f, 0.401453793f, 0.530161977f },
+	{ { { 12, 0, 8, 2, -1 }, { 16, 0, 4, 1, 2 }, { 12, 1, 4, 1, 2 } }, 0.00175579602f, 0.479403913f, 0.565316975f },
+	{ { { 2, 12, 10, 8, -1 }, { 2, 16, 10, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.095637463f, 0.203419507f, 0.500670671f },
+	{ { { 17, 7, 2, 10, -1 }, { 18, 7, 1, 5, 2 }, { 17, 12, 1, 5, 2 } }, -0.0222412292f, 0.767247319f, 0.504634023f },
+	{ { { 1, 7, 2, 10, -1 }, { 1, 7, 1, 5, 2 }, { 2, 12, 1, 5, 2 } }, -0.0155758196f, 0.749034226f, 0.475585103f },
+	{ { { 15, 10, 3, 6, -1 }, { 15, 12, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00535991183f, 0.536530375f, 0.400467098f },
+	{ { { 4, 4, 6, 2, -1 }, { 6, 4, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0217634998f, 0.0740154982f, 0.496417493f },
+	{ { { 0, 5, 20, 6, -1 }, { 0, 7, 20, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.165615901f, 0.285910308f, 0.521808624f },
+	{ { { 0, 0, 8, 2, -1 }, { 0, 0, 4, 1, 2 }, { 4, 1, 4, 1, 2 } }, 0.0001646132f, 0.419161588f, 0.538079321f },
+	{ { { 1, 0, 18, 4, -1 }, { 7, 0, 6, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00890775025f, 0.627319276f, 0.487740487f },
+	{ { { 1, 13, 6, 2, -1 }, { 1, 14, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000863464491f, 0.515994072f, 0.367102593f },
+	{ { { 10, 8, 3, 4, -1 }, { 11, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00137517601f, 0.588437676f, 0.457908392f },
+	{ { { 6, 1, 6, 1, -1 }, { 8, 1, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00140812399f, 0.356050998f, 0.513994515f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00393428886f, 0.599428892f, 0.466427207f },
+	{ { { 1, 6, 18, 2, -1 }, { 10, 6, 9, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0319669284f, 0.334546208f, 0.514418304f },
+	{ { { 15, 11, 1, 2, -1 }, { 15, 12, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -1.50892802e-05f, 0.558265626f, 0.441405714f },
+	{ { { 6, 5, 1, 2, -1 }, { 6, 6, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000519944704f, 0.462368011f, 0.616899371f },
+	{ { { 13, 4, 1, 3, -1 }, { 13, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00342204608f, 0.655707479f, 0.497480512f },
+	{ { { 2, 15, 1, 2, -1 }, { 2, 16, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000177233f, 0.526950181f, 0.39019081f },
+	{ { { 12, 4, 4, 3, -1 }, { 12, 5, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.001571676f, 0.463337302f, 0.579045773f },
+	{ { { 0, 0, 7, 3, -1 }, { 0, 1, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00890413299f, 0.268960804f, 0.505359113f },
+	{ { { 9, 12, 6, 2, -1 }, { 9, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000406775187f, 0.545660317f, 0.432989895f },
+	{ { { 5, 4, 2, 3, -1 }, { 5, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00676047802f, 0.464899391f, 0.668976188f },
+	{ { { 18, 4, 2, 3, -1 }, { 18, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00291000889f, 0.530970395f, 0.337783992f },
+	{ { { 3, 0, 8, 6, -1 }, { 3, 2, 8, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00138854596f, 0.407473892f, 0.534913301f },
+	{ { { 0, 2, 20, 6, -1 }, { 10, 2, 10, 3, 2 }, { 0, 5, 10, 3, 2 } }, -0.0767642632f, 0.199217603f, 0.522824228f },
+	{ { { 4, 7, 2, 4, -1 }, { 5, 7, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000226883101f, 0.543850183f, 0.425307214f },
+	{ { { 3, 10, 15, 2, -1 }, { 8, 10, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00630941521f, 0.425917894f, 0.537890971f },
+	{ { { 3, 0, 12, 11, -1 }, { 9, 0, 6, 11, 2 }, { 0, 0, 0, 0, 0 } }, -0.110072799f, 0.69041568f, 0.472174913f },
+	{ { { 13, 0, 2, 6, -1 }, { 13, 0, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.000286196591f, 0.452491492f, 0.554830611f },
+	{ { { 0, 19, 2, 1, -1 }, { 1, 19, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 2.94253296e-05f, 0.537037373f, 0.42364639f },
+	{ { { 16, 10, 4, 10, -1 }, { 18, 10, 2, 5, 2 }, { 16, 15, 2, 5, 2 } }, -0.0248865709f, 0.6423558f, 0.496930391f },
+	{ { { 4, 8, 10, 3, -1 }, { 4, 9, 10, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0331488512f, 0.498847514f, 0.1613812f },
+	{ { { 14, 12, 3, 3, -1 }, { 14, 13, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00078491692f, 0.541602612f, 0.422300905f },
+	{ { { 0, 10, 4, 10, -1 }, { 0, 10, 2, 5, 2 }, { 2, 15, 2, 5, 2 } }, 0.00470871897f, 0.457632899f, 0.602755785f },
+	{ { { 18, 3, 2, 6, -1 }, { 18, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00241444795f, 0.530897319f, 0.442249894f },
+	{ { { 6, 6, 1, 3, -1 }, { 6, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00195231801f, 0.470563412f, 0.666332483f },
+	{ { { 7, 7, 7, 2, -1 }, { 7, 8, 7, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00130319805f, 0.440612614f, 0.552696228f },
+	{ { { 0, 3, 2, 6, -1 }, { 0, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00447354978f, 0.512902379f, 0.330149889f },
+	{ { { 11, 1, 3, 1, -1 }, { 12, 1, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00266528688f, 0.313547105f, 0.517503619f },
+	{ { { 5, 0, 2, 6, -1 }, { 6, 0, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.000136667702f, 0.411937088f, 0.53068769f },
+	{ { { 1, 1, 18, 14, -1 }, { 7, 1, 6, 14, 3 }, { 0, 0, 0, 0, 0 } }, -0.0171264503f, 0.617780626f, 0.483657897f },
+	{ { { 4, 6, 8, 3, -1 }, { 8, 6, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000266014307f, 0.365433097f, 0.516973674f },
+	{ { { 9, 12, 6, 2, -1 }, { 9, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0229323804f, 0.3490915f, 0.516399205f },
+	{ { { 5, 12, 6, 2, -1 }, { 8, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00233165501f, 0.516629994f, 0.370938987f },
+	{ { { 10, 7, 3, 5, -1 }, { 11, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0169256609f, 0.501473606f, 0.805398822f },
+	{ { { 7, 7, 3, 5, -1 }, { 8, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00898588262f, 0.647078872f, 0.465702087f },
+	{ { { 13, 0, 3, 10, -1 }, { 14, 0, 1, 10, 3 }, { 0, 0, 0, 0, 0 } }, -0.0118747f, 0.32463789f, 0.525875509f },
+	{ { { 4, 11, 3, 2, -1 }, { 4, 12, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000193505693f, 0.519194186f, 0.38396439f },
+	{ { { 17, 3, 3, 6, -1 }, { 18, 3, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.00587134901f, 0.491813391f, 0.618704319f },
+	{ { { 1, 8, 18, 10, -1 }, { 1, 13, 18, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.248387903f, 0.183680296f, 0.498815f },
+	{ { { 13, 0, 3, 10, -1 }, { 14, 0, 1, 10, 3 }, { 0, 0, 0, 0, 0 } }, 0.0122560002f, 0.522705376f, 0.363202989f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000839901797f, 0.449025005f, 0.577414811f },
+	{ { { 16, 3, 3, 7, -1 }, { 17, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.00254073692f, 0.480478704f, 0.585829914f },
+	{ { { 4, 0, 3, 10, -1 }, { 5, 0, 1, 10, 3 }, { 0, 0, 0, 0, 0 } }, -0.01482243f, 0.252104998f, 0.502353728f },
+	{ { { 16, 3, 3, 7, -1 }, { 17, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.00579739595f, 0.599669576f, 0.4853715f },
+	{ { { 0, 9, 1, 2, -1 }, { 0, 10, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000726621482f, 0.51537168f, 0.367177993f },
+	{ { { 18, 1, 2, 10, -1 }, { 18, 1, 1, 10, 2 }, { 0, 0, 0, 0, 0 } }, -0.0172325801f, 0.6621719f, 0.499465615f },
+	{ { { 0, 1, 2, 10, -1 }, { 1, 1, 1, 10, 2 }, { 0, 0, 0, 0, 0 } }, 0.00786240865f, 0.463339508f, 0.625610173f },
+	{ { { 10, 16, 3, 4, -1 }, { 11, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00473436201f, 0.361557305f, 0.528188527f },
+	{ { { 2, 8, 3, 3, -1 }, { 3, 8, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.000830484787f, 0.444288909f, 0.555095792f },
+	{ { { 11, 0, 2, 6, -1 }, { 12, 0, 1, 3, 2 }, { 11, 3, 1, 3, 2 } }, 0.00766021991f, 0.516293526f, 0.261335492f },
+	{ { { 7, 0, 2, 6, -1 }, { 7, 0, 1, 3, 2 }, { 8, 3, 1, 3, 2 } }, -0.00410483778f, 0.278963208f, 0.501903176f },
+	{ { { 16, 3, 3, 7, -1 }, { 17, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.00485125789f, 0.496898413f, 0.566166818f },
+	{ { { 1, 3, 3, 7, -1 }, { 2, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.000998964533f, 0.444560796f, 0.555181324f },
+	{ { { 14, 1, 6, 16, -1 }, { 16, 1, 2, 16, 3 }, { 0, 0, 0, 0, 0 } }, -0.270236313f, 0.0293882098f, 0.515131414f },
+	{ { { 0, 1, 6, 16, -1 }, { 2, 1, 2, 16, 3 }, { 0, 0, 0, 0, 0 } }, -0.0130906804f, 0.569939971f, 0.444745988f },
+	{ { { 2, 0, 16, 8, -1 }, { 10, 0, 8, 4, 2 }, { 2, 4, 8, 4, 2 } }, -0.00943427905f, 0.430546612f, 0.548789501f },
+	{ { { 6, 8, 5, 3, -1 }, { 6, 9, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00154820399f, 0.36803171f, 0.512808084f },
+	{ { { 9, 7, 3, 3, -1 }, { 10, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00537461322f, 0.483891696f, 0.610155582f },
+	{ { { 8, 8, 4, 3, -1 }, { 8, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00157867698f, 0.532522321f, 0.411854804f },
+	{ { { 9, 6, 2, 4, -1 }, { 9, 6, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00368560501f, 0.481094807f, 0.625230312f },
+	{ { { 0, 7, 15, 1, -1 }, { 5, 7, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00938870199f, 0.520022988f, 0.362941086f },
+	{ { { 8, 2, 7, 9, -1 }, { 8, 5, 7, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0127926301f, 0.496170998f, 0.673801601f },
+	{ { { 1, 7, 16, 4, -1 }, { 1, 7, 8, 2, 2 }, { 9, 9, 8, 2, 2 } }, -0.00336610409f, 0.406027913f, 0.52835989f },
+	{ { { 6, 12, 8, 2, -1 }, { 6, 13, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000397714204f, 0.467411399f, 0.590077519f },
+	{ { { 8, 11, 3, 3, -1 }, { 8, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00148680306f, 0.451911688f, 0.608205378f },
+	{ { { 4, 5, 14, 10, -1 }, { 11, 5, 7, 5, 2 }, { 4, 10, 7, 5, 2 } }, -0.0886867493f, 0.280789912f, 0.518099189f },
+	{ { { 4, 12, 3, 2, -1 }, { 4, 13, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -7.42961129e-05f, 0.52955842f, 0.408762515f },
+	{ { { 9, 11, 6, 1, -1 }, { 11, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -1.49329398e-05f, 0.546140015f, 0.453854293f },
+	{ { { 4, 9, 7, 6, -1 }, { 4, 11, 7, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00591622386f, 0.532916129f, 0.419213414f },
+	{ { { 7, 10, 6, 3, -1 }, { 7, 11, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00111416401f, 0.451201797f, 0.570621729f },
+	{ { { 9, 11, 2, 2, -1 }, { 9, 12, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 8.92493626e-05f, 0.4577806f, 0.58976382f },
+	{ { { 0, 5, 20, 6, -1 }, { 0, 7, 20, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00253195106f, 0.529960394f, 0.335763901f },
+	{ { { 6, 4, 6, 1, -1 }, { 8, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0124262003f, 0.495905906f, 0.134660199f },
+	{ { { 9, 11, 6, 1, -1 }, { 11, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0283357501f, 0.511707902f, 0.000610436371f },
+	{ { { 5, 11, 6, 1, -1 }, { 7, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00661658822f, 0.473634988f, 0.701162815f },
+	{ { { 10, 16, 3, 4, -1 }, { 11, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00804687664f, 0.521641791f, 0.328281999f },
+	{ { { 8, 7, 3, 3, -1 }, { 9, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00111939805f, 0.580986083f, 0.4563739f },
+	{ { { 2, 12, 16, 8, -1 }, { 2, 16, 16, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0132775903f, 0.539836228f, 0.410390109f },
+	{ { { 0, 15, 15, 2, -1 }, { 0, 16, 15, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0004879474f, 0.424928606f, 0.541059077f },
+	{ { { 15, 4, 5, 6, -1 }, { 15, 6, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0112431701f, 0.526996374f, 0.343821585f },
+	{ { { 9, 5, 2, 4, -1 }, { 10, 5, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.000898966682f, 0.563307583f, 0.445661306f },
+	{ { { 8, 10, 9, 6, -1 }, { 8, 12, 9, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00666771596f, 0.531288922f, 0.436267912f },
+	{ { { 2, 19, 15, 1, -1 }, { 7, 19, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0289472993f, 0.470179498f, 0.65757978f },
+	{ { { 10, 16, 3, 4, -1 }, { 11, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0234000497f, 0.f, 0.513739884f },
+	{ { { 0, 15, 20, 4, -1 }, { 0, 17, 20, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0891170502f, 0.0237452798f, 0.494243085f },
+	{ { { 10, 16, 3, 4, -1 }, { 11, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0140546001f, 0.312732309f, 0.511751115f },
+	{ { { 7, 16, 3, 4, -1 }, { 8, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00812393986f, 0.500904918f, 0.252002597f },
+	{ { { 9, 16, 3, 3, -1 }, { 9, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00499646505f, 0.638714373f, 0.492781192f },
+	{ { { 8, 11, 4, 6, -1 }, { 8, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00312539702f, 0.513684988f, 0.368045211f },
+	{ { { 9, 6, 2, 12, -1 }, { 9, 10, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00676696422f, 0.550984383f, 0.43636319f },
+	{ { { 8, 17, 4, 3, -1 }, { 8, 18, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00237114402f, 0.616233528f, 0.458694696f },
+	{ { { 9, 18, 8, 2, -1 }, { 13, 18, 4, 1, 2 }, { 9, 19, 4, 1, 2 } }, -0.00535227917f, 0.618545771f, 0.492049098f },
+	{ { { 1, 18, 8, 2, -1 }, { 1, 19, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.0159688592f, 0.138261795f, 0.498325288f },
+	{ { { 13, 5, 6, 15, -1 }, { 15, 5, 2, 15, 3 }, { 0, 0, 0, 0, 0 } }, 0.00476760603f, 0.46880579f, 0.549004614f },
+	{ { { 9, 8, 2, 2, -1 }, { 9, 9, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00247146911f, 0.236851498f, 0.500395298f },
+	{ { { 9, 5, 2, 3, -1 }, { 9, 5, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000710337888f, 0.585639417f, 0.472153306f },
+	{ { { 1, 5, 6, 15, -1 }, { 3, 5, 2, 15, 3 }, { 0, 0, 0, 0, 0 } }, -0.141175598f, 0.0869000629f, 0.496159106f },
+	{ { { 4, 1, 14, 8, -1 }, { 11, 1, 7, 4, 2 }, { 4, 5, 7, 4, 2 } }, 0.106518097f, 0.51388371f, 0.174100503f },
+	{ { { 2, 4, 4, 16, -1 }, { 2, 4, 2, 8, 2 }, { 4, 12, 2, 8, 2 } }, -0.0527447499f, 0.735363603f, 0.477288187f },
+	{ { { 12, 4, 3, 12, -1 }, { 12, 10, 3, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.00474317605f, 0.388440609f, 0.529270172f },
+	{ { { 4, 5, 10, 12, -1 }, { 4, 5, 5, 6, 2 }, { 9, 11, 5, 6, 2 } }, 0.00099676766f, 0.522349298f, 0.400342405f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00802841317f, 0.495910615f, 0.72129643f },
+	{ { { 5, 4, 2, 3, -1 }, { 5, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000860258588f, 0.444488406f, 0.553847611f },
+	{ { { 12, 2, 4, 10, -1 }, { 14, 2, 2, 5, 2 }, { 12, 7, 2, 5, 2 } }, 0.000931915012f, 0.539837122f, 0.416324407f },
+	{ { { 6, 4, 7, 3, -1 }, { 6, 5, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00250820606f, 0.585426509f, 0.456250012f },
+	{ { { 2, 0, 18, 2, -1 }, { 11, 0, 9, 1, 2 }, { 2, 1, 9, 1, 2 } }, -0.00213787612f, 0.460806906f, 0.528025925f },
+	{ { { 0, 0, 18, 2, -1 }, { 0, 0, 9, 1, 2 }, { 9, 1, 9, 1, 2 } }, -0.002154605f, 0.379112691f, 0.525599718f },
+	{ { { 13, 13, 4, 6, -1 }, { 15, 13, 2, 3, 2 }, { 13, 16, 2, 3, 2 } }, -0.00762140099f, 0.599860907f, 0.495207399f },
+	{ { { 3, 13, 4, 6, -1 }, { 3, 13, 2, 3, 2 }, { 5, 16, 2, 3, 2 } }, 0.002205536f, 0.448420614f, 0.55885309f },
+	{ { { 10, 12, 2, 6, -1 }, { 10, 15, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00125869503f, 0.545074701f, 0.442384094f },
+	{ { { 5, 9, 10, 10, -1 }, { 5, 9, 5, 5, 2 }, { 10, 14, 5, 5, 2 } }, -0.00509267207f, 0.411827505f, 0.526303589f },
+	{ { { 11, 4, 4, 2, -1 }, { 13, 4, 2, 1, 2 }, { 11, 5, 2, 1, 2 } }, -0.00250957394f, 0.578790784f, 0.499849498f },
+	{ { { 7, 12, 6, 8, -1 }, { 10, 12, 3, 8, 2 }, { 0, 0, 0, 0, 0 } }, -0.0773275569f, 0.839786589f, 0.481112003f },
+	{ { { 12, 2, 4, 10, -1 }, { 14, 2, 2, 5, 2 }, { 12, 7, 2, 5, 2 } }, -0.04148582f, 0.240861103f, 0.517699301f },
+	{ { { 8, 11, 2, 1, -1 }, { 9, 11, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000103556697f, 0.435536087f, 0.54170543f },
+	{ { { 10, 5, 1, 12, -1 }, { 10, 9, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00132558099f, 0.545397103f, 0.489409506f },
+	{ { { 0, 11, 6, 9, -1 }, { 3, 11, 3, 9, 2 }, { 0, 0, 0, 0, 0 } }, -0.00805987325f, 0.577102423f, 0.457791895f },
+	{ { { 12, 2, 4, 10, -1 }, { 14, 2, 2, 5, 2 }, { 12, 7, 2, 5, 2 } }, 0.0190586206f, 0.516986787f, 0.340047508f },
+	{ { { 4, 2, 4, 10, -1 }, { 4, 2, 2, 5, 2 }, { 6, 7, 2, 5, 2 } }, -0.0350578912f, 0.220324397f, 0.500050306f },
+	{ { { 11, 4, 4, 2, -1 }, { 13, 4, 2, 1, 2 }, { 11, 5, 2, 1, 2 } }, 0.00572960591f, 0.504340827f, 0.659757078f },
+	{ { { 0, 14, 6, 3, -1 }, { 0, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0116483299f, 0.218628496f, 0.49966529f },
+	{ { { 11, 4, 4, 2, -1 }, { 13, 4, 2, 1, 2 }, { 11, 5, 2, 1, 2 } }, 0.00145444798f, 0.500768185f, 0.550372779f },
+	{ { { 6, 1, 3, 2, -1 }, { 7, 1, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000250309095f, 0.412984103f, 0.524167001f },
+	{ { { 11, 4, 4, 2, -1 }, { 13, 4, 2, 1, 2 }, { 11, 5, 2, 1, 2 } }, -0.000829072727f, 0.541286826f, 0.497449607f },
+	{ { { 5, 4, 4, 2, -1 }, { 5, 4, 2, 1, 2 }, { 7, 5, 2, 1, 2 } }, 0.00108622096f, 0.46055299f, 0.587922871f },
+	{ { { 13, 0, 2, 12, -1 }, { 14, 0, 1, 6, 2 }, { 13, 6, 1, 6, 2 } }, 0.000200005001f, 0.527885497f, 0.470520914f },
+	{ { { 6, 0, 3, 10, -1 }, { 7, 0, 1, 10, 3 }, { 0, 0, 0, 0, 0 } }, 0.00292129209f, 0.51296097f, 0.375553697f },
+	{ { { 3, 0, 17, 8, -1 }, { 3, 4, 17, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0253874008f, 0.482269198f, 0.579076827f },
+	{ { { 0, 4, 20, 4, -1 }, { 0, 6, 20, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00319684693f, 0.52483952f, 0.396284014f },
+	/* stage 19 */
+	{ { { 0, 3, 8, 2, -1 }, { 4, 3, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00580317387f, 0.349898398f, 0.59619832f },
+	{ { { 8, 11, 4, 3, -1 }, { 8, 12, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00900030695f, 0.681663692f, 0.447855204f },
+	{ { { 5, 7, 6, 4, -1 }, { 5, 7, 3, 2, 2 }, { 8, 9, 3, 2, 2 } }, -0.00115496595f, 0.558570623f, 0.3578251f },
+	{ { { 8, 3, 4, 9, -1 }, { 8, 6, 4, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00110698503f, 0.536503613f, 0.305042803f },
+	{ { { 8, 15, 1, 4, -1 }, { 8, 17, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000103083097f, 0.363909513f, 0.534463584f },
+	{ { { 4, 5, 12, 7, -1 }, { 8, 5, 4, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.00509848399f, 0.285915703f, 0.550426483f },
+	{ { { 4, 2, 4, 10, -1 }, { 4, 2, 2, 5, 2 }, { 6, 7, 2, 5, 2 } }, 0.000825722003f, 0.523652375f, 0.347604185f },
+	{ { { 3, 0, 17, 2, -1 }, { 3, 1, 17, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00997833256f, 0.47503221f, 0.621964693f },
+	{ { { 2, 2, 16, 15, -1 }, { 2, 7, 16, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0374025293f, 0.334337592f, 0.527806282f },
+	{ { { 15, 2, 5, 2, -1 }, { 15, 3, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00485482579f, 0.519218087f, 0.37004441f },
+	{ { { 9, 3, 2, 2, -1 }, { 10, 3, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00186644704f, 0.292984396f, 0.509194493f },
+	{ { { 4, 5, 16, 15, -1 }, { 4, 10, 16, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0168888904f, 0.36868459f, 0.54312259f },
+	{ { { 7, 13, 5, 6, -1 }, { 7, 16, 5, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00583726214f, 0.363218397f, 0.522133589f },
+	{ { { 10, 7, 3, 2, -1 }, { 11, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00147137395f, 0.587068379f, 0.470065087f },
+	{ { { 8, 3, 3, 1, -1 }, { 9, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00115229504f, 0.319589496f, 0.514095426f },
+	{ { { 9, 16, 3, 3, -1 }, { 9, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00425603008f, 0.630185902f, 0.481492102f },
+	{ { { 0, 2, 5, 2, -1 }, { 0, 3, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00673782919f, 0.197704807f, 0.502580822f },
+	{ { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0113826701f, 0.495413214f, 0.686704576f },
+	{ { { 1, 7, 12, 1, -1 }, { 5, 7, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00517947087f, 0.516442776f, 0.335064799f },
+	{ { { 7, 5, 6, 14, -1 }, { 7, 12, 6, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.117437899f, 0.231524602f, 0.523441374f },
+	{ { { 0, 0, 8, 10, -1 }, { 0, 0, 4, 5, 2 }, { 4, 5, 4, 5, 2 } }, 0.0287034493f, 0.46642971f, 0.672252119f },
+	{ { { 9, 1, 3, 2, -1 }, { 10, 1, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00482310308f, 0.522087514f, 0.272353292f },
+	{ { { 8, 1, 3, 2, -1 }, { 9, 1, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.002679853f, 0.507927716f, 0.290694892f },
+	{ { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00805040821f, 0.488595098f, 0.639502108f },
+	{ { { 7, 4, 6, 16, -1 }, { 7, 12, 6, 8, 2 }, { 0, 0, 0, 0, 0 } }, 0.00480549596f, 0.51972568f, 0.365666389f },
+	{ { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00224201591f, 0.615346789f, 0.476370186f },
+	{ { { 2, 3, 2, 6, -1 }, { 2, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0137577103f, 0.26373449f, 0.503090322f },
+	{ { { 14, 2, 6, 9, -1 }, { 14, 5, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.103382997f, 0.228752196f, 0.518246114f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00944320858f, 0.695330381f, 0.469494909f },
+	{ { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000802711817f, 0.545065522f, 0.426878393f },
+	{ { { 5, 5, 2, 3, -1 }, { 5, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00419456698f, 0.609138787f, 0.457164288f },
+	{ { { 13, 11, 3, 6, -1 }, { 13, 13, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0109422104f, 0.524106324f, 0.328454703f },
+	{ { { 3, 14, 2, 6, -1 }, { 3, 17, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000578410691f, 0.538792908f, 0.417936891f },
+	{ { { 14, 3, 6, 2, -1 }, { 14, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00208886201f, 0.429269105f, 0.530171573f },
+	{ { { 0, 8, 16, 2, -1 }, { 0, 9, 16, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00323839695f, 0.379234791f, 0.522074401f },
+	{ { { 14, 3, 6, 2, -1 }, { 14, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00490750279f, 0.523728311f, 0.412675798f },
+	{ { { 0, 0, 5, 6, -1 }, { 0, 2, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0322779417f, 0.194765598f, 0.499450207f },
+	{ { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00897112302f, 0.601128519f, 0.492903203f },
+	{ { { 4, 11, 3, 6, -1 }, { 4, 13, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0153210899f, 0.50097537f, 0.203982204f },
+	{ { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00208555697f, 0.486218989f, 0.572169483f },
+	{ { { 9, 5, 1, 3, -1 }, { 9, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0050615021f, 0.500021875f, 0.180180594f },
+	{ { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00371747511f, 0.553011715f, 0.489759296f },
+	{ { { 6, 6, 8, 12, -1 }, { 6, 12, 8, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.0121705001f, 0.417860597f, 0.538372397f },
+	{ { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00462483987f, 0.499716997f, 0.576132715f },
+	{ { { 5, 12, 9, 2, -1 }, { 8, 12, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000210404294f, 0.533180714f, 0.409768105f },
+	{ { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0146417804f, 0.575592518f, 0.505177617f },
+	{ { { 4, 5, 4, 3, -1 }, { 4, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00331994891f, 0.45769769f, 0.603180587f },
+	{ { { 6, 6, 9, 2, -1 }, { 9, 6, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00372368796f, 0.43803969f, 0.541588306f },
+	{ { { 4, 11, 1, 3, -1 }, { 4, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000829511613f, 0.516303182f, 0.370221913f },
+	{ { { 14, 12, 6, 6, -1 }, { 14, 12, 3, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.0114084901f, 0.607294679f, 0.48625651f },
+	{ { { 7, 0, 3, 7, -1 }, { 8, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.00453201216f, 0.329247594f, 0.508896291f },
+	{ { { 9, 8, 3, 3, -1 }, { 10, 8, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00512760179f, 0.482976794f, 0.612270892f },
+	{ { { 8, 8, 3, 3, -1 }, { 9, 8, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00985831581f, 0.466068f, 0.655617714f },
+	{ { { 5, 10, 11, 3, -1 }, { 5, 11, 11, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0369859189f, 0.520484924f, 0.169047207f },
+	{ { { 5, 7, 10, 1, -1 }, { 10, 7, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00464911619f, 0.516732216f, 0.372522503f },
+	{ { { 9, 7, 3, 2, -1 }, { 10, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00426647021f, 0.640649319f, 0.498734295f },
+	{ { { 8, 7, 3, 2, -1 }, { 9, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000479565904f, 0.589729309f, 0.446487397f },
+	{ { { 11, 9, 4, 2, -1 }, { 11, 9, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00368271605f, 0.544156075f, 0.347266287f },
+	{ { { 5, 9, 4, 2, -1 }, { 7, 9, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0100598801f, 0.214316294f, 0.500482976f },
+	{ { { 14, 10, 2, 4, -1 }, { 14, 12, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000303618406f, 0.538642406f, 0.459032387f },
+	{ { { 7, 7, 3, 2, -1 }, { 8, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00145454798f, 0.575118423f, 0.449709505f },
+	{ { { 14, 17, 6, 3, -1 }, { 14, 18, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00165152096f, 0.54219377f, 0.423852086f },
+	{ { { 4, 5, 12, 12, -1 }, { 4, 5, 6, 6, 2 }, { 10, 11, 6, 6, 2 } }, -0.00784686394f, 0.407792091f, 0.525815725f },
+	{ { { 6, 9, 8, 8, -1 }, { 10, 9, 4, 4, 2 }, { 6, 13, 4, 4, 2 } }, -0.00512598502f, 0.422927588f, 0.547945321f },
+	{ { { 0, 4, 15, 4, -1 }, { 5, 4, 5, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0368909612f, 0.65963757f, 0.467467815f },
+	{ { { 13, 2, 4, 1, -1 }, { 13, 2, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000240356399f, 0.425113589f, 0.557320297f },
+	{ { { 4, 12, 2, 2, -1 }, { 4, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -1.51501699e-05f, 0.525924683f, 0.407411486f },
+	{ { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0022108471f, 0.467172295f, 0.588635206f },
+	{ { { 9, 13, 2, 3, -1 }, { 9, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00115686201f, 0.571106613f, 0.448716193f },
+	{ { { 13, 11, 2, 3, -1 }, { 13, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00499962922f, 0.526419818f, 0.289832711f },
+	{ { { 7, 12, 4, 4, -1 }, { 7, 12, 2, 2, 2 }, { 9, 14, 2, 2, 2 } }, -0.00146561896f, 0.389173806f, 0.519787192f },
+	{ { { 10, 11, 2, 2, -1 }, { 11, 11, 1, 1, 2 }, { 10, 12, 1, 1, 2 } }, -0.001197504f, 0.579587281f, 0.492795587f },
+	{ { { 8, 17, 3, 2, -1 }, { 9, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00449543307f, 0.237760305f, 0.501255512f },
+	{ { { 10, 11, 2, 2, -1 }, { 11, 11, 1, 1, 2 }, { 10, 12, 1, 1, 2 } }, 0.000149971602f, 0.487662613f, 0.561760783f },
+	{ { { 0, 17, 6, 3, -1 }, { 0, 18, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00263915095f, 0.516808808f, 0.376550913f },
+	{ { { 10, 11, 2, 2, -1 }, { 11, 11, 1, 1, 2 }, { 10, 12, 1, 1, 2 } }, -0.000293681311f, 0.544664919f, 0.487463087f },
+	{ { { 8, 11, 2, 2, -1 }, { 8, 11, 1, 1, 2 }, { 9, 12, 1, 1, 2 } }, 0.00142117601f, 0.468789786f, 0.669133186f },
+	{ { { 12, 5, 8, 4, -1 }, { 12, 5, 4, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0794276372f, 0.519344389f, 0.273294598f },
+	{ { { 0, 5, 8, 4, -1 }, { 4, 5, 4, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0799375027f, 0.497173101f, 0.178208396f },
+	{ { { 13, 2, 4, 1, -1 }, { 13, 2, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0110892598f, 0.516599476f, 0.320947587f },
+	{ { { 3, 2, 4, 1, -1 }, { 5, 2, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000165607096f, 0.405847192f, 0.530727625f },
+	{ { { 10, 0, 4, 2, -1 }, { 12, 0, 2, 1, 2 }, { 10, 1, 2, 1, 2 } }, -0.00533542922f, 0.344505697f, 0.515812993f },
+	{ { { 7, 12, 3, 1, -1 }, { 8, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00112872606f, 0.459486306f, 0.607553303f },
+	{ { { 8, 11, 4, 8, -1 }, { 10, 11, 2, 4, 2 }, { 8, 15, 2, 4, 2 } }, -0.0219692197f, 0.168040097f, 0.522859573f },
+	{ { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000217753201f, 0.386159688f, 0.521567285f },
+	{ { { 3, 18, 15, 2, -1 }, { 3, 19, 15, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000202001494f, 0.551797926f, 0.436303914f },
+	{ { { 2, 6, 2, 12, -1 }, { 2, 6, 1, 6, 2 }, { 3, 12, 1, 6, 2 } }, -0.0217331499f, 0.79994601f, 0.478985101f },
+	{ { { 9, 8, 2, 3, -1 }, { 9, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000843999325f, 0.408597589f, 0.537477314f },
+	{ { { 7, 10, 3, 2, -1 }, { 8, 10, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000438952498f, 0.547040522f, 0.436614305f },
+	{ { { 11, 11, 3, 1, -1 }, { 12, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00150924001f, 0.498899698f, 0.584214926f },
+	{ { { 6, 11, 3, 1, -1 }, { 7, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00355478399f, 0.675369024f, 0.472100586f },
+	{ { { 9, 2, 4, 2, -1 }, { 11, 2, 2, 1, 2 }, { 9, 3, 2, 1, 2 } }, 0.000481914001f, 0.541585386f, 0.435710907f },
+	{ { { 4, 12, 2, 3, -1 }, { 4, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00602643983f, 0.225850999f, 0.499188095f },
+	{ { { 2, 1, 18, 3, -1 }, { 8, 1, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0116681401f, 0.625655472f, 0.4927499f },
+	{ { { 5, 1, 4, 14, -1 }, { 7, 1, 2, 14, 2 }, { 0, 0, 0, 0, 0 } }, -0.002871837f, 0.39477849f, 0.524580181f },
+	{ { { 8, 16, 12, 3, -1 }, { 8, 16, 6, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0170511696f, 0.475251108f, 0.579422414f },
+	{ { { 1, 17, 18, 3, -1 }, { 7, 17, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0133520802f, 0.604110479f, 0.454453588f },
+	{ { { 9, 14, 2, 6, -1 }, { 9, 17, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00039301801f, 0.425827593f, 0.554490507f },
+	{ { { 9, 12, 1, 8, -1 }, { 9, 16, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00304833497f, 0.523342013f, 0.37802729f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00435792888f, 0.637188911f, 0.483867407f },
+	{ { { 9, 6, 2, 12, -1 }, { 9, 10, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00566610182f, 0.537470579f, 0.416366607f },
+	{ { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 6.06773392e-05f, 0.463879585f, 0.5311625f },
+	{ { { 0, 1, 4, 8, -1 }, { 2, 1, 2, 8, 2 }, { 0, 0, 0, 0, 0 } }, 0.036738161f, 0.468865603f, 0.6466524f },
+	{ { { 9, 1, 6, 2, -1 }, { 12, 1, 3, 1, 2 }, { 9, 2, 3, 1, 2 } }, 0.00865281373f, 0.520431876f, 0.218865797f },
+	{ { { 1, 3, 12, 14, -1 }, { 1, 10, 12, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.153713599f, 0.163037196f, 0.495884001f },
+	{ { { 8, 12, 4, 2, -1 }, { 10, 12, 2, 1, 2 }, { 8, 13, 2, 1, 2 } }, -0.000415604212f, 0.577445924f, 0.469645888f },
+	{ { { 1, 9, 10, 2, -1 }, { 1, 9, 5, 1, 2 }, { 6, 10, 5, 1, 2 } }, -0.00126401696f, 0.397717595f, 0.521719813f },
+	{ { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00354733411f, 0.604652822f, 0.480831504f },
+	{ { { 6, 8, 8, 3, -1 }, { 6, 9, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, 3.00190695e-05f, 0.399672389f, 0.522820115f },
+	{ { { 9, 15, 5, 3, -1 }, { 9, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00131130195f, 0.471215814f, 0.576599777f },
+	{ { { 8, 7, 4, 3, -1 }, { 8, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00133747095f, 0.410958499f, 0.525317013f },
+	{ { { 7, 7, 6, 2, -1 }, { 7, 8, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0208767094f, 0.520299375f, 0.175798193f },
+	{ { { 5, 7, 8, 2, -1 }, { 5, 7, 4, 1, 2 }, { 9, 8, 4, 1, 2 } }, -0.00754979486f, 0.656660974f, 0.469497502f },
+	{ { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0241885502f, 0.512867391f, 0.337022096f },
+	{ { { 4, 7, 4, 2, -1 }, { 4, 8, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00293588289f, 0.658078671f, 0.46945411f },
+	{ { { 14, 2, 6, 9, -1 }, { 14, 5, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0575579293f, 0.514644504f, 0.277525991f },
+	{ { { 4, 9, 3, 3, -1 }, { 5, 9, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00113433704f, 0.383660197f, 0.519266725f },
+	{ { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0168169998f, 0.508559287f, 0.617726088f },
+	{ { { 0, 2, 6, 9, -1 }, { 0, 5, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00505351787f, 0.513876319f, 0.368479192f },
+	{ { { 17, 3, 3, 6, -1 }, { 18, 3, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.00458747102f, 0.598965526f, 0.48352021f },
+	{ { { 0, 3, 3, 6, -1 }, { 1, 3, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.00168824603f, 0.450948685f, 0.572305679f },
+	{ { { 17, 14, 1, 2, -1 }, { 17, 15, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00165540003f, 0.349677086f, 0.524331927f },
+	{ { { 4, 9, 4, 3, -1 }, { 6, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0193738006f, 0.1120537f, 0.496871293f },
+	{ { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0103744501f, 0.514819682f, 0.439521313f },
+	{ { { 5, 9, 3, 3, -1 }, { 5, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000149730506f, 0.408499986f, 0.526988685f },
+	{ { { 9, 5, 6, 8, -1 }, { 12, 5, 3, 4, 2 }, { 9, 9, 3, 4, 2 } }, -0.0429819301f, 0.639410496f, 0.501850426f },
+	{ { { 5, 5, 6, 8, -1 }, { 5, 5, 3, 4, 2 }, { 8, 9, 3, 4, 2 } }, 0.00830659363f, 0.470755398f, 0.669835329f },
+	{ { { 16, 1, 4, 6, -1 }, { 16, 4, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00412857905f, 0.454136908f, 0.532364726f },
+	{ { { 1, 0, 6, 20, -1 }, { 3, 0, 2, 20, 3 }, { 0, 0, 0, 0, 0 } }, 0.001739942f, 0.43339619f, 0.543986619f },
+	{ { { 12, 11, 3, 2, -1 }, { 13, 11, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000117397503f, 0.457968712f, 0.554342628f },
+	{ { { 5, 11, 3, 2, -1 }, { 6, 11, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000185857803f, 0.432464391f, 0.542675495f },
+	{ { { 9, 4, 6, 1, -1 }, { 11, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00555876922f, 0.525722086f, 0.355061114f },
+	{ { { 0, 0, 8, 3, -1 }, { 4, 0, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00798515603f, 0.60430181f, 0.463063598f },
+	{ { { 15, 0, 2, 5, -1 }, { 15, 0, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.000605941226f, 0.459825486f, 0.553319514f },
+	{ { { 4, 1, 3, 2, -1 }, { 5, 1, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000229830403f, 0.413075209f, 0.532246113f },
+	{ { { 7, 0, 6, 15, -1 }, { 9, 0, 2, 15, 3 }, { 0, 0, 0, 0, 0 } }, 0.000437402108f, 0.404303998f, 0.5409289f },
+	{ { { 6, 11, 3, 1, -1 }, { 7, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000294820202f, 0.449496388f, 0.562885225f },
+	{ { { 12, 0, 3, 4, -1 }, { 13, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0103126597f, 0.517751098f, 0.270431697f },
+	{ { { 5, 4, 6, 1, -1 }, { 7, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00772411097f, 0.198801905f, 0.498055398f },
+	{ { { 12, 7, 3, 2, -1 }, { 12, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00467972085f, 0.664475024f, 0.501829624f },
+	{ { { 0, 1, 4, 6, -1 }, { 0, 4, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00507554598f, 0.3898305f, 0.518526912f },
+	{ { { 12, 7, 3, 2, -1 }, { 12, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00224797404f, 0.480180889f, 0.566033602f },
+	{ { { 2, 16, 3, 3, -1 }, { 2, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000833270082f, 0.521091998f, 0.395718813f },
+	{ { { 13, 8, 6, 10, -1 }, { 16, 8, 3, 5, 2 }, { 13, 13, 3, 5, 2 } }, -0.0412793308f, 0.615454197f, 0.500705421f },
+	{ { { 0, 9, 5, 2, -1 }, { 0, 10, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000509301899f, 0.397594213f, 0.522840381f },
+	{ { { 12, 11, 2, 2, -1 }, { 13, 11, 1, 1, 2 }, { 12, 12, 1, 1, 2 } }, 0.00125687802f, 0.497913808f, 0.593918324f },
+	{ { { 3, 15, 3, 3, -1 }, { 3, 16, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00800484978f, 0.498449713f, 0.163336605f },
+	{ { { 12, 7, 3, 2, -1 }, { 12, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00118793f, 0.59049648f, 0.494262487f },
+	{ { { 5, 7, 3, 2, -1 }, { 5, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000619489525f, 0.41995579f, 0.532872617f },
+	{ { { 9, 5, 9, 9, -1 }, { 9, 8, 9, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00668298593f, 0.541860282f, 0.490588903f },
+	{ { { 5, 0, 3, 7, -1 }, { 6, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.00370623404f, 0.37259391f, 0.513800025f },
+	{ { { 5, 2, 12, 5, -1 }, { 9, 2, 4, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0397394113f, 0.647896111f, 0.505034685f },
+	{ { { 6, 11, 2, 2, -1 }, { 6, 11, 1, 1, 2 }, { 7, 12, 1, 1, 2 } }, 0.00140850095f, 0.468233913f, 0.637788415f },
+	{ { { 15, 15, 3, 2, -1 }, { 15, 16, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000393226888f, 0.545853019f, 0.415048212f },
+	{ { { 2, 15, 3, 2, -1 }, { 2, 16, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00189798197f, 0.369015992f, 0.514970422f },
+	{ { { 14, 12, 6, 8, -1 }, { 17, 12, 3, 4, 2 }, { 14, 16, 3, 4, 2 } }, -0.0139704403f, 0.605056286f, 0.481135786f },
+	{ { { 2, 8, 15, 6, -1 }, { 7, 8, 5, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.101008199f, 0.201708004f, 0.499236196f },
+	{ { { 2, 2, 18, 17, -1 }, { 8, 2, 6, 17, 3 }, { 0, 0, 0, 0, 0 } }, -0.0173469204f, 0.571314871f, 0.489948601f },
+	{ { { 5, 1, 4, 1, -1 }, { 7, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000156197595f, 0.421538889f, 0.539264202f },
+	{ { { 5, 2, 12, 5, -1 }, { 9, 2, 4, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.134389296f, 0.513615191f, 0.376761287f },
+	{ { { 3, 2, 12, 5, -1 }, { 7, 2, 4, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0245822407f, 0.702735782f, 0.474790692f },
+	{ { { 4, 9, 12, 4, -1 }, { 10, 9, 6, 2, 2 }, { 4, 11, 6, 2, 2 } }, -0.00385537208f, 0.43174091f, 0.542771697f },
+	{ { { 5, 15, 6, 2, -1 }, { 5, 15, 3, 1, 2 }, { 8, 16, 3, 1, 2 } }, -0.00231652497f, 0.594269872f, 0.461864799f },
+	{ { { 10, 14, 2, 3, -1 }, { 10, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00485181203f, 0.619156897f, 0.488489509f },
+	{ { { 0, 13, 20, 2, -1 }, { 0, 13, 10, 1, 2 }, { 10, 14, 10, 1, 2 } }, 0.00246999389f, 0.525666475f, 0.401719987f },
+	{ { { 4, 9, 12, 8, -1 }, { 10, 9, 6, 4, 2 }, { 4, 13, 6, 4, 2 } }, 0.0454969592f, 0.523786783f, 0.268577397f },
+	{ { { 8, 13, 3, 6, -1 }, { 8, 16, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0203195997f, 0.213044599f, 0.497973889f },
+	{ { { 10, 12, 2, 2, -1 }, { 10, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000269949989f, 0.481404185f, 0.554312229f },
+	{ { { 9, 12, 2, 2, -1 }, { 9, 12, 1, 1, 2 }, { 10, 13, 1, 1, 2 } }, -0.00182326999f, 0.648257971f, 0.470998913f },
+	{ { { 4, 11, 14, 4, -1 }, { 11, 11, 7, 2, 2 }, { 4, 13, 7, 2, 2 } }, -0.00630157907f, 0.458192796f, 0.530623615f },
+	{ { { 8, 5, 4, 2, -1 }, { 8, 6, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000241394999f, 0.523208678f, 0.405176312f },
+	{ { { 10, 10, 6, 3, -1 }, { 12, 10, 2, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00103303697f, 0.555620193f, 0.478919387f },
+	{ { { 2, 14, 1, 2, -1 }, { 2, 15, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000180411604f, 0.522944272f, 0.401181012f },
+	{ { { 13, 8, 6, 12, -1 }, { 16, 8, 3, 6, 2 }, { 13, 14, 3, 6, 2 } }, -0.0614078604f, 0.629868209f, 0.501070321f },
+	{ { { 1, 8, 6, 12, -1 }, { 1, 8, 3, 6, 2 }, { 4, 14, 3, 6, 2 } }, -0.069543913f, 0.72282809f, 0.477318406f },
+	{ { { 10, 0, 6, 10, -1 }, { 12, 0, 2, 10, 3 }, { 0, 0, 0, 0, 0 } }, -0.0705426633f, 0.226951301f, 0.518252909f },
+	{ { { 5, 11, 8, 4, -1 }, { 5, 11, 4, 2, 2 }, { 9, 13, 4, 2, 2 } }, 0.00244237995f, 0.523709714f, 0.409815103f },
+	{ { { 10, 16, 8, 4, -1 }, { 14, 16, 4, 2, 2 }, { 10, 18, 4, 2, 2 } }, 0.00154943496f, 0.47737509f, 0.546804309f },
+	{ { { 7, 7, 6, 6, -1 }, { 9, 7, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0239142198f, 0.714697599f, 0.478382498f },
+	{ { { 10, 2, 4, 10, -1 }, { 10, 2, 2, 10, 2 }, { 0, 0, 0, 0, 0 } }, -0.0124536902f, 0.263529688f, 0.524112284f },
+	{ { { 6, 1, 4, 9, -1 }, { 8, 1, 2, 9, 2 }, { 0, 0, 0, 0, 0 } }, -0.000207601799f, 0.362375706f, 0.511360884f },
+	{ { { 12, 19, 2, 1, -1 }, { 12, 19, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 2.97810802e-05f, 0.470593214f, 0.543280184f },
+	/* stage 20 */
+	{ { { 1, 2, 4, 9, -1 }, { 3, 2, 2, 9, 2 }, { 0, 0, 0, 0, 0 } }, 0.0117727499f, 0.386051893f, 0.642116725f },
+	{ { { 7, 5, 6, 4, -1 }, { 9, 5, 2, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0270375703f, 0.438565493f, 0.675403893f },
+	{ { { 9, 4, 2, 4, -1 }, { 9, 6, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -3.64195002e-05f, 0.548710108f, 0.342331588f },
+	{ { { 14, 5, 2, 8, -1 }, { 14, 9, 2, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00199954095f, 0.323053211f, 0.540031791f },
+	{ { { 7, 6, 5, 12, -1 }, { 7, 12, 5, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00452783005f, 0.509163976f, 0.293504387f },
+	{ { { 14, 6, 2, 6, -1 }, { 14, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000478909205f, 0.417815387f, 0.534406424f },
+	{ { { 4, 6, 2, 6, -1 }, { 4, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00117209204f, 0.289918214f, 0.513207078f },
+	{ { { 8, 15, 10, 4, -1 }, { 13, 15, 5, 2, 2 }, { 8, 17, 5, 2, 2 } }, 0.000953057024f, 0.42801249f, 0.556084514f },
+	{ { { 6, 18, 2, 2, -1 }, { 7, 18, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 1.509915e-05f, 0.404487193f, 0.540476024f },
+	{ { { 11, 3, 6, 2, -1 }, { 11, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00060817902f, 0.427176893f, 0.550346613f },
+	{ { { 2, 0, 16, 6, -1 }, { 2, 2, 16, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00332245207f, 0.396272391f, 0.536973476f },
+	{ { { 11, 3, 6, 2, -1 }, { 11, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00110374903f, 0.472717792f, 0.523774981f },
+	{ { { 4, 11, 10, 3, -1 }, { 4, 12, 10, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00143502699f, 0.560300827f, 0.422350913f },
+	{ { { 11, 3, 6, 2, -1 }, { 11, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00207673991f, 0.52259171f, 0.473272592f },
+	{ { { 3, 3, 6, 2, -1 }, { 3, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000164128098f, 0.399907589f, 0.543273985f },
+	{ { { 16, 0, 4, 7, -1 }, { 16, 0, 2, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.00883024372f, 0.467838585f, 0.602732718f },
+	{ { { 0, 14, 9, 6, -1 }, { 0, 16, 9, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0105520701f, 0.349396706f, 0.521397471f },
+	{ { { 9, 16, 3, 3, -1 }, { 9, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00227316003f, 0.618581891f, 0.474906296f },
+	{ { { 4, 6, 6, 2, -1 }, { 6, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000847863324f, 0.528534114f, 0.384348214f },
+	{ { { 15, 11, 1, 3, -1 }, { 15, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00120813597f, 0.536064088f, 0.344733596f },
+	{ { { 5, 5, 2, 3, -1 }, { 5, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00265127304f, 0.455829203f, 0.61939621f },
+	{ { { 10, 9, 2, 2, -1 }, { 10, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00110124797f, 0.368023008f, 0.532762825f },
+	{ { { 3, 1, 4, 3, -1 }, { 5, 1, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000495615182f, 0.396059513f, 0.527494073f },
+	{ { { 16, 0, 4, 7, -1 }, { 16, 0, 2, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0439017713f, 0.702044487f, 0.49928391f },
+	{ { { 0, 0, 20, 1, -1 }, { 10, 0, 10, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0346903503f, 0.50491643f, 0.276660293f },
+	{ { { 15, 11, 1, 3, -1 }, { 15, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00274421903f, 0.267263293f, 0.527497113f },
+	{ { { 0, 4, 3, 4, -1 }, { 1, 4, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0033316589f, 0.457948297f, 0.600110173f },
+	{ { { 16, 3, 3, 6, -1 }, { 16, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0200445708f, 0.317159414f, 0.523571789f },
+	{ { { 1, 3, 3, 6, -1 }, { 1, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00134920306f, 0.526536286f, 0.403432488f },
+	{ { { 6, 2, 12, 6, -1 }, { 12, 2, 6, 3, 2 }, { 6, 5, 6, 3, 2 } }, 0.00297020189f, 0.533245683f, 0.457198411f },
+	{ { { 8, 10, 4, 3, -1 }, { 8, 11, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00630399818f, 0.459331095f, 0.60346359f },
+	{ { { 4, 2, 14, 6, -1 }, { 11, 2, 7, 3, 2 }, { 4, 5, 7, 3, 2 } }, -0.0129365902f, 0.443796396f, 0.53729713f },
+	{ { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00401487295f, 0.46803239f, 0.643783391f },
+	{ { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00264016795f, 0.370963186f, 0.531433284f },
+	{ { { 8, 12, 4, 3, -1 }, { 8, 13, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0139184399f, 0.472355515f, 0.713080883f },
+	{ { { 15, 11, 1, 3, -1 }, { 15, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000450878695f, 0.449239403f, 0.537040412f },
+	{ { { 7, 13, 5, 2, -1 }, { 7, 14, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000253843493f, 0.440686405f, 0.551440299f },
+	{ { { 7, 12, 6, 3, -1 }, { 7, 13, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00227100006f, 0.468241692f, 0.59679842f },
+	{ { { 5, 11, 4, 4, -1 }, { 5, 13, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00241207797f, 0.507939219f, 0.301859885f },
+	{ { { 11, 4, 3, 3, -1 }, { 12, 4, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -3.60256709e-05f, 0.560103714f, 0.447109699f },
+	{ { { 6, 4, 3, 3, -1 }, { 7, 4, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00749055296f, 0.220753506f, 0.49899441f },
+	{ { { 16, 5, 3, 6, -1 }, { 17, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0175131205f, 0.653121591f, 0.501764894f },
+	{ { { 3, 6, 12, 7, -1 }, { 7, 6, 4, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.142816305f, 0.49679631f, 0.148206204f },
+	{ { { 16, 5, 3, 6, -1 }, { 17, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.00553452689f, 0.489894688f, 0.595422387f },
+	{ { { 3, 13, 2, 3, -1 }, { 3, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000963235914f, 0.392711699f, 0.519607425f },
+	{ { { 16, 5, 3, 6, -1 }, { 17, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.00203700108f, 0.561332524f, 0.488485813f },
+	{ { { 1, 5, 3, 6, -1 }, { 2, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.00166148297f, 0.447288007f, 0.557888091f },
+	{ { { 1, 9, 18, 1, -1 }, { 7, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00311880908f, 0.38405329f, 0.539747775f },
+	{ { { 0, 9, 8, 7, -1 }, { 4, 9, 4, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.00640006177f, 0.584398389f, 0.453321815f },
+	{ { { 12, 11, 8, 2, -1 }, { 12, 12, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000313196011f, 0.543922186f, 0.423472792f },
+	{ { { 0, 11, 8, 2, -1 }, { 0, 12, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.0182220992f, 0.128846496f, 0.49584049f },
+	{ { { 9, 13, 2, 3, -1 }, { 9, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00879692473f, 0.495129794f, 0.715348005f },
+	{ { { 4, 10, 12, 4, -1 }, { 4, 10, 6, 2, 2 }, { 10, 12, 6, 2, 2 } }, -0.00423950702f, 0.394659996f, 0.519493699f },
+	{ { { 9, 3, 3, 7, -1 }, { 10, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.00970862713f, 0.489750385f, 0.606490016f },
+	{ { { 7, 2, 3, 5, -1 }, { 8, 2, 1, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.00399341714f, 0.324544013f, 0.506082892f },
+	{ { { 9, 12, 4, 6, -1 }, { 11, 12, 2, 3, 2 }, { 9, 15, 2, 3, 2 } }, -0.0167850591f, 0.158195302f, 0.520377874f },
+	{ { { 8, 7, 3, 6, -1 }, { 9, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.0182720907f, 0.468093514f, 0.662697911f },
+	{ { { 15, 4, 4, 2, -1 }, { 15, 5, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00568728382f, 0.521169782f, 0.351218492f },
+	{ { { 8, 7, 3, 3, -1 }, { 9, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00107390399f, 0.576838613f, 0.452984512f },
+	{ { { 14, 2, 6, 4, -1 }, { 14, 4, 6, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00370938703f, 0.450776309f, 0.531358123f },
+	{ { { 7, 16, 6, 1, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000211107093f, 0.54608202f, 0.433337688f },
+	{ { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00106701395f, 0.537185609f, 0.40783909f },
+	{ { { 8, 7, 3, 10, -1 }, { 9, 7, 1, 10, 3 }, { 0, 0, 0, 0, 0 } }, 0.00359430211f, 0.447128713f, 0.564383626f },
+	{ { { 11, 10, 2, 6, -1 }, { 11, 12, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0051776031f, 0.449939311f, 0.528033018f },
+	{ { { 6, 10, 4, 1, -1 }, { 8, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000254143699f, 0.551617324f, 0.440770805f },
+	{ { { 10, 9, 2, 2, -1 }, { 10, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00635225605f, 0.519419014f, 0.246522799f },
+	{ { { 8, 9, 2, 2, -1 }, { 8, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000442050805f, 0.383070588f, 0.513968229f },
+	{ { { 12, 7, 2, 2, -1 }, { 13, 7, 1, 1, 2 }, { 12, 8, 1, 1, 2 } }, 0.000744887278f, 0.489109099f, 0.597478688f },
+	{ { { 5, 7, 2, 2, -1 }, { 5, 7, 1, 1, 2 }, { 6, 8, 1, 1, 2 } }, -0.00351163791f, 0.741368175f, 0.476876497f },
+	{ { { 13, 0, 3, 14, -1 }, { 14, 0, 1, 14, 3 }, { 0, 0, 0, 0, 0 } }, -0.0125409104f, 0.364881903f, 0.525282681f },
+	{ { { 4, 0, 3, 14, -1 }, { 5, 0, 1, 14, 3 }, { 0, 0, 0, 0, 0 } }, 0.00949318521f, 0.510049284f, 0.362958699f },
+	{ { { 13, 4, 3, 14, -1 }, { 14, 4, 1, 14, 3 }, { 0, 0, 0, 0, 0 } }, 0.0129611501f, 0.523244202f, 0.433356106f },
+	{ { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00472094491f, 0.464814901f, 0.633105278f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00231190794f, 0.593030989f, 0.453105807f },
+	{ { { 4, 2, 3, 16, -1 }, { 5, 2, 1, 16, 3 }, { 0, 0, 0, 0, 0 } }, -0.0028262299f, 0.387047797f, 0.525710106f },
+	{ { { 7, 2, 8, 10, -1 }, { 7, 7, 8, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00143113395f, 0.552250326f, 0.45618549f },
+	{ { { 6, 14, 7, 3, -1 }, { 6, 15, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00193783105f, 0.45462209f, 0.573696673f },
+	{ { { 9, 2, 10, 12, -1 }, { 14, 2, 5, 6, 2 }, { 9, 8, 5, 6, 2 } }, 0.000263435591f, 0.534573913f, 0.457187504f },
+	{ { { 6, 7, 8, 2, -1 }, { 6, 8, 8, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000782575225f, 0.396781594f, 0.52201879f },
+	{ { { 8, 13, 4, 6, -1 }, { 8, 16, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0195504408f, 0.282964289f, 0.524350822f },
+	{ { { 6, 6, 1, 3, -1 }, { 6, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00043914959f, 0.459006697f, 0.589909017f },
+	{ { { 16, 2, 4, 6, -1 }, { 16, 4, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0214520004f, 0.523141086f, 0.285537899f },
+	{ { { 6, 6, 4, 2, -1 }, { 6, 6, 2, 1, 2 }, { 8, 7, 2, 1, 2 } }, 0.000589735806f, 0.439725697f, 0.550642192f },
+	{ { { 16, 2, 4, 6, -1 }, { 16, 4, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0261576101f, 0.313507915f, 0.518917501f },
+	{ { { 0, 2, 4, 6, -1 }, { 0, 4, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0139598604f, 0.321327299f, 0.504071772f },
+	{ { { 9, 6, 2, 6, -1 }, { 9, 6, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.00636990182f, 0.638754487f, 0.484950691f },
+	{ { { 3, 4, 6, 10, -1 }, { 3, 9, 6, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.00856138207f, 0.275913209f, 0.503201902f },
+	{ { { 9, 5, 2, 6, -1 }, { 9, 5, 1, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.00096622901f, 0.468564093f, 0.583487928f },
+	{ { { 3, 13, 2, 3, -1 }, { 3, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000765502686f, 0.517520726f, 0.389642209f },
+	{ { { 13, 13, 3, 2, -1 }, { 13, 14, 3, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00818333402f, 0.206913695f, 0.520812213f },
+	{ { { 2, 16, 10, 4, -1 }, { 2, 16, 5, 2, 2 }, { 7, 18, 5, 2, 2 } }, -0.00939769391f, 0.613409102f, 0.464122295f },
+	{ { { 5, 6, 10, 6, -1 }, { 10, 6, 5, 3, 2 }, { 5, 9, 5, 3, 2 } }, 0.00480289804f, 0.545410812f, 0.439521998f },
+	{ { { 7, 14, 1, 3, -1 }, { 7, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00356805697f, 0.634448528f, 0.468109399f },
+	{ { { 14, 16, 6, 3, -1 }, { 14, 17, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00407331204f, 0.529268324f, 0.401562005f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00125681295f, 0.439298809f, 0.545282483f },
+	{ { { 7, 4, 10, 3, -1 }, { 7, 5, 10, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00290650106f, 0.589883208f, 0.48633799f },
+	{ { { 0, 4, 5, 4, -1 }, { 0, 6, 5, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00244093407f, 0.406936496f, 0.524742186f },
+	{ { { 13, 11, 3, 9, -1 }, { 13, 14, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0248307008f, 0.518272579f, 0.368252486f },
+	{ { { 4, 11, 3, 9, -1 }, { 4, 14, 3, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0488540083f, 0.130757794f, 0.496128112f },
+	{ { { 9, 7, 2, 1, -1 }, { 9, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00161103799f, 0.642100573f, 0.487266213f },
+	{ { { 5, 0, 6, 17, -1 }, { 7, 0, 2, 17, 3 }, { 0, 0, 0, 0, 0 } }, -0.09700948f, 0.0477693491f, 0.495098889f },
+	{ { { 10, 3, 6, 3, -1 }, { 10, 3, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00112092402f, 0.461626709f, 0.535474598f },
+	{ { { 2, 2, 15, 4, -1 }, { 7, 2, 5, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00130640902f, 0.626185417f, 0.463880599f },
+	{ { { 8, 2, 8, 2, -1 }, { 12, 2, 4, 1, 2 }, { 8, 3, 4, 1, 2 } }, 0.000457716204f, 0.538441777f, 0.464664012f },
+	{ { { 8, 1, 3, 6, -1 }, { 8, 3, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000631499512f, 0.380404711f, 0.513025701f },
+	{ { { 9, 17, 2, 2, -1 }, { 9, 18, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000145059705f, 0.455431014f, 0.566446185f },
+	{ { { 0, 0, 2, 14, -1 }, { 1, 0, 1, 14, 2 }, { 0, 0, 0, 0, 0 } }, -0.0164745506f, 0.659695804f, 0.471585989f },
+	{ { { 12, 0, 7, 3, -1 }, { 12, 1, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0133695798f, 0.519546628f, 0.303596497f },
+	{ { { 1, 14, 1, 2, -1 }, { 1, 15, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0001027178f, 0.522917628f, 0.410706609f },
+	{ { { 14, 12, 2, 8, -1 }, { 15, 12, 1, 4, 2 }, { 14, 16, 1, 4, 2 } }, -0.00553115597f, 0.635288775f, 0.49609071f },
+	{ { { 1, 0, 7, 3, -1 }, { 1, 1, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00261870492f, 0.382454604f, 0.514098406f },
+	{ { { 14, 12, 2, 8, -1 }, { 15, 12, 1, 4, 2 }, { 14, 16, 1, 4, 2 } }, 0.00508342683f, 0.495043993f, 0.622081876f },
+	{ { { 6, 0, 8, 12, -1 }, { 6, 0, 4, 6, 2 }, { 10, 6, 4, 6, 2 } }, 0.0798181593f, 0.495233595f, 0.132247597f },
+	{ { { 6, 1, 8, 9, -1 }, { 6, 4, 8, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0992265865f, 0.754272878f, 0.500841677f },
+	{ { { 5, 2, 2, 2, -1 }, { 5, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000651740178f, 0.369930297f, 0.513012111f },
+	{ { { 13, 14, 6, 6, -1 }, { 16, 14, 3, 3, 2 }, { 13, 17, 3, 3, 2 } }, -0.0189968497f, 0.668917894f, 0.492120296f },
+	{ { { 0, 17, 20, 2, -1 }, { 0, 17, 10, 1, 2 }, { 10, 18, 10, 1, 2 } }, 0.0173469f, 0.498330086f, 0.185919806f },
+	{ { { 10, 3, 2, 6, -1 }, { 11, 3, 1, 3, 2 }, { 10, 6, 1, 3, 2 } }, 0.000550821016f, 0.457442403f, 0.552212179f },
+	{ { { 5, 12, 6, 2, -1 }, { 8, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.00200560503f, 0.513174474f, 0.385646999f },
+	{ { { 10, 7, 6, 13, -1 }, { 10, 7, 3, 13, 2 }, { 0, 0, 0, 0, 0 } }, -0.00776881911f, 0.436170012f, 0.543430924f },
+	{ { { 5, 15, 10, 5, -1 }, { 10, 15, 5, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.0508782789f, 0.46827209f, 0.684063971f },
+	{ { { 10, 4, 4, 10, -1 }, { 10, 4, 2, 10, 2 }, { 0, 0, 0, 0, 0 } }, -0.00229017809f, 0.432924509f, 0.530609906f },
+	{ { { 5, 7, 2, 1, -1 }, { 6, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000157153801f, 0.537005723f, 0.437816411f },
+	{ { { 10, 3, 6, 7, -1 }, { 10, 3, 3, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.105192401f, 0.513727427f, 0.0673614666f },
+	{ { { 4, 3, 6, 7, -1 }, { 7, 3, 3, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.00271989196f, 0.411206096f, 0.525566518f },
+	{ { { 1, 7, 18, 5, -1 }, { 7, 7, 6, 5, 3 }, { 0, 0, 0, 0, 0 } }, 0.0483377799f, 0.540462375f, 0.443896711f },
+	{ { { 3, 17, 4, 3, -1 }, { 5, 17, 2, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000957037613f, 0.435596913f, 0.539951086f },
+	{ { { 8, 14, 12, 6, -1 }, { 14, 14, 6, 3, 2 }, { 8, 17, 6, 3, 2 } }, -0.0253712591f, 0.599517524f, 0.503102481f },
+	{ { { 0, 13, 20, 4, -1 }, { 0, 13, 10, 2, 2 }, { 10, 15, 10, 2, 2 } }, 0.052457951f, 0.495028794f, 0.139835104f },
+	{ { { 4, 5, 14, 2, -1 }, { 11, 5, 7, 1, 2 }, { 4, 6, 7, 1, 2 } }, -0.0123656299f, 0.639729917f, 0.496410608f },
+	{ { { 1, 2, 10, 12, -1 }, { 1, 2, 5, 6, 2 }, { 6, 8, 5, 6, 2 } }, -0.145897195f, 0.100166999f, 0.494632214f },
+	{ { { 6, 1, 14, 3, -1 }, { 6, 2, 14, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0159086008f, 0.331232995f, 0.520834088f },
+	{ { { 8, 16, 2, 3, -1 }, { 8, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00039486069f, 0.440636396f, 0.542610288f },
+	{ { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00524540013f, 0.279958993f, 0.518996716f },
+	{ { { 5, 15, 4, 2, -1 }, { 5, 15, 2, 1, 2 }, { 7, 16, 2, 1, 2 } }, -0.00504217995f, 0.698758006f, 0.475214213f },
+	{ { { 10, 15, 1, 3, -1 }, { 10, 16, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00298121898f, 0.498328894f, 0.630747974f },
+	{ { { 8, 16, 4, 4, -1 }, { 8, 16, 2, 2, 2 }, { 10, 18, 2, 2, 2 } }, -0.00728843082f, 0.2982333f, 0.502686977f },
+	{ { { 6, 11, 8, 6, -1 }, { 6, 14, 8, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00150943501f, 0.530844212f, 0.383297086f },
+	{ { { 2, 13, 5, 2, -1 }, { 2, 14, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00933407992f, 0.203796402f, 0.49698171f },
+	{ { { 13, 14, 6, 6, -1 }, { 16, 14, 3, 3, 2 }, { 13, 17, 3, 3, 2 } }, 0.0286671408f, 0.502569675f, 0.692802727f },
+	{ { { 1, 9, 18, 4, -1 }, { 7, 9, 6, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.170196801f, 0.496005297f, 0.147644296f },
+	{ { { 13, 14, 6, 6, -1 }, { 16, 14, 3, 3, 2 }, { 13, 17, 3, 3, 2 } }, -0.00326144788f, 0.56030637f, 0.482605606f },
+	{ { { 0, 2, 1, 6, -1 }, { 0, 4, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00055769278f, 0.520556211f, 0.412963301f },
+	{ { { 5, 0, 15, 20, -1 }, { 5, 10, 15, 10, 2 }, { 0, 0, 0, 0, 0 } }, 0.362583399f, 0.522165298f, 0.376861215f },
+	{ { { 1, 14, 6, 6, -1 }, { 1, 14, 3, 3, 2 }, { 4, 17, 3, 3, 2 } }, -0.0116151301f, 0.602268279f, 0.463748991f },
+	{ { { 8, 14, 4, 6, -1 }, { 10, 14, 2, 3, 2 }, { 8, 17, 2, 3, 2 } }, -0.00407951977f, 0.407044709f, 0.533747911f },
+	{ { { 7, 11, 2, 1, -1 }, { 8, 11, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000572043005f, 0.460183501f, 0.590039313f },
+	{ { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00067543349f, 0.539825201f, 0.434542894f },
+	{ { { 8, 17, 3, 2, -1 }, { 9, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000632956973f, 0.520156324f, 0.4051359f },
+	{ { { 12, 14, 4, 6, -1 }, { 14, 14, 2, 3, 2 }, { 12, 17, 2, 3, 2 } }, 0.00124353205f, 0.464238793f, 0.554744124f },
+	{ { { 4, 14, 4, 6, -1 }, { 4, 14, 2, 3, 2 }, { 6, 17, 2, 3, 2 } }, -0.00473638577f, 0.619856715f, 0.467255205f },
+	{ { { 13, 14, 2, 6, -1 }, { 14, 14, 1, 3, 2 }, { 13, 17, 1, 3, 2 } }, -0.00646584621f, 0.683733284f, 0.501900077f },
+	{ { { 5, 14, 2, 6, -1 }, { 5, 14, 1, 3, 2 }, { 6, 17, 1, 3, 2 } }, 0.000350173214f, 0.434480309f, 0.53636229f },
+	{ { { 7, 0, 6, 12, -1 }, { 7, 4, 6, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.000157549206f, 0.476007909f, 0.573202074f },
+	{ { { 0, 7, 12, 2, -1 }, { 4, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00997743662f, 0.509098589f, 0.363503993f },
+	{ { { 10, 3, 3, 13, -1 }, { 11, 3, 1, 13, 3 }, { 0, 0, 0, 0, 0 } }, -0.000414645299f, 0.557006478f, 0.459380209f },
+	{ { { 7, 3, 3, 13, -1 }, { 8, 3, 1, 13, 3 }, { 0, 0, 0, 0, 0 } }, -0.000358888996f, 0.535684586f, 0.433913499f },
+	{ { { 10, 8, 6, 3, -1 }, { 10, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000404632505f, 0.443980306f, 0.543677688f },
+	{ { { 3, 11, 3, 2, -1 }, { 4, 11, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000821847876f, 0.404229492f, 0.517629921f },
+	{ { { 13, 12, 6, 8, -1 }, { 16, 12, 3, 4, 2 }, { 13, 16, 3, 4, 2 } }, 0.00594674191f, 0.492765188f, 0.563377976f },
+	{ { { 7, 6, 6, 5, -1 }, { 9, 6, 2, 5, 3 }, { 0, 0, 0, 0, 0 } }, -0.0217533894f, 0.800629377f, 0.480084091f },
+	{ { { 17, 11, 2, 7, -1 }, { 17, 11, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0145403799f, 0.394605488f, 0.518222272f },
+	{ { { 3, 13, 8, 2, -1 }, { 7, 13, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0405107699f, 0.0213249903f, 0.493579298f },
+	{ { { 6, 9, 8, 3, -1 }, { 6, 10, 8, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000584582682f, 0.401279598f, 0.531402528f },
+	{ { { 4, 3, 4, 3, -1 }, { 4, 4, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00551518006f, 0.464241892f, 0.589626074f },
+	{ { { 11, 3, 4, 3, -1 }, { 11, 4, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00606262218f, 0.650215924f, 0.50164777f },
+	{ { { 1, 4, 17, 12, -1 }, { 1, 8, 17, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.0945358425f, 0.5264709f, 0.412682712f },
+	{ { { 11, 3, 4, 3, -1 }, { 11, 4, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00473150518f, 0.487919986f, 0.589244783f },
+	{ { { 4, 8, 6, 3, -1 }, { 4, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000525714713f, 0.391728014f, 0.518941283f },
+	{ { { 12, 3, 5, 3, -1 }, { 12, 4, 5, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00254640495f, 0.583759904f, 0.498570591f },
+	{ { { 1, 11, 2, 7, -1 }, { 2, 11, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0260756891f, 0.126198396f, 0.495582193f },
+	{ { { 15, 12, 2, 8, -1 }, { 16, 12, 1, 4, 2 }, { 15, 16, 1, 4, 2 } }, -0.00547797093f, 0.572251379f, 0.501026571f },
+	{ { { 4, 8, 11, 3, -1 }, { 4, 9, 11, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00513377413f, 0.527326226f, 0.422637612f },
+	{ { { 9, 13, 6, 2, -1 }, { 12, 13, 3, 1, 2 }, { 9, 14, 3, 1, 2 } }, 0.000479449809f, 0.445006698f, 0.581958711f },
+	{ { { 6, 13, 4, 3, -1 }, { 6, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00211140793f, 0.575765312f, 0.451171488f },
+	{ { { 9, 12, 3, 3, -1 }, { 10, 12, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0131799905f, 0.188438103f, 0.516073406f },
+	{ { { 5, 3, 3, 3, -1 }, { 5, 4, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00479680998f, 0.658978999f, 0.473611891f },
+	{ { { 9, 4, 2, 3, -1 }, { 9, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00674831681f, 0.525942981f, 0.335639507f },
+	{ { { 0, 2, 16, 3, -1 }, { 0, 3, 16, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00146233698f, 0.53552711f, 0.426409215f },
+	{ { { 15, 12, 2, 8, -1 }, { 16, 12, 1, 4, 2 }, { 15, 16, 1, 4, 2 } }, 0.00476451591f, 0.503440678f, 0.57868278f },
+	{ { { 3, 12, 2, 8, -1 }, { 3, 12, 1, 4, 2 }, { 4, 16, 1, 4, 2 } }, 0.00680666603f, 0.475660503f, 0.667782903f },
+	{ { { 14, 13, 3, 6, -1 }, { 14, 15, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0036608621f, 0.536961198f, 0.431154698f },
+	{ { { 3, 13, 3, 6, -1 }, { 3, 15, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0214496404f, 0.4968642f, 0.188881606f },
+	{ { { 6, 5, 10, 2, -1 }, { 11, 5, 5, 1, 2 }, { 6, 6, 5, 1, 2 } }, 0.00416789018f, 0.493073314f, 0.581536889f },
+	{ { { 2, 14, 14, 6, -1 }, { 2, 17, 14, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00864675641f, 0.520520508f, 0.413259506f },
+	{ { { 10, 14, 1, 3, -1 }, { 10, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000361140788f, 0.54835552f, 0.480092794f },
+	{ { { 4, 16, 2, 2, -1 }, { 4, 16, 1, 1, 2 }, { 5, 17, 1, 1, 2 } }, 0.00108087296f, 0.468990207f, 0.604142129f },
+	{ { { 10, 6, 2, 3, -1 }, { 10, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00577199599f, 0.517114222f, 0.305327713f },
+	{ { { 0, 17, 20, 2, -1 }, { 0, 17, 10, 1, 2 }, { 10, 18, 10, 1, 2 } }, 0.00157207705f, 0.521997809f, 0.417880386f },
+	{ { { 13, 6, 1, 3, -1 }, { 13, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00193078595f, 0.58603698f, 0.481292009f },
+	{ { { 8, 13, 3, 2, -1 }, { 9, 13, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00789262727f, 0.174927697f, 0.497173399f },
+	{ { { 12, 2, 3, 3, -1 }, { 13, 2, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.00222246791f, 0.434258908f, 0.521284819f },
+	{ { { 3, 18, 2, 2, -1 }, { 3, 18, 1, 1, 2 }, { 4, 19, 1, 1, 2 } }, 0.00190119899f, 0.476518691f, 0.689205527f },
+	{ { { 9, 16, 3, 4, -1 }, { 10, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00275761192f, 0.52621913f, 0.433748603f },
+	{ { { 6, 6, 1, 3, -1 }, { 6, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0051787449f, 0.48040691f, 0.784372926f },
+	{ { { 13, 1, 5, 2, -1 }, { 13, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000902733416f, 0.412084699f, 0.535342395f },
+	{ { { 7, 14, 6, 2, -1 }, { 7, 14, 3, 1, 2 }, { 10, 15, 3, 1, 2 } }, 0.0051797959f, 0.47403729f, 0.642596006f },
+	{ { { 11, 3, 3, 4, -1 }, { 12, 3, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0101140002f, 0.246879205f, 0.517501771f },
+	{ { { 1, 13, 12, 6, -1 }, { 5, 13, 4, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.01861706f, 0.575629413f, 0.462897897f },
+	{ { { 14, 11, 5, 2, -1 }, { 14, 12, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00592259597f, 0.516962588f, 0.321427107f },
+	{ { { 2, 15, 14, 4, -1 }, { 2, 15, 7, 2, 2 }, { 9, 17, 7, 2, 2 } }, -0.006294508f, 0.387201488f, 0.514163673f },
+	{ { { 3, 7, 14, 2, -1 }, { 10, 7, 7, 1, 2 }, { 3, 8, 7, 1, 2 } }, 0.00653530192f, 0.485304892f, 0.631048977f },
+	{ { { 1, 11, 4, 2, -1 }, { 1, 12, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00108783995f, 0.511731505f, 0.372325897f },
+	{ { { 14, 0, 6, 14, -1 }, { 16, 0, 2, 14, 3 }, { 0, 0, 0, 0, 0 } }, -0.0225422401f, 0.569274008f, 0.488711298f },
+	{ { { 4, 11, 1, 3, -1 }, { 4, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00300656608f, 0.255601287f, 0.500399292f },
+	{ { { 14, 0, 6, 14, -1 }, { 16, 0, 2, 14, 3 }, { 0, 0, 0, 0, 0 } }, 0.00747412723f, 0.481087297f, 0.56759268f },
+	{ { { 1, 10, 3, 7, -1 }, { 2, 10, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.0261623207f, 0.497119486f, 0.177723706f },
+	{ { { 8, 12, 9, 2, -1 }, { 8, 13, 9, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000943527382f, 0.494001091f, 0.549125075f },
+	{ { { 0, 6, 20, 1, -1 }, { 10, 6, 10, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0333632417f, 0.500761211f, 0.279072404f },
+	{ { { 8, 4, 4, 4, -1 }, { 8, 4, 2, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0151186502f, 0.70595789f, 0.497303188f },
+	{ { { 0, 0, 2, 2, -1 }, { 0, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000986489467f, 0.512862027f, 0.377676189f },
+	/* stage 21 */
+	{ { { 5, 3, 10, 9, -1 }, { 5, 6, 10, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0951507986f, 0.647075713f, 0.40172869f },
+	{ { { 15, 2, 4, 10, -1 }, { 15, 2, 2, 10, 2 }, { 0, 0, 0, 0, 0 } }, 0.00627023401f, 0.399982214f, 0.574644923f },
+	{ { { 8, 2, 2, 7, -1 }, { 9, 2, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.000300180895f, 0.355877012f, 0.55388099f },
+	{ { { 7, 4, 12, 1, -1 }, { 11, 4, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00117574097f, 0.425653487f, 0.538261771f },
+	{ { { 3, 4, 9, 1, -1 }, { 6, 4, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 4.42352684e-05f, 0.368290812f, 0.558992684f },
+	{ { { 15, 10, 1, 4, -1 }, { 15, 12, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, -2.99369203e-05f, 0.545247018f, 0.402036786f },
+	{ { { 4, 10, 6, 4, -1 }, { 7, 10, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00300731999f, 0.523905814f, 0.331784397f },
+	{ { { 15, 9, 1, 6, -1 }, { 15, 12, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0105138896f, 0.432068914f, 0.530798376f },
+	{ { { 7, 17, 6, 3, -1 }, { 7, 18, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00834768265f, 0.450463712f, 0.645329893f },
+	{ { { 14, 3, 2, 16, -1 }, { 15, 3, 1, 8, 2 }, { 14, 11, 1, 8, 2 } }, -0.00314922701f, 0.431342512f, 0.537052512f },
+	{ { { 4, 9, 1, 6, -1 }, { 4, 12, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -1.443565e-05f, 0.532660306f, 0.381797194f },
+	{ { { 12, 1, 5, 2, -1 }, { 12, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000428550906f, 0.430516392f, 0.538200974f },
+	{ { { 6, 18, 4, 2, -1 }, { 6, 18, 2, 1, 2 }, { 8, 19, 2, 1, 2 } }, 0.000150624299f, 0.423597097f, 0.554496527f },
+	{ { { 2, 4, 16, 10, -1 }, { 10, 4, 8, 5, 2 }, { 2, 9, 8, 5, 2 } }, 0.0715598315f, 0.530305982f, 0.267880291f },
+	{ { { 6, 5, 1, 10, -1 }, { 6, 10, 1, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.000840951805f, 0.355710894f, 0.520543396f },
+	{ { { 4, 8, 15, 2, -1 }, { 9, 8, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0629865006f, 0.522536278f, 0.286137611f },
+	{ { { 1, 8, 15, 2, -1 }, { 6, 8, 5, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00337986299f, 0.362418592f, 0.520169795f },
+	{ { { 9, 5, 3, 6, -1 }, { 9, 7, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000118107397f, 0.547447681f, 0.395989388f },
+	{ { { 5, 7, 8, 2, -1 }, { 9, 7, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000545056013f, 0.374042213f, 0.521571577f },
+	{ { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.001845491f, 0.589305222f, 0.458444893f },
+	{ { { 1, 0, 16, 3, -1 }, { 1, 1, 16, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00043832371f, 0.408458203f, 0.538535118f },
+	{ { { 11, 2, 7, 2, -1 }, { 11, 3, 7, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.002400083f, 0.377745509f, 0.529358029f },
+	{ { { 5, 1, 10, 18, -1 }, { 5, 7, 10, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0987957418f, 0.296361208f, 0.50700891f },
+	{ { { 17, 4, 3, 2, -1 }, { 18, 4, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00317982398f, 0.487763286f, 0.672644377f },
+	{ { { 8, 13, 1, 3, -1 }, { 8, 14, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000324064196f, 0.436691105f, 0.556110978f },
+	{ { { 3, 14, 14, 6, -1 }, { 3, 16, 14, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0325472504f, 0.312815785f, 0.530861616f },
+	{ { { 0, 2, 3, 4, -1 }, { 1, 2, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00775611307f, 0.656022489f, 0.463987201f },
+	{ { { 12, 1, 5, 2, -1 }, { 12, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.0160272494f, 0.517268002f, 0.314189792f },
+	{ { { 3, 1, 5, 2, -1 }, { 3, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } }, 7.10023505e-06f, 0.408444613f, 0.533629477f },
+	{ { { 10, 13, 2, 3, -1 }, { 10, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00734228082f, 0.49669221f, 0.660346508f },
+	{ { { 8, 13, 2, 3, -1 }, { 8, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00169702806f, 0.59082371f, 0.450018287f },
+	{ { { 14, 12, 2, 3, -1 }, { 14, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00241182605f, 0.531516075f, 0.35997209f },
+	{ { { 7, 2, 2, 3, -1 }, { 7, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0055300938f, 0.2334041f, 0.499681413f },
+	{ { { 5, 6, 10, 4, -1 }, { 10, 6, 5, 2, 2 }, { 5, 8, 5, 2, 2 } }, -0.00264787301f, 0.588093579f, 0.468473405f },
+	{ { { 9, 13, 1, 6, -1 }, { 9, 16, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0112956297f, 0.498377711f, 0.188459098f },
+	{ { { 10, 12, 2, 2, -1 }, { 11, 12, 1, 1, 2 }, { 10, 13, 1, 1, 2 } }, -0.000669528788f, 0.587213814f, 0.479901999f },
+	{ { { 4, 12, 2, 3, -1 }, { 4, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00144106802f, 0.513118923f, 0.350101113f },
+	{ { { 14, 4, 6, 6, -1 }, { 14, 6, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0024637871f, 0.533937216f, 0.411763906f },
+	{ { { 8, 17, 2, 3, -1 }, { 8, 18, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000331145187f, 0.43133831f, 0.539824605f },
+	{ { { 16, 4, 4, 6, -1 }, { 16, 6, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0335572697f, 0.26753369f, 0.517915487f },
+	{ { { 0, 4, 4, 6, -1 }, { 0, 6, 4, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.0185394194f, 0.497386992f, 0.231717706f },
+	{ { { 14, 6, 2, 3, -1 }, { 14, 6, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.000296981394f, 0.552970827f, 0.464366406f },
+	{ { { 4, 9, 8, 1, -1 }, { 8, 9, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000455772592f, 0.562958419f, 0.446919113f },
+	{ { { 8, 12, 4, 3, -1 }, { 8, 13, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0101589803f, 0.670621276f, 0.492591888f },
+	{ { { 5, 12, 10, 6, -1 }, { 5, 14, 10, 2, 3 }, { 0, 0, 0, 0, 0 } }, -2.24138294e-05f, 0.523942173f, 0.391290188f },
+	{ { { 11, 12, 1, 2, -1 }, { 11, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 7.20349635e-05f, 0.479943812f, 0.550178885f },
+	{ { { 8, 15, 4, 2, -1 }, { 8, 16, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00692672096f, 0.693000972f, 0.469808489f },
+	{ { { 6, 9, 8, 8, -1 }, { 10, 9, 4, 4, 2 }, { 6, 13, 4, 4, 2 } }, -0.00769978389f, 0.409962386f, 0.548088312f },
+	{ { { 7, 12, 4, 6, -1 }, { 7, 12, 2, 3, 2 }, { 9, 15, 2, 3, 2 } }, -0.00731305499f, 0.328347594f, 0.505788624f },
+	{ { { 10, 11, 3, 1, -1 }, { 11, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00196505897f, 0.497804701f, 0.639824986f },
+	{ { { 9, 7, 2, 10, -1 }, { 9, 7, 1, 5, 2 }, { 10, 12, 1, 5, 2 } }, 0.00716476003f, 0.466116011f, 0.622213721f },
+	{ { { 8, 0, 6, 6, -1 }, { 10, 0, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0240786392f, 0.233464494f, 0.522216201f },
+	{ { { 3, 11, 2, 6, -1 }, { 3, 13, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0210279692f, 0.1183654f, 0.493822604f },
+	{ { { 16, 12, 1, 2, -1 }, { 16, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000360170205f, 0.532501996f, 0.411671102f },
+	{ { { 1, 14, 6, 6, -1 }, { 1, 14, 3, 3, 2 }, { 4, 17, 3, 3, 2 } }, -0.0172197297f, 0.627876222f, 0.466426909f },
+	{ { { 13, 1, 3, 6, -1 }, { 14, 1, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.00786721427f, 0.340341508f, 0.524973691f },
+	{ { { 8, 8, 2, 2, -1 }, { 8, 9, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000447773898f, 0.361041188f, 0.508625925f },
+	{ { { 9, 9, 3, 3, -1 }, { 10, 9, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.00554860104f, 0.488426596f, 0.620349824f },
+	{ { { 8, 7, 3, 3, -1 }, { 8, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00694611482f, 0.262593001f, 0.501109719f },
+	{ { { 14, 0, 2, 3, -1 }, { 14, 0, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.000135698705f, 0.434079498f, 0.562831223f },
+	{ { { 1, 0, 18, 9, -1 }, { 7, 0, 6, 9, 3 }, { 0, 0, 0, 0, 0 } }, -0.0458802506f, 0.65079987f, 0.4696275f },
+	{ { { 11, 5, 4, 15, -1 }, { 11, 5, 2, 15, 2 }, { 0, 0, 0, 0, 0 } }, -0.0215825606f, 0.382650286f, 0.528761685f },
+	{ { { 5, 5, 4, 15, -1 }, { 7, 5, 2, 15, 2 }, { 0, 0, 0, 0, 0 } }, -0.0202095397f, 0.32333681f, 0.50744772f },
+	{ { { 14, 0, 2, 3, -1 }, { 14, 0, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00584967108f, 0.517760396f, 0.448967099f },
+	{ { { 4, 0, 2, 3, -1 }, { 5, 0, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -5.74763799e-05f, 0.402085096f, 0.524636388f },
+	{ { { 11, 12, 2, 2, -1 }, { 12, 12, 1, 1, 2 }, { 11, 13, 1, 1, 2 } }, -0.00115131005f, 0.631507218f, 0.490515411f },
+	{ { { 7, 12, 2, 2, -1 }, { 7, 12, 1, 1, 2 }, { 8, 13, 1, 1, 2 } }, 0.00198628311f, 0.470245987f, 0.649715126f },
+	{ { { 12, 0, 3, 4, -1 }, { 13, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0052719512f, 0.365038395f, 0.522765279f },
+	{ { { 4, 11, 3, 3, -1 }, { 4, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00126626994f, 0.516610086f, 0.387761801f },
+	{ { { 12, 7, 4, 2, -1 }, { 12, 8, 4, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00629194407f, 0.737589419f, 0.502384782f },
+	{ { { 8, 10, 3, 2, -1 }, { 9, 10, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.000673601113f, 0.442322612f, 0.54955858f },
+	{ { { 9, 9, 3, 2, -1 }, { 10, 9, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00105234503f, 0.59763962f, 0.485958308f },
+	{ { { 8, 9, 3, 2, -1 }, { 9, 9, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.000442162389f, 0.595593929f, 0.439893097f },
+	{ { { 12, 0, 3, 4, -1 }, { 13, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00117479404f, 0.534988821f, 0.460505813f },
+	{ { { 5, 0, 3, 4, -1 }, { 6, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00524574379f, 0.504919112f, 0.294157714f },
+	{ { { 4, 14, 12, 4, -1 }, { 10, 14, 6, 2, 2 }, { 4, 16, 6, 2, 2 } }, -0.0245397203f, 0.255017787f, 0.521858692f },
+	{ { { 8, 13, 2, 3, -1 }, { 8, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000737930415f, 0.442486107f, 0.549081624f },
+	{ { { 10, 10, 3, 8, -1 }, { 10, 14, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00142337999f, 0.531951427f, 0.408135593f },
+	{ { { 8, 10, 4, 8, -1 }, { 8, 10, 2, 4, 2 }, { 10, 14, 2, 4, 2 } }, -0.00241491105f, 0.408765912f, 0.523895025f },
+	{ { { 10, 8, 3, 1, -1 }, { 11, 8, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00121652998f, 0.567457914f, 0.490805298f },
+	{ { { 9, 12, 1, 6, -1 }, { 9, 15, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00124388095f, 0.412942588f, 0.525611818f },
+	{ { { 10, 8, 3, 1, -1 }, { 11, 8, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00619427394f, 0.506019413f, 0.731365323f },
+	{ { { 7, 8, 3, 1, -1 }, { 8, 8, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00166071695f, 0.597963214f, 0.459636986f },
+	{ { { 5, 2, 15, 14, -1 }, { 5, 9, 15, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0273162592f, 0.41743651f, 0.530884206f },
+	{ { { 2, 1, 2, 10, -1 }, { 2, 1, 1, 5, 2 }, { 3, 6, 1, 5, 2 } }, -0.001584557f, 0.561580479f, 0.451948613f },
+	{ { { 14, 14, 2, 3, -1 }, { 14, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00155147398f, 0.407618701f, 0.536078513f },
+	{ { { 2, 7, 3, 3, -1 }, { 3, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.000384465588f, 0.434729397f, 0.543044209f },
+	{ { { 17, 4, 3, 3, -1 }, { 17, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0146722598f, 0.165930495f, 0.514609396f },
+	{ { { 0, 4, 3, 3, -1 }, { 0, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00816088822f, 0.496181905f, 0.188474596f },
+	{ { { 13, 5, 6, 2, -1 }, { 16, 5, 3, 1, 2 }, { 13, 6, 3, 1, 2 } }, 0.00111216598f, 0.48682639f, 0.609381616f },
+	{ { { 4, 19, 12, 1, -1 }, { 8, 19, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00726037705f, 0.628432512f, 0.469037592f },
+	{ { { 12, 12, 2, 4, -1 }, { 12, 14, 2, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.000240464302f, 0.557500005f, 0.404604405f },
+	{ { { 3, 15, 1, 3, -1 }, { 3, 16, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0002334819f, 0.411576211f, 0.525284827f },
+	{ { { 11, 16, 6, 4, -1 }, { 11, 16, 3, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.00557364803f, 0.473007292f, 0.569010079f },
+	{ { { 2, 10, 3, 10, -1 }, { 3, 10, 1, 10, 3 }, { 0, 0, 0, 0, 0 } }, 0.0306237694f, 0.497188687f, 0.174009502f },
+	{ { { 12, 8, 2, 4, -1 }, { 12, 8, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.000920747989f, 0.537211776f, 0.435487211f },
+	{ { { 6, 8, 2, 4, -1 }, { 7, 8, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -4.35507391e-05f, 0.536688387f, 0.434731692f },
+	{ { { 10, 14, 2, 3, -1 }, { 10, 14, 1, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.00664527109f, 0.343551815f, 0.516053319f },
+	{ { { 5, 1, 10, 3, -1 }, { 10, 1, 5, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.043221999f, 0.476679206f, 0.729365289f },
+	{ { { 10, 7, 3, 2, -1 }, { 11, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00223317696f, 0.502931595f, 0.56331712f },
+	{ { { 5, 6, 9, 2, -1 }, { 8, 6, 3, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00318297395f, 0.401609212f, 0.519213676f },
+	{ { { 9, 8, 2, 2, -1 }, { 9, 9, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000180277493f, 0.408831596f, 0.541791975f },
+	{ { { 2, 11, 16, 6, -1 }, { 2, 11, 8, 3, 2 }, { 10, 14, 8, 3, 2 } }, -0.00529346894f, 0.40756771f, 0.524356186f },
+	{ { { 12, 7, 2, 2, -1 }, { 13, 7, 1, 1, 2 }, { 12, 8, 1, 1, 2 } }, 0.00127509597f, 0.491328299f, 0.638701081f },
+	{ { { 9, 5, 2, 3, -1 }, { 9, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00433853222f, 0.503167212f, 0.294734687f },
+	{ { { 9, 7, 3, 2, -1 }, { 10, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00852507446f, 0.494978905f, 0.630886912f },
+	{ { { 5, 1, 8, 12, -1 }, { 5, 7, 8, 6, 2 }, { 0, 0, 0, 0, 0 } }, -0.000942663522f, 0.532836676f, 0.428564996f },
+	{ { { 13, 5, 2, 2, -1 }, { 13, 6, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00136096601f, 0.499152511f, 0.594150126f },
+	{ { { 5, 5, 2, 2, -1 }, { 5, 6, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000447825092f, 0.457350403f, 0.585448086f },
+	{ { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00133600505f, 0.460435897f, 0.584905207f },
+	{ { { 4, 14, 2, 3, -1 }, { 4, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000609675481f, 0.39693889f, 0.522942305f },
+	{ { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00236567808f, 0.580832005f, 0.489835709f },
+	{ { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00107343402f, 0.435121089f, 0.547003925f },
+	{ { { 9, 14, 2, 6, -1 }, { 10, 14, 1, 3, 2 }, { 9, 17, 1, 3, 2 } }, 0.0021923359f, 0.53550601f, 0.384290397f },
+	{ { { 8, 14, 3, 2, -1 }, { 9, 14, 1, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00549686188f, 0.501813889f, 0.282719195f },
+	{ { { 9, 5, 6, 6, -1 }, { 11, 5, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, -0.0753688216f, 0.122507602f, 0.514882684f },
+	{ { { 5, 5, 6, 6, -1 }, { 7, 5, 2, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.0251344703f, 0.473176688f, 0.70254463f },
+	{ { { 13, 13, 1, 2, -1 }, { 13, 14, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -2.93585999e-05f, 0.54305321f, 0.465608686f },
+	{ { { 0, 2, 10, 2, -1 }, { 0, 3, 10, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.0005835591f, 0.403104007f, 0.519011974f },
+	{ { { 13, 13, 1, 2, -1 }, { 13, 14, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00266394508f, 0.430812687f, 0.516177118f },
+	{ { { 5, 7, 2, 2, -1 }, { 5, 7, 1, 1, 2 }, { 6, 8, 1, 1, 2 } }, -0.001380409f, 0.621982992f, 0.469551593f },
+	{ { { 13, 5, 2, 7, -1 }, { 13, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.00123132195f, 0.537936389f, 0.442583114f },
+	{ { { 6, 13, 1, 2, -1 }, { 6, 14, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -1.46441798e-05f, 0.528164029f, 0.422250301f },
+	{ { { 11, 0, 3, 7, -1 }, { 12, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.0128188096f, 0.258209288f, 0.517993271f },
+	{ { { 0, 3, 2, 16, -1 }, { 0, 3, 1, 8, 2 }, { 1, 11, 1, 8, 2 } }, 0.0228521898f, 0.477869302f, 0.760926425f },
+	{ { { 11, 0, 3, 7, -1 }, { 12, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.000823059701f, 0.534099221f, 0.467172414f },
+	{ { { 6, 0, 3, 7, -1 }, { 7, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.0127701201f, 0.496576101f, 0.147236601f },
+	{ { { 11, 16, 8, 4, -1 }, { 11, 16, 4, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0500515103f, 0.6414994f, 0.501659214f },
+	{ { { 1, 16, 8, 4, -1 }, { 5, 16, 4, 4, 2 }, { 0, 0, 0, 0, 0 } }, 0.0157752708f, 0.452232003f, 0.568536222f },
+	{ { { 13, 5, 2, 7, -1 }, { 13, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.0185016207f, 0.276474893f, 0.513795912f },
+	{ { { 5, 5, 2, 7, -1 }, { 6, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.00246262504f, 0.514194191f, 0.379540801f },
+	{ { { 18, 6, 2, 14, -1 }, { 18, 13, 2, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.0629161671f, 0.506064892f, 0.658043385f },
+	{ { { 6, 10, 3, 4, -1 }, { 6, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } }, -2.16485005e-05f, 0.51953882f, 0.401988685f },
+	{ { { 14, 7, 1, 2, -1 }, { 14, 8, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.00211809902f, 0.496236503f, 0.595445871f },
+	{ { { 0, 1, 18, 6, -1 }, { 0, 1, 9, 3, 2 }, { 9, 4, 9, 3, 2 } }, -0.0166348908f, 0.375793308f, 0.517544687f },
+	{ { { 14, 7, 1, 2, -1 }, { 14, 8, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.00288994703f, 0.662401378f, 0.505717874f },
+	{ { { 0, 6, 2, 14, -1 }, { 0, 13, 2, 7, 2 }, { 0, 0, 0, 0, 0 } }, 0.0767832622f, 0.479579687f, 0.804771483f },
+	{ { { 17, 0, 3, 12, -1 }, { 18, 0, 1, 12, 3 }, { 0, 0, 0, 0, 0 } }, 0.00391706778f, 0.493788213f, 0.571994185f },
+	{ { { 0, 6, 18, 3, -1 }, { 0, 7, 18, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0726706013f, 0.0538945608f, 0.494390398f },
+	{ { { 6, 0, 14, 16, -1 }, { 6, 8, 14, 8, 2 }, { 0, 0, 0, 0, 0 } }, 0.540395021f, 0.512977421f, 0.114333898f },
+	{ { { 0, 0, 3, 12, -1 }, { 1, 0, 1, 12, 3 }, { 0, 0, 0, 0, 0 } }, 0.00295100198f, 0.452834398f, 0.569857419f },
+	{ { { 13, 0, 3, 7, -1 }, { 14, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.00345083699f, 0.535772681f, 0.421873093f },
+	{ { { 5, 7, 1, 2, -1 }, { 5, 8, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000420779397f, 0.591617286f, 0.463792592f },
+	{ { { 14, 4, 6, 6, -1 }, { 14, 6, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00330510503f, 0.527338505f, 0.438204288f },
+	{ { { 5, 7, 7, 2, -1 }, { 5, 8, 7, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000477350608f, 0.404652804f, 0.518188477f },
+	{ { { 8, 6, 6, 9, -1 }, { 8, 9, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0259285104f, 0.745223582f, 0.508938611f },
+	{ { { 5, 4, 6, 1, -1 }, { 7, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0029729791f, 0.329543591f, 0.505879521f },
+	{ { { 13, 0, 6, 4, -1 }, { 16, 0, 3, 2, 2 }, { 13, 2, 3, 2, 2 } }, 0.00585083291f, 0.485714406f, 0.57930249f },
+	{ { { 1, 2, 18, 12, -1 }, { 1, 6, 18, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.0459675193f, 0.431273103f, 0.538065314f },
+	{ { { 3, 2, 17, 12, -1 }, { 3, 6, 17, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.155859604f, 0.519617021f, 0.168471396f },
+	{ { { 5, 14, 7, 3, -1 }, { 5, 15, 7, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0151648298f, 0.473575711f, 0.673502684f },
+	{ { { 10, 14, 1, 3, -1 }, { 10, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00106042495f, 0.582292676f, 0.477570295f },
+	{ { { 3, 14, 3, 3, -1 }, { 3, 15, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0066476292f, 0.499919891f, 0.231953502f },
+	{ { { 14, 4, 6, 6, -1 }, { 14, 6, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.0122311302f, 0.475089312f, 0.526298225f },
+	{ { { 0, 4, 6, 6, -1 }, { 0, 6, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00565288821f, 0.506976783f, 0.35618189f },
+	{ { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00129778299f, 0.487569392f, 0.561906278f },
+	{ { { 4, 5, 4, 3, -1 }, { 4, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0107815899f, 0.475077003f, 0.678230822f },
+	{ { { 18, 0, 2, 6, -1 }, { 18, 2, 2, 2, 3 }, { 0, 0, 0, 0, 0 } }, 0.00286547793f, 0.530546188f, 0.429073602f },
+	{ { { 8, 1, 4, 9, -1 }, { 10, 1, 2, 9, 2 }, { 0, 0, 0, 0, 0 } }, 0.0028663429f, 0.451847911f, 0.553935111f },
+	{ { { 6, 6, 8, 2, -1 }, { 6, 6, 4, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00519833202f, 0.414911985f, 0.543418884f },
+	{ { { 6, 5, 4, 2, -1 }, { 6, 5, 2, 1, 2 }, { 8, 6, 2, 1, 2 } }, 0.00537399901f, 0.471789688f, 0.650765717f },
+	{ { { 10, 5, 2, 3, -1 }, { 10, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0146415299f, 0.217216402f, 0.516177714f },
+	{ { { 9, 5, 1, 3, -1 }, { 9, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -1.50425803e-05f, 0.533738375f, 0.429883689f },
+	{ { { 9, 10, 2, 2, -1 }, { 9, 11, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000118756601f, 0.460459411f, 0.558244705f },
+	{ { { 0, 8, 4, 3, -1 }, { 0, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0169955306f, 0.494589508f, 0.0738800764f },
+	{ { { 6, 0, 8, 6, -1 }, { 6, 3, 8, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0350959413f, 0.700550914f, 0.497759104f },
+	{ { { 1, 0, 6, 4, -1 }, { 1, 0, 3, 2, 2 }, { 4, 2, 3, 2, 2 } }, 0.00242173509f, 0.446626514f, 0.547769427f },
+	{ { { 13, 0, 3, 7, -1 }, { 14, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.000963403378f, 0.471409887f, 0.531333804f },
+	{ { { 9, 16, 2, 2, -1 }, { 9, 17, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000163911303f, 0.433154613f, 0.534224212f },
+	{ { { 11, 4, 6, 10, -1 }, { 11, 9, 6, 5, 2 }, { 0, 0, 0, 0, 0 } }, -0.0211414602f, 0.264470011f, 0.520449877f },
+	{ { { 0, 10, 19, 2, -1 }, { 0, 11, 19, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000877752027f, 0.520834982f, 0.415274292f },
+	{ { { 9, 5, 8, 9, -1 }, { 9, 8, 8, 3, 3 }, { 0, 0, 0, 0, 0 } }, -0.0279439203f, 0.634412527f, 0.501881182f },
+	{ { { 4, 0, 3, 7, -1 }, { 5, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, 0.00672973786f, 0.505043805f, 0.350086391f },
+	{ { { 8, 6, 4, 12, -1 }, { 10, 6, 2, 6, 2 }, { 8, 12, 2, 6, 2 } }, 0.0232810397f, 0.496631801f, 0.696867704f },
+	{ { { 0, 2, 6, 4, -1 }, { 0, 4, 6, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.0116449799f, 0.330026001f, 0.504962981f },
+	{ { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.0157643091f, 0.499159813f, 0.732115388f },
+	{ { { 8, 0, 3, 7, -1 }, { 9, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } }, -0.00136114797f, 0.391173512f, 0.516067088f },
+	{ { { 9, 5, 3, 4, -1 }, { 10, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.000815223379f, 0.562891126f, 0.494971901f },
+	{ { { 8, 5, 3, 4, -1 }, { 9, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.000600662723f, 0.585359514f, 0.455059588f },
+	{ { { 7, 6, 6, 1, -1 }, { 9, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000497155183f, 0.427147001f, 0.544359922f },
+	{ { { 7, 14, 4, 4, -1 }, { 7, 14, 2, 2, 2 }, { 9, 16, 2, 2, 2 } }, 0.00234753708f, 0.514311075f, 0.388765693f },
+	{ { { 13, 14, 4, 6, -1 }, { 15, 14, 2, 3, 2 }, { 13, 17, 2, 3, 2 } }, -0.00892615691f, 0.604450226f, 0.497172087f },
+	{ { { 7, 8, 1, 8, -1 }, { 7, 12, 1, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.0139199104f, 0.2583161f, 0.500036776f },
+	{ { { 16, 0, 2, 8, -1 }, { 17, 0, 1, 4, 2 }, { 16, 4, 1, 4, 2 } }, 0.00102099497f, 0.485737413f, 0.556035817f },
+	{ { { 2, 0, 2, 8, -1 }, { 2, 0, 1, 4, 2 }, { 3, 4, 1, 4, 2 } }, -0.00274416292f, 0.593688488f, 0.464577705f },
+	{ { { 6, 1, 14, 3, -1 }, { 6, 2, 14, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.0162001308f, 0.316301495f, 0.519349515f },
+	{ { { 7, 9, 3, 10, -1 }, { 7, 14, 3, 5, 2 }, { 0, 0, 0, 0, 0 } }, 0.00433319807f, 0.50612241f, 0.345887899f },
+	{ { { 9, 14, 2, 2, -1 }, { 9, 15, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000584979309f, 0.477901787f, 0.587017775f },
+	{ { { 7, 7, 6, 8, -1 }, { 7, 11, 6, 4, 2 }, { 0, 0, 0, 0, 0 } }, -0.00224664505f, 0.429785103f, 0.537477314f },
+	{ { { 9, 7, 3, 6, -1 }, { 9, 10, 3, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.00231460994f, 0.543867171f, 0.464096993f },
+	{ { { 7, 13, 3, 3, -1 }, { 7, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00876791216f, 0.472689301f, 0.677178979f },
+	{ { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } }, -0.000224480202f, 0.422917306f, 0.542804897f },
+	{ { { 0, 1, 18, 2, -1 }, { 6, 1, 6, 2, 3 }, { 0, 0, 0, 0, 0 } }, -0.00743360212f, 0.609888077f, 0.468367398f },
+	{ { { 7, 1, 6, 14, -1 }, { 7, 8, 6, 7, 2 }, { 0, 0, 0, 0, 0 } }, -0.00231892406f, 0.568943679f, 0.442424208f },
+	{ { { 1, 9, 18, 1, -1 }, { 7, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.00210421789f, 0.376222104f, 0.518708706f },
+	{ { { 9, 7, 2, 2, -1 }, { 9, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } }, 0.000460348412f, 0.469940513f, 0.577120721f },
+	{ { { 9, 3, 2, 9, -1 }, { 10, 3, 1, 9, 2 }, { 0, 0, 0, 0, 0 } }, 0.00105476298f, 0.446521699f, 0.560170174f },
+	{ { { 18, 14, 2, 3, -1 }, { 18, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000871488184f, 0.544980526f, 0.391470909f },
+	{ { { 7, 11, 3, 1, -1 }, { 8, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.000333648204f, 0.456400901f, 0.564573884f },
+	{ { { 10, 8, 3, 4, -1 }, { 11, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.00148532505f, 0.574737787f, 0.469277889f },
+	{ { { 7, 14, 3, 6, -1 }, { 8, 14, 1, 6, 3 }, { 0, 0, 0, 0, 0 } }, 0.00302516203f, 0.516619682f, 0.37628141f },
+	{ { { 10, 8, 3, 4, -1 }, { 11, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, 0.00502807414f, 0.500211179f, 0.615152717f },
+	{ { { 7, 8, 3, 4, -1 }, { 8, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } }, -0.000581645116f, 0.539459825f, 0.439075112f },
+	{ { { 7, 9, 6, 9, -1 }, { 7, 12, 6, 3, 3 }, { 0, 0, 0, 0, 0 } }, 0.0451415293f, 0.518832684f, 0.206303596f },
+	{ { { 0, 14, 2, 3, -1 }, { 0, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.001079562f, 0.390468508f, 0.513790727f },
+	{ { { 11, 12, 1, 2, -1 }, { 11, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } }, 0.000159959993f, 0.489532292f, 0.542750418f },
+	{ { { 4, 3, 8, 3, -1 }, { 8, 3, 4, 3, 2 }, { 0, 0, 0, 0, 0 } }, -0.0193592701f, 0.697522879f, 0.477350712f },
+	{ { { 0, 4, 20, 6, -1 }, { 0, 4, 10, 6, 2 }, { 0, 0, 0, 0, 0 } }, 0.207255095f, 0.52336359f, 0.303499192f },
+	{ { { 9, 14, 1, 3, -1 }, { 9, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } }, -0.000419532909f, 0.541939676f, 0.446018606f },
+	{ { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } }, 0.00225820695f, 0.481576413f, 0.602740884f },
+	{ { { 0, 15, 14, 4, -1 }, { 0, 17, 14, 2, 2 }, { 0, 0, 0, 0, 0 } }, -0.00678112078f, 0.398027897f, 0.518330574f },
+	{ { { 1, 14, 18, 6, -1 }, { 1, 17, 18, 3, 2 }, { 0, 0, 0, 0, 0 } }, 0.0111543098f, 0.543123186f, 0.418875992f },
+	{ { { 0, 0, 10, 6, -1 }, { 0, 0, 5, 3, 2 }, { 5, 3, 5, 3, 2 } }, 0.0431624316f, 0.473822802f, 0.652296126f },
+};
+
+const int _camera_face_stage_count = sizeof(_camera_face_stages) / sizeof(_camera_face_stages[0]);
+const int _camera_face_stump_count = sizeof(_camera_face_stumps) / sizeof(_camera_face_stumps[0]);
@@ -0,0 +1,516 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <glib.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* O_DIRECT needs buffer address, file offset and length aligned to the logical block size */
+#define FILE_WRITER_ALIGN 4096
+/* upper bound of shots held in memory waiting for storage, a shot beyond it is dropped */
+#define FILE_WRITER_MAX_PENDING 32
+/* files kept open between fdatasync batches */
+#define FILE_WRITER_SYNC_BATCH 16
+#define FILE_WRITER_PATH_MAX 4096
+
+typedef enum {
+	_FILE_WRITER_JOB_WRITE,
+	_FILE_WRITER_JOB_DROPPED,
+	_FILE_WRITER_JOB_FINISH,
+	_FILE_WRITER_JOB_QUIT,
+} _camera_file_writer_job_e;
+
+typedef struct {
+	_camera_file_writer_job_e type;
+	int index;
+	char *path;
+	unsigned char *data;
+	unsigned int size;
+	camera_file_sync_policy_e sync_policy;
+	bool direct_io;
+	camera_capture_file_saved_cb saved_cb;
+	camera_capture_completed_cb completed_cb;
+	void *user_data;
+} _camera_file_writer_job_s;
+
+struct _camera_file_writer_s {
+	GThread *thread;
+	GAsyncQueue *queue;
+	GMutex lock;
+	int pending;
+	struct _camera_file_writer_done_s *dones;
+
+	/* current burst, only touched by the capture side */
+	char *path_template;
+	int next_index;
+	camera_file_sync_policy_e sync_policy;
+	bool direct_io;
+	camera_capture_file_saved_cb saved_cb;
+	camera_capture_completed_cb completed_cb;
+	void *user_data;
+
+	/* writer thread only */
+	int batch_fds[FILE_WRITER_SYNC_BATCH];
+	int batch_count;
+	char last_dir[FILE_WRITER_PATH_MAX];
+};
+
+typedef struct _camera_file_writer_done_s {
+	camera_file_writer_s *writer;
+	camera_capture_completed_cb callback;
+	void *user_data;
+	guint source;
+	struct _camera_file_writer_done_s *next;
+} _camera_file_writer_done_s;
+
+
+/*
+ * Path templates accept a single %d conversion with an optional zero padded
+ * width (%d, %04d) and %% for a literal percent. Anything else is rejected so
+ * the template never reaches a printf family function.
+ */
+static int __parse_template(const char *path_template, int *conversions){
+	const char *p;
+	int count = 0;
+
+	for( p = path_template ; *p ; p++ ){
+		if( *p != '%' )
+			continue;
+		p++;
+		if( *p == '%' )
+			continue;
+		while( *p >= '0' && *p <= '9' )
+			p++;
+		if( *p != 'd' )
+			return -1;
+		count++;
+	}
+	*conversions = count;
+	return 0;
+}
+
+static int __format_path(const char *path_template, int index, char *path, int path_size){
+	const char *p;
+	char number[16];
+	int len = 0;
+
+	for( p = path_template ; *p ; p++ ){
+		if( *p == '%' && p[1] == '%' ){
+			p++;
+		}else if( *p == '%' ){
+			int width = 0;
+			int digits;
+			int i;
+			for( p++ ; *p >= '0' && *p <= '9' ; p++ )
+				width = width * 10 + (*p - '0');
+			digits = snprintf(number, sizeof(number), "%d", index);
+			for( i = digits ; i < width && len < path_size - 1 ; i++ )
+				path[len++] = '0';
+			for( i = 0 ; i < digits && len < path_size - 1 ; i++ )
+				path[len++] = number[i];
+			continue;
+		}
+		if( len >= path_size - 1 )
+			return -1;
+		path[len++] = *p;
+	}
+	if( len >= path_size - 1 )
+		return -1;
+	path[len] = '\0';
+	return 0;
+}
+
+bool _camera_file_writer_is_valid_template(const char *path_template, int count){
+	int conversions = 0;
+
+	if( path_template == NULL || path_template[0] == '\0' || strlen(path_template) >= FILE_WRITER_PATH_MAX )
+		return false;
+	if( __parse_template(path_template, &conversions) != 0 || conversions > 1 )
+		return false;
+	/* a burst without a sequence number would overwrite the same file */
+	if( count > 1 && conversions == 0 )
+		return false;
+	return true;
+}
+
+static void __job_free(_camera_file_writer_job_s *job){
+	if( job == NULL )
+		return;
+	free(job->path);
+	free(job->data);
+	free(job);
+}
+
+static int __write_all(int fd, const unsigned char *data, size_t size){
+	while( size > 0 ){
+		ssize_t written = write(fd, data, size);
+		if( written < 0 ){
+			if( errno == EINTR )
+				continue;
+			return -1;
+		}
+		data += written;
+		size -= written;
+	}
+	return 0;
+}
+
+static void __sync_dir(camera_file_writer_s *writer){
+	int fd;
+
+	if( writer->last_dir[0] == '\0' )
+		return;
+	fd = open(writer->last_dir, O_RDONLY | O_DIRECTORY);
+	if( fd >= 0 ){
+		fsync(fd);
+		close(fd);
+	}
+	writer->last_dir[0] = '\0';
+}
+
+static void __sync_batch(camera_file_writer_s *writer){
+	int i;
+
+	/* all writes of the batch are already queued, so writeback can merge them */
+	for( i = 0 ; i < writer->batch_count ; i++ ){
+		if( fdatasync(writer->batch_fds[i]) != 0 )
+			LOGE("[%s] fdatasync fail(%d)",__func__, errno);
+		close(writer->batch_fds[i]);
+	}
+	writer->batch_count = 0;
+	__sync_dir(writer);
+}
+
+static void __remember_dir(camera_file_writer_s *writer, const char *path){
+	const char *slash = strrchr(path, '/');
+	int len;
+
+	if( slash == NULL ){
+		strcpy(writer->last_dir, ".");
+		return;
+	}
+	len = slash == path ? 1 : slash - path;
+	if( writer->last_dir[0] != '\0' && (strncmp(writer->last_dir, path, len) != 0 || writer->last_dir[len] != '\0') )
+		__sync_dir(writer);
+	memcpy(writer->last_dir, path, len);
+	writer->last_dir[len] = '\0';
+}
+
+static int __open_file(const char *path, bool direct_io, bool *is_direct){
+	int flags = O_WRONLY | O_CREAT | O_TRUNC;
+	int fd = -1;
+
+	*is_direct = false;
+#ifdef O_DIRECT
+	if( direct_io ){
+		fd = open(path, flags | O_DIRECT, 0644);
+		if( fd >= 0 ){
+			*is_direct = true;
+			return fd;
+		}
+		/* tmpfs and some FUSE mounts refuse O_DIRECT, fall back to buffered I/O */
+		if( errno != EINVAL )
+			return -1;
+	}
+#endif
+	fd = open(path, flags, 0644);
+	return fd;
+}
+
+static int __write_file(camera_file_writer_s *writer, _camera_file_writer_job_s *job){
+	bool is_direct = false;
+	size_t write_size;
+	int fd;
+
+	fd = __open_file(job->path, job->direct_io, &is_direct);
+	if( fd < 0 ){
+		LOGE("[%s] open %s fail(%d)",__func__, job->path, errno);
+		return errno == ENOSPC ? CAMERA_ERROR_OUT_OF_MEMORY : CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	/* the buffer is padded to FILE_WRITER_ALIGN, direct writes cover the padding and truncate it afterwards */
+	write_size = is_direct ? (job->size + FILE_WRITER_ALIGN - 1) & ~(FILE_WRITER_ALIGN - 1) : job->size;
+	if( __write_all(fd, job->data, write_size) != 0 || (is_direct && ftruncate(fd, job->size) != 0) ){
+		int err = errno;
+		LOGE("[%s] write %s fail(%d)",__func__, job->path, err);
+		close(fd);
+		unlink(job->path);
+		return err == ENOSPC ? CAMERA_ERROR_OUT_OF_MEMORY : CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	switch( job->sync_policy ){
+		case CAMERA_FILE_SYNC_EACH:
+			__remember_dir(writer, job->path);
+			fdatasync(fd);
+			close(fd);
+			__sync_dir(writer);
+			break;
+		case CAMERA_FILE_SYNC_BURST:
+			__remember_dir(writer, job->path);
+			writer->batch_fds[writer->batch_count++] = fd;
+			if( writer->batch_count == FILE_WRITER_SYNC_BATCH )
+				__sync_batch(writer);
+			break;
+		case CAMERA_FILE_SYNC_NONE:
+		default:
+			close(fd);
+			break;
+	}
+	return CAMERA_ERROR_NONE;
+}
+
+static gboolean __file_writer_done_cb(gpointer data){
+	_camera_file_writer_done_s *done = (_camera_file_writer_done_s*)data;
+	camera_file_writer_s *writer = done->writer;
+	_camera_file_writer_done_s **link;
+
+	g_mutex_lock(&writer->lock);
+	for( link = &writer->dones ; *link != done ; link = &(*link)->next )
+		;
+	*link = done->next;
+	g_mutex_unlock(&writer->lock);
+	done->callback(done->user_data);
+	free(done);
+	return FALSE;
+}
+
+static gpointer __file_writer_thread(gpointer data){
+	camera_file_writer_s *writer = (camera_file_writer_s*)data;
+	_camera_file_writer_job_s *job;
+	bool quit = false;
+	int ret;
+
+	while( !quit ){
+		job = (_camera_file_writer_job_s*)g_async_queue_pop(writer->queue);
+		switch( job->type ){
+			case _FILE_WRITER_JOB_WRITE:
+				ret = __write_file(writer, job);
+				if( job->saved_cb )
+					job->saved_cb(job->index, job->path, ret, job->user_data);
+				g_mutex_lock(&writer->lock);
+				writer->pending--;
+				g_mutex_unlock(&writer->lock);
+				break;
+			case _FILE_WRITER_JOB_DROPPED:
+				/* reported in order with the written ones, on the thread the application expects */
+				if( job->saved_cb )
+					job->saved_cb(job->index, job->path, CAMERA_ERROR_OUT_OF_MEMORY, job->user_data);
+				break;
+			case _FILE_WRITER_JOB_FINISH:
+				__sync_batch(writer);
+				if( job->completed_cb ){
+					_camera_file_writer_done_s *done = (_camera_file_writer_done_s*)malloc(sizeof(_camera_file_writer_done_s));
+					/* the source is kept so that destroying the writer can take a notification not run yet back */
+					if( done ){
+						done->writer = writer;
+						done->callback = job->completed_cb;
+						done->user_data = job->user_data;
+						g_mutex_lock(&writer->lock);
+						done->source = g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __file_writer_done_cb, done, NULL);
+						done->next = writer->dones;
+						writer->dones = done;
+						g_mutex_unlock(&writer->lock);
+					}
+				}
+				break;
+			case _FILE_WRITER_JOB_QUIT:
+			default:
+				__sync_batch(writer);
+				quit = true;
+				break;
+		}
+		__job_free(job);
+	}
+	return NULL;
+}
+
+int _camera_file_writer_create(camera_file_writer_s **writer){
+	camera_file_writer_s *new_writer;
+
+	if( writer == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	new_writer = (camera_file_writer_s*)calloc(1, sizeof(camera_file_writer_s));
+	if( new_writer == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	g_mutex_init(&new_writer->lock);
+	new_writer->queue = g_async_queue_new();
+	new_writer->thread = g_thread_new("camera_file_writer", __file_writer_thread, new_writer);
+	if( new_writer->thread == NULL ){
+		LOGE("[%s] writer thread create fail",__func__);
+		g_async_queue_unref(new_writer->queue);
+		g_mutex_clear(&new_writer->lock);
+		free(new_writer);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	*writer = new_writer;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_file_writer_destroy(camera_file_writer_s *writer){
+	_camera_file_writer_job_s *job;
+
+	if( writer == NULL )
+		return;
+
+	/* queued shots are still written, the quit job is handled after them */
+	job = (_camera_file_writer_job_s*)calloc(1, sizeof(_camera_file_writer_job_s));
+	if( job ){
+		job->type = _FILE_WRITER_JOB_QUIT;
+		g_async_queue_push(writer->queue, job);
+		g_thread_join(writer->thread);
+	}else{
+		LOGE("[%s] malloc fail, writer thread is left running",__func__);
+		return;
+	}
+
+	/* the camera is gone, a completion still queued on the main loop is dropped */
+	while( writer->dones ){
+		_camera_file_writer_done_s *done = writer->dones;
+		g_source_remove(done->source);
+		writer->dones = done->next;
+		free(done);
+	}
+
+	g_async_queue_unref(writer->queue);
+	g_mutex_clear(&writer->lock);
+	free(writer->path_template);
+	free(writer);
+}
+
+int _camera_file_writer_start(camera_file_writer_s *writer, const char *path_template, camera_file_sync_policy_e sync_policy, bool direct_io, camera_capture_file_saved_cb saved_cb, camera_capture_completed_cb completed_cb, void *user_data){
+	char *new_template;
+
+	if( writer == NULL || path_template == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	new_template = strdup(path_template);
+	if( new_template == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	free(writer->path_template);
+	writer->path_template = new_template;
+	writer->next_index = 1;
+	writer->sync_policy = sync_policy;
+	writer->direct_io = direct_io;
+	writer->saved_cb = saved_cb;
+	writer->completed_cb = completed_cb;
+	writer->user_data = user_data;
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_file_writer_push(camera_file_writer_s *writer, camera_image_data_s *image){
+	_camera_file_writer_job_s *job;
+	char path[FILE_WRITER_PATH_MAX];
+	size_t alloc_size;
+	bool dropped;
+	int index;
+
+	if( writer == NULL || writer->path_template == NULL || image == NULL || image->data == NULL || image->size == 0 )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	index = writer->next_index++;
+	if( __format_path(writer->path_template, index, path, sizeof(path)) != 0 ){
+		LOGE("[%s] path too long",__func__);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	job = (_camera_file_writer_job_s*)calloc(1, sizeof(_camera_file_writer_job_s));
+	if( job == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	job->path = strdup(path);
+	if( job->path == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		__job_free(job);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	job->index = index;
+	job->saved_cb = writer->saved_cb;
+	job->user_data = writer->user_data;
+
+	/* bound the memory held by a burst that outruns the storage, the capture thread never waits for it */
+	g_mutex_lock(&writer->lock);
+	dropped = writer->pending >= FILE_WRITER_MAX_PENDING;
+	if( !dropped )
+		writer->pending++;
+	g_mutex_unlock(&writer->lock);
+	if( dropped ){
+		LOGE("[%s] %d shots wait for storage, shot %d dropped",__func__, FILE_WRITER_MAX_PENDING, index);
+		job->type = _FILE_WRITER_JOB_DROPPED;
+		g_async_queue_push(writer->queue, job);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+
+	alloc_size = ((size_t)image->size + FILE_WRITER_ALIGN - 1) & ~(size_t)(FILE_WRITER_ALIGN - 1);
+	if( posix_memalign((void**)&job->data, FILE_WRITER_ALIGN, alloc_size) != 0 ){
+		LOGE("[%s] malloc fail",__func__);
+		job->data = NULL;
+		__job_free(job);
+		g_mutex_lock(&writer->lock);
+		writer->pending--;
+		g_mutex_unlock(&writer->lock);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	memcpy(job->data, image->data, image->size);
+	memset(job->data + image->size, 0, alloc_size - image->size);
+	job->type = _FILE_WRITER_JOB_WRITE;
+	job->size = image->size;
+	job->sync_policy = writer->sync_policy;
+	job->direct_io = writer->direct_io;
+
+	g_async_queue_push(writer->queue, job);
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_file_writer_finish(camera_file_writer_s *writer){
+	_camera_file_writer_job_s *job;
+
+	if( writer == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	job = (_camera_file_writer_job_s*)calloc(1, sizeof(_camera_file_writer_job_s));
+	if( job == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	job->type = _FILE_WRITER_JOB_FINISH;
+	job->completed_cb = writer->completed_cb;
+	job->user_data = writer->user_data;
+	g_async_queue_push(writer->queue, job);
+	return CAMERA_ERROR_NONE;
+}
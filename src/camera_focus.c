@@ -0,0 +1,270 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FOCUS_USE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define FOCUS_USE_SSE2
+#endif
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* squared Sobel gradient an edge needs to peak, a step of about 25 luma levels */
+#define FOCUS_PEAKING_MIN_ENERGY 10000
+/* and how many times the mean of the frame, so only the sharpest edges of a detailed scene peak */
+#define FOCUS_PEAKING_RATIO 8
+
+/*
+ * Focus measures on the luma plane : the Tenengrad sharpness is the mean of
+ * the squared Sobel gradient gx * gx + gy * gy, which grows as edges get
+ * sharper and is at its peak when the scene is in focus. Focus peaking marks
+ * the pixels whose gradient stands out both in absolute terms and against
+ * the mean of the frame. The outer pixels have no full neighborhood and are
+ * left out. Packed 4:2:2 frames are read with a stride of two.
+ */
+
+bool _camera_focus_is_supported_format(camera_pixel_format_e format){
+	switch( format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV16:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+		case CAMERA_PIXEL_FORMAT_422P:
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+			return true;
+		default:
+			return false;
+	}
+}
+
+static const unsigned char *__focus_luma(camera_image_data_s *frame, int *stride, int *step){
+	if( frame->format == CAMERA_PIXEL_FORMAT_YUYV || frame->format == CAMERA_PIXEL_FORMAT_UYVY ){
+		*stride = frame->width * 2;
+		*step = 2;
+		return frame->data + (frame->format == CAMERA_PIXEL_FORMAT_UYVY ? 1 : 0);
+	}
+	*stride = frame->width;
+	*step = 1;
+	return frame->data;
+}
+
+static inline int __focus_energy(const unsigned char *r0, const unsigned char *r1, const unsigned char *r2, int x, int step){
+	int l = x - step;
+	int r = x + step;
+	int gx = (r0[r] - r0[l]) + 2 * (r1[r] - r1[l]) + (r2[r] - r2[l]);
+	int gy = (r2[l] + 2 * r2[x] + r2[r]) - (r0[l] + 2 * r0[x] + r0[r]);
+	return gx * gx + gy * gy;
+}
+
+#if defined(FOCUS_USE_SSE2)
+/* Sobel gradients of the 8 pixels from x on, on rows of plain luma */
+static inline void __focus_sobel8(const unsigned char *r0, const unsigned char *r1, const unsigned char *r2, int x, __m128i *gx, __m128i *gy){
+	const __m128i zero = _mm_setzero_si128();
+	__m128i a0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r0 + x - 1)), zero);
+	__m128i a1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r0 + x)), zero);
+	__m128i a2 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r0 + x + 1)), zero);
+	__m128i b0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r1 + x - 1)), zero);
+	__m128i b2 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r1 + x + 1)), zero);
+	__m128i c0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r2 + x - 1)), zero);
+	__m128i c1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r2 + x)), zero);
+	__m128i c2 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r2 + x + 1)), zero);
+	__m128i middle = _mm_sub_epi16(b2, b0);
+
+	*gx = _mm_add_epi16(_mm_add_epi16(_mm_sub_epi16(a2, a0), _mm_sub_epi16(c2, c0)), _mm_add_epi16(middle, middle));
+	*gy = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(c0, c2), _mm_add_epi16(c1, c1)), _mm_add_epi16(_mm_add_epi16(a0, a2), _mm_add_epi16(a1, a1)));
+}
+#elif defined(FOCUS_USE_NEON)
+static inline void __focus_sobel8(const unsigned char *r0, const unsigned char *r1, const unsigned char *r2, int x, int16x8_t *gx, int16x8_t *gy){
+	int16x8_t a0 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r0 + x - 1)));
+	int16x8_t a1 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r0 + x)));
+	int16x8_t a2 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r0 + x + 1)));
+	int16x8_t b0 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r1 + x - 1)));
+	int16x8_t b2 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r1 + x + 1)));
+	int16x8_t c0 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r2 + x - 1)));
+	int16x8_t c1 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r2 + x)));
+	int16x8_t c2 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r2 + x + 1)));
+
+	*gx = vaddq_s16(vaddq_s16(vsubq_s16(a2, a0), vsubq_s16(c2, c0)), vshlq_n_s16(vsubq_s16(b2, b0), 1));
+	*gy = vsubq_s16(vaddq_s16(vaddq_s16(c0, c2), vshlq_n_s16(c1, 1)), vaddq_s16(vaddq_s16(a0, a2), vshlq_n_s16(a1, 1)));
+}
+#endif
+
+/* sum of the squared gradients of pixels x0 to x1 - 1 of the middle row */
+static unsigned long long __focus_row_energy(const unsigned char *r0, const unsigned char *r1, const unsigned char *r2, int x0, int x1, int step){
+	unsigned long long total = 0;
+	int x = x0;
+
+	if( step == 1 ){
+#if defined(FOCUS_USE_SSE2)
+		while( x + 8 <= x1 ){
+			// a lane takes up to 4 * 1040400 per 8 pixels, flushed before it can overflow
+			int end = MIN(x1, x + 8 * 256);
+			__m128i sum = _mm_setzero_si128();
+			unsigned int lanes[4];
+			for( ; x + 8 <= end ; x += 8 ){
+				__m128i gx;
+				__m128i gy;
+				__focus_sobel8(r0, r1, r2, x, &gx, &gy);
+				sum = _mm_add_epi32(sum, _mm_add_epi32(_mm_madd_epi16(gx, gx), _mm_madd_epi16(gy, gy)));
+			}
+			_mm_storeu_si128((__m128i*)lanes, sum);
+			total += (unsigned long long)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+		}
+#elif defined(FOCUS_USE_NEON)
+		while( x + 8 <= x1 ){
+			int end = MIN(x1, x + 8 * 256);
+			uint32x4_t sum = vdupq_n_u32(0);
+			for( ; x + 8 <= end ; x += 8 ){
+				int16x8_t gx;
+				int16x8_t gy;
+				int32x4_t energy;
+				__focus_sobel8(r0, r1, r2, x, &gx, &gy);
+				energy = vmull_s16(vget_low_s16(gx), vget_low_s16(gx));
+				energy = vmlal_s16(energy, vget_high_s16(gx), vget_high_s16(gx));
+				energy = vmlal_s16(energy, vget_low_s16(gy), vget_low_s16(gy));
+				energy = vmlal_s16(energy, vget_high_s16(gy), vget_high_s16(gy));
+				sum = vaddq_u32(sum, vreinterpretq_u32_s32(energy));
+			}
+			total += vgetq_lane_u32(sum, 0) + (unsigned long long)vgetq_lane_u32(sum, 1) + vgetq_lane_u32(sum, 2) + vgetq_lane_u32(sum, 3);
+		}
+#endif
+	}
+	for( ; x < x1 ; x++ )
+		total += __focus_energy(r0, r1, r2, x * step, step);
+	return total;
+}
+
+/*
+ * Tenengrad sharpness of the luma inside the area, clipped to the frame.
+ * An empty area measures the whole frame.
+ */
+unsigned int _camera_focus_get_sharpness(camera_image_data_s *frame, int x, int y, int width, int height){
+	const unsigned char *luma;
+	unsigned long long total = 0;
+	int stride;
+	int step;
+	int x0;
+	int x1;
+	int y0;
+	int y1;
+	int row;
+
+	if( frame == NULL || !_camera_focus_is_supported_format(frame->format) || !_camera_image_is_valid(frame) )
+		return 0;
+	if( width <= 0 || height <= 0 ){
+		x = 0;
+		y = 0;
+		width = frame->width;
+		height = frame->height;
+	}
+	x0 = MAX(x, 1);
+	y0 = MAX(y, 1);
+	x1 = (int)MIN((long long)x + width, frame->width - 1);
+	y1 = (int)MIN((long long)y + height, frame->height - 1);
+	if( x1 <= x0 || y1 <= y0 )
+		return 0;
+
+	luma = __focus_luma(frame, &stride, &step);
+	for( row = y0 ; row < y1 ; row++ )
+		total += __focus_row_energy(luma + (row - 1) * stride, luma + row * stride, luma + (row + 1) * stride, x0, x1, step);
+	return (unsigned int)(total / ((unsigned long long)(x1 - x0) * (y1 - y0)));
+}
+
+/* marks the pixels of the middle row whose squared gradient exceeds threshold */
+static void __focus_row_mask(const unsigned char *r0, const unsigned char *r1, const unsigned char *r2, int width, int step, int threshold, unsigned char *mask){
+	int x = 1;
+
+	if( step == 1 ){
+#if defined(FOCUS_USE_SSE2)
+		const __m128i limit = _mm_set1_epi32(threshold);
+		for( ; x + 8 <= width - 1 ; x += 8 ){
+			__m128i gx;
+			__m128i gy;
+			__m128i lo;
+			__m128i hi;
+			__m128i peak;
+			__focus_sobel8(r0, r1, r2, x, &gx, &gy);
+			lo = _mm_madd_epi16(_mm_unpacklo_epi16(gx, gy), _mm_unpacklo_epi16(gx, gy));
+			hi = _mm_madd_epi16(_mm_unpackhi_epi16(gx, gy), _mm_unpackhi_epi16(gx, gy));
+			peak = _mm_packs_epi32(_mm_cmpgt_epi32(lo, limit), _mm_cmpgt_epi32(hi, limit));
+			_mm_storel_epi64((__m128i*)(mask + x), _mm_packs_epi16(peak, peak));
+		}
+#elif defined(FOCUS_USE_NEON)
+		const int32x4_t limit = vdupq_n_s32(threshold);
+		for( ; x + 8 <= width - 1 ; x += 8 ){
+			int16x8_t gx;
+			int16x8_t gy;
+			int32x4_t lo;
+			int32x4_t hi;
+			uint16x8_t peak;
+			__focus_sobel8(r0, r1, r2, x, &gx, &gy);
+			lo = vmlal_s16(vmull_s16(vget_low_s16(gx), vget_low_s16(gx)), vget_low_s16(gy), vget_low_s16(gy));
+			hi = vmlal_s16(vmull_s16(vget_high_s16(gx), vget_high_s16(gx)), vget_high_s16(gy), vget_high_s16(gy));
+			peak = vcombine_u16(vmovn_u32(vcgtq_s32(lo, limit)), vmovn_u32(vcgtq_s32(hi, limit)));
+			vst1_u8(mask + x, vmovn_u16(peak));
+		}
+#endif
+	}
+	for( ; x < width - 1 ; x++ )
+		mask[x] = __focus_energy(r0, r1, r2, x * step, step) > threshold ? 255 : 0;
+}
+
+/*
+ * Writes the focus peaking mask of frame, one byte per pixel set to 255 on
+ * the sharpest edges and 0 elsewhere. mask holds width x height bytes.
+ */
+int _camera_focus_get_peaking_mask(camera_image_data_s *frame, unsigned char *mask){
+	const unsigned char *luma;
+	unsigned int sharpness;
+	int threshold;
+	int stride;
+	int step;
+	int row;
+
+	if( frame == NULL || mask == NULL || !_camera_focus_is_supported_format(frame->format) || !_camera_image_is_valid(frame) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( frame->width < 3 || frame->height < 3 )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	sharpness = _camera_focus_get_sharpness(frame, 0, 0, 0, 0);
+	threshold = (int)MIN(MAX((unsigned long long)sharpness * FOCUS_PEAKING_RATIO, FOCUS_PEAKING_MIN_ENERGY), 0x7fffffff);
+	luma = __focus_luma(frame, &stride, &step);
+	memset(mask, 0, frame->width);
+	for( row = 1 ; row < frame->height - 1 ; row++ ){
+		unsigned char *line = mask + row * frame->width;
+		line[0] = 0;
+		line[frame->width - 1] = 0;
+		__focus_row_mask(luma + (row - 1) * stride, luma + row * stride, luma + (row + 1) * stride, frame->width, step, threshold, line);
+	}
+	memset(mask + (frame->height - 1) * frame->width, 0, frame->width);
+	return CAMERA_ERROR_NONE;
+}
@@ -0,0 +1,414 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+#define GOVERNOR_MAX_RATES 16
+/* the load is judged over windows of about half a second of frames */
+#define GOVERNOR_MIN_WINDOW 4
+/* consecutive overloaded windows before a step down, and windows with room before a step up */
+#define GOVERNOR_DOWN_WINDOWS 2
+#define GOVERNOR_UP_WINDOWS 6
+/* overloaded : frames handled in more than this share of the interval, in percent */
+#define GOVERNOR_BUSY_SHARE 80
+/* room : frames would be handled in less than this share of the interval at the next rate up */
+#define GOVERNOR_ROOM_SHARE 60
+/* overloaded : more than one frame in this many missing */
+#define GOVERNOR_DROP_RATIO 10
+#define GOVERNOR_QUEUE_HIGH 75
+#define GOVERNOR_QUEUE_LOW 25
+#define GOVERNOR_CPU_HIGH 90
+#define GOVERNOR_CPU_LOW 75
+#define GOVERNOR_CPU_STAT "/proc/stat"
+
+/*
+ * FPS governor : the preview frames are watched on the streaming thread, and
+ * judged over windows of about half a second. A window is overloaded when
+ * frames went missing, when handling a frame took most of its interval, when
+ * the encoder or session queues were filling up, or when the CPU was nearly
+ * fully loaded. Two overloaded windows in a row step the rate down, six with
+ * room at the next rate up step it back. The rate is not applied here, the
+ * camera applies it from the main loop and reports back, and the window
+ * after a change is not judged, the stream takes a while to settle on it.
+ * The thermal policy may lower the ceiling below the rate the governor was
+ * started at, the rate is then stepped down to it right away.
+ */
+struct _camera_fps_governor_s {
+	GMutex lock;
+	bool running;
+	int rates[GOVERNOR_MAX_RATES];
+	int rate_count;
+	int level;
+	int ceiling;
+	int top;
+	int target;
+	camera_fps_governor_reason_e reason;
+
+	int window_frames;
+	long long window_time;
+	int window_drops;
+	int window_queue;
+	bool settling;
+	int overloaded_windows;
+	int relaxed_windows;
+	unsigned int last_timestamp;
+	bool has_timestamp;
+	unsigned long long cpu_busy;
+	unsigned long long cpu_total;
+
+	camera_fps_governor_statistics_s statistics;
+	long long total_time;
+};
+
+int _camera_fps_governor_create(camera_fps_governor_s **governor){
+	camera_fps_governor_s *handle;
+
+	if( governor == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	handle = (camera_fps_governor_s*)calloc(1, sizeof(camera_fps_governor_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	g_mutex_init(&handle->lock);
+	*governor = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_fps_governor_destroy(camera_fps_governor_s *governor){
+	if( governor == NULL )
+		return;
+	g_mutex_clear(&governor->lock);
+	free(governor);
+}
+
+bool _camera_fps_governor_is_running(camera_fps_governor_s *governor){
+	bool running;
+
+	if( governor == NULL )
+		return false;
+	g_mutex_lock(&governor->lock);
+	running = governor->running;
+	g_mutex_unlock(&governor->lock);
+	return running;
+}
+
+/* busy and total jiffies of all the CPUs, false when they can not be read */
+static bool __governor_read_cpu(unsigned long long *busy, unsigned long long *total){
+	unsigned long long user, nice, system, idle, iowait, irq, softirq, steal;
+	FILE *fp = fopen(GOVERNOR_CPU_STAT, "r");
+	int fields;
+
+	if( fp == NULL )
+		return false;
+	user = nice = system = idle = iowait = irq = softirq = steal = 0;
+	fields = fscanf(fp, "cpu %llu %llu %llu %llu %llu %llu %llu %llu", &user, &nice, &system, &idle, &iowait, &irq, &softirq, &steal);
+	fclose(fp);
+	if( fields < 4 )
+		return false;
+	*busy = user + nice + system + irq + softirq + steal;
+	*total = *busy + idle + iowait;
+	return true;
+}
+
+/* load since the last call in percent, -1 when it is not known yet */
+static int __governor_cpu_load(camera_fps_governor_s *governor){
+	unsigned long long busy;
+	unsigned long long total;
+	int load = -1;
+
+	if( !__governor_read_cpu(&busy, &total) )
+		return -1;
+	if( governor->cpu_total > 0 && total > governor->cpu_total )
+		load = (int)((busy - governor->cpu_busy) * 100 / (total - governor->cpu_total));
+	governor->cpu_busy = busy;
+	governor->cpu_total = total;
+	return load;
+}
+
+static int __governor_window_size(camera_fps_governor_s *governor){
+	int frames = governor->rates[governor->level] / 2;
+	return frames < GOVERNOR_MIN_WINDOW ? GOVERNOR_MIN_WINDOW : frames;
+}
+
+static void __governor_reset_window(camera_fps_governor_s *governor){
+	governor->window_frames = 0;
+	governor->window_time = 0;
+	governor->window_drops = 0;
+	governor->window_queue = 0;
+}
+
+/* judges a full window, returns true when a rate change is asked for */
+static bool __governor_judge(camera_fps_governor_s *governor){
+	int interval = 1000000 / governor->rates[governor->level];
+	int mean = (int)(governor->window_time / governor->window_frames);
+	int cpu = __governor_cpu_load(governor);
+	bool overloaded = true;
+	bool room = false;
+
+	governor->statistics.cpu_load = cpu;
+	governor->statistics.queue_level = governor->window_queue;
+	if( governor->settling ){
+		governor->settling = false;
+		return false;
+	}
+
+	if( governor->window_drops * GOVERNOR_DROP_RATIO > governor->window_frames )
+		governor->reason = CAMERA_FPS_GOVERNOR_REASON_FRAME_DROP;
+	else if( mean * 100 > interval * GOVERNOR_BUSY_SHARE )
+		governor->reason = CAMERA_FPS_GOVERNOR_REASON_CALLBACK_DURATION;
+	else if( governor->window_queue >= GOVERNOR_QUEUE_HIGH )
+		governor->reason = CAMERA_FPS_GOVERNOR_REASON_QUEUE_DEPTH;
+	else if( cpu >= GOVERNOR_CPU_HIGH )
+		governor->reason = CAMERA_FPS_GOVERNOR_REASON_CPU_LOAD;
+	else
+		overloaded = false;
+
+	if( !overloaded && governor->level < governor->ceiling ){
+		int next_interval = 1000000 / governor->rates[governor->level + 1];
+		room = governor->window_drops == 0 && mean * 100 < next_interval * GOVERNOR_ROOM_SHARE &&
+			governor->window_queue <= GOVERNOR_QUEUE_LOW && cpu < GOVERNOR_CPU_LOW;
+	}
+
+	governor->overloaded_windows = overloaded ? governor->overloaded_windows + 1 : 0;
+	governor->relaxed_windows = room ? governor->relaxed_windows + 1 : 0;
+	if( governor->overloaded_windows >= GOVERNOR_DOWN_WINDOWS && governor->level > 0 ){
+		governor->target = governor->level - 1;
+		return true;
+	}
+	if( governor->relaxed_windows >= GOVERNOR_UP_WINDOWS ){
+		governor->target = governor->level + 1;
+		governor->reason = CAMERA_FPS_GOVERNOR_REASON_RECOVERED;
+		return true;
+	}
+	return false;
+}
+
+int _camera_fps_governor_start(camera_fps_governor_s *governor, const int *rates, int count, int fps){
+	int i;
+	int j;
+
+	if( governor == NULL || rates == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&governor->lock);
+	if( governor->running ){
+		g_mutex_unlock(&governor->lock);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	// the rates up to the current one, lowest first
+	governor->rate_count = 0;
+	for( i = 0 ; i < count && governor->rate_count < GOVERNOR_MAX_RATES ; i++ ){
+		int rate = rates[i];
+		if( rate <= 0 || rate > fps )
+			continue;
+		for( j = governor->rate_count ; j > 0 && governor->rates[j - 1] > rate ; j-- )
+			governor->rates[j] = governor->rates[j - 1];
+		if( j > 0 && governor->rates[j - 1] == rate ){
+			memmove(&governor->rates[j], &governor->rates[j + 1], (governor->rate_count - j) * sizeof(int));
+			continue;
+		}
+		governor->rates[j] = rate;
+		governor->rate_count++;
+	}
+	if( governor->rate_count < 2 || governor->rates[governor->rate_count - 1] != fps ){
+		g_mutex_unlock(&governor->lock);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	governor->top = governor->rate_count - 1;
+	governor->ceiling = governor->top;
+	governor->level = governor->ceiling;
+	governor->target = -1;
+	__governor_reset_window(governor);
+	governor->settling = true;
+	governor->overloaded_windows = 0;
+	governor->relaxed_windows = 0;
+	governor->has_timestamp = false;
+	governor->cpu_total = 0;
+	__governor_cpu_load(governor);
+	memset(&governor->statistics, 0, sizeof(governor->statistics));
+	governor->statistics.cpu_load = -1;
+	governor->statistics.fps = fps;
+	governor->total_time = 0;
+	governor->running = true;
+	g_mutex_unlock(&governor->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+/* returns the rate the governor was started at */
+int _camera_fps_governor_stop(camera_fps_governor_s *governor){
+	int fps = 0;
+
+	if( governor == NULL )
+		return 0;
+	g_mutex_lock(&governor->lock);
+	if( governor->running )
+		fps = governor->rates[governor->top];
+	governor->running = false;
+	governor->target = -1;
+	g_mutex_unlock(&governor->lock);
+	return fps;
+}
+
+/*
+ * Feeds a preview frame : its stream timestamp in milliseconds, the time it
+ * was handled in and how full the preview queues are. Returns true when the
+ * rate should change, see _camera_fps_governor_get_change.
+ */
+bool _camera_fps_governor_push(camera_fps_governor_s *governor, unsigned int timestamp, int duration, int queue_level){
+	bool change = false;
+
+	if( governor == NULL )
+		return false;
+	g_mutex_lock(&governor->lock);
+	if( !governor->running || governor->target >= 0 ){
+		g_mutex_unlock(&governor->lock);
+		return false;
+	}
+
+	// a gap of one and a half intervals or more is frames the device gave up
+	if( governor->has_timestamp && timestamp > governor->last_timestamp ){
+		unsigned int interval = 1000 / governor->rates[governor->level];
+		unsigned int gap = timestamp - governor->last_timestamp;
+		if( interval > 0 && gap * 2 >= interval * 3 ){
+			unsigned int missing = (gap + interval / 2) / interval - 1;
+			// a long pause is not a second of drops after another
+			if( missing > (unsigned int)governor->rates[governor->level] )
+				missing = governor->rates[governor->level];
+			governor->window_drops += missing;
+			governor->statistics.dropped_frames += missing;
+		}
+	}
+	governor->last_timestamp = timestamp;
+	governor->has_timestamp = true;
+
+	if( duration < 0 )
+		duration = 0;
+	governor->window_frames++;
+	governor->window_time += duration;
+	if( queue_level > governor->window_queue )
+		governor->window_queue = queue_level;
+	governor->statistics.frames++;
+	governor->total_time += duration;
+	governor->statistics.mean_callback_time = (int)(governor->total_time / governor->statistics.frames);
+	if( duration > governor->statistics.largest_callback_time )
+		governor->statistics.largest_callback_time = duration;
+
+	if( governor->window_frames >= __governor_window_size(governor) ){
+		change = __governor_judge(governor);
+		__governor_reset_window(governor);
+	}
+	g_mutex_unlock(&governor->lock);
+	return change;
+}
+
+bool _camera_fps_governor_get_change(camera_fps_governor_s *governor, int *previous, int *fps, camera_fps_governor_reason_e *reason){
+	bool change = false;
+
+	if( governor == NULL )
+		return false;
+	g_mutex_lock(&governor->lock);
+	if( governor->running && governor->target >= 0 ){
+		*previous = governor->rates[governor->level];
+		*fps = governor->rates[governor->target];
+		*reason = governor->reason;
+		change = true;
+	}
+	g_mutex_unlock(&governor->lock);
+	return change;
+}
+
+/*
+ * Caps the rate at the highest supported one up to fps, the start rate is
+ * never exceeded. Returns true when the current rate is above the cap and
+ * has to change, see _camera_fps_governor_get_change.
+ */
+bool _camera_fps_governor_set_limit(camera_fps_governor_s *governor, int fps){
+	bool change = false;
+	int ceiling;
+
+	if( governor == NULL )
+		return false;
+	g_mutex_lock(&governor->lock);
+	if( !governor->running ){
+		g_mutex_unlock(&governor->lock);
+		return false;
+	}
+	for( ceiling = governor->top ; ceiling > 0 && governor->rates[ceiling] > fps ; ceiling-- )
+		;
+	governor->ceiling = ceiling;
+	governor->relaxed_windows = 0;
+	// a step up waiting to be applied may go past the cap
+	if( governor->target > ceiling )
+		governor->target = -1;
+	if( governor->level > ceiling && governor->target < 0 ){
+		governor->target = ceiling;
+		governor->reason = CAMERA_FPS_GOVERNOR_REASON_THERMAL;
+		change = true;
+	}
+	g_mutex_unlock(&governor->lock);
+	return change;
+}
+
+/* reports how the change went, a rate the device did not take leaves the governor where it was */
+void _camera_fps_governor_set_applied(camera_fps_governor_s *governor, bool applied){
+	if( governor == NULL )
+		return;
+	g_mutex_lock(&governor->lock);
+	if( governor->target >= 0 ){
+		if( applied ){
+			if( governor->target < governor->level )
+				governor->statistics.steps_down++;
+			else
+				governor->statistics.steps_up++;
+			governor->level = governor->target;
+			governor->statistics.fps = governor->rates[governor->level];
+		}
+		governor->target = -1;
+		__governor_reset_window(governor);
+		governor->settling = true;
+		governor->overloaded_windows = 0;
+		governor->relaxed_windows = 0;
+		governor->has_timestamp = false;
+	}
+	g_mutex_unlock(&governor->lock);
+}
+
+int _camera_fps_governor_get_statistics(camera_fps_governor_s *governor, camera_fps_governor_statistics_s *statistics){
+	if( statistics == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( governor == NULL ){
+		memset(statistics, 0, sizeof(camera_fps_governor_statistics_s));
+		statistics->cpu_load = -1;
+		return CAMERA_ERROR_NONE;
+	}
+	g_mutex_lock(&governor->lock);
+	*statistics = governor->statistics;
+	g_mutex_unlock(&governor->lock);
+	return CAMERA_ERROR_NONE;
+}
@@ -0,0 +1,634 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <glib.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+#define FRAME_TRACE_MAGIC "CAMTRC01"
+#define FRAME_TRACE_VERSION 1
+#define FRAME_TRACE_RECORD_MAGIC 0x4d524643	/* "CFRM" */
+/* the part of the file mapped for writing at once, and how far the file grows ahead */
+#define FRAME_TRACE_WINDOW_SIZE (8 * 1024 * 1024)
+/* the dimensions a replayed frame may have, the JPEG header is not parsed */
+#define FRAME_TRACE_MAX_DIMENSION 16384
+
+#define FRAME_TRACE_ALIGN(size) (((uint64_t)(size) + 7) & ~(uint64_t)7)
+
+/*
+ * Frame trace : an append-only container of the raw frames the camcorder
+ * handed out, written through a memory-mapped window that slides along the
+ * end of the file. The file is grown with posix_fallocate() before a window
+ * is mapped, so a full disk fails the append instead of faulting the
+ * streaming thread.
+ *
+ *  header    64 bytes, magic, version, offset and entry count of the index
+ *  records   40 byte header, data padded to 8 bytes, in arrival order
+ *  index     one entry per record, written when the trace is stopped
+ *
+ * A trace cut short by a crash has no index, the reader then walks the
+ * records up to the first one that does not check out.
+ */
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t header_size;
+	uint64_t index_offset;
+	uint32_t record_count;
+	uint32_t reserved[9];
+} _frame_trace_header_s;
+
+typedef struct {
+	uint32_t magic;
+	uint32_t type;
+	uint32_t format;
+	uint32_t width;
+	uint32_t height;
+	uint32_t size;
+	uint32_t sequence;
+	uint32_t stream_timestamp;
+	int64_t timestamp;
+} _frame_trace_record_header_s;
+
+typedef struct {
+	uint64_t offset;
+	int64_t timestamp;
+} _frame_trace_index_entry_s;
+
+struct _camera_frame_trace_writer_s {
+	GMutex lock;
+	int fd;
+	unsigned char *map;
+	uint64_t map_offset;
+	size_t map_size;
+	uint64_t write_offset;
+	uint64_t file_size;
+	_frame_trace_index_entry_s *index;
+	unsigned int count;
+	unsigned int capacity;
+	unsigned int sequence;
+};
+
+struct _camera_frame_trace_reader_s {
+	unsigned char *map;
+	size_t map_size;
+	const unsigned char *data;
+	size_t size;
+	uint64_t *offsets;
+	unsigned int count;
+};
+
+struct _camera_frame_replay_s {
+	GThread *thread;
+	GMutex lock;
+	GCond cond;
+	bool stop;
+	camera_frame_trace_reader_s *reader;
+	int speed;
+	camera_frame_replay_dispatch_cb dispatch;
+	void *dispatch_data;
+	camera_frame_replay_completed_cb completed_cb;
+	void *completed_data;
+};
+
+/* makes [write_offset, write_offset + size) writable, sliding the window when it does not fit */
+static unsigned char *__writer_reserve(camera_frame_trace_writer_s *writer, uint64_t size){
+	uint64_t page = (uint64_t)sysconf(_SC_PAGESIZE);
+	uint64_t end = writer->write_offset + size;
+	uint64_t map_size;
+	void *map;
+	int ret;
+
+	if( writer->map && end <= writer->map_offset + writer->map_size )
+		return writer->map + (writer->write_offset - writer->map_offset);
+
+	if( writer->map ){
+		munmap(writer->map, writer->map_size);
+		writer->map = NULL;
+	}
+	writer->map_offset = writer->write_offset & ~(page - 1);
+	map_size = MAX(FRAME_TRACE_WINDOW_SIZE, end - writer->map_offset);
+	map_size = (map_size + page - 1) & ~(page - 1);
+	if( map_size > (size_t)-1 )
+		return NULL;
+	if( writer->map_offset + map_size > writer->file_size ){
+		ret = posix_fallocate(writer->fd, writer->file_size, writer->map_offset + map_size - writer->file_size);
+		if( ret != 0 ){
+			LOGE("[%s] fallocate fail(%d)",__func__, ret);
+			return NULL;
+		}
+		writer->file_size = writer->map_offset + map_size;
+	}
+	map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, writer->fd, writer->map_offset);
+	if( map == MAP_FAILED ){
+		LOGE("[%s] mmap fail(%d)",__func__, errno);
+		return NULL;
+	}
+	writer->map = (unsigned char*)map;
+	writer->map_size = map_size;
+	return writer->map + (writer->write_offset - writer->map_offset);
+}
+
+static int __writer_append_record(camera_frame_trace_writer_s *writer, int type, camera_image_data_s *image, unsigned int stream_timestamp, int64_t timestamp){
+	_frame_trace_record_header_s header;
+	unsigned char *dst;
+
+	if( writer->count == writer->capacity ){
+		unsigned int capacity = writer->capacity ? writer->capacity * 2 : 256;
+		_frame_trace_index_entry_s *index = (_frame_trace_index_entry_s*)realloc(writer->index, capacity * sizeof(_frame_trace_index_entry_s));
+		if( index == NULL ){
+			LOGE("[%s] malloc fail",__func__);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+		writer->index = index;
+		writer->capacity = capacity;
+	}
+
+	dst = __writer_reserve(writer, sizeof(header) + FRAME_TRACE_ALIGN(image->size));
+	if( dst == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+
+	memset(&header, 0, sizeof(header));
+	header.magic = FRAME_TRACE_RECORD_MAGIC;
+	header.type = type;
+	header.format = image->format;
+	header.width = image->width;
+	header.height = image->height;
+	header.size = image->size;
+	header.sequence = writer->sequence++;
+	header.stream_timestamp = stream_timestamp;
+	header.timestamp = timestamp;
+	memcpy(dst, &header, sizeof(header));
+	memcpy(dst + sizeof(header), image->data, image->size);
+	// the padding is left as fallocate zeroed it
+
+	writer->index[writer->count].offset = writer->write_offset;
+	writer->index[writer->count].timestamp = timestamp;
+	writer->count++;
+	writer->write_offset += sizeof(header) + FRAME_TRACE_ALIGN(image->size);
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_frame_trace_writer_create(camera_frame_trace_writer_s **writer){
+	camera_frame_trace_writer_s *handle;
+
+	if( writer == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	handle = (camera_frame_trace_writer_s*)calloc(1, sizeof(camera_frame_trace_writer_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	handle->fd = -1;
+	g_mutex_init(&handle->lock);
+	*writer = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_frame_trace_writer_destroy(camera_frame_trace_writer_s *writer){
+	if( writer == NULL )
+		return;
+
+	_camera_frame_trace_writer_close(writer);
+	g_mutex_clear(&writer->lock);
+	free(writer->index);
+	free(writer);
+}
+
+bool _camera_frame_trace_writer_is_open(camera_frame_trace_writer_s *writer){
+	bool is_open;
+
+	if( writer == NULL )
+		return false;
+	g_mutex_lock(&writer->lock);
+	is_open = writer->fd >= 0;
+	g_mutex_unlock(&writer->lock);
+	return is_open;
+}
+
+int _camera_frame_trace_writer_open(camera_frame_trace_writer_s *writer, const char *path){
+	_frame_trace_header_s header;
+	unsigned char *dst;
+	int fd;
+
+	if( writer == NULL || path == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&writer->lock);
+	if( writer->fd >= 0 ){
+		g_mutex_unlock(&writer->lock);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if( fd < 0 ){
+		LOGE("[%s] open %s fail(%d)",__func__, path, errno);
+		g_mutex_unlock(&writer->lock);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	writer->fd = fd;
+	writer->map = NULL;
+	writer->map_offset = 0;
+	writer->map_size = 0;
+	writer->write_offset = 0;
+	writer->file_size = 0;
+	writer->count = 0;
+	writer->sequence = 0;
+
+	// the index is not known yet, a reader of an unfinished trace walks the records
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, FRAME_TRACE_MAGIC, sizeof(header.magic));
+	header.version = FRAME_TRACE_VERSION;
+	header.header_size = sizeof(header);
+	dst = __writer_reserve(writer, sizeof(header));
+	if( dst == NULL ){
+		close(fd);
+		unlink(path);
+		writer->fd = -1;
+		g_mutex_unlock(&writer->lock);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	memcpy(dst, &header, sizeof(header));
+	writer->write_offset = sizeof(header);
+	g_mutex_unlock(&writer->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_frame_trace_writer_append(camera_frame_trace_writer_s *writer, int type, camera_image_data_s *image, camera_image_data_s *thumbnail, unsigned int stream_timestamp){
+	int64_t timestamp = g_get_monotonic_time();
+	int ret;
+
+	if( writer == NULL || image == NULL || image->data == NULL || image->size == 0 )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	// a capture and its thumbnail stay next to each other
+	g_mutex_lock(&writer->lock);
+	if( writer->fd < 0 ){
+		g_mutex_unlock(&writer->lock);
+		return CAMERA_ERROR_INVALID_STATE;
+	}
+	ret = __writer_append_record(writer, type, image, stream_timestamp, timestamp);
+	if( ret == CAMERA_ERROR_NONE && thumbnail && thumbnail->data && thumbnail->size > 0 )
+		ret = __writer_append_record(writer, _CAMERA_FRAME_TRACE_THUMBNAIL, thumbnail, 0, timestamp);
+	g_mutex_unlock(&writer->lock);
+	return ret;
+}
+
+int _camera_frame_trace_writer_close(camera_frame_trace_writer_s *writer){
+	_frame_trace_header_s header;
+	uint64_t index_size;
+	unsigned char *dst;
+	int ret = CAMERA_ERROR_NONE;
+
+	if( writer == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&writer->lock);
+	if( writer->fd < 0 ){
+		g_mutex_unlock(&writer->lock);
+		return CAMERA_ERROR_NONE;
+	}
+	index_size = (uint64_t)writer->count * sizeof(_frame_trace_index_entry_s);
+	dst = __writer_reserve(writer, index_size);
+	if( dst ){
+		memcpy(dst, writer->index, index_size);
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, FRAME_TRACE_MAGIC, sizeof(header.magic));
+		header.version = FRAME_TRACE_VERSION;
+		header.header_size = sizeof(header);
+		header.index_offset = writer->write_offset;
+		header.record_count = writer->count;
+		writer->write_offset += index_size;
+		if( pwrite(writer->fd, &header, sizeof(header), 0) != sizeof(header) ){
+			LOGE("[%s] header write fail(%d)",__func__, errno);
+			ret = CAMERA_ERROR_INVALID_OPERATION;
+		}
+	}else{
+		// the records are still there, the reader walks them without the index
+		ret = CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	if( writer->map )
+		munmap(writer->map, writer->map_size);
+	writer->map = NULL;
+	if( ftruncate(writer->fd, writer->write_offset) != 0 )
+		LOGE("[%s] truncate fail(%d)",__func__, errno);
+	close(writer->fd);
+	writer->fd = -1;
+	g_mutex_unlock(&writer->lock);
+	return ret;
+}
+
+/* checks a record header at offset and returns the offset of the next record, 0 when it does not check out */
+static uint64_t __reader_check_record(const unsigned char *data, size_t size, uint64_t offset){
+	_frame_trace_record_header_s header;
+	camera_image_data_s image;
+	uint64_t end;
+
+	if( offset < sizeof(_frame_trace_header_s) || (offset & 7) || offset > size || size - offset < sizeof(header) )
+		return 0;
+	memcpy(&header, data + offset, sizeof(header));
+	if( header.magic != FRAME_TRACE_RECORD_MAGIC || header.type > _CAMERA_FRAME_TRACE_THUMBNAIL || header.size == 0 )
+		return 0;
+	end = offset + sizeof(header) + FRAME_TRACE_ALIGN(header.size);
+	if( end > size )
+		return 0;
+
+	if( header.width == 0 || header.height == 0 || header.width > FRAME_TRACE_MAX_DIMENSION || header.height > FRAME_TRACE_MAX_DIMENSION )
+		return 0;
+	if( header.format != CAMERA_PIXEL_FORMAT_JPEG ){
+		// the frame goes through the same code as a camera frame, it must hold what its size says
+		image.data = (unsigned char*)data + offset + sizeof(header);
+		image.size = header.size;
+		image.width = header.width;
+		image.height = header.height;
+		image.format = header.format;
+		if( !_camera_image_is_valid(&image) )
+			return 0;
+	}
+	return end;
+}
+
+static int __reader_build(camera_frame_trace_reader_s *reader){
+	_frame_trace_header_s header;
+	const unsigned char *data = reader->data;
+	size_t size = reader->size;
+	uint64_t offset;
+	unsigned int i;
+
+	if( size < sizeof(header) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	memcpy(&header, data, sizeof(header));
+	if( memcmp(header.magic, FRAME_TRACE_MAGIC, sizeof(header.magic)) != 0 || header.version != FRAME_TRACE_VERSION ||
+		header.header_size != sizeof(header) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	if( header.index_offset != 0 && header.record_count > 0 && header.index_offset <= size &&
+		header.record_count <= (size - header.index_offset) / sizeof(_frame_trace_index_entry_s) ){
+		reader->offsets = (uint64_t*)malloc(header.record_count * sizeof(uint64_t));
+		if( reader->offsets == NULL ){
+			LOGE("[%s] malloc fail",__func__);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+		for( i = 0 ; i < header.record_count ; i++ ){
+			_frame_trace_index_entry_s entry;
+			memcpy(&entry, data + header.index_offset + i * sizeof(entry), sizeof(entry));
+			if( entry.offset + sizeof(_frame_trace_record_header_s) > header.index_offset || __reader_check_record(data, size, entry.offset) == 0 )
+				break;
+			reader->offsets[i] = entry.offset;
+		}
+		if( i == header.record_count ){
+			reader->count = i;
+			return CAMERA_ERROR_NONE;
+		}
+		LOGE("[%s] index entry %u is broken, walking the records",__func__, i);
+		free(reader->offsets);
+		reader->offsets = NULL;
+	}
+
+	// no index or a broken one, take the records up to the first that does not check out
+	for( offset = sizeof(header) ; ; ){
+		uint64_t next = __reader_check_record(data, size, offset);
+		if( next == 0 )
+			break;
+		if( reader->count % 256 == 0 ){
+			uint64_t *offsets = (uint64_t*)realloc(reader->offsets, (reader->count + 256) * sizeof(uint64_t));
+			if( offsets == NULL ){
+				LOGE("[%s] malloc fail",__func__);
+				return CAMERA_ERROR_OUT_OF_MEMORY;
+			}
+			reader->offsets = offsets;
+		}
+		reader->offsets[reader->count++] = offset;
+		offset = next;
+	}
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_frame_trace_reader_close(camera_frame_trace_reader_s *reader){
+	if( reader == NULL )
+		return;
+	if( reader->map )
+		munmap(reader->map, reader->map_size);
+	free(reader->offsets);
+	free(reader);
+}
+
+int _camera_frame_trace_reader_open_buffer(const unsigned char *data, size_t size, camera_frame_trace_reader_s **reader){
+	camera_frame_trace_reader_s *handle;
+	int ret;
+
+	if( data == NULL || reader == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	handle = (camera_frame_trace_reader_s*)calloc(1, sizeof(camera_frame_trace_reader_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	handle->data = data;
+	handle->size = size;
+	ret = __reader_build(handle);
+	if( ret != CAMERA_ERROR_NONE ){
+		_camera_frame_trace_reader_close(handle);
+		return ret;
+	}
+	*reader = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_frame_trace_reader_open(const char *path, camera_frame_trace_reader_s **reader){
+	camera_frame_trace_reader_s *handle = NULL;
+	struct stat st;
+	void *map;
+	int fd;
+	int ret;
+
+	if( path == NULL || reader == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	fd = open(path, O_RDONLY);
+	if( fd < 0 ){
+		LOGE("[%s] open %s fail(%d)",__func__, path, errno);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	if( fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(_frame_trace_header_s) || (uint64_t)st.st_size > (size_t)-1 ){
+		close(fd);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	// private and writable, a frame changed in place on its way through the camera stays out of the file
+	map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if( map == MAP_FAILED ){
+		LOGE("[%s] mmap fail(%d)",__func__, errno);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	ret = _camera_frame_trace_reader_open_buffer((const unsigned char*)map, st.st_size, &handle);
+	if( ret != CAMERA_ERROR_NONE ){
+		munmap(map, st.st_size);
+		return ret;
+	}
+	handle->map = (unsigned char*)map;
+	handle->map_size = st.st_size;
+	*reader = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+unsigned int _camera_frame_trace_reader_get_count(camera_frame_trace_reader_s *reader){
+	return reader ? reader->count : 0;
+}
+
+int _camera_frame_trace_reader_get_record(camera_frame_trace_reader_s *reader, unsigned int index, camera_frame_trace_record_s *record){
+	_frame_trace_record_header_s header;
+
+	if( reader == NULL || record == NULL || index >= reader->count )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	memcpy(&header, reader->data + reader->offsets[index], sizeof(header));
+	record->type = header.type;
+	record->image.data = (unsigned char*)reader->data + reader->offsets[index] + sizeof(header);
+	record->image.size = header.size;
+	record->image.width = header.width;
+	record->image.height = header.height;
+	record->image.format = header.format;
+	record->sequence = header.sequence;
+	record->stream_timestamp = header.stream_timestamp;
+	record->timestamp = header.timestamp;
+	return CAMERA_ERROR_NONE;
+}
+
+/* waits until the record is due, returns false when the replay is stopped meanwhile */
+static bool __replay_wait(camera_frame_replay_s *replay, gint64 start, int64_t first, int64_t timestamp){
+	gint64 due;
+	bool stop;
+
+	g_mutex_lock(&replay->lock);
+	if( replay->speed > 0 && timestamp > first ){
+		due = start + (timestamp - first) / replay->speed;
+		while( !replay->stop && g_get_monotonic_time() < due )
+			g_cond_wait_until(&replay->cond, &replay->lock, due);
+	}
+	stop = replay->stop;
+	g_mutex_unlock(&replay->lock);
+	return !stop;
+}
+
+static gpointer __replay_thread(gpointer data){
+	camera_frame_replay_s *replay = (camera_frame_replay_s*)data;
+	camera_frame_trace_record_s record;
+	camera_frame_trace_record_s thumbnail;
+	unsigned int count = _camera_frame_trace_reader_get_count(replay->reader);
+	unsigned int delivered = 0;
+	gint64 start = g_get_monotonic_time();
+	int64_t first = 0;
+	unsigned int i;
+
+	for( i = 0 ; i < count ; i++ ){
+		bool has_thumbnail = false;
+
+		_camera_frame_trace_reader_get_record(replay->reader, i, &record);
+		// a thumbnail without its capture is left out
+		if( record.type == _CAMERA_FRAME_TRACE_THUMBNAIL )
+			continue;
+		if( record.type == _CAMERA_FRAME_TRACE_CAPTURE && i + 1 < count ){
+			_camera_frame_trace_reader_get_record(replay->reader, i + 1, &thumbnail);
+			has_thumbnail = thumbnail.type == _CAMERA_FRAME_TRACE_THUMBNAIL;
+		}
+		if( delivered == 0 )
+			first = record.timestamp;
+		if( !__replay_wait(replay, start, first, record.timestamp) )
+			break;
+		replay->dispatch(&record, has_thumbnail ? &thumbnail : NULL, replay->dispatch_data);
+		delivered++;
+		if( has_thumbnail )
+			i++;
+	}
+	if( replay->completed_cb )
+		replay->completed_cb((int)delivered, replay->completed_data);
+	return NULL;
+}
+
+int _camera_frame_replay_start(const char *path, int speed, camera_frame_replay_dispatch_cb dispatch, void *dispatch_data,
+	camera_frame_replay_completed_cb completed_cb, void *completed_data, camera_frame_replay_s **replay){
+	camera_frame_replay_s *handle;
+	int ret;
+
+	if( path == NULL || speed < 0 || dispatch == NULL || replay == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	handle = (camera_frame_replay_s*)calloc(1, sizeof(camera_frame_replay_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	ret = _camera_frame_trace_reader_open(path, &handle->reader);
+	if( ret != CAMERA_ERROR_NONE ){
+		free(handle);
+		return ret;
+	}
+	g_mutex_init(&handle->lock);
+	g_cond_init(&handle->cond);
+	handle->speed = speed;
+	handle->dispatch = dispatch;
+	handle->dispatch_data = dispatch_data;
+	handle->completed_cb = completed_cb;
+	handle->completed_data = completed_data;
+	handle->thread = g_thread_new("camera_replay", __replay_thread, handle);
+	if( handle->thread == NULL ){
+		LOGE("[%s] thread creation fail",__func__);
+		_camera_frame_trace_reader_close(handle->reader);
+		g_cond_clear(&handle->cond);
+		g_mutex_clear(&handle->lock);
+		free(handle);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	*replay = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_frame_replay_stop(camera_frame_replay_s *replay){
+	if( replay == NULL )
+		return;
+
+	g_mutex_lock(&replay->lock);
+	replay->stop = true;
+	g_cond_signal(&replay->cond);
+	g_mutex_unlock(&replay->lock);
+	g_thread_join(replay->thread);
+
+	_camera_frame_trace_reader_close(replay->reader);
+	g_cond_clear(&replay->cond);
+	g_mutex_clear(&replay->lock);
+	free(replay);
+}
@@ -0,0 +1,1067 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HDR_USE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define HDR_USE_SSE2
+#endif
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+#define HDR_MAX_THREADS 8
+#define HDR_MAX_LEVELS 8
+#define HDR_ALIGN_LEVELS 6
+/* pixels this close to the median are left out of the alignment error, they flip with noise */
+#define HDR_ALIGN_NOISE 4
+#define HDR_MIN_BAND_ROWS 32
+
+/*
+ * Software HDR : the frames of an exposure bracket are converted to I420,
+ * aligned to the first one with median threshold bitmaps, and merged with
+ * Mertens exposure fusion. Each frame gets a per pixel weight from its local
+ * contrast, saturation and well-exposedness, and the frames are blended in
+ * a Laplacian pyramid so that the weight changes do not show as seams.
+ * Pyramids are fixed point, weights are 8 bit and sum to 255 over the frames.
+ */
+
+typedef struct {
+	int width;
+	int height;
+	unsigned char *data;
+} _camera_hdr_plane8_s;
+
+typedef struct {
+	int width;
+	int height;
+	short *data;
+} _camera_hdr_plane16_s;
+
+typedef struct {
+	camera_image_data_s frames[CAMERA_HDR_MAX_FRAMES];
+	int count;
+	int received;
+	int expected;
+	bool failed;
+	camera_pixel_format_e format;
+	int quality;
+	camera_attr_hdr_progress_cb progress_cb;
+	void *progress_user_data;
+	camera_capturing_cb callback;
+	void *user_data;
+} _camera_hdr_job_s;
+
+struct _camera_hdr_s {
+	GThreadPool *fusion;
+	GThreadPool *bands;
+	int threads;
+	GMutex lock;
+	GCond cond;
+	int bands_left;
+	_camera_hdr_job_s *collecting;
+	int generation;	/* bumped when the collecting bracket is replaced or dropped */
+	int pending;
+	int error;	/* first fusion failure not reported yet */
+	camera_capture_completed_cb done_cb;
+	void *done_user_data;
+	camera_error_cb error_cb;
+	void *error_user_data;
+	struct _camera_hdr_done_s *dones;
+};
+
+typedef void (*_camera_hdr_band_func)(void *ctx, int start, int end);
+
+typedef struct {
+	camera_hdr_s *hdr;
+	_camera_hdr_band_func func;
+	void *ctx;
+	int start;
+	int end;
+} _camera_hdr_band_s;
+
+typedef struct _camera_hdr_done_s {
+	camera_hdr_s *hdr;
+	camera_capture_completed_cb callback;
+	void *user_data;
+	int error;
+	camera_error_cb error_cb;
+	void *error_user_data;
+	guint source;
+	struct _camera_hdr_done_s *next;
+} _camera_hdr_done_s;
+
+
+static inline int __clamp(int value, int low, int high){
+	return value < low ? low : (value > high ? high : value);
+}
+
+static void __hdr_band_worker(gpointer data, gpointer user_data){
+	_camera_hdr_band_s *band = (_camera_hdr_band_s*)data;
+	camera_hdr_s *hdr = band->hdr;
+
+	band->func(band->ctx, band->start, band->end);
+
+	g_mutex_lock(&hdr->lock);
+	if( --hdr->bands_left == 0 )
+		g_cond_broadcast(&hdr->cond);
+	g_mutex_unlock(&hdr->lock);
+}
+
+/* splits rows into one band per thread, the calling thread takes the first band */
+static void __hdr_parallel(camera_hdr_s *hdr, _camera_hdr_band_func func, void *ctx, int rows){
+	_camera_hdr_band_s bands[HDR_MAX_THREADS];
+	int count = hdr->threads;
+	int i;
+
+	if( count > rows / HDR_MIN_BAND_ROWS )
+		count = rows / HDR_MIN_BAND_ROWS;
+	if( count <= 1 || hdr->bands == NULL ){
+		func(ctx, 0, rows);
+		return;
+	}
+
+	g_mutex_lock(&hdr->lock);
+	hdr->bands_left = count - 1;
+	g_mutex_unlock(&hdr->lock);
+
+	for( i = 0 ; i < count ; i++ ){
+		bands[i].hdr = hdr;
+		bands[i].func = func;
+		bands[i].ctx = ctx;
+		bands[i].start = rows * i / count;
+		bands[i].end = rows * (i + 1) / count;
+		if( i > 0 )
+			g_thread_pool_push(hdr->bands, &bands[i], NULL);
+	}
+	func(ctx, bands[0].start, bands[0].end);
+
+	g_mutex_lock(&hdr->lock);
+	while( hdr->bands_left > 0 )
+		g_cond_wait(&hdr->cond, &hdr->lock);
+	g_mutex_unlock(&hdr->lock);
+}
+
+static void __hdr_progress(_camera_hdr_job_s *job, int percent){
+	if( job->progress_cb )
+		job->progress_cb(percent, job->progress_user_data);
+}
+
+/*
+ * Alignment. The median threshold bitmap of a frame does not depend on its
+ * exposure, so bitmaps of the bracket can be compared directly. The shift is
+ * searched from the coarsest 2x2 box level down, +-1 pixel per level.
+ */
+typedef struct {
+	const unsigned char *ref;
+	const unsigned char *img;
+	int width;
+	int height;
+	int ref_median;
+	int img_median;
+	int dx;
+	int dy;
+	volatile gint errors[9];
+} _camera_hdr_align_ctx_s;
+
+static void __hdr_box_reduce(const unsigned char *src, int width, int height, unsigned char *dst){
+	int w = width / 2;
+	int h = height / 2;
+	int x;
+	int y;
+
+	for( y = 0 ; y < h ; y++ ){
+		const unsigned char *r0 = src + (y * 2) * width;
+		const unsigned char *r1 = r0 + width;
+		for( x = 0 ; x < w ; x++ )
+			dst[y * w + x] = (r0[x * 2] + r0[x * 2 + 1] + r1[x * 2] + r1[x * 2 + 1] + 2) >> 2;
+	}
+}
+
+static int __hdr_median(const unsigned char *data, int count){
+	unsigned int histogram[256];
+	int sum = 0;
+	int i;
+
+	memset(histogram, 0, sizeof(histogram));
+	for( i = 0 ; i < count ; i++ )
+		histogram[data[i]]++;
+	for( i = 0 ; i < 256 ; i++ ){
+		sum += histogram[i];
+		if( sum * 2 >= count )
+			return i;
+	}
+	return 128;
+}
+
+static void __hdr_align_band(void *data, int start, int end){
+	_camera_hdr_align_ctx_s *ctx = (_camera_hdr_align_ctx_s*)data;
+	int errors[9] = { 0, };
+	int x;
+	int y;
+	int i;
+
+	for( y = start ; y < end ; y++ ){
+		const unsigned char *ref_row = ctx->ref + y * ctx->width;
+		for( i = 0 ; i < 9 ; i++ ){
+			int sx = ctx->dx + i % 3 - 1;
+			int sy = __clamp(y + ctx->dy + i / 3 - 1, 0, ctx->height - 1);
+			const unsigned char *img_row = ctx->img + sy * ctx->width;
+			int x0 = sx < 0 ? -sx : 0;
+			int x1 = sx > 0 ? ctx->width - sx : ctx->width;
+			for( x = x0 ; x < x1 ; x++ ){
+				int r = ref_row[x] - ctx->ref_median;
+				int m = img_row[x + sx] - ctx->img_median;
+				if( r > HDR_ALIGN_NOISE || r < -HDR_ALIGN_NOISE ){
+					if( m > HDR_ALIGN_NOISE || m < -HDR_ALIGN_NOISE )
+						errors[i] += (r > 0) != (m > 0);
+				}
+			}
+		}
+	}
+	for( i = 0 ; i < 9 ; i++ )
+		g_atomic_int_add(&ctx->errors[i], errors[i]);
+}
+
+static int __hdr_find_shift(camera_hdr_s *hdr, unsigned char *ref_levels[], unsigned char *img_levels[], int levels, int width, int height, int *dx, int *dy){
+	_camera_hdr_align_ctx_s ctx;
+	int level;
+	int i;
+
+	ctx.dx = 0;
+	ctx.dy = 0;
+	for( level = levels - 1 ; level >= 0 ; level-- ){
+		int best = 4;
+		memset((void*)ctx.errors, 0, sizeof(ctx.errors));
+		ctx.ref = ref_levels[level];
+		ctx.img = img_levels[level];
+		ctx.width = width >> level;
+		ctx.height = height >> level;
+		ctx.ref_median = __hdr_median(ctx.ref, ctx.width * ctx.height);
+		ctx.img_median = __hdr_median(ctx.img, ctx.width * ctx.height);
+		__hdr_parallel(hdr, __hdr_align_band, &ctx, ctx.height);
+		for( i = 0 ; i < 9 ; i++ ){
+			if( ctx.errors[i] < ctx.errors[best] )
+				best = i;
+		}
+		ctx.dx += best % 3 - 1;
+		ctx.dy += best / 3 - 1;
+		if( level > 0 ){
+			ctx.dx *= 2;
+			ctx.dy *= 2;
+		}
+	}
+	*dx = ctx.dx;
+	*dy = ctx.dy;
+	return CAMERA_ERROR_NONE;
+}
+
+/* dst(x, y) = src(x + dx, y + dy) with replicated edges, done in place */
+static void __hdr_shift_plane(unsigned char *data, int width, int height, int dx, int dy){
+	int y;
+	int i;
+
+	dx = __clamp(dx, -(width - 1), width - 1);
+	for( i = 0 ; i < height ; i++ ){
+		unsigned char *row;
+		y = dy > 0 ? i : height - 1 - i;
+		row = data + y * width;
+		if( dy != 0 )
+			memcpy(row, data + __clamp(y + dy, 0, height - 1) * width, width);
+		if( dx > 0 ){
+			memmove(row, row + dx, width - dx);
+			memset(row + width - dx, row[width - 1], dx - 1);
+		}else if( dx < 0 ){
+			memmove(row - dx, row, width + dx);
+			memset(row + 1, row[0], -dx - 1);
+		}
+	}
+}
+
+static int __hdr_align(camera_hdr_s *hdr, _camera_hdr_job_s *job){
+	unsigned char *levels[CAMERA_HDR_MAX_FRAMES][HDR_ALIGN_LEVELS];
+	unsigned char *pool;
+	int width = job->frames[0].width;
+	int height = job->frames[0].height;
+	int count = 1;
+	unsigned int size = 0;
+	unsigned int offset;
+	int k;
+	int l;
+
+	while( count < HDR_ALIGN_LEVELS && (width >> count) >= 64 && (height >> count) >= 64 )
+		count++;
+	for( l = 1 ; l < count ; l++ )
+		size += (width >> l) * (height >> l);
+	pool = (unsigned char*)malloc(size * job->count + 1);
+	if( pool == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+
+	for( k = 0, offset = 0 ; k < job->count ; k++ ){
+		levels[k][0] = job->frames[k].data;
+		for( l = 1 ; l < count ; l++ ){
+			levels[k][l] = pool + offset;
+			offset += (width >> l) * (height >> l);
+			__hdr_box_reduce(levels[k][l - 1], width >> (l - 1), height >> (l - 1), levels[k][l]);
+		}
+	}
+
+	for( k = 1 ; k < job->count ; k++ ){
+		int dx = 0;
+		int dy = 0;
+		int w2 = width / 2;
+		int h2 = height / 2;
+		__hdr_find_shift(hdr, levels[0], levels[k], count, width, height, &dx, &dy);
+		if( dx != 0 || dy != 0 ){
+			unsigned char *y_plane = job->frames[k].data;
+			LOGI("[%s] frame %d shifted by (%d, %d)",__func__, k, dx, dy);
+			__hdr_shift_plane(y_plane, width, height, dx, dy);
+			__hdr_shift_plane(y_plane + width * height, w2, h2, dx / 2, dy / 2);
+			__hdr_shift_plane(y_plane + width * height + w2 * h2, w2, h2, dx / 2, dy / 2);
+		}
+		__hdr_progress(job, 20 * k / (job->count - 1));
+	}
+
+	free(pool);
+	return CAMERA_ERROR_NONE;
+}
+
+/*
+ * Weights. Well-exposedness is exp(-(y - 0.5)^2 / (2 * 0.2^2)) like the Mertens paper,
+ * built once into a table with (1 + t/256)^-256 so that libm is not needed.
+ */
+typedef struct {
+	_camera_hdr_job_s *job;
+	unsigned char *weights[CAMERA_HDR_MAX_FRAMES];
+	float exposedness[256];
+} _camera_hdr_weight_ctx_s;
+
+static float __hdr_exp_neg(float t){
+	float x = 1.0f / (1.0f + t / 256.0f);
+	int i;
+
+	for( i = 0 ; i < 8 ; i++ )
+		x *= x;
+	return x;
+}
+
+static void __hdr_weight_band(void *data, int start, int end){
+	_camera_hdr_weight_ctx_s *ctx = (_camera_hdr_weight_ctx_s*)data;
+	_camera_hdr_job_s *job = ctx->job;
+	int width = job->frames[0].width;
+	int height = job->frames[0].height;
+	int chroma_width = width / 2;
+	float raw[CAMERA_HDR_MAX_FRAMES];
+	int x;
+	int y;
+	int k;
+
+	for( y = start ; y < end ; y++ ){
+		int up = y > 0 ? -width : 0;
+		int down = y < height - 1 ? width : 0;
+		for( x = 0 ; x < width ; x++ ){
+			int left = x > 0 ? -1 : 0;
+			int right = x < width - 1 ? 1 : 0;
+			float sum = 0.0f;
+			for( k = 0 ; k < job->count ; k++ ){
+				const unsigned char *p = job->frames[k].data + y * width + x;
+				const unsigned char *u = job->frames[k].data + width * height + (y >> 1) * chroma_width + (x >> 1);
+				const unsigned char *v = u + chroma_width * (height / 2);
+				int contrast = abs(4 * p[0] - p[up] - p[down] - p[left] - p[right]);
+				int saturation = abs(u[0] - 128) + abs(v[0] - 128);
+				raw[k] = (contrast + 1) * (saturation + 1) * ctx->exposedness[p[0]] + 1e-6f;
+				sum += raw[k];
+			}
+			for( k = 0 ; k < job->count ; k++ )
+				ctx->weights[k][y * width + x] = (unsigned char)(raw[k] * 255.0f / sum + 0.5f);
+		}
+	}
+}
+
+/*
+ * Pyramids, with the 5 tap binomial kernel.
+ * reduce : coarse[i] = (f[2i-2] + 4 f[2i-1] + 6 f[2i] + 4 f[2i+1] + f[2i+2]) / 16 in both directions
+ * expand : fine[2i] = (c[i-1] + 6 c[i] + c[i+1]) / 8, fine[2i+1] = (c[i] + c[i+1]) / 2
+ */
+typedef struct {
+	const _camera_hdr_plane8_s *src;
+	_camera_hdr_plane8_s *dst;
+	int failed;	/* set by a band that could not get its scratch row */
+} _camera_hdr_reduce_ctx_s;
+
+static void __hdr_reduce_band(void *data, int start, int end){
+	_camera_hdr_reduce_ctx_s *ctx = (_camera_hdr_reduce_ctx_s*)data;
+	const _camera_hdr_plane8_s *src = ctx->src;
+	_camera_hdr_plane8_s *dst = ctx->dst;
+	unsigned short *column = (unsigned short*)malloc(src->width * sizeof(unsigned short));
+	int x;
+	int y;
+
+	if( column == NULL ){
+		g_atomic_int_set(&ctx->failed, 1);
+		return;
+	}
+	for( y = start ; y < end ; y++ ){
+		const unsigned char *r[5];
+		unsigned char *out = dst->data + y * dst->width;
+		int i;
+		for( i = 0 ; i < 5 ; i++ )
+			r[i] = src->data + __clamp(y * 2 + i - 2, 0, src->height - 1) * src->width;
+		for( x = 0 ; x < src->width ; x++ )
+			column[x] = r[0][x] + 4 * r[1][x] + 6 * r[2][x] + 4 * r[3][x] + r[4][x];
+		for( x = 0 ; x < dst->width ; x++ ){
+			int x0 = __clamp(x * 2 - 2, 0, src->width - 1);
+			int x1 = __clamp(x * 2 - 1, 0, src->width - 1);
+			int x2 = __clamp(x * 2, 0, src->width - 1);
+			int x3 = __clamp(x * 2 + 1, 0, src->width - 1);
+			int x4 = __clamp(x * 2 + 2, 0, src->width - 1);
+			out[x] = (column[x0] + 4 * column[x1] + 6 * column[x2] + 4 * column[x3] + column[x4] + 128) >> 8;
+		}
+	}
+	free(column);
+}
+
+static int __hdr_reduce(camera_hdr_s *hdr, const _camera_hdr_plane8_s *src, _camera_hdr_plane8_s *dst){
+	_camera_hdr_reduce_ctx_s ctx = { src, dst, 0 };
+	__hdr_parallel(hdr, __hdr_reduce_band, &ctx, dst->height);
+	return g_atomic_int_get(&ctx.failed) ? CAMERA_ERROR_OUT_OF_MEMORY : CAMERA_ERROR_NONE;
+}
+
+/* expands fine row y from a coarse plane of either 8 or 16 bit samples, column is one coarse width of scratch */
+static void __hdr_expand_row(const unsigned char *coarse8, const short *coarse16, int coarse_width, int coarse_height, int fine_width, int y, int *column, short *out){
+	int i = y / 2;
+	int r0 = __clamp(i - 1, 0, coarse_height - 1);
+	int r2 = __clamp(i + 1, 0, coarse_height - 1);
+	int x;
+
+	/* even rows sit on coarse row i, odd rows half way between i and i + 1 */
+	for( x = 0 ; x < coarse_width ; x++ ){
+		int s0 = coarse8 ? coarse8[r0 * coarse_width + x] : coarse16[r0 * coarse_width + x];
+		int s1 = coarse8 ? coarse8[i * coarse_width + x] : coarse16[i * coarse_width + x];
+		int s2 = coarse8 ? coarse8[r2 * coarse_width + x] : coarse16[r2 * coarse_width + x];
+		column[x] = (y & 1) ? 4 * (s1 + s2) : s0 + 6 * s1 + s2;
+	}
+	for( x = 0 ; x < fine_width ; x++ ){
+		int j = x / 2;
+		int next = j + 1 < coarse_width ? j + 1 : j;
+		int sum;
+		if( x & 1 )
+			sum = 4 * (column[j] + column[next]);
+		else
+			sum = column[j > 0 ? j - 1 : 0] + 6 * column[j] + column[next];
+		out[x] = (sum + 32) >> 6;
+	}
+}
+
+/* acc += (g - e) * w / 255, with w / 255 as a Q15 multiplier */
+static void __hdr_accumulate_row(const unsigned char *g, const short *e, const unsigned char *w, short *acc, int width){
+	int x = 0;
+
+#if defined(HDR_USE_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	for( ; x + 8 <= width ; x += 8 ){
+		__m128i gv = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(g + x)), zero);
+		__m128i wv = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(w + x)), zero);
+		__m128i lap = _mm_slli_epi16(_mm_sub_epi16(gv, _mm_loadu_si128((const __m128i*)(e + x))), 1);
+		__m128i q15 = _mm_add_epi16(_mm_slli_epi16(wv, 7), _mm_srli_epi16(wv, 1));
+		__m128i a = _mm_loadu_si128((const __m128i*)(acc + x));
+		_mm_storeu_si128((__m128i*)(acc + x), _mm_add_epi16(a, _mm_mulhi_epi16(lap, q15)));
+	}
+#elif defined(HDR_USE_NEON)
+	for( ; x + 8 <= width ; x += 8 ){
+		int16x8_t gv = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(g + x)));
+		uint16x8_t wv = vmovl_u8(vld1_u8(w + x));
+		int16x8_t lap = vsubq_s16(gv, vld1q_s16(e + x));
+		int16x8_t q15 = vreinterpretq_s16_u16(vaddq_u16(vshlq_n_u16(wv, 7), vshrq_n_u16(wv, 1)));
+		vst1q_s16(acc + x, vaddq_s16(vld1q_s16(acc + x), vqdmulhq_s16(lap, q15)));
+	}
+#endif
+	for( ; x < width ; x++ ){
+		int q15 = (w[x] << 7) + (w[x] >> 1);
+		acc[x] += ((g[x] - e[x]) * 2 * q15) >> 16;
+	}
+}
+
+typedef struct {
+	const _camera_hdr_plane8_s *gauss;	/* this level */
+	const _camera_hdr_plane8_s *coarser;	/* next level, NULL on the top level */
+	const _camera_hdr_plane8_s *weight;
+	_camera_hdr_plane16_s *acc;
+	int failed;
+} _camera_hdr_blend_ctx_s;
+
+static void __hdr_blend_band(void *data, int start, int end){
+	_camera_hdr_blend_ctx_s *ctx = (_camera_hdr_blend_ctx_s*)data;
+	int width = ctx->gauss->width;
+	int coarse_width = ctx->coarser ? ctx->coarser->width : 1;
+	int *rows = (int*)malloc(coarse_width * sizeof(int));
+	short *expanded = (short*)calloc(width, sizeof(short));
+	int y;
+
+	if( rows == NULL || expanded == NULL ){
+		g_atomic_int_set(&ctx->failed, 1);
+		free(rows);
+		free(expanded);
+		return;
+	}
+	for( y = start ; y < end ; y++ ){
+		if( ctx->coarser )
+			__hdr_expand_row(ctx->coarser->data, NULL, coarse_width, ctx->coarser->height, width, y, rows, expanded);
+		__hdr_accumulate_row(ctx->gauss->data + y * width, expanded, ctx->weight->data + y * width, ctx->acc->data + y * width, width);
+	}
+	free(rows);
+	free(expanded);
+}
+
+typedef struct {
+	_camera_hdr_plane16_s *fine;
+	const _camera_hdr_plane16_s *coarse;
+	unsigned char *out;	/* level 0 only */
+	int failed;
+} _camera_hdr_collapse_ctx_s;
+
+static void __hdr_collapse_band(void *data, int start, int end){
+	_camera_hdr_collapse_ctx_s *ctx = (_camera_hdr_collapse_ctx_s*)data;
+	int width = ctx->fine->width;
+	int *rows = (int*)malloc(ctx->coarse->width * sizeof(int));
+	short *expanded = (short*)malloc(width * sizeof(short));
+	int x;
+	int y;
+
+	if( rows == NULL || expanded == NULL ){
+		g_atomic_int_set(&ctx->failed, 1);
+		free(rows);
+		free(expanded);
+		return;
+	}
+	for( y = start ; y < end ; y++ ){
+		short *fine = ctx->fine->data + y * width;
+		__hdr_expand_row(NULL, ctx->coarse->data, ctx->coarse->width, ctx->coarse->height, width, y, rows, expanded);
+		if( ctx->out ){
+			unsigned char *out = ctx->out + y * width;
+			for( x = 0 ; x < width ; x++ )
+				out[x] = __clamp(fine[x] + expanded[x], 0, 255);
+		}else{
+			for( x = 0 ; x < width ; x++ )
+				fine[x] += expanded[x];
+		}
+	}
+	free(rows);
+	free(expanded);
+}
+
+static int __hdr_level_count(int width, int height){
+	int levels = 1;
+
+	/* the chroma pyramid is one level shorter and its top must stay a few pixels wide */
+	while( levels < HDR_MAX_LEVELS && (width >> levels) >= 16 && (height >> levels) >= 16 )
+		levels++;
+	return levels;
+}
+
+/* blends one plane of every frame, weights starts at the level matching the plane resolution */
+static int __hdr_fuse_plane(camera_hdr_s *hdr, _camera_hdr_job_s *job, int plane_offset, int width, int height, int levels, _camera_hdr_plane8_s weights[][HDR_MAX_LEVELS], int weight_level, unsigned char *out, int progress_from, int progress_to){
+	_camera_hdr_plane8_s gauss[HDR_MAX_LEVELS];
+	_camera_hdr_plane16_s acc[HDR_MAX_LEVELS];
+	int ret = CAMERA_ERROR_NONE;
+	int k;
+	int l;
+
+	memset(gauss, 0, sizeof(gauss));
+	memset(acc, 0, sizeof(acc));
+	for( l = 0 ; l < levels ; l++ ){
+		gauss[l].width = l == 0 ? width : (gauss[l - 1].width + 1) / 2;
+		gauss[l].height = l == 0 ? height : (gauss[l - 1].height + 1) / 2;
+		acc[l].width = gauss[l].width;
+		acc[l].height = gauss[l].height;
+		acc[l].data = (short*)calloc(acc[l].width * acc[l].height, sizeof(short));
+		if( l > 0 )
+			gauss[l].data = (unsigned char*)malloc(gauss[l].width * gauss[l].height);
+		if( acc[l].data == NULL || (l > 0 && gauss[l].data == NULL) ){
+			ret = CAMERA_ERROR_OUT_OF_MEMORY;
+			goto done;
+		}
+	}
+
+	for( k = 0 ; k < job->count ; k++ ){
+		gauss[0].data = job->frames[k].data + plane_offset;
+		for( l = 1 ; l < levels && ret == CAMERA_ERROR_NONE ; l++ )
+			ret = __hdr_reduce(hdr, &gauss[l - 1], &gauss[l]);
+		for( l = 0 ; l < levels && ret == CAMERA_ERROR_NONE ; l++ ){
+			_camera_hdr_blend_ctx_s ctx = { &gauss[l], l + 1 < levels ? &gauss[l + 1] : NULL, &weights[k][l + weight_level], &acc[l], 0 };
+			__hdr_parallel(hdr, __hdr_blend_band, &ctx, gauss[l].height);
+			if( g_atomic_int_get(&ctx.failed) )
+				ret = CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+		if( ret != CAMERA_ERROR_NONE )
+			goto done;
+		__hdr_progress(job, progress_from + (progress_to - progress_from) * (k + 1) / job->count);
+	}
+
+	for( l = levels - 2 ; l >= 0 ; l-- ){
+		_camera_hdr_collapse_ctx_s ctx = { &acc[l], &acc[l + 1], l == 0 ? out : NULL, 0 };
+		__hdr_parallel(hdr, __hdr_collapse_band, &ctx, acc[l].height);
+		if( g_atomic_int_get(&ctx.failed) ){
+			ret = CAMERA_ERROR_OUT_OF_MEMORY;
+			goto done;
+		}
+	}
+	if( levels == 1 ){
+		for( k = 0 ; k < width * height ; k++ )
+			out[k] = __clamp(acc[0].data[k], 0, 255);
+	}
+
+done:
+	for( l = 0 ; l < levels ; l++ ){
+		free(acc[l].data);
+		if( l > 0 )
+			free(gauss[l].data);
+	}
+	return ret;
+}
+
+static int __hdr_fuse(camera_hdr_s *hdr, _camera_hdr_job_s *job, camera_image_data_s *fused){
+	_camera_hdr_weight_ctx_s weight_ctx;
+	_camera_hdr_plane8_s weights[CAMERA_HDR_MAX_FRAMES][HDR_MAX_LEVELS];
+	int width = job->frames[0].width;
+	int height = job->frames[0].height;
+	int levels = __hdr_level_count(width, height);
+	unsigned char *out;
+	int ret;
+	int k;
+	int l;
+	int i;
+
+	for( k = 1 ; k < job->count ; k++ ){
+		if( job->frames[k].width != width || job->frames[k].height != height ){
+			LOGE("[%s] bracket frame %d is %dx%d, expected %dx%d",__func__, k, job->frames[k].width, job->frames[k].height, width, height);
+			return CAMERA_ERROR_INVALID_PARAMETER;
+		}
+	}
+
+	out = (unsigned char*)malloc(width * height * 3 / 2);
+	if( out == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+
+	ret = __hdr_align(hdr, job);
+	if( ret != CAMERA_ERROR_NONE ){
+		free(out);
+		return ret;
+	}
+
+	memset(weights, 0, sizeof(weights));
+	memset(&weight_ctx, 0, sizeof(weight_ctx));
+	weight_ctx.job = job;
+	for( i = 0 ; i < 256 ; i++ ){
+		float d = i / 255.0f - 0.5f;
+		weight_ctx.exposedness[i] = __hdr_exp_neg(d * d / (2.0f * 0.2f * 0.2f));
+	}
+	for( k = 0 ; k < job->count ; k++ ){
+		for( l = 0 ; l < levels ; l++ ){
+			weights[k][l].width = l == 0 ? width : (weights[k][l - 1].width + 1) / 2;
+			weights[k][l].height = l == 0 ? height : (weights[k][l - 1].height + 1) / 2;
+			weights[k][l].data = (unsigned char*)malloc(weights[k][l].width * weights[k][l].height);
+			if( weights[k][l].data == NULL ){
+				ret = CAMERA_ERROR_OUT_OF_MEMORY;
+				goto done;
+			}
+		}
+		weight_ctx.weights[k] = weights[k][0].data;
+	}
+	__hdr_parallel(hdr, __hdr_weight_band, &weight_ctx, height);
+	for( k = 0 ; k < job->count ; k++ ){
+		for( l = 1 ; l < levels && ret == CAMERA_ERROR_NONE ; l++ )
+			ret = __hdr_reduce(hdr, &weights[k][l - 1], &weights[k][l]);
+	}
+	if( ret != CAMERA_ERROR_NONE )
+		goto done;
+	__hdr_progress(job, 30);
+
+	/* luma uses weight levels from 0, the half resolution chroma from 1 */
+	ret = __hdr_fuse_plane(hdr, job, 0, width, height, levels, weights, 0, out, 30, 70);
+	if( ret == CAMERA_ERROR_NONE && levels > 1 )
+		ret = __hdr_fuse_plane(hdr, job, width * height, width / 2, height / 2, levels - 1, weights, 1, out + width * height, 70, 80);
+	if( ret == CAMERA_ERROR_NONE && levels > 1 )
+		ret = __hdr_fuse_plane(hdr, job, width * height * 5 / 4, width / 2, height / 2, levels - 1, weights, 1, out + width * height * 5 / 4, 80, 90);
+	if( ret == CAMERA_ERROR_NONE && levels == 1 )
+		memcpy(out + width * height, job->frames[0].data + width * height, width * height / 2);
+
+done:
+	for( k = 0 ; k < job->count ; k++ ){
+		for( l = 0 ; l < levels ; l++ )
+			free(weights[k][l].data);
+	}
+	if( ret != CAMERA_ERROR_NONE ){
+		free(out);
+		return ret;
+	}
+	fused->data = out;
+	fused->size = width * height * 3 / 2;
+	fused->width = width;
+	fused->height = height;
+	fused->format = CAMERA_PIXEL_FORMAT_I420;
+	return CAMERA_ERROR_NONE;
+}
+
+/* brings the fused I420 image back to the format of the captured frames */
+static int __hdr_convert_output(camera_image_data_s *fused, camera_pixel_format_e format, int quality){
+	int w = fused->width;
+	int h = fused->height;
+	unsigned char *y_plane = fused->data;
+	unsigned char *u_plane = y_plane + w * h;
+	unsigned char *v_plane = u_plane + w * h / 4;
+	unsigned char *out;
+	unsigned int size;
+	int x;
+	int y;
+
+	switch( format ){
+		case CAMERA_PIXEL_FORMAT_JPEG:
+		{
+			unsigned char *jpeg = NULL;
+			unsigned int jpeg_size = 0;
+			int ret = _camera_jpeg_encode(fused, quality, &jpeg, &jpeg_size);
+			if( ret != CAMERA_ERROR_NONE )
+				return ret;
+			free(fused->data);
+			fused->data = jpeg;
+			fused->size = jpeg_size;
+			fused->format = CAMERA_PIXEL_FORMAT_JPEG;
+			return CAMERA_ERROR_NONE;
+		}
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		case CAMERA_PIXEL_FORMAT_YV12:
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+			break;
+		default:
+			return CAMERA_ERROR_NONE;
+	}
+
+	size = _camera_get_image_size(format, w, h);
+	out = (unsigned char*)malloc(size);
+	if( out == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+
+	if( format == CAMERA_PIXEL_FORMAT_YUYV || format == CAMERA_PIXEL_FORMAT_UYVY ){
+		int yo = format == CAMERA_PIXEL_FORMAT_UYVY ? 1 : 0;
+		for( y = 0 ; y < h ; y++ ){
+			unsigned char *d = out + y * w * 2;
+			const unsigned char *yr = y_plane + y * w;
+			const unsigned char *ur = u_plane + (y >> 1) * (w >> 1);
+			const unsigned char *vr = v_plane + (y >> 1) * (w >> 1);
+			for( x = 0 ; x < w ; x += 2, d += 4 ){
+				d[yo] = yr[x];
+				d[yo + 2] = yr[x + 1];
+				d[1 - yo] = ur[x >> 1];
+				d[3 - yo] = vr[x >> 1];
+			}
+		}
+	}else{
+		memcpy(out, y_plane, w * h);
+		if( format == CAMERA_PIXEL_FORMAT_YV12 ){
+			memcpy(out + w * h, v_plane, w * h / 4);
+			memcpy(out + w * h + w * h / 4, u_plane, w * h / 4);
+		}else{
+			const unsigned char *first = format == CAMERA_PIXEL_FORMAT_NV12 ? u_plane : v_plane;
+			const unsigned char *second = format == CAMERA_PIXEL_FORMAT_NV12 ? v_plane : u_plane;
+			unsigned char *d = out + w * h;
+			for( x = 0 ; x < w * h / 4 ; x++ ){
+				d[x * 2] = first[x];
+				d[x * 2 + 1] = second[x];
+			}
+		}
+	}
+
+	free(fused->data);
+	fused->data = out;
+	fused->size = size;
+	fused->format = format;
+	return CAMERA_ERROR_NONE;
+}
+
+static void __hdr_job_free(_camera_hdr_job_s *job){
+	int k;
+
+	if( job == NULL )
+		return;
+	for( k = 0 ; k < job->count ; k++ )
+		free(job->frames[k].data);
+	free(job);
+}
+
+static gboolean __hdr_done_cb(gpointer data){
+	_camera_hdr_done_s *done = (_camera_hdr_done_s*)data;
+	camera_hdr_s *hdr = done->hdr;
+	_camera_hdr_done_s **link;
+
+	g_mutex_lock(&hdr->lock);
+	for( link = &hdr->dones ; *link != done ; link = &(*link)->next )
+		;
+	*link = done->next;
+	g_mutex_unlock(&hdr->lock);
+	/* the fused image was not delivered, the error comes first so the completion is not taken as a success */
+	if( done->error != CAMERA_ERROR_NONE && done->error_cb )
+		done->error_cb(done->error, CAMERA_STATE_CAPTURED, done->error_user_data);
+	if( done->callback )
+		done->callback(done->user_data);
+	free(done);
+	return FALSE;
+}
+
+/* called with the lock held, hands the completion and any fusion error to the main loop */
+static void __hdr_queue_done(camera_hdr_s *hdr){
+	_camera_hdr_done_s *done = (_camera_hdr_done_s*)malloc(sizeof(_camera_hdr_done_s));
+
+	/* the source is kept so that destroying the fusion can take a notification not run yet back */
+	if( done ){
+		done->hdr = hdr;
+		done->callback = hdr->done_cb;
+		done->user_data = hdr->done_user_data;
+		done->error = hdr->error;
+		done->error_cb = hdr->error_cb;
+		done->error_user_data = hdr->error_user_data;
+		done->source = g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __hdr_done_cb, done, NULL);
+		done->next = hdr->dones;
+		hdr->dones = done;
+	}
+	hdr->done_cb = NULL;
+	hdr->done_user_data = NULL;
+	hdr->error_cb = NULL;
+	hdr->error_user_data = NULL;
+	hdr->error = CAMERA_ERROR_NONE;
+}
+
+static void __hdr_fusion_worker(gpointer data, gpointer user_data){
+	_camera_hdr_job_s *job = (_camera_hdr_job_s*)data;
+	camera_hdr_s *hdr = (camera_hdr_s*)user_data;
+	camera_image_data_s fused = { NULL, 0, 0, 0, 0 };
+	gint64 start = g_get_monotonic_time();
+	int ret = CAMERA_ERROR_INVALID_OPERATION;
+
+	if( !job->failed ){
+		ret = __hdr_fuse(hdr, job, &fused);
+		if( ret == CAMERA_ERROR_NONE )
+			ret = __hdr_convert_output(&fused, job->format, job->quality);
+	}
+	if( ret == CAMERA_ERROR_NONE ){
+		LOGI("[%s] %d frames %dx%d fused in %lld ms",__func__, job->count, fused.width, fused.height, (g_get_monotonic_time() - start) / 1000);
+		__hdr_progress(job, 100);
+		if( job->callback )
+			job->callback(&fused, NULL, NULL, job->user_data);
+	}else{
+		LOGE("[%s] HDR fusion fail(0x%08x)",__func__, ret);
+	}
+	free(fused.data);
+	__hdr_job_free(job);
+
+	g_mutex_lock(&hdr->lock);
+	if( ret != CAMERA_ERROR_NONE && hdr->error == CAMERA_ERROR_NONE )
+		hdr->error = ret;
+	hdr->pending--;
+	if( hdr->pending == 0 && hdr->done_cb )
+		__hdr_queue_done(hdr);
+	g_mutex_unlock(&hdr->lock);
+}
+
+int _camera_hdr_create(camera_hdr_s **hdr){
+	camera_hdr_s *new_hdr;
+
+	if( hdr == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	new_hdr = (camera_hdr_s*)calloc(1, sizeof(camera_hdr_s));
+	if( new_hdr == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+
+	new_hdr->threads = g_get_num_processors();
+	if( new_hdr->threads < 1 )
+		new_hdr->threads = 1;
+	if( new_hdr->threads > HDR_MAX_THREADS )
+		new_hdr->threads = HDR_MAX_THREADS;
+
+	g_mutex_init(&new_hdr->lock);
+	g_cond_init(&new_hdr->cond);
+	new_hdr->fusion = g_thread_pool_new(__hdr_fusion_worker, new_hdr, 1, TRUE, NULL);
+	/* the fusion thread works on a band too, so one thread less is needed */
+	if( new_hdr->threads > 1 )
+		new_hdr->bands = g_thread_pool_new(__hdr_band_worker, NULL, new_hdr->threads - 1, TRUE, NULL);
+	if( new_hdr->fusion == NULL || (new_hdr->threads > 1 && new_hdr->bands == NULL) ){
+		LOGE("[%s] thread pool creation fail",__func__);
+		if( new_hdr->fusion )
+			g_thread_pool_free(new_hdr->fusion, TRUE, TRUE);
+		g_cond_clear(&new_hdr->cond);
+		g_mutex_clear(&new_hdr->lock);
+		free(new_hdr);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	*hdr = new_hdr;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_hdr_destroy(camera_hdr_s *hdr){
+	_camera_hdr_job_s *job;
+
+	if( hdr == NULL )
+		return;
+
+	/* a bracket already captured is still fused and delivered */
+	g_thread_pool_free(hdr->fusion, FALSE, TRUE);
+	if( hdr->bands )
+		g_thread_pool_free(hdr->bands, FALSE, TRUE);
+	g_mutex_lock(&hdr->lock);
+	job = hdr->collecting;
+	hdr->collecting = NULL;
+	g_mutex_unlock(&hdr->lock);
+	__hdr_job_free(job);
+	/* the camera is gone, a completion still queued on the main loop is dropped */
+	while( hdr->dones ){
+		_camera_hdr_done_s *done = hdr->dones;
+		g_source_remove(done->source);
+		hdr->dones = done->next;
+		free(done);
+	}
+	g_cond_clear(&hdr->cond);
+	g_mutex_clear(&hdr->lock);
+	free(hdr);
+}
+
+int _camera_hdr_start(camera_hdr_s *hdr, int frames, int quality, camera_attr_hdr_progress_cb progress_cb, void *progress_user_data, camera_capturing_cb callback, void *user_data){
+	_camera_hdr_job_s *job;
+	_camera_hdr_job_s *old;
+
+	if( hdr == NULL || frames < 2 || frames > CAMERA_HDR_MAX_FRAMES )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	job = (_camera_hdr_job_s*)calloc(1, sizeof(_camera_hdr_job_s));
+	if( job == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	job->expected = frames;
+	job->quality = quality;
+	job->progress_cb = progress_cb;
+	job->progress_user_data = progress_user_data;
+	job->callback = callback;
+	job->user_data = user_data;
+
+	/* a bracket cut short by an earlier error is dropped */
+	g_mutex_lock(&hdr->lock);
+	old = hdr->collecting;
+	hdr->collecting = job;
+	hdr->generation++;
+	/* an error nobody asked the completion of is stale once a new bracket starts */
+	if( hdr->pending == 0 )
+		hdr->error = CAMERA_ERROR_NONE;
+	g_mutex_unlock(&hdr->lock);
+	__hdr_job_free(old);
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_hdr_push(camera_hdr_s *hdr, camera_image_data_s *image){
+	_camera_hdr_job_s *job;
+	int generation;
+	int ret;
+
+	if( hdr == NULL || image == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	/* the bracket is taken out while the frame is decoded, a cancel meanwhile bumps the generation */
+	g_mutex_lock(&hdr->lock);
+	job = hdr->collecting;
+	hdr->collecting = NULL;
+	generation = hdr->generation;
+	g_mutex_unlock(&hdr->lock);
+	if( job == NULL )
+		return CAMERA_ERROR_INVALID_STATE;
+
+	if( job->received == 0 )
+		job->format = image->format;
+	job->received++;
+	ret = _camera_jpeg_to_i420(image, &job->frames[job->count]);
+	if( ret == CAMERA_ERROR_NONE ){
+		job->count++;
+	}else{
+		LOGE("[%s] bracket frame %d conversion fail(0x%08x)",__func__, job->received - 1, ret);
+		job->failed = true;
+	}
+	g_mutex_lock(&hdr->lock);
+	if( hdr->generation != generation ){
+		g_mutex_unlock(&hdr->lock);
+		__hdr_job_free(job);
+		return ret;
+	}
+	/* the whole burst is consumed even after a failure, the fusion thread then drops it */
+	if( job->received < job->expected ){
+		hdr->collecting = job;
+		g_mutex_unlock(&hdr->lock);
+		return ret;
+	}
+	hdr->pending++;
+	g_mutex_unlock(&hdr->lock);
+	__hdr_progress(job, 0);
+	g_thread_pool_push(hdr->fusion, job, NULL);
+	return ret;
+}
+
+void _camera_hdr_cancel(camera_hdr_s *hdr){
+	_camera_hdr_job_s *job;
+
+	if( hdr == NULL )
+		return;
+
+	/* only a bracket still collecting frames, one handed to the fusion thread is finished */
+	g_mutex_lock(&hdr->lock);
+	job = hdr->collecting;
+	hdr->collecting = NULL;
+	hdr->generation++;
+	g_mutex_unlock(&hdr->lock);
+	__hdr_job_free(job);
+}
+
+bool _camera_hdr_set_done_cb(camera_hdr_s *hdr, camera_capture_completed_cb callback, void *user_data, camera_error_cb error_cb, void *error_user_data){
+	bool pending;
+
+	if( hdr == NULL )
+		return false;
+
+	g_mutex_lock(&hdr->lock);
+	/* a fusion that already failed still has its error reported ahead of the completion */
+	pending = hdr->pending > 0 || hdr->error != CAMERA_ERROR_NONE;
+	if( pending ){
+		hdr->done_cb = callback;
+		hdr->done_user_data = user_data;
+		hdr->error_cb = error_cb;
+		hdr->error_user_data = error_user_data;
+		if( hdr->pending == 0 )
+			__hdr_queue_done(hdr);
+	}
+	g_mutex_unlock(&hdr->lock);
+
+	return pending;
+}
@@ -0,0 +1,164 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+
+unsigned int _camera_get_image_size(camera_pixel_format_e format, int width, int height){
+	unsigned int pixels;
+
+	if( width <= 0 || height <= 0 || width > 16384 || height > 16384 )
+		return 0;
+
+	pixels = (unsigned int)width * (unsigned int)height;
+	switch( format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV12T:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+			if( (width & 1) || (height & 1) )
+				return 0;
+			return pixels * 3 / 2;
+		case CAMERA_PIXEL_FORMAT_NV16:
+		case CAMERA_PIXEL_FORMAT_422P:
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+			if( width & 1 )
+				return 0;
+			return pixels * 2;
+		case CAMERA_PIXEL_FORMAT_RGB565:
+			return pixels * 2;
+		case CAMERA_PIXEL_FORMAT_RGB888:
+			return pixels * 3;
+		case CAMERA_PIXEL_FORMAT_RGBA:
+		case CAMERA_PIXEL_FORMAT_ARGB:
+			return pixels * 4;
+		default:
+			return 0;
+	}
+}
+
+bool _camera_image_is_valid(camera_image_data_s *image){
+	unsigned int size;
+
+	if( image == NULL || image->data == NULL )
+		return false;
+
+	size = _camera_get_image_size(image->format, image->width, image->height);
+	return size != 0 && image->size >= size;
+}
+
+int _camera_image_copy(camera_image_data_s *dst, camera_image_data_s *src){
+	if( dst == NULL || src == NULL || src->data == NULL || src->size == 0 )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	*dst = *src;
+	dst->data = (unsigned char*)malloc(src->size);
+	if( dst->data == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	memcpy(dst->data, src->data, src->size);
+	return CAMERA_ERROR_NONE;
+}
+
+static void __crop_plane(const unsigned char *src, int src_stride, unsigned char *dst, int dst_stride, int rows){
+	int y;
+
+	for( y = 0 ; y < rows ; y++ )
+		memcpy(dst + y * dst_stride, src + y * src_stride, dst_stride);
+}
+
+/* x and y have to be even for the formats with subsampled chroma, dst->data holds the result */
+int _camera_image_crop(camera_image_data_s *src, int x, int y, int width, int height, camera_image_data_s *dst){
+	unsigned int size;
+	int w = src->width;
+	int h = src->height;
+	int bpp = 0;
+	unsigned char *s = src->data;
+	unsigned char *d = dst->data;
+
+	if( x < 0 || y < 0 || x + width > w || y + height > h || d == NULL || !_camera_image_is_valid(src) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	size = _camera_get_image_size(src->format, width, height);
+	// every format up to YV12 has horizontally subsampled chroma
+	if( size == 0 || (src->format <= CAMERA_PIXEL_FORMAT_YV12 && (x & 1)) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	switch( src->format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+			if( y & 1 )
+				return CAMERA_ERROR_INVALID_PARAMETER;
+			__crop_plane(s + y * w + x, w, d, width, height);
+			s += w * h;
+			d += width * height;
+			if( src->format == CAMERA_PIXEL_FORMAT_NV12 || src->format == CAMERA_PIXEL_FORMAT_NV21 ){
+				__crop_plane(s + y / 2 * w + x, w, d, width, height / 2);
+			}else{
+				__crop_plane(s + y / 2 * (w / 2) + x / 2, w / 2, d, width / 2, height / 2);
+				__crop_plane(s + w * h / 4 + y / 2 * (w / 2) + x / 2, w / 2, d + width * height / 4, width / 2, height / 2);
+			}
+			break;
+		case CAMERA_PIXEL_FORMAT_NV16:
+			__crop_plane(s + y * w + x, w, d, width, height);
+			__crop_plane(s + w * h + y * w + x, w, d + width * height, width, height);
+			break;
+		case CAMERA_PIXEL_FORMAT_422P:
+			__crop_plane(s + y * w + x, w, d, width, height);
+			s += w * h;
+			d += width * height;
+			__crop_plane(s + y * (w / 2) + x / 2, w / 2, d, width / 2, height);
+			__crop_plane(s + w * h / 2 + y * (w / 2) + x / 2, w / 2, d + width * height / 2, width / 2, height);
+			break;
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+		case CAMERA_PIXEL_FORMAT_RGB565:
+			bpp = 2;
+			break;
+		case CAMERA_PIXEL_FORMAT_RGB888:
+			bpp = 3;
+			break;
+		case CAMERA_PIXEL_FORMAT_RGBA:
+		case CAMERA_PIXEL_FORMAT_ARGB:
+			bpp = 4;
+			break;
+		default:
+			return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	if( bpp > 0 )
+		__crop_plane(s + (y * w + x) * bpp, w * bpp, d, width * bpp, height);
+
+	dst->size = size;
+	dst->width = width;
+	dst->height = height;
+	dst->format = src->format;
+	return CAMERA_ERROR_NONE;
+}
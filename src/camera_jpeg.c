@@ -0,0 +1,847 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <jpeglib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <glib.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* each worker may hold one shot plus one waiting in the queue */
+#define JPEG_ENCODER_JOBS_PER_THREAD 2
+#define JPEG_ENCODER_MAX_THREADS 8
+/* a decoded capture larger than this is refused, the same bound as _camera_get_image_size() */
+#define JPEG_DECODE_MAX_DIMENSION 16384
+
+typedef struct {
+	unsigned int seq;
+	camera_image_data_s image;
+	camera_image_data_s thumbnail;
+	camera_image_data_s postview;
+	bool has_thumbnail;
+	bool has_postview;
+	int quality;
+	bool encode;
+	int thumbnail_width;
+	int thumbnail_height;
+	camera_capturing_cb callback;
+	void *user_data;
+	bool done;
+} _camera_jpeg_job_s;
+
+struct _camera_jpeg_encoder_s {
+	GThreadPool *pool;
+	GMutex lock;
+	GCond cond;
+	_camera_jpeg_job_s **slots;
+	int slot_count;
+	unsigned int next_seq;
+	unsigned int deliver_seq;
+	int outstanding;
+	bool delivering;
+	camera_capture_completed_cb drain_cb;
+	void *drain_user_data;
+	struct _camera_jpeg_drain_s *drains;
+};
+
+typedef struct _camera_jpeg_drain_s {
+	camera_jpeg_encoder_s *encoder;
+	camera_capture_completed_cb callback;
+	void *user_data;
+	guint source;
+	struct _camera_jpeg_drain_s *next;
+} _camera_jpeg_drain_s;
+
+typedef struct {
+	struct jpeg_error_mgr pub;
+	jmp_buf jump;
+} _camera_jpeg_error_s;
+
+
+static void __jpeg_error_exit(j_common_ptr cinfo){
+	_camera_jpeg_error_s *err = (_camera_jpeg_error_s*)cinfo->err;
+	char msg[JMSG_LENGTH_MAX];
+	(*cinfo->err->format_message)(cinfo, msg);
+	LOGE("[%s] libjpeg error : %s",__func__, msg);
+	longjmp(err->jump, 1);
+}
+
+static inline void __put_ycc(JSAMPLE *dst, int y, int u, int v){
+	dst[0] = y;
+	dst[1] = u;
+	dst[2] = v;
+}
+
+static inline void __put_rgb(JSAMPLE *dst, int r, int g, int b){
+	dst[0] = r;
+	dst[1] = g;
+	dst[2] = b;
+}
+
+/* expands one source row into the interleaved YCbCr or RGB scanline libjpeg expects */
+static void __fill_scanline(camera_image_data_s *src, int row, JSAMPLE *line){
+	int w = src->width;
+	int h = src->height;
+	unsigned char *data = src->data;
+	unsigned char *y_row = data + row * w;
+	unsigned char *c_row;
+	unsigned char *u_row;
+	unsigned char *v_row;
+	int x;
+
+	switch( src->format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		{
+			int u_off = src->format == CAMERA_PIXEL_FORMAT_NV12 ? 0 : 1;
+			c_row = data + w * h + (row >> 1) * w;
+			for( x = 0 ; x < w ; x++ )
+				__put_ycc(line + x * 3, y_row[x], c_row[(x & ~1) + u_off], c_row[(x & ~1) + (u_off ^ 1)]);
+			break;
+		}
+		case CAMERA_PIXEL_FORMAT_NV16:
+			c_row = data + w * h + row * w;
+			for( x = 0 ; x < w ; x++ )
+				__put_ycc(line + x * 3, y_row[x], c_row[x & ~1], c_row[x | 1]);
+			break;
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+		{
+			unsigned char *p1 = data + w * h + (row >> 1) * (w >> 1);
+			unsigned char *p2 = p1 + (w >> 1) * (h >> 1);
+			u_row = src->format == CAMERA_PIXEL_FORMAT_I420 ? p1 : p2;
+			v_row = src->format == CAMERA_PIXEL_FORMAT_I420 ? p2 : p1;
+			for( x = 0 ; x < w ; x++ )
+				__put_ycc(line + x * 3, y_row[x], u_row[x >> 1], v_row[x >> 1]);
+			break;
+		}
+		case CAMERA_PIXEL_FORMAT_422P:
+			u_row = data + w * h + row * (w >> 1);
+			v_row = u_row + (w >> 1) * h;
+			for( x = 0 ; x < w ; x++ )
+				__put_ycc(line + x * 3, y_row[x], u_row[x >> 1], v_row[x >> 1]);
+			break;
+		case CAMERA_PIXEL_FORMAT_YUYV:
+			c_row = data + row * w * 2;
+			for( x = 0 ; x < w ; x += 2, c_row += 4 ){
+				__put_ycc(line + x * 3, c_row[0], c_row[1], c_row[3]);
+				__put_ycc(line + x * 3 + 3, c_row[2], c_row[1], c_row[3]);
+			}
+			break;
+		case CAMERA_PIXEL_FORMAT_UYVY:
+			c_row = data + row * w * 2;
+			for( x = 0 ; x < w ; x += 2, c_row += 4 ){
+				__put_ycc(line + x * 3, c_row[1], c_row[0], c_row[2]);
+				__put_ycc(line + x * 3 + 3, c_row[3], c_row[0], c_row[2]);
+			}
+			break;
+		case CAMERA_PIXEL_FORMAT_RGB888:
+			memcpy(line, data + row * w * 3, w * 3);
+			break;
+		case CAMERA_PIXEL_FORMAT_RGBA:
+			c_row = data + row * w * 4;
+			for( x = 0 ; x < w ; x++, c_row += 4 )
+				__put_rgb(line + x * 3, c_row[0], c_row[1], c_row[2]);
+			break;
+		case CAMERA_PIXEL_FORMAT_ARGB:
+			c_row = data + row * w * 4;
+			for( x = 0 ; x < w ; x++, c_row += 4 )
+				__put_rgb(line + x * 3, c_row[1], c_row[2], c_row[3]);
+			break;
+		case CAMERA_PIXEL_FORMAT_RGB565:
+			c_row = data + row * w * 2;
+			for( x = 0 ; x < w ; x++, c_row += 2 ){
+				int p = c_row[0] | (c_row[1] << 8);
+				__put_rgb(line + x * 3, ((p >> 11) & 0x1f) << 3, ((p >> 5) & 0x3f) << 2, (p & 0x1f) << 3);
+			}
+			break;
+		default:
+			memset(line, 0, w * 3);
+			break;
+	}
+}
+
+bool _camera_jpeg_is_supported_format(camera_pixel_format_e format){
+	switch( format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV16:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+		case CAMERA_PIXEL_FORMAT_422P:
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+		case CAMERA_PIXEL_FORMAT_RGB565:
+		case CAMERA_PIXEL_FORMAT_RGB888:
+		case CAMERA_PIXEL_FORMAT_RGBA:
+		case CAMERA_PIXEL_FORMAT_ARGB:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/* compresses either a camera frame (src) or an interleaved 3 component buffer (pixels) */
+static int __jpeg_compress(camera_image_data_s *src, JSAMPLE *pixels, int width, int height, J_COLOR_SPACE color_space, int quality, unsigned char **jpeg, unsigned int *jpeg_size){
+	struct jpeg_compress_struct cinfo;
+	_camera_jpeg_error_s jerr;
+	unsigned char *out = NULL;
+	unsigned long out_size = 0;
+	JSAMPLE *line = NULL;
+	JSAMPROW row[1];
+
+	if( src ){
+		line = (JSAMPLE*)malloc(width * 3);
+		if( line == NULL )
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+
+	cinfo.err = jpeg_std_error(&jerr.pub);
+	jerr.pub.error_exit = __jpeg_error_exit;
+	if( setjmp(jerr.jump) ){
+		jpeg_destroy_compress(&cinfo);
+		free(out);
+		free(line);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	jpeg_create_compress(&cinfo);
+	jpeg_mem_dest(&cinfo, &out, &out_size);
+
+	cinfo.image_width = width;
+	cinfo.image_height = height;
+	cinfo.input_components = 3;
+	cinfo.in_color_space = color_space;
+	jpeg_set_defaults(&cinfo);
+	jpeg_set_quality(&cinfo, quality < 1 ? 1 : (quality > 100 ? 100 : quality), TRUE);
+	cinfo.dct_method = JDCT_IFAST;
+	jpeg_start_compress(&cinfo, TRUE);
+
+	while( cinfo.next_scanline < cinfo.image_height ){
+		if( src ){
+			__fill_scanline(src, cinfo.next_scanline, line);
+			row[0] = line;
+		}else{
+			row[0] = pixels + cinfo.next_scanline * width * 3;
+		}
+		jpeg_write_scanlines(&cinfo, row, 1);
+	}
+
+	jpeg_finish_compress(&cinfo);
+	jpeg_destroy_compress(&cinfo);
+	free(line);
+
+	*jpeg = out;
+	*jpeg_size = out_size;
+	return CAMERA_ERROR_NONE;
+}
+
+static J_COLOR_SPACE __jpeg_color_space(camera_pixel_format_e format){
+	switch( format ){
+		case CAMERA_PIXEL_FORMAT_RGB565:
+		case CAMERA_PIXEL_FORMAT_RGB888:
+		case CAMERA_PIXEL_FORMAT_RGBA:
+		case CAMERA_PIXEL_FORMAT_ARGB:
+			return JCS_RGB;
+		default:
+			return JCS_YCbCr;
+	}
+}
+
+int _camera_jpeg_encode(camera_image_data_s *src, int quality, unsigned char **jpeg, unsigned int *jpeg_size){
+	if( src == NULL || jpeg == NULL || jpeg_size == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	if( !_camera_jpeg_is_supported_format(src->format) || !_camera_image_is_valid(src) ){
+		LOGE("[%s] unsupported source image(format %d, %dx%d, size %u)",__func__, src->format, src->width, src->height, src->size);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	return __jpeg_compress(src, NULL, src->width, src->height, __jpeg_color_space(src->format), quality, jpeg, jpeg_size);
+}
+
+/* BT.601 full range, the same matrix libjpeg uses */
+static void __rgb_line_to_ycc(JSAMPLE *line, int width){
+	int x;
+
+	for( x = 0 ; x < width ; x++, line += 3 ){
+		int r = line[0];
+		int g = line[1];
+		int b = line[2];
+		line[0] = (19595 * r + 38470 * g + 7471 * b + 32768) >> 16;
+		line[1] = (-11059 * r - 21709 * g + 32768 * b + 8421376) >> 16;
+		line[2] = (32768 * r - 27439 * g - 5329 * b + 8421376) >> 16;
+	}
+}
+
+/* two interleaved YCbCr lines become one I420 luma row pair and one chroma row */
+static void __ycc_lines_to_i420(const JSAMPLE *line0, const JSAMPLE *line1, int width, unsigned char *y0, unsigned char *y1, unsigned char *u, unsigned char *v){
+	int x;
+
+	for( x = 0 ; x < width ; x += 2, line0 += 6, line1 += 6 ){
+		y0[x] = line0[0];
+		y0[x + 1] = line0[3];
+		y1[x] = line1[0];
+		y1[x + 1] = line1[3];
+		u[x >> 1] = (line0[1] + line0[4] + line1[1] + line1[4] + 2) >> 2;
+		v[x >> 1] = (line0[2] + line0[5] + line1[2] + line1[5] + 2) >> 2;
+	}
+}
+
+int _camera_jpeg_to_i420(camera_image_data_s *src, camera_image_data_s *i420){
+	struct jpeg_decompress_struct cinfo;
+	_camera_jpeg_error_s jerr;
+	JSAMPLE *lines = NULL;
+	JSAMPROW row[1];
+	unsigned char *out = NULL;
+	bool decode;
+	int width;
+	int height;
+	int y;
+
+	if( src == NULL || src->data == NULL || i420 == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	decode = src->format == CAMERA_PIXEL_FORMAT_JPEG;
+	if( !decode && (!_camera_jpeg_is_supported_format(src->format) || !_camera_image_is_valid(src)) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	cinfo.err = jpeg_std_error(&jerr.pub);
+	jerr.pub.error_exit = __jpeg_error_exit;
+	if( setjmp(jerr.jump) ){
+		jpeg_destroy_decompress(&cinfo);
+		free(lines);
+		free(out);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	jpeg_create_decompress(&cinfo);
+
+	if( decode ){
+		jpeg_mem_src(&cinfo, src->data, src->size);
+		jpeg_read_header(&cinfo, TRUE);
+		cinfo.out_color_space = JCS_YCbCr;
+		// the header is not trusted, libjpeg takes up to JPEG_MAX_DIMENSION (65500)
+		if( cinfo.image_width > JPEG_DECODE_MAX_DIMENSION || cinfo.image_height > JPEG_DECODE_MAX_DIMENSION ){
+			jpeg_destroy_decompress(&cinfo);
+			return CAMERA_ERROR_INVALID_PARAMETER;
+		}
+		jpeg_start_decompress(&cinfo);
+		if( cinfo.output_components != 3 ){
+			jpeg_destroy_decompress(&cinfo);
+			return CAMERA_ERROR_INVALID_PARAMETER;
+		}
+		width = cinfo.output_width;
+		height = cinfo.output_height;
+	}else{
+		width = src->width;
+		height = src->height;
+	}
+	if( width < 2 || height < 2 || width > JPEG_DECODE_MAX_DIMENSION || height > JPEG_DECODE_MAX_DIMENSION ){
+		jpeg_destroy_decompress(&cinfo);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	/* an odd last row or column is dropped, I420 needs even dimensions */
+	lines = (JSAMPLE*)malloc((size_t)width * 3 * 2);
+	out = (unsigned char*)malloc((size_t)(width & ~1) * (size_t)(height & ~1) * 3 / 2);
+	if( lines == NULL || out == NULL ){
+		jpeg_destroy_decompress(&cinfo);
+		free(lines);
+		free(out);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+
+	i420->width = width & ~1;
+	i420->height = height & ~1;
+	for( y = 0 ; y < i420->height ; y += 2 ){
+		unsigned char *u = out + i420->width * i420->height + (y >> 1) * (i420->width >> 1);
+		if( decode ){
+			row[0] = lines;
+			jpeg_read_scanlines(&cinfo, row, 1);
+			row[0] = lines + width * 3;
+			jpeg_read_scanlines(&cinfo, row, 1);
+		}else{
+			__fill_scanline(src, y, lines);
+			__fill_scanline(src, y + 1, lines + width * 3);
+			if( __jpeg_color_space(src->format) == JCS_RGB ){
+				__rgb_line_to_ycc(lines, width);
+				__rgb_line_to_ycc(lines + width * 3, width);
+			}
+		}
+		__ycc_lines_to_i420(lines, lines + width * 3, i420->width, out + y * i420->width, out + (y + 1) * i420->width, u, u + (i420->width >> 1) * (i420->height >> 1));
+	}
+
+	/* the remaining scanlines of an odd height JPEG are not needed */
+	jpeg_destroy_decompress(&cinfo);
+	free(lines);
+	i420->data = out;
+	i420->size = i420->width * i420->height * 3 / 2;
+	i420->format = CAMERA_PIXEL_FORMAT_I420;
+	return CAMERA_ERROR_NONE;
+}
+
+/*
+ * Box filter fed one source row at a time, so neither the decoded JPEG nor the
+ * converted raw frame has to be held in memory. Each destination pixel is the
+ * average of the source pixels mapped onto it.
+ */
+typedef struct {
+	int src_width;
+	int src_height;
+	int dst_width;
+	int dst_height;
+	int *x_map;
+	unsigned int *sums;
+	unsigned int *x_count;
+	int band_rows;
+	int dst_row;
+	JSAMPLE *out;
+} _camera_thumbnail_scaler_s;
+
+static int __scaler_init(_camera_thumbnail_scaler_s *scaler, int src_width, int src_height, int dst_width, int dst_height){
+	int x;
+
+	memset(scaler, 0, sizeof(_camera_thumbnail_scaler_s));
+	scaler->src_width = src_width;
+	scaler->src_height = src_height;
+	scaler->dst_width = dst_width;
+	scaler->dst_height = dst_height;
+	scaler->x_map = (int*)malloc(src_width * sizeof(int));
+	scaler->sums = (unsigned int*)calloc(dst_width * 3, sizeof(unsigned int));
+	scaler->x_count = (unsigned int*)calloc(dst_width, sizeof(unsigned int));
+	scaler->out = (JSAMPLE*)malloc(dst_width * dst_height * 3);
+	if( scaler->x_map == NULL || scaler->sums == NULL || scaler->x_count == NULL || scaler->out == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+
+	for( x = 0 ; x < src_width ; x++ ){
+		scaler->x_map[x] = (int)((long long)x * dst_width / src_width) * 3;
+		scaler->x_count[scaler->x_map[x] / 3]++;
+	}
+	return CAMERA_ERROR_NONE;
+}
+
+static void __scaler_deinit(_camera_thumbnail_scaler_s *scaler){
+	free(scaler->x_map);
+	free(scaler->sums);
+	free(scaler->x_count);
+	free(scaler->out);
+}
+
+static void __scaler_flush_band(_camera_thumbnail_scaler_s *scaler){
+	JSAMPLE *dst = scaler->out + scaler->dst_row * scaler->dst_width * 3;
+	int x;
+
+	for( x = 0 ; x < scaler->dst_width ; x++ ){
+		unsigned int count = scaler->x_count[x] * scaler->band_rows;
+		dst[x * 3] = (scaler->sums[x * 3] + count / 2) / count;
+		dst[x * 3 + 1] = (scaler->sums[x * 3 + 1] + count / 2) / count;
+		dst[x * 3 + 2] = (scaler->sums[x * 3 + 2] + count / 2) / count;
+	}
+	memset(scaler->sums, 0, scaler->dst_width * 3 * sizeof(unsigned int));
+	scaler->band_rows = 0;
+}
+
+static void __scaler_push_row(_camera_thumbnail_scaler_s *scaler, int src_row, const JSAMPLE *line){
+	int dst_row = (int)((long long)src_row * scaler->dst_height / scaler->src_height);
+	unsigned int *sums = scaler->sums;
+	const int *x_map = scaler->x_map;
+	int x;
+
+	if( dst_row != scaler->dst_row && scaler->band_rows > 0 ){
+		__scaler_flush_band(scaler);
+	}
+	scaler->dst_row = dst_row;
+	for( x = 0 ; x < scaler->src_width ; x++, line += 3 ){
+		unsigned int *sum = sums + x_map[x];
+		sum[0] += line[0];
+		sum[1] += line[1];
+		sum[2] += line[2];
+	}
+	scaler->band_rows++;
+	if( src_row == scaler->src_height - 1 )
+		__scaler_flush_band(scaler);
+}
+
+static void __thumbnail_fit(int src_width, int src_height, int max_width, int max_height, int *width, int *height){
+	if( src_width <= max_width && src_height <= max_height ){
+		*width = src_width;
+		*height = src_height;
+	}else if( (long long)src_width * max_height > (long long)src_height * max_width ){
+		*width = max_width;
+		*height = (int)((long long)src_height * max_width / src_width);
+	}else{
+		*height = max_height;
+		*width = (int)((long long)src_width * max_height / src_height);
+	}
+	if( *width < 1 )
+		*width = 1;
+	if( *height < 1 )
+		*height = 1;
+}
+
+/* scale_denom lets libjpeg skip most of the IDCT work, the box filter only does the remaining step */
+static int __thumbnail_from_jpeg(camera_image_data_s *src, int max_width, int max_height, _camera_thumbnail_scaler_s *scaler){
+	struct jpeg_decompress_struct cinfo;
+	_camera_jpeg_error_s jerr;
+	JSAMPLE *line = NULL;
+	JSAMPROW row[1];
+	int width;
+	int height;
+	int denom;
+	int ret;
+
+	cinfo.err = jpeg_std_error(&jerr.pub);
+	jerr.pub.error_exit = __jpeg_error_exit;
+	if( setjmp(jerr.jump) ){
+		jpeg_destroy_decompress(&cinfo);
+		free(line);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	jpeg_create_decompress(&cinfo);
+	jpeg_mem_src(&cinfo, src->data, src->size);
+	jpeg_read_header(&cinfo, TRUE);
+	if( cinfo.image_width == 0 || cinfo.image_height == 0 || cinfo.image_width > JPEG_DECODE_MAX_DIMENSION || cinfo.image_height > JPEG_DECODE_MAX_DIMENSION ){
+		jpeg_destroy_decompress(&cinfo);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	__thumbnail_fit(cinfo.image_width, cinfo.image_height, max_width, max_height, &width, &height);
+
+	for( denom = 8 ; denom > 1 ; denom >>= 1 ){
+		if( (int)((cinfo.image_width + denom - 1) / denom) >= width && (int)((cinfo.image_height + denom - 1) / denom) >= height )
+			break;
+	}
+	cinfo.scale_num = 1;
+	cinfo.scale_denom = denom;
+	cinfo.out_color_space = JCS_YCbCr;
+	cinfo.dct_method = JDCT_IFAST;
+	cinfo.do_fancy_upsampling = FALSE;
+	jpeg_start_decompress(&cinfo);
+
+	ret = __scaler_init(scaler, cinfo.output_width, cinfo.output_height, width, height);
+	line = (JSAMPLE*)malloc(cinfo.output_width * cinfo.output_components);
+	if( ret != CAMERA_ERROR_NONE || line == NULL || cinfo.output_components != 3 ){
+		jpeg_destroy_decompress(&cinfo);
+		free(line);
+		return ret != CAMERA_ERROR_NONE ? ret : CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+
+	row[0] = line;
+	while( cinfo.output_scanline < cinfo.output_height ){
+		int src_row = cinfo.output_scanline;
+		jpeg_read_scanlines(&cinfo, row, 1);
+		__scaler_push_row(scaler, src_row, line);
+	}
+	jpeg_finish_decompress(&cinfo);
+	jpeg_destroy_decompress(&cinfo);
+	free(line);
+	return CAMERA_ERROR_NONE;
+}
+
+static int __thumbnail_from_raw(camera_image_data_s *src, int max_width, int max_height, _camera_thumbnail_scaler_s *scaler){
+	JSAMPLE *line;
+	int width;
+	int height;
+	int y;
+	int ret;
+
+	if( !_camera_jpeg_is_supported_format(src->format) || !_camera_image_is_valid(src) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	__thumbnail_fit(src->width, src->height, max_width, max_height, &width, &height);
+	ret = __scaler_init(scaler, src->width, src->height, width, height);
+	if( ret != CAMERA_ERROR_NONE )
+		return ret;
+
+	line = (JSAMPLE*)malloc(src->width * 3);
+	if( line == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	for( y = 0 ; y < src->height ; y++ ){
+		__fill_scanline(src, y, line);
+		__scaler_push_row(scaler, y, line);
+	}
+	free(line);
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_jpeg_make_thumbnail(camera_image_data_s *src, int max_width, int max_height, int quality, camera_image_data_s *thumbnail){
+	_camera_thumbnail_scaler_s scaler;
+	unsigned char *jpeg = NULL;
+	unsigned int jpeg_size = 0;
+	int ret;
+
+	if( src == NULL || src->data == NULL || thumbnail == NULL || max_width <= 0 || max_height <= 0 )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	memset(&scaler, 0, sizeof(scaler));
+	if( src->format == CAMERA_PIXEL_FORMAT_JPEG )
+		ret = __thumbnail_from_jpeg(src, max_width, max_height, &scaler);
+	else
+		ret = __thumbnail_from_raw(src, max_width, max_height, &scaler);
+
+	if( ret == CAMERA_ERROR_NONE )
+		ret = __jpeg_compress(NULL, scaler.out, scaler.dst_width, scaler.dst_height, src->format == CAMERA_PIXEL_FORMAT_JPEG ? JCS_YCbCr : __jpeg_color_space(src->format), quality, &jpeg, &jpeg_size);
+
+	if( ret == CAMERA_ERROR_NONE ){
+		thumbnail->data = jpeg;
+		thumbnail->size = jpeg_size;
+		thumbnail->width = scaler.dst_width;
+		thumbnail->height = scaler.dst_height;
+		thumbnail->format = CAMERA_PIXEL_FORMAT_JPEG;
+	}
+	__scaler_deinit(&scaler);
+	return ret;
+}
+
+
+static void __jpeg_job_free(_camera_jpeg_job_s *job){
+	if( job == NULL )
+		return;
+	free(job->image.data);
+	free(job->thumbnail.data);
+	free(job->postview.data);
+	free(job);
+}
+
+static gboolean __jpeg_encoder_drained_cb(gpointer data){
+	_camera_jpeg_drain_s *drain = (_camera_jpeg_drain_s*)data;
+	camera_jpeg_encoder_s *encoder = drain->encoder;
+	_camera_jpeg_drain_s **link;
+
+	g_mutex_lock(&encoder->lock);
+	for( link = &encoder->drains ; *link != drain ; link = &(*link)->next )
+		;
+	*link = drain->next;
+	g_mutex_unlock(&encoder->lock);
+	drain->callback(drain->user_data);
+	free(drain);
+	return FALSE;
+}
+
+/* called with lock held, returns with lock held */
+static void __jpeg_encoder_deliver(camera_jpeg_encoder_s *encoder){
+	_camera_jpeg_job_s *job;
+	int index;
+
+	if( encoder->delivering )
+		return;
+	encoder->delivering = true;
+
+	while( 1 ){
+		index = encoder->deliver_seq % encoder->slot_count;
+		job = encoder->slots[index];
+		if( job == NULL || !job->done )
+			break;
+		encoder->slots[index] = NULL;
+
+		g_mutex_unlock(&encoder->lock);
+		if( job->callback )
+			job->callback(&job->image, job->has_thumbnail ? &job->thumbnail : NULL, job->has_postview ? &job->postview : NULL, job->user_data);
+		__jpeg_job_free(job);
+		g_mutex_lock(&encoder->lock);
+
+		encoder->deliver_seq++;
+		encoder->outstanding--;
+		g_cond_broadcast(&encoder->cond);
+	}
+
+	encoder->delivering = false;
+
+	if( encoder->outstanding == 0 && encoder->drain_cb ){
+		_camera_jpeg_drain_s *drain = (_camera_jpeg_drain_s*)malloc(sizeof(_camera_jpeg_drain_s));
+		/* the source is kept so that destroying the encoder can take a notification not run yet back */
+		if( drain ){
+			drain->encoder = encoder;
+			drain->callback = encoder->drain_cb;
+			drain->user_data = encoder->drain_user_data;
+			drain->source = g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, __jpeg_encoder_drained_cb, drain, NULL);
+			drain->next = encoder->drains;
+			encoder->drains = drain;
+		}
+		encoder->drain_cb = NULL;
+		encoder->drain_user_data = NULL;
+	}
+}
+
+static void __jpeg_encoder_worker(gpointer data, gpointer user_data){
+	_camera_jpeg_job_s *job = (_camera_jpeg_job_s*)data;
+	camera_jpeg_encoder_s *encoder = (camera_jpeg_encoder_s*)user_data;
+	unsigned char *jpeg = NULL;
+	unsigned int jpeg_size = 0;
+
+	/* the thumbnail is built first, from the raw frame when there is one, as that is cheaper than decoding */
+	if( job->thumbnail_width > 0 && !job->has_thumbnail ){
+		if( _camera_jpeg_make_thumbnail(&job->image, job->thumbnail_width, job->thumbnail_height, job->quality, &job->thumbnail) == CAMERA_ERROR_NONE )
+			job->has_thumbnail = true;
+		else
+			LOGE("[%s] shot %u thumbnail failed",__func__, job->seq);
+	}
+
+	if( job->encode ){
+		if( _camera_jpeg_encode(&job->image, job->quality, &jpeg, &jpeg_size) == CAMERA_ERROR_NONE ){
+			free(job->image.data);
+			job->image.data = jpeg;
+			job->image.size = jpeg_size;
+			job->image.format = CAMERA_PIXEL_FORMAT_JPEG;
+		}else{
+			LOGE("[%s] shot %u encoding failed, delivering raw image",__func__, job->seq);
+		}
+	}
+
+	g_mutex_lock(&encoder->lock);
+	job->done = true;
+	__jpeg_encoder_deliver(encoder);
+	g_mutex_unlock(&encoder->lock);
+}
+
+int _camera_jpeg_encoder_create(camera_jpeg_encoder_s **encoder){
+	camera_jpeg_encoder_s *new_encoder;
+	int threads;
+
+	if( encoder == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	threads = g_get_num_processors();
+	if( threads < 1 )
+		threads = 1;
+	if( threads > JPEG_ENCODER_MAX_THREADS )
+		threads = JPEG_ENCODER_MAX_THREADS;
+
+	new_encoder = (camera_jpeg_encoder_s*)calloc(1, sizeof(camera_jpeg_encoder_s));
+	if( new_encoder == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+
+	new_encoder->slot_count = threads * JPEG_ENCODER_JOBS_PER_THREAD;
+	new_encoder->slots = (_camera_jpeg_job_s**)calloc(new_encoder->slot_count, sizeof(_camera_jpeg_job_s*));
+	if( new_encoder->slots == NULL ){
+		free(new_encoder);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+
+	g_mutex_init(&new_encoder->lock);
+	g_cond_init(&new_encoder->cond);
+	new_encoder->pool = g_thread_pool_new(__jpeg_encoder_worker, new_encoder, threads, TRUE, NULL);
+	if( new_encoder->pool == NULL ){
+		LOGE("[%s] thread pool creation fail",__func__);
+		g_cond_clear(&new_encoder->cond);
+		g_mutex_clear(&new_encoder->lock);
+		free(new_encoder->slots);
+		free(new_encoder);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+
+	LOGI("[%s] %d encoding threads",__func__, threads);
+	*encoder = new_encoder;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_jpeg_encoder_destroy(camera_jpeg_encoder_s *encoder){
+	int i;
+
+	if( encoder == NULL )
+		return;
+
+	/* let queued shots finish so that every capture is delivered */
+	g_thread_pool_free(encoder->pool, FALSE, TRUE);
+
+	for( i = 0 ; i < encoder->slot_count ; i++ )
+		__jpeg_job_free(encoder->slots[i]);
+
+	/* the camera is gone, a drain notification still queued on the main loop is dropped */
+	while( encoder->drains ){
+		_camera_jpeg_drain_s *drain = encoder->drains;
+		g_source_remove(drain->source);
+		encoder->drains = drain->next;
+		free(drain);
+	}
+
+	g_cond_clear(&encoder->cond);
+	g_mutex_clear(&encoder->lock);
+	free(encoder->slots);
+	free(encoder);
+}
+
+int _camera_jpeg_encoder_push(camera_jpeg_encoder_s *encoder, camera_image_data_s *image, camera_image_data_s *thumbnail, camera_image_data_s *postview, int quality, bool encode, int thumbnail_width, int thumbnail_height, camera_capturing_cb callback, void *user_data){
+	_camera_jpeg_job_s *job;
+	int ret;
+
+	if( encoder == NULL || image == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	job = (_camera_jpeg_job_s*)calloc(1, sizeof(_camera_jpeg_job_s));
+	if( job == NULL )
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+
+	/* mm-camcorder reuses the capture buffers after the callback returns */
+	ret = _camera_image_copy(&job->image, image);
+	if( ret == CAMERA_ERROR_NONE && thumbnail ){
+		ret = _camera_image_copy(&job->thumbnail, thumbnail);
+		job->has_thumbnail = ret == CAMERA_ERROR_NONE;
+	}
+	if( ret == CAMERA_ERROR_NONE && postview ){
+		ret = _camera_image_copy(&job->postview, postview);
+		job->has_postview = ret == CAMERA_ERROR_NONE;
+	}
+	if( ret != CAMERA_ERROR_NONE ){
+		__jpeg_job_free(job);
+		return ret;
+	}
+	job->quality = quality;
+	job->encode = encode;
+	job->thumbnail_width = thumbnail_width;
+	job->thumbnail_height = thumbnail_height;
+	job->callback = callback;
+	job->user_data = user_data;
+
+	g_mutex_lock(&encoder->lock);
+	/* back pressure : hold the capture thread rather than buffering a whole burst */
+	while( encoder->outstanding >= encoder->slot_count )
+		g_cond_wait(&encoder->cond, &encoder->lock);
+	job->seq = encoder->next_seq++;
+	encoder->slots[job->seq % encoder->slot_count] = job;
+	encoder->outstanding++;
+	g_mutex_unlock(&encoder->lock);
+
+	g_thread_pool_push(encoder->pool, job, NULL);
+	return CAMERA_ERROR_NONE;
+}
+
+bool _camera_jpeg_encoder_set_drain_cb(camera_jpeg_encoder_s *encoder, camera_capture_completed_cb callback, void *user_data){
+	bool pending;
+
+	if( encoder == NULL )
+		return false;
+
+	g_mutex_lock(&encoder->lock);
+	pending = encoder->outstanding > 0;
+	if( pending ){
+		encoder->drain_cb = callback;
+		encoder->drain_user_data = user_data;
+	}
+	g_mutex_unlock(&encoder->lock);
+
+	return pending;
+}
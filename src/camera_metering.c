@@ -0,0 +1,415 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* a region is sampled on a sparser grid until it has at most this many samples */
+#define METERING_MAX_SAMPLES 65536
+/* full range luma at or below, and at or above, these levels is taken as clipped */
+#define METERING_DARK_LEVEL 2
+#define METERING_BRIGHT_LEVEL 253
+#define METERING_MAX_WEIGHT 1000
+
+/*
+ * Focus and metering regions : the focus regions weight the sharpness of
+ * the focus metric, the metering regions get luma statistics computed on
+ * every preview frame. Large regions are sampled on a grid of one pixel
+ * out of 2, 4, ... in both directions, which keeps the cost per frame
+ * bounded whatever the preview size. A frame is measured on a copy of
+ * the regions into the spare array without holding the lock, the lock is
+ * only taken to copy the regions and to swap the statistics in, so neither
+ * a reader nor a setter waits for a frame. The copies are allocated with
+ * the regions, the frame in progress owns them until it gives them back.
+ */
+struct _camera_metering_s {
+	GMutex lock;
+	camera_region_s *focus_regions;
+	camera_region_s *focus_measured;
+	int focus_count;
+	camera_region_s *regions;
+	camera_region_s *measured;
+	int count;
+	camera_region_statistics_s *statistics;
+	camera_region_statistics_s *spare;
+	unsigned int frame;
+	unsigned int generation;		// bumped when the regions are replaced
+	unsigned int focus_generation;
+};
+
+int _camera_metering_create(camera_metering_s **metering){
+	camera_metering_s *handle;
+
+	if( metering == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	handle = (camera_metering_s*)calloc(1, sizeof(camera_metering_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	g_mutex_init(&handle->lock);
+	*metering = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_metering_destroy(camera_metering_s *metering){
+	if( metering == NULL )
+		return;
+	g_mutex_clear(&metering->lock);
+	free(metering->focus_regions);
+	free(metering->focus_measured);
+	free(metering->regions);
+	free(metering->measured);
+	free(metering->statistics);
+	free(metering->spare);
+	free(metering);
+}
+
+bool _camera_metering_is_valid_regions(const camera_region_s *regions, int count){
+	int i;
+
+	if( count < 0 || (count > 0 && regions == NULL) || count > INT_MAX / (int)sizeof(camera_region_statistics_s) )
+		return false;
+	for( i = 0 ; i < count ; i++ ){
+		if( regions[i].x < 0 || regions[i].y < 0 || regions[i].width <= 0 || regions[i].height <= 0 ||
+			regions[i].weight <= 0 || regions[i].weight > METERING_MAX_WEIGHT )
+			return false;
+	}
+	return true;
+}
+
+static camera_region_s *__metering_copy_regions(const camera_region_s *regions, int count){
+	camera_region_s *copy;
+
+	copy = (camera_region_s*)malloc(count * sizeof(camera_region_s));
+	if( copy == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return NULL;
+	}
+	memcpy(copy, regions, count * sizeof(camera_region_s));
+	return copy;
+}
+
+int _camera_metering_set_focus_regions(camera_metering_s *metering, const camera_region_s *regions, int count){
+	camera_region_s *copy = NULL;
+	camera_region_s *measured = NULL;
+
+	if( metering == NULL || !_camera_metering_is_valid_regions(regions, count) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( count > 0 ){
+		copy = __metering_copy_regions(regions, count);
+		measured = __metering_copy_regions(regions, count);
+		if( copy == NULL || measured == NULL ){
+			free(copy);
+			free(measured);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	g_mutex_lock(&metering->lock);
+	free(metering->focus_regions);
+	free(metering->focus_measured);		// NULL while a frame owns it, the frame frees it
+	metering->focus_regions = copy;
+	metering->focus_measured = measured;
+	metering->focus_count = count;
+	metering->focus_generation++;
+	g_mutex_unlock(&metering->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+/* the statistics of the former regions are dropped, they are computed again from the next frame */
+int _camera_metering_set_regions(camera_metering_s *metering, const camera_region_s *regions, int count){
+	camera_region_s *copy = NULL;
+	camera_region_s *measured = NULL;
+	camera_region_statistics_s *statistics = NULL;
+	camera_region_statistics_s *spare = NULL;
+
+	if( metering == NULL || !_camera_metering_is_valid_regions(regions, count) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( count > 0 ){
+		copy = __metering_copy_regions(regions, count);
+		measured = __metering_copy_regions(regions, count);
+		statistics = (camera_region_statistics_s*)calloc(count, sizeof(camera_region_statistics_s));
+		spare = (camera_region_statistics_s*)calloc(count, sizeof(camera_region_statistics_s));
+		if( copy == NULL || measured == NULL || statistics == NULL || spare == NULL ){
+			LOGE("[%s] malloc fail",__func__);
+			free(copy);
+			free(measured);
+			free(statistics);
+			free(spare);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	g_mutex_lock(&metering->lock);
+	free(metering->regions);
+	free(metering->measured);		// NULL while a frame owns them, the frame frees them
+	free(metering->statistics);
+	free(metering->spare);
+	metering->regions = copy;
+	metering->measured = measured;
+	metering->statistics = statistics;
+	metering->spare = spare;
+	metering->count = count;
+	metering->generation++;
+	g_mutex_unlock(&metering->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+bool _camera_metering_has_regions(camera_metering_s *metering){
+	bool has_regions;
+
+	if( metering == NULL )
+		return false;
+	g_mutex_lock(&metering->lock);
+	has_regions = metering->count > 0;
+	g_mutex_unlock(&metering->lock);
+	return has_regions;
+}
+
+static const unsigned char *__metering_luma(camera_image_data_s *frame, int *stride, int *step){
+	if( frame->format == CAMERA_PIXEL_FORMAT_YUYV || frame->format == CAMERA_PIXEL_FORMAT_UYVY ){
+		*stride = frame->width * 2;
+		*step = 2;
+		return frame->data + (frame->format == CAMERA_PIXEL_FORMAT_UYVY ? 1 : 0);
+	}
+	*stride = frame->width;
+	*step = 1;
+	return frame->data;
+}
+
+static void __metering_measure(camera_image_data_s *frame, const camera_region_s *region, camera_region_statistics_s *statistics){
+	unsigned int levels[256];
+	unsigned long long total = 0;
+	unsigned int dark = 0;
+	unsigned int bright = 0;
+	const unsigned char *luma;
+	int stride;
+	int step;
+	int grid = 1;
+	int x0 = MIN(region->x, frame->width);
+	int y0 = MIN(region->y, frame->height);
+	// 64 bit, x + width of a valid region may not fit in an int
+	int x1 = (int)MIN((long long)region->x + region->width, frame->width);
+	int y1 = (int)MIN((long long)region->y + region->height, frame->height);
+	int x;
+	int y;
+	int i;
+
+	memset(levels, 0, sizeof(levels));
+	while( (long long)((x1 - x0 + grid - 1) / grid) * ((y1 - y0 + grid - 1) / grid) > METERING_MAX_SAMPLES )
+		grid *= 2;
+
+	luma = __metering_luma(frame, &stride, &step);
+	for( y = y0 ; y < y1 ; y += grid ){
+		const unsigned char *row = luma + y * stride;
+		for( x = x0 ; x < x1 ; x += grid )
+			levels[row[x * step]]++;
+	}
+
+	memset(statistics->histogram, 0, sizeof(statistics->histogram));
+	statistics->pixels = 0;
+	for( i = 0 ; i < 256 ; i++ ){
+		statistics->histogram[i >> 2] += levels[i];
+		statistics->pixels += levels[i];
+		total += (unsigned long long)levels[i] * i;
+		if( i <= METERING_DARK_LEVEL )
+			dark += levels[i];
+		else if( i >= METERING_BRIGHT_LEVEL )
+			bright += levels[i];
+	}
+	if( statistics->pixels == 0 ){
+		// the region is outside of the frame
+		statistics->mean = 0;
+		statistics->dark_clipping = 0;
+		statistics->bright_clipping = 0;
+		return;
+	}
+	statistics->mean = (int)((total + statistics->pixels / 2) / statistics->pixels);
+	statistics->dark_clipping = (int)((unsigned long long)dark * 1000 / statistics->pixels);
+	statistics->bright_clipping = (int)((unsigned long long)bright * 1000 / statistics->pixels);
+}
+
+/*
+ * Computes the statistics of the metering regions on a preview frame.
+ * The frame is dropped when the regions are replaced while it is measured,
+ * or when another frame is being measured.
+ */
+int _camera_metering_process(camera_metering_s *metering, camera_image_data_s *frame){
+	camera_region_s *regions;
+	camera_region_statistics_s *done;
+	unsigned int generation;
+	unsigned int number;
+	int count;
+	int i;
+
+	if( metering == NULL || frame == NULL || !_camera_focus_is_supported_format(frame->format) || !_camera_image_is_valid(frame) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&metering->lock);
+	if( metering->count == 0 || metering->spare == NULL ){
+		g_mutex_unlock(&metering->lock);
+		return CAMERA_ERROR_NONE;
+	}
+	metering->frame++;
+	if( metering->frame == 0 )
+		metering->frame = 1;
+	number = metering->frame;
+	generation = metering->generation;
+	count = metering->count;
+	regions = metering->measured;
+	done = metering->spare;
+	memcpy(regions, metering->regions, count * sizeof(camera_region_s));
+	metering->measured = NULL;
+	metering->spare = NULL;
+	g_mutex_unlock(&metering->lock);
+
+	for( i = 0 ; i < count ; i++ ){
+		__metering_measure(frame, &regions[i], &done[i]);
+		done[i].frame = number;
+	}
+
+	g_mutex_lock(&metering->lock);
+	if( metering->generation == generation ){
+		metering->measured = regions;
+		metering->spare = metering->statistics;
+		metering->statistics = done;
+		regions = NULL;
+		done = NULL;
+	}
+	g_mutex_unlock(&metering->lock);
+	free(regions);
+	free(done);
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_metering_get_statistics(camera_metering_s *metering, int index, camera_region_statistics_s *statistics){
+	int ret = CAMERA_ERROR_NONE;
+
+	if( metering == NULL || statistics == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	g_mutex_lock(&metering->lock);
+	if( index < 0 || index >= metering->count )
+		ret = CAMERA_ERROR_INVALID_PARAMETER;
+	else if( metering->statistics[index].frame == 0 )
+		ret = CAMERA_ERROR_INVALID_OPERATION;
+	else
+		*statistics = metering->statistics[index];
+	g_mutex_unlock(&metering->lock);
+	return ret;
+}
+
+/* mean luma of the metering regions, each weighted by its weight and its sampled area */
+int _camera_metering_get_weighted_mean(camera_metering_s *metering, int *mean){
+	unsigned long long total = 0;
+	unsigned long long weights = 0;
+	int ret = CAMERA_ERROR_NONE;
+	int i;
+
+	if( metering == NULL || mean == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	g_mutex_lock(&metering->lock);
+	for( i = 0 ; i < metering->count ; i++ ){
+		const camera_region_statistics_s *statistics = &metering->statistics[i];
+		total += (unsigned long long)statistics->mean * statistics->pixels * metering->regions[i].weight;
+		weights += (unsigned long long)statistics->pixels * metering->regions[i].weight;
+	}
+	if( metering->count == 0 || metering->statistics[0].frame == 0 )
+		ret = CAMERA_ERROR_INVALID_OPERATION;
+	else
+		*mean = weights > 0 ? (int)((total + weights / 2) / weights) : 0;
+	g_mutex_unlock(&metering->lock);
+	return ret;
+}
+
+/*
+ * Sharpness of frame as the weighted mean of the sharpness of the focus
+ * regions. Returns false when there is no focus region.
+ */
+bool _camera_metering_get_sharpness(camera_metering_s *metering, camera_image_data_s *frame, unsigned int *sharpness){
+	unsigned long long total = 0;
+	unsigned long long weights = 0;
+	camera_region_s *regions;
+	unsigned int generation;
+	int count;
+	int i;
+
+	if( metering == NULL || frame == NULL || sharpness == NULL )
+		return false;
+	g_mutex_lock(&metering->lock);
+	if( metering->focus_count == 0 ){
+		g_mutex_unlock(&metering->lock);
+		return false;
+	}
+	generation = metering->focus_generation;
+	count = metering->focus_count;
+	regions = metering->focus_measured;
+	if( regions ){
+		memcpy(regions, metering->focus_regions, count * sizeof(camera_region_s));
+		metering->focus_measured = NULL;
+	}else{
+		// another frame owns the copy
+		regions = __metering_copy_regions(metering->focus_regions, count);
+	}
+	g_mutex_unlock(&metering->lock);
+	if( regions == NULL )
+		return false;
+
+	for( i = 0 ; i < count ; i++ ){
+		total += (unsigned long long)_camera_focus_get_sharpness(frame, regions[i].x, regions[i].y, regions[i].width, regions[i].height) * regions[i].weight;
+		weights += regions[i].weight;
+	}
+
+	g_mutex_lock(&metering->lock);
+	if( metering->focus_generation == generation && metering->focus_measured == NULL ){
+		metering->focus_measured = regions;
+		regions = NULL;
+	}
+	g_mutex_unlock(&metering->lock);
+	free(regions);
+	*sharpness = (unsigned int)(total / weights);
+	return true;
+}
+
+/* the center of the heaviest focus region, where the device focuses */
+bool _camera_metering_get_focus_point(camera_metering_s *metering, int *x, int *y){
+	const camera_region_s *best = NULL;
+	int i;
+
+	if( metering == NULL || x == NULL || y == NULL )
+		return false;
+	g_mutex_lock(&metering->lock);
+	for( i = 0 ; i < metering->focus_count ; i++ ){
+		if( best == NULL || metering->focus_regions[i].weight > best->weight )
+			best = &metering->focus_regions[i];
+	}
+	if( best ){
+		*x = (int)(best->x + (long long)best->width / 2);
+		*y = (int)(best->y + (long long)best->height / 2);
+	}
+	g_mutex_unlock(&metering->lock);
+	return best != NULL;
+}
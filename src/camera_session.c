@@ -0,0 +1,392 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* frames of both cameras waiting for the dispatch thread or for a partner */
+#define SESSION_POOL_SIZE 8
+/* frames of one camera waiting for a partner, older ones are given up */
+#define SESSION_MAX_WAITING 2
+/* default largest skew of a pair, half a frame at 30 fps */
+#define SESSION_DEFAULT_MAX_SKEW_US 16667
+
+/*
+ * Camera session : both cameras hand their preview frames to a single pool,
+ * stamped on the monotonic clock as they arrive, and a single dispatch
+ * thread pairs them. The oldest waiting frames of the two cameras are
+ * compared : closer than the largest skew they make a pair, otherwise the
+ * older one can not pair with any later frame and is given up. A frame that
+ * finds the pool full is given up on the streaming thread, which never
+ * waits for the application.
+ */
+typedef struct {
+	camera_image_buffer_s buffer;
+	camera_image_data_s image;
+	gint64 timestamp;
+	int device;
+	bool in_use;
+} _camera_session_frame_s;
+
+struct _camera_session_s {
+	camera_h cameras[2];
+	GMutex lock;
+	GCond idle;
+	GThreadPool *dispatcher;
+	int pending;
+	_camera_session_frame_s pool[SESSION_POOL_SIZE];
+	_camera_session_frame_s *waiting[2][SESSION_MAX_WAITING];
+	int waiting_count[2];
+	int max_skew;
+	camera_session_preview_cb callback;
+	void *user_data;
+	unsigned int pairs;
+	unsigned int unpaired[2];
+	long long total_skew;
+	int last_skew;
+	int largest_skew;
+};
+
+static _camera_session_frame_s *__session_pop(camera_session_s *session, int device){
+	_camera_session_frame_s *frame = session->waiting[device][0];
+
+	session->waiting_count[device]--;
+	memmove(&session->waiting[device][0], &session->waiting[device][1], session->waiting_count[device] * sizeof(_camera_session_frame_s*));
+	return frame;
+}
+
+/* runs on the dispatch thread, the only one that pairs and calls back */
+static void __session_dispatch(gpointer data, gpointer user_data){
+	_camera_session_frame_s *frame = (_camera_session_frame_s*)data;
+	camera_session_s *session = (camera_session_s*)user_data;
+	int device = frame->device;
+
+	g_mutex_lock(&session->lock);
+	if( session->waiting_count[device] == SESSION_MAX_WAITING ){
+		// the other camera stalls, the oldest frame would only get older
+		__session_pop(session, device)->in_use = false;
+		session->unpaired[device]++;
+	}
+	session->waiting[device][session->waiting_count[device]++] = frame;
+
+	while( session->waiting_count[0] > 0 && session->waiting_count[1] > 0 ){
+		_camera_session_frame_s *first = session->waiting[0][0];
+		_camera_session_frame_s *second = session->waiting[1][0];
+		gint64 skew = second->timestamp - first->timestamp;
+		camera_session_preview_cb callback = session->callback;
+		void *callback_data = session->user_data;
+
+		if( ABS(skew) > session->max_skew ){
+			int older = skew > 0 ? 0 : 1;
+			__session_pop(session, older)->in_use = false;
+			session->unpaired[older]++;
+			continue;
+		}
+		__session_pop(session, 0);
+		__session_pop(session, 1);
+		session->pairs++;
+		session->total_skew += ABS(skew);
+		session->last_skew = (int)skew;
+		session->largest_skew = MAX(session->largest_skew, (int)ABS(skew));
+		// frames that came before the callback was set were not copied
+		if( callback && first->image.data && second->image.data ){
+			// the frames stay in use, the streaming threads can not take them
+			g_mutex_unlock(&session->lock);
+			callback(&first->image, &second->image, (int)skew, callback_data);
+			g_mutex_lock(&session->lock);
+		}
+		first->in_use = false;
+		second->in_use = false;
+	}
+
+	session->pending--;
+	if( session->pending == 0 )
+		g_cond_broadcast(&session->idle);
+	g_mutex_unlock(&session->lock);
+}
+
+/*
+ * Waits for the dispatch thread and gives up the frames still waiting for a
+ * partner. Called with both cameras stopped, nothing is pushed meanwhile.
+ */
+static void __session_flush(camera_session_s *session){
+	int device;
+
+	g_mutex_lock(&session->lock);
+	while( session->pending > 0 )
+		g_cond_wait(&session->idle, &session->lock);
+	for( device = 0 ; device < 2 ; device++ ){
+		while( session->waiting_count[device] > 0 ){
+			__session_pop(session, device)->in_use = false;
+			session->unpaired[device]++;
+		}
+	}
+	g_mutex_unlock(&session->lock);
+}
+
+/*
+ * Hands a preview frame of device to the session. Runs on the streaming
+ * thread of the camera, the frame is copied only when someone looks at it.
+ */
+int _camera_session_push(camera_session_s *session, int device, camera_image_data_s *frame){
+	gint64 now = g_get_monotonic_time();
+	_camera_session_frame_s *slot = NULL;
+	bool copy;
+	int i;
+
+	if( session == NULL || frame == NULL || device < 0 || device > 1 )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	g_mutex_lock(&session->lock);
+	for( i = 0 ; i < SESSION_POOL_SIZE ; i++ ){
+		if( !session->pool[i].in_use ){
+			slot = &session->pool[i];
+			slot->in_use = true;
+			break;
+		}
+	}
+	if( slot == NULL ){
+		session->unpaired[device]++;
+		g_mutex_unlock(&session->lock);
+		return CAMERA_ERROR_NONE;
+	}
+	copy = session->callback != NULL;
+	g_mutex_unlock(&session->lock);
+
+	// the slot is ours until the dispatch thread takes it
+	slot->device = device;
+	slot->timestamp = now;
+	slot->image = *frame;
+	slot->image.data = NULL;
+	slot->image.size = 0;
+	if( copy ){
+		if( _camera_image_buffer_reserve(&slot->buffer, frame->size) != CAMERA_ERROR_NONE ){
+			g_mutex_lock(&session->lock);
+			slot->in_use = false;
+			session->unpaired[device]++;
+			g_mutex_unlock(&session->lock);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+		memcpy(slot->buffer.data, frame->data, frame->size);
+		slot->image.data = slot->buffer.data;
+		slot->image.size = frame->size;
+	}
+
+	g_mutex_lock(&session->lock);
+	session->pending++;
+	g_mutex_unlock(&session->lock);
+	g_thread_pool_push(session->dispatcher, slot, NULL);
+	return CAMERA_ERROR_NONE;
+}
+
+/* how many of the pool slots wait for the dispatch thread, in percent */
+int _camera_session_get_queue_level(camera_session_s *session){
+	int level;
+
+	if( session == NULL )
+		return 0;
+	g_mutex_lock(&session->lock);
+	level = session->pending * 100 / SESSION_POOL_SIZE;
+	g_mutex_unlock(&session->lock);
+	return level;
+}
+
+int camera_session_create(camera_session_h *session){
+	if( session == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle;
+	int device;
+	int ret;
+
+	handle = (camera_session_s*)calloc(1, sizeof(camera_session_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	g_mutex_init(&handle->lock);
+	g_cond_init(&handle->idle);
+	handle->max_skew = SESSION_DEFAULT_MAX_SKEW_US;
+	handle->dispatcher = g_thread_pool_new(__session_dispatch, handle, 1, TRUE, NULL);
+	if( handle->dispatcher == NULL ){
+		LOGE("[%s] thread pool creation fail",__func__);
+		g_cond_clear(&handle->idle);
+		g_mutex_clear(&handle->lock);
+		free(handle);
+		return CAMERA_ERROR_INVALID_OPERATION;
+	}
+	for( device = 0 ; device < 2 ; device++ ){
+		ret = camera_create(device == 0 ? CAMERA_DEVICE_CAMERA0 : CAMERA_DEVICE_CAMERA1, &handle->cameras[device]);
+		if( ret != CAMERA_ERROR_NONE ){
+			LOGE("[%s] camera %d creation fail(0x%08x)",__func__, device, ret);
+			camera_session_destroy((camera_session_h)handle);
+			return ret;
+		}
+		((camera_s*)handle->cameras[device])->session = handle;
+		((camera_s*)handle->cameras[device])->session_device = device;
+	}
+	*session = (camera_session_h)handle;
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_session_destroy(camera_session_h session){
+	if( session == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle = (camera_session_s*)session;
+	int device;
+	int ret;
+	int i;
+
+	for( device = 0 ; device < 2 ; device++ ){
+		if( handle->cameras[device] == NULL )
+			continue;
+		camera_stop_preview(handle->cameras[device]);
+		((camera_s*)handle->cameras[device])->session = NULL;
+		ret = camera_destroy(handle->cameras[device]);
+		if( ret != CAMERA_ERROR_NONE ){
+			// the camera still streams into the session, it can not go
+			LOGE("[%s] camera %d destroy fail(0x%08x)",__func__, device, ret);
+			((camera_s*)handle->cameras[device])->session = handle;
+			return ret;
+		}
+		handle->cameras[device] = NULL;
+	}
+	__session_flush(handle);
+	g_thread_pool_free(handle->dispatcher, FALSE, TRUE);
+	if( handle->pairs > 0 )
+		LOGI("[%s] %u pairs, mean skew %lld us",__func__, handle->pairs, handle->total_skew / handle->pairs);
+	for( i = 0 ; i < SESSION_POOL_SIZE ; i++ )
+		_camera_image_buffer_release(&handle->pool[i].buffer);
+	g_cond_clear(&handle->idle);
+	g_mutex_clear(&handle->lock);
+	free(handle);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_session_get_camera(camera_session_h session, camera_device_e device, camera_h *camera){
+	if( session == NULL || camera == NULL || (device != CAMERA_DEVICE_CAMERA0 && device != CAMERA_DEVICE_CAMERA1) ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle = (camera_session_s*)session;
+	*camera = handle->cameras[device == CAMERA_DEVICE_CAMERA0 ? 0 : 1];
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_session_set_max_skew(camera_session_h session, int skew){
+	if( session == NULL || skew < 0 ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle = (camera_session_s*)session;
+	g_mutex_lock(&handle->lock);
+	handle->max_skew = skew;
+	g_mutex_unlock(&handle->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_session_set_preview_cb(camera_session_h session, camera_session_preview_cb callback, void *user_data){
+	if( session == NULL || callback == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle = (camera_session_s*)session;
+	g_mutex_lock(&handle->lock);
+	handle->callback = callback;
+	handle->user_data = user_data;
+	g_mutex_unlock(&handle->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_session_unset_preview_cb(camera_session_h session){
+	if( session == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle = (camera_session_s*)session;
+	// a running callback finishes on the dispatch thread, it is not waited for
+	g_mutex_lock(&handle->lock);
+	handle->callback = NULL;
+	handle->user_data = NULL;
+	g_mutex_unlock(&handle->lock);
+	return CAMERA_ERROR_NONE;
+}
+
+int camera_session_start_preview(camera_session_h session){
+	if( session == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle = (camera_session_s*)session;
+	int ret;
+
+	ret = camera_start_preview(handle->cameras[0]);
+	if( ret != CAMERA_ERROR_NONE )
+		return ret;
+	ret = camera_start_preview(handle->cameras[1]);
+	if( ret != CAMERA_ERROR_NONE ){
+		// the device can not run both cameras, leave the first one as it was
+		LOGE("[%s] second camera start fail(0x%08x)",__func__, ret);
+		camera_stop_preview(handle->cameras[0]);
+		__session_flush(handle);
+	}
+	return ret;
+}
+
+int camera_session_stop_preview(camera_session_h session){
+	if( session == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle = (camera_session_s*)session;
+	int first = camera_stop_preview(handle->cameras[0]);
+	int second = camera_stop_preview(handle->cameras[1]);
+
+	// no pair is delivered after this returns
+	__session_flush(handle);
+	return first != CAMERA_ERROR_NONE ? first : second;
+}
+
+int camera_session_get_skew_statistics(camera_session_h session, camera_session_skew_s *statistics){
+	if( session == NULL || statistics == NULL){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	camera_session_s *handle = (camera_session_s*)session;
+	g_mutex_lock(&handle->lock);
+	statistics->pairs = handle->pairs;
+	statistics->unpaired_first = handle->unpaired[0];
+	statistics->unpaired_second = handle->unpaired[1];
+	statistics->mean_skew = handle->pairs > 0 ? (int)(handle->total_skew / handle->pairs) : 0;
+	statistics->last_skew = handle->last_skew;
+	statistics->largest_skew = handle->largest_skew;
+	g_mutex_unlock(&handle->lock);
+	return CAMERA_ERROR_NONE;
+}
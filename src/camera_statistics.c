@@ -0,0 +1,465 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define STATISTICS_USE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define STATISTICS_USE_SSE2
+#endif
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* full range BT.601 YCbCr to RGB, in 1/1024 */
+#define STATISTICS_CR_TO_R 1436
+#define STATISTICS_CB_TO_G 352
+#define STATISTICS_CR_TO_G 731
+#define STATISTICS_CB_TO_B 1815
+/* pixels darker than this are too noisy for the white balance estimate */
+#define STATISTICS_AWB_MIN_LUMA 16
+
+/*
+ * Frame statistics : a single pass over the frame takes every pixel once,
+ * with the chroma sample it shares with its neighbor. It counts the luma
+ * histogram, the pixels whose red, green or blue is clipped, and the luma
+ * and chroma sums of every cell of the white balance grid. The conversion
+ * to RGB is linear, so the channel means come from the YCbCr means at the
+ * end instead of converting every pixel. A channel clips where its value
+ * reaches 255, that is where the luma reaches 255 minus the chroma offset,
+ * one compare per pixel. The gray world estimate of a cell leaves out the
+ * dark and the clipped pixels, whose color is not the color of the light.
+ * Planar luma is taken 16 pixels at a time with SSE2/NEON, except for the
+ * histogram, the chroma offsets are floored term by term so that the vector
+ * and the scalar paths agree to the pixel.
+ */
+
+static void __statistics_chroma_layout(camera_image_data_s *frame, const unsigned char **cb, const unsigned char **cr, int *stride, int *row_shift, int *step){
+	const unsigned char *chroma = frame->data + frame->width * frame->height;
+	int width = frame->width;
+	int height = frame->height;
+
+	*row_shift = 0;
+	switch( frame->format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV21:
+			*row_shift = 1;
+			/* fall through - interleaved as NV16, on half the rows */
+		case CAMERA_PIXEL_FORMAT_NV16:
+			*cb = frame->format == CAMERA_PIXEL_FORMAT_NV21 ? chroma + 1 : chroma;
+			*cr = frame->format == CAMERA_PIXEL_FORMAT_NV21 ? chroma : chroma + 1;
+			*stride = width;
+			*step = 2;
+			break;
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+			*row_shift = 1;
+			*cb = frame->format == CAMERA_PIXEL_FORMAT_YV12 ? chroma + (width / 2) * (height / 2) : chroma;
+			*cr = frame->format == CAMERA_PIXEL_FORMAT_YV12 ? chroma : chroma + (width / 2) * (height / 2);
+			*stride = width / 2;
+			*step = 1;
+			break;
+		case CAMERA_PIXEL_FORMAT_422P:
+			*cb = chroma;
+			*cr = chroma + (width / 2) * height;
+			*stride = width / 2;
+			*step = 1;
+			break;
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+		default:
+			*cb = frame->data + (frame->format == CAMERA_PIXEL_FORMAT_YUYV ? 1 : 0);
+			*cr = *cb + 2;
+			*stride = width * 2;
+			*step = 4;
+			break;
+	}
+}
+
+typedef struct {
+	unsigned long long y;
+	unsigned long long cb;
+	unsigned long long cr;
+	unsigned long long pixels;
+} _camera_statistics_sum_s;
+
+static void __statistics_to_rgb(const _camera_statistics_sum_s *sum, int *red, int *green, int *blue){
+	long long half = sum->pixels / 2;
+	int y = (int)((sum->y + half) / sum->pixels);
+	int cb = (int)((sum->cb + half) / sum->pixels) - 128;
+	int cr = (int)((sum->cr + half) / sum->pixels) - 128;
+
+	*red = CLAMP(y + ((STATISTICS_CR_TO_R * cr) >> 10), 0, 255);
+	*green = CLAMP(y - ((STATISTICS_CB_TO_G * cb) >> 10) - ((STATISTICS_CR_TO_G * cr) >> 10), 0, 255);
+	*blue = CLAMP(y + ((STATISTICS_CB_TO_B * cb) >> 10), 0, 255);
+}
+
+#if defined(STATISTICS_USE_SSE2) || defined(STATISTICS_USE_NEON)
+/* the histogram of 16 pixels, spread over the 4 histograms */
+static inline void __statistics_count16(const unsigned char *pixels, unsigned int *levels){
+	int i;
+
+	for( i = 0 ; i < 16 ; i += 4 ){
+		levels[pixels[i]]++;
+		levels[256 + pixels[i + 1]]++;
+		levels[512 + pixels[i + 2]]++;
+		levels[768 + pixels[i + 3]]++;
+	}
+}
+#endif
+
+#if defined(STATISTICS_USE_SSE2)
+static inline unsigned int __statistics_sum_epi32(__m128i sum){
+	unsigned int lanes[4];
+
+	_mm_storeu_si128((__m128i*)lanes, sum);
+	return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+static inline unsigned int __statistics_count_epi16(__m128i count){
+	return __statistics_sum_epi32(_mm_madd_epi16(count, _mm_set1_epi16(1)));
+}
+
+/*
+ * The pixels of planar luma from x0 on, 16 at a time, chroma_step is 1 or 2.
+ * Returns where the scalar path goes on.
+ */
+static int __statistics_segment_simd(const unsigned char *luma, const unsigned char *cb, const unsigned char *cr, int chroma_step, int x0, int x1,
+	unsigned int *levels, unsigned int *clipped, unsigned int *sums){
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i low = _mm_set1_epi16(0xff);
+	const __m128i ones = _mm_set1_epi16(1);
+	const __m128i center = _mm_set1_epi16(128);
+	const __m128i white = _mm_set1_epi16(254);
+	const __m128i dark = _mm_set1_epi16(STATISTICS_AWB_MIN_LUMA - 1);
+	const unsigned char *interleaved = cb < cr ? cb : cr;
+	int x = x0;
+
+	while( x + 16 <= x1 ){
+		// the 16 bit counters take at most 2 per round
+		int end = MIN(x1, x + 16 * 4096);
+		__m128i sum_y = zero;
+		__m128i sum_cb = zero;
+		__m128i sum_cr = zero;
+		__m128i gray_y = zero;
+		__m128i gray_cb = zero;
+		__m128i gray_cr = zero;
+		__m128i gray_pixels = zero;
+		__m128i clip_red = zero;
+		__m128i clip_green = zero;
+		__m128i clip_blue = zero;
+		for( ; x + 16 <= end ; x += 16 ){
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(luma + x));
+			__m128i even = _mm_and_si128(pixels, low);
+			__m128i odd = _mm_srli_epi16(pixels, 8);
+			__m128i u;
+			__m128i v;
+			__m128i u4;
+			__m128i v4;
+			__m128i red;
+			__m128i green;
+			__m128i blue;
+			__m128i top;
+			__m128i gray;
+			if( chroma_step == 2 ){
+				__m128i chroma = _mm_loadu_si128((const __m128i*)(interleaved + x));
+				u = cb < cr ? _mm_and_si128(chroma, low) : _mm_srli_epi16(chroma, 8);
+				v = cb < cr ? _mm_srli_epi16(chroma, 8) : _mm_and_si128(chroma, low);
+			}else{
+				u = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(cb + (x >> 1))), zero);
+				v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(cr + (x >> 1))), zero);
+			}
+			// (c - 128) * 4 * k * 16 >> 16 is (c - 128) * k >> 10, floored like the scalar shift
+			u4 = _mm_slli_epi16(_mm_sub_epi16(u, center), 2);
+			v4 = _mm_slli_epi16(_mm_sub_epi16(v, center), 2);
+			red = _mm_sub_epi16(white, _mm_mulhi_epi16(v4, _mm_set1_epi16(STATISTICS_CR_TO_R * 16)));
+			green = _mm_add_epi16(white, _mm_add_epi16(_mm_mulhi_epi16(u4, _mm_set1_epi16(STATISTICS_CB_TO_G * 16)), _mm_mulhi_epi16(v4, _mm_set1_epi16(STATISTICS_CR_TO_G * 16))));
+			blue = _mm_sub_epi16(white, _mm_mulhi_epi16(u4, _mm_set1_epi16(STATISTICS_CB_TO_B * 16)));
+
+			// the limits are one below the clipping level, a pixel above them clips
+			clip_red = _mm_sub_epi16(_mm_sub_epi16(clip_red, _mm_cmpgt_epi16(even, red)), _mm_cmpgt_epi16(odd, red));
+			clip_green = _mm_sub_epi16(_mm_sub_epi16(clip_green, _mm_cmpgt_epi16(even, green)), _mm_cmpgt_epi16(odd, green));
+			clip_blue = _mm_sub_epi16(_mm_sub_epi16(clip_blue, _mm_cmpgt_epi16(even, blue)), _mm_cmpgt_epi16(odd, blue));
+			top = _mm_max_epi16(even, odd);
+			gray = _mm_and_si128(_mm_cmpgt_epi16(_mm_min_epi16(even, odd), dark),
+				_mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi16(top, red), _mm_or_si128(_mm_cmpgt_epi16(top, green), _mm_cmpgt_epi16(top, blue))), _mm_cmpeq_epi16(zero, zero)));
+
+			sum_y = _mm_add_epi64(sum_y, _mm_sad_epu8(pixels, zero));
+			sum_cb = _mm_add_epi32(sum_cb, _mm_madd_epi16(u, ones));
+			sum_cr = _mm_add_epi32(sum_cr, _mm_madd_epi16(v, ones));
+			gray_y = _mm_add_epi32(gray_y, _mm_madd_epi16(_mm_and_si128(_mm_add_epi16(even, odd), gray), ones));
+			gray_cb = _mm_add_epi32(gray_cb, _mm_madd_epi16(_mm_and_si128(u, gray), ones));
+			gray_cr = _mm_add_epi32(gray_cr, _mm_madd_epi16(_mm_and_si128(v, gray), ones));
+			gray_pixels = _mm_sub_epi16(gray_pixels, gray);
+			__statistics_count16(luma + x, levels);
+		}
+		sums[0] += __statistics_sum_epi32(sum_y);
+		sums[1] += __statistics_sum_epi32(sum_cb);
+		sums[2] += __statistics_sum_epi32(sum_cr);
+		sums[3] += __statistics_sum_epi32(gray_y);
+		sums[4] += __statistics_sum_epi32(gray_cb);
+		sums[5] += __statistics_sum_epi32(gray_cr);
+		sums[6] += __statistics_count_epi16(gray_pixels) * 2;
+		clipped[0] += __statistics_count_epi16(clip_red);
+		clipped[1] += __statistics_count_epi16(clip_green);
+		clipped[2] += __statistics_count_epi16(clip_blue);
+	}
+	return x;
+}
+#elif defined(STATISTICS_USE_NEON)
+static inline unsigned int __statistics_sum_u32(uint32x4_t sum){
+	return vgetq_lane_u32(sum, 0) + vgetq_lane_u32(sum, 1) + vgetq_lane_u32(sum, 2) + vgetq_lane_u32(sum, 3);
+}
+
+static inline int16x8_t __statistics_offset(int16x8_t chroma, int k){
+	int32x4_t low = vmull_n_s16(vget_low_s16(chroma), k);
+	int32x4_t high = vmull_n_s16(vget_high_s16(chroma), k);
+	return vcombine_s16(vshrn_n_s32(low, 10), vshrn_n_s32(high, 10));
+}
+
+static int __statistics_segment_simd(const unsigned char *luma, const unsigned char *cb, const unsigned char *cr, int chroma_step, int x0, int x1,
+	unsigned int *levels, unsigned int *clipped, unsigned int *sums){
+	const unsigned char *interleaved = cb < cr ? cb : cr;
+	const int16x8_t center = vdupq_n_s16(128);
+	const int16x8_t white = vdupq_n_s16(254);
+	const int16x8_t dark = vdupq_n_s16(STATISTICS_AWB_MIN_LUMA - 1);
+	int x = x0;
+
+	while( x + 16 <= x1 ){
+		int end = MIN(x1, x + 16 * 4096);
+		uint32x4_t sum_y = vdupq_n_u32(0);
+		uint32x4_t sum_cb = vdupq_n_u32(0);
+		uint32x4_t sum_cr = vdupq_n_u32(0);
+		uint32x4_t gray_y = vdupq_n_u32(0);
+		uint32x4_t gray_cb = vdupq_n_u32(0);
+		uint32x4_t gray_cr = vdupq_n_u32(0);
+		uint16x8_t gray_pixels = vdupq_n_u16(0);
+		uint16x8_t clip_red = vdupq_n_u16(0);
+		uint16x8_t clip_green = vdupq_n_u16(0);
+		uint16x8_t clip_blue = vdupq_n_u16(0);
+		for( ; x + 16 <= end ; x += 16 ){
+			uint8x8x2_t pixels = vld2_u8(luma + x);
+			int16x8_t even = vreinterpretq_s16_u16(vmovl_u8(pixels.val[0]));
+			int16x8_t odd = vreinterpretq_s16_u16(vmovl_u8(pixels.val[1]));
+			uint16x8_t u;
+			uint16x8_t v;
+			int16x8_t u0;
+			int16x8_t v0;
+			int16x8_t red;
+			int16x8_t green;
+			int16x8_t blue;
+			int16x8_t top;
+			uint16x8_t gray;
+			if( chroma_step == 2 ){
+				uint8x8x2_t chroma = vld2_u8(interleaved + x);
+				u = vmovl_u8(cb < cr ? chroma.val[0] : chroma.val[1]);
+				v = vmovl_u8(cb < cr ? chroma.val[1] : chroma.val[0]);
+			}else{
+				u = vmovl_u8(vld1_u8(cb + (x >> 1)));
+				v = vmovl_u8(vld1_u8(cr + (x >> 1)));
+			}
+			u0 = vsubq_s16(vreinterpretq_s16_u16(u), center);
+			v0 = vsubq_s16(vreinterpretq_s16_u16(v), center);
+			red = vsubq_s16(white, __statistics_offset(v0, STATISTICS_CR_TO_R));
+			green = vaddq_s16(white, vaddq_s16(__statistics_offset(u0, STATISTICS_CB_TO_G), __statistics_offset(v0, STATISTICS_CR_TO_G)));
+			blue = vsubq_s16(white, __statistics_offset(u0, STATISTICS_CB_TO_B));
+
+			clip_red = vsubq_u16(vsubq_u16(clip_red, vcgtq_s16(even, red)), vcgtq_s16(odd, red));
+			clip_green = vsubq_u16(vsubq_u16(clip_green, vcgtq_s16(even, green)), vcgtq_s16(odd, green));
+			clip_blue = vsubq_u16(vsubq_u16(clip_blue, vcgtq_s16(even, blue)), vcgtq_s16(odd, blue));
+			top = vmaxq_s16(even, odd);
+			gray = vandq_u16(vcgtq_s16(vminq_s16(even, odd), dark), vandq_u16(vcleq_s16(top, red), vandq_u16(vcleq_s16(top, green), vcleq_s16(top, blue))));
+
+			sum_y = vpadalq_u16(sum_y, vaddl_u8(pixels.val[0], pixels.val[1]));
+			sum_cb = vpadalq_u16(sum_cb, u);
+			sum_cr = vpadalq_u16(sum_cr, v);
+			gray_y = vpadalq_u16(gray_y, vandq_u16(vaddl_u8(pixels.val[0], pixels.val[1]), gray));
+			gray_cb = vpadalq_u16(gray_cb, vandq_u16(u, gray));
+			gray_cr = vpadalq_u16(gray_cr, vandq_u16(v, gray));
+			gray_pixels = vsubq_u16(gray_pixels, gray);
+			__statistics_count16(luma + x, levels);
+		}
+		sums[0] += __statistics_sum_u32(sum_y);
+		sums[1] += __statistics_sum_u32(sum_cb);
+		sums[2] += __statistics_sum_u32(sum_cr);
+		sums[3] += __statistics_sum_u32(gray_y);
+		sums[4] += __statistics_sum_u32(gray_cb);
+		sums[5] += __statistics_sum_u32(gray_cr);
+		sums[6] += __statistics_sum_u32(vpaddlq_u16(gray_pixels)) * 2;
+		clipped[0] += __statistics_sum_u32(vpaddlq_u16(clip_red));
+		clipped[1] += __statistics_sum_u32(vpaddlq_u16(clip_green));
+		clipped[2] += __statistics_sum_u32(vpaddlq_u16(clip_blue));
+	}
+	return x;
+}
+#endif
+
+/* the pixels x0 to x1 - 1 of a row, x0 and x1 even */
+static inline void __statistics_segment(const unsigned char *luma, int luma_step, const unsigned char *cb, const unsigned char *cr, int chroma_step, int x0, int x1,
+	unsigned int *levels, unsigned int *clipped, _camera_statistics_sum_s *all, _camera_statistics_sum_s *gray){
+	// luma, cb and cr of all the pixels, then of the gray ones, and how many these are
+	unsigned int sums[7] = { 0, 0, 0, 0, 0, 0, 0 };
+	int x = x0;
+
+#if defined(STATISTICS_USE_SSE2) || defined(STATISTICS_USE_NEON)
+	if( luma_step == 1 )
+		x = __statistics_segment_simd(luma, cb, cr, chroma_step, x0, x1, levels, clipped, sums);
+#endif
+	for( ; x < x1 ; x += 2 ){
+		int u = cb[(x >> 1) * chroma_step];
+		int v = cr[(x >> 1) * chroma_step];
+		int y0 = luma[x * luma_step];
+		int y1 = luma[(x + 1) * luma_step];
+		int red = 255 - ((STATISTICS_CR_TO_R * (v - 128)) >> 10);
+		int green = 255 + ((STATISTICS_CB_TO_G * (u - 128)) >> 10) + ((STATISTICS_CR_TO_G * (v - 128)) >> 10);
+		int blue = 255 - ((STATISTICS_CB_TO_B * (u - 128)) >> 10);
+		int top = MAX(y0, y1);
+		// all ones when the pair is usable for the white balance, without a branch the data decides
+		unsigned int gray_mask = 0u - (unsigned int)((MIN(y0, y1) >= STATISTICS_AWB_MIN_LUMA) & (top < red) & (top < green) & (top < blue));
+
+		// flat areas repeat the same level, successive pixels count in separate histograms so that an increment does not wait for the one before
+		levels[(x & 2) * 256 + y0]++;
+		levels[(x & 2) * 256 + 256 + y1]++;
+		clipped[0] += (y0 >= red) + (y1 >= red);
+		clipped[1] += (y0 >= green) + (y1 >= green);
+		clipped[2] += (y0 >= blue) + (y1 >= blue);
+		sums[0] += y0 + y1;
+		sums[1] += u;
+		sums[2] += v;
+		sums[3] += (y0 + y1) & gray_mask;
+		sums[4] += u & gray_mask;
+		sums[5] += v & gray_mask;
+		sums[6] += 2 & gray_mask;
+	}
+	// a chroma sample stands for two pixels
+	all->y += sums[0];
+	all->cb += (unsigned long long)sums[1] * 2;
+	all->cr += (unsigned long long)sums[2] * 2;
+	all->pixels += x1 - x0;
+	gray->y += sums[3];
+	gray->cb += (unsigned long long)sums[4] * 2;
+	gray->cr += (unsigned long long)sums[5] * 2;
+	gray->pixels += sums[6];
+}
+
+/* computes the statistics of frame in a single pass, frame number is left to the caller */
+int _camera_statistics_compute(camera_image_data_s *frame, camera_frame_statistics_s *statistics){
+	_camera_statistics_sum_s cells[CAMERA_STATISTICS_GRID_ROWS][CAMERA_STATISTICS_GRID_COLUMNS];
+	_camera_statistics_sum_s total;
+	unsigned int levels[4 * 256];
+	unsigned int clipped[3] = { 0, 0, 0 };
+	unsigned long long luma_total = 0;
+	const unsigned char *luma = frame ? frame->data : NULL;
+	const unsigned char *cb;
+	const unsigned char *cr;
+	int luma_stride;
+	int luma_step = 1;
+	int chroma_stride;
+	int row_shift;
+	int chroma_step;
+	int row;
+	int column;
+	int y;
+	int i;
+
+	if( frame == NULL || statistics == NULL || !_camera_focus_is_supported_format(frame->format) || !_camera_image_is_valid(frame) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( frame->width < 2 * CAMERA_STATISTICS_GRID_COLUMNS || frame->height < CAMERA_STATISTICS_GRID_ROWS )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	__statistics_chroma_layout(frame, &cb, &cr, &chroma_stride, &row_shift, &chroma_step);
+	luma_stride = frame->width;
+	if( frame->format == CAMERA_PIXEL_FORMAT_YUYV || frame->format == CAMERA_PIXEL_FORMAT_UYVY ){
+		luma_step = 2;
+		luma_stride = frame->width * 2;
+		if( frame->format == CAMERA_PIXEL_FORMAT_UYVY )
+			luma++;
+	}
+
+	memset(levels, 0, sizeof(levels));
+	memset(cells, 0, sizeof(cells));
+	memset(&total, 0, sizeof(total));
+	for( row = 0 ; row < CAMERA_STATISTICS_GRID_ROWS ; row++ ){
+		int y0 = row * frame->height / CAMERA_STATISTICS_GRID_ROWS;
+		int y1 = (row + 1) * frame->height / CAMERA_STATISTICS_GRID_ROWS;
+		_camera_statistics_sum_s all[CAMERA_STATISTICS_GRID_COLUMNS];
+		memset(all, 0, sizeof(all));
+		for( y = y0 ; y < y1 ; y++ ){
+			const unsigned char *line = luma + y * luma_stride;
+			int chroma_row = (y >> row_shift) * chroma_stride;
+			for( column = 0 ; column < CAMERA_STATISTICS_GRID_COLUMNS ; column++ ){
+				// an odd last column is left out, it has no chroma sample of its own in every format
+				int x0 = (column * frame->width / CAMERA_STATISTICS_GRID_COLUMNS) & ~1;
+				int x1 = ((column + 1) * frame->width / CAMERA_STATISTICS_GRID_COLUMNS) & ~1;
+				// constant steps let the compiler drop the multiplications of the common layouts
+				if( luma_step == 2 )
+					__statistics_segment(line, 2, cb + chroma_row, cr + chroma_row, 4, x0, x1, levels, clipped, &all[column], &cells[row][column]);
+				else if( chroma_step == 2 )
+					__statistics_segment(line, 1, cb + chroma_row, cr + chroma_row, 2, x0, x1, levels, clipped, &all[column], &cells[row][column]);
+				else
+					__statistics_segment(line, 1, cb + chroma_row, cr + chroma_row, 1, x0, x1, levels, clipped, &all[column], &cells[row][column]);
+			}
+		}
+		for( column = 0 ; column < CAMERA_STATISTICS_GRID_COLUMNS ; column++ ){
+			total.y += all[column].y;
+			total.cb += all[column].cb;
+			total.cr += all[column].cr;
+			total.pixels += all[column].pixels;
+		}
+	}
+
+	statistics->pixels = (unsigned int)total.pixels;
+	for( i = 0 ; i < 256 ; i++ ){
+		statistics->luma_histogram[i] = levels[i] + levels[256 + i] + levels[512 + i] + levels[768 + i];
+		luma_total += (unsigned long long)statistics->luma_histogram[i] * i;
+	}
+	statistics->luma_mean = (int)((luma_total + total.pixels / 2) / total.pixels);
+	__statistics_to_rgb(&total, &statistics->red_mean, &statistics->green_mean, &statistics->blue_mean);
+	statistics->clipped_red = clipped[0];
+	statistics->clipped_green = clipped[1];
+	statistics->clipped_blue = clipped[2];
+
+	for( row = 0 ; row < CAMERA_STATISTICS_GRID_ROWS ; row++ ){
+		for( column = 0 ; column < CAMERA_STATISTICS_GRID_COLUMNS ; column++ ){
+			camera_awb_cell_s *cell = &statistics->awb_grid[row][column];
+			int red;
+			int green;
+			int blue;
+			cell->pixels = (unsigned int)cells[row][column].pixels;
+			cell->red_gain = 1024;
+			cell->blue_gain = 1024;
+			if( cell->pixels == 0 )
+				continue;
+			__statistics_to_rgb(&cells[row][column], &red, &green, &blue);
+			// the gains that turn the mean of the cell gray
+			cell->red_gain = green * 1024 / MAX(red, 1);
+			cell->blue_gain = green * 1024 / MAX(blue, 1);
+		}
+	}
+	return CAMERA_ERROR_NONE;
+}
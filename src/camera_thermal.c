@@ -0,0 +1,282 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <glib.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+#define THERMAL_SYSFS_ROOT "/sys"
+#define THERMAL_MAX_ZONES 32
+#define THERMAL_MAX_CPUS 32
+#define THERMAL_DEFAULT_WARM 45000
+#define THERMAL_DEFAULT_HOT 55000
+#define THERMAL_DEFAULT_CRITICAL 65000
+/* polls in a row over a threshold before the level rises */
+#define THERMAL_RISE_POLLS 2
+/* polls in a row this far below a threshold before the level drops, in millidegrees */
+#define THERMAL_COOL_POLLS 5
+#define THERMAL_HYSTERESIS 3000
+/* a CPU capped below these shares of its maximum frequency is throttled, in percent */
+#define THERMAL_CPU_WARM 80
+#define THERMAL_CPU_HOT 60
+
+/*
+ * Thermal policy : the hottest thermal zone and the most throttled CPU are
+ * read from sysfs on every poll, and turned into a level of pressure. A level
+ * reached on two polls in a row is taken at once, cooling down goes one level
+ * at a time and needs five polls with every zone clear of the threshold by
+ * the hysteresis. What a level does to the camera is up to the caller, the
+ * policy only keeps the log of the steps taken for the statistics.
+ *
+ * The sysfs root can be moved so a test can lay out its own zones.
+ */
+struct _camera_thermal_s {
+	bool running;
+	int thresholds[CAMERA_THERMAL_LEVEL_CRITICAL];
+	camera_thermal_level_e level;
+	int rise_polls;
+	int cool_polls;
+	gint64 started;
+	int step_head;
+	camera_thermal_statistics_s statistics;
+};
+
+static char g_thermal_root[PATH_MAX] = THERMAL_SYSFS_ROOT;
+
+void _camera_thermal_set_sysfs_root(const char *root){
+	g_strlcpy(g_thermal_root, root ? root : THERMAL_SYSFS_ROOT, sizeof(g_thermal_root));
+}
+
+int _camera_thermal_create(camera_thermal_s **thermal){
+	camera_thermal_s *handle;
+
+	if( thermal == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	handle = (camera_thermal_s*)calloc(1, sizeof(camera_thermal_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	*thermal = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_thermal_destroy(camera_thermal_s *thermal){
+	free(thermal);
+}
+
+bool _camera_thermal_is_running(camera_thermal_s *thermal){
+	return thermal != NULL && thermal->running;
+}
+
+static bool __thermal_read_int(const char *path, long long *value){
+	FILE *fp = fopen(path, "r");
+	int fields;
+
+	if( fp == NULL )
+		return false;
+	fields = fscanf(fp, "%lld", value);
+	fclose(fp);
+	return fields == 1;
+}
+
+/* the hottest zone in millidegrees, returns the number of zones read */
+static int __thermal_read_temperature(int *temperature){
+	char path[PATH_MAX];
+	long long value;
+	int zones = 0;
+	int length;
+	int i;
+
+	*temperature = 0;
+	for( i = 0 ; i < THERMAL_MAX_ZONES ; i++ ){
+		// a truncated path would read another file
+		length = snprintf(path, sizeof(path), "%s/class/thermal/thermal_zone%d/temp", g_thermal_root, i);
+		if( length < 0 || length >= (int)sizeof(path) || !__thermal_read_int(path, &value) )
+			continue;
+		if( zones == 0 || value > *temperature )
+			*temperature = (int)CLAMP(value, INT_MIN, INT_MAX);
+		zones++;
+	}
+	return zones;
+}
+
+/* the frequency cap of the most throttled CPU in percent of its maximum, -1 when none can be read */
+static int __thermal_read_cpu_frequency(void){
+	char path[PATH_MAX];
+	long long limit;
+	long long maximum;
+	int lowest = -1;
+	int share;
+	int length;
+	int i;
+
+	for( i = 0 ; i < THERMAL_MAX_CPUS ; i++ ){
+		length = snprintf(path, sizeof(path), "%s/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", g_thermal_root, i);
+		if( length < 0 || length >= (int)sizeof(path) || !__thermal_read_int(path, &maximum) || maximum <= 0 )
+			continue;
+		length = snprintf(path, sizeof(path), "%s/devices/system/cpu/cpu%d/cpufreq/scaling_max_freq", g_thermal_root, i);
+		if( length < 0 || length >= (int)sizeof(path) || !__thermal_read_int(path, &limit) || limit < 0 )
+			continue;
+		share = limit >= maximum ? 100 : (int)(limit * 100 / maximum);
+		if( lowest < 0 || share < lowest )
+			lowest = share;
+	}
+	return lowest;
+}
+
+/* the level of a temperature, with the thresholds lowered by offset */
+static camera_thermal_level_e __thermal_get_level(camera_thermal_s *thermal, int zones, int temperature, int cpu_frequency, int offset){
+	camera_thermal_level_e level = CAMERA_THERMAL_LEVEL_NORMAL;
+
+	while( zones > 0 && level < CAMERA_THERMAL_LEVEL_CRITICAL && temperature >= thermal->thresholds[level] - offset )
+		level++;
+	if( cpu_frequency >= 0 && cpu_frequency < THERMAL_CPU_HOT )
+		level = MAX(level, CAMERA_THERMAL_LEVEL_HOT);
+	else if( cpu_frequency >= 0 && cpu_frequency < THERMAL_CPU_WARM )
+		level = MAX(level, CAMERA_THERMAL_LEVEL_WARM);
+	return level;
+}
+
+int _camera_thermal_start(camera_thermal_s *thermal, int warm, int hot, int critical){
+	if( thermal == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( thermal->running )
+		return CAMERA_ERROR_INVALID_STATE;
+	if( warm == 0 && hot == 0 && critical == 0 ){
+		warm = THERMAL_DEFAULT_WARM;
+		hot = THERMAL_DEFAULT_HOT;
+		critical = THERMAL_DEFAULT_CRITICAL;
+	}
+	if( warm >= hot || hot >= critical )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	memset(thermal, 0, sizeof(camera_thermal_s));
+	thermal->thresholds[0] = warm;
+	thermal->thresholds[1] = hot;
+	thermal->thresholds[2] = critical;
+	thermal->level = CAMERA_THERMAL_LEVEL_NORMAL;
+	thermal->started = g_get_monotonic_time();
+	thermal->statistics.cpu_frequency = -1;
+	thermal->running = true;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_thermal_stop(camera_thermal_s *thermal){
+	if( thermal )
+		thermal->running = false;
+}
+
+/*
+ * Reads the sensors and moves the level, returns true when it moved. The
+ * level is taken from the hottest zone, so one hot zone is enough.
+ */
+bool _camera_thermal_poll(camera_thermal_s *thermal, camera_thermal_level_e *previous, camera_thermal_level_e *level){
+	camera_thermal_statistics_s *statistics;
+	camera_thermal_level_e heat;
+	camera_thermal_level_e cool;
+
+	if( thermal == NULL || !thermal->running )
+		return false;
+	statistics = &thermal->statistics;
+	statistics->zones = __thermal_read_temperature(&statistics->temperature);
+	statistics->cpu_frequency = __thermal_read_cpu_frequency();
+	statistics->polls++;
+
+	heat = __thermal_get_level(thermal, statistics->zones, statistics->temperature, statistics->cpu_frequency, 0);
+	cool = __thermal_get_level(thermal, statistics->zones, statistics->temperature, statistics->cpu_frequency, THERMAL_HYSTERESIS);
+	*previous = thermal->level;
+	if( heat > thermal->level ){
+		thermal->cool_polls = 0;
+		if( ++thermal->rise_polls >= THERMAL_RISE_POLLS ){
+			thermal->level = heat;
+			thermal->rise_polls = 0;
+		}
+	}else if( cool < thermal->level ){
+		thermal->rise_polls = 0;
+		if( ++thermal->cool_polls >= THERMAL_COOL_POLLS ){
+			thermal->level--;
+			thermal->cool_polls = 0;
+		}
+	}else{
+		thermal->rise_polls = 0;
+		thermal->cool_polls = 0;
+	}
+	*level = thermal->level;
+	statistics->level = thermal->level;
+	return *level != *previous;
+}
+
+/* records a step and the settings the caller left with it, stopping the policy is a step back to normal */
+void _camera_thermal_log_step(camera_thermal_s *thermal, camera_thermal_level_e previous, camera_thermal_level_e level, int fps, int width, int height, int jpeg_quality){
+	camera_thermal_statistics_s *statistics;
+	camera_thermal_step_s *step;
+
+	if( thermal == NULL )
+		return;
+	statistics = &thermal->statistics;
+	step = &statistics->steps[thermal->step_head];
+	thermal->step_head = (thermal->step_head + 1) % CAMERA_THERMAL_STEP_LOG;
+	if( statistics->step_count < CAMERA_THERMAL_STEP_LOG )
+		statistics->step_count++;
+	if( level > previous )
+		statistics->steps_down++;
+	else
+		statistics->steps_up++;
+
+	statistics->level = level;
+	step->previous = previous;
+	step->level = level;
+	step->temperature = statistics->temperature;
+	step->cpu_frequency = statistics->cpu_frequency;
+	step->timestamp = (g_get_monotonic_time() - thermal->started) / 1000;
+	step->fps = fps;
+	step->preview_width = width;
+	step->preview_height = height;
+	step->jpeg_quality = jpeg_quality;
+	LOGI("[%s] level %d -> %d at %d mC, cpu cap %d%% : %d fps, %dx%d, quality %d",__func__, previous, step->level,
+		step->temperature, step->cpu_frequency, fps, width, height, jpeg_quality);
+}
+
+int _camera_thermal_get_statistics(camera_thermal_s *thermal, camera_thermal_statistics_s *statistics){
+	int first;
+	int i;
+
+	if( statistics == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( thermal == NULL ){
+		memset(statistics, 0, sizeof(camera_thermal_statistics_s));
+		statistics->cpu_frequency = -1;
+		return CAMERA_ERROR_NONE;
+	}
+	*statistics = thermal->statistics;
+	// the log is a ring, it is handed out oldest first
+	first = thermal->statistics.step_count < CAMERA_THERMAL_STEP_LOG ? 0 : thermal->step_head;
+	for( i = 0 ; i < thermal->statistics.step_count ; i++ )
+		statistics->steps[i] = thermal->statistics.steps[(first + i) % CAMERA_THERMAL_STEP_LOG];
+	return CAMERA_ERROR_NONE;
+}
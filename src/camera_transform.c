@@ -0,0 +1,677 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define TRANSFORM_USE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define TRANSFORM_USE_SSE2
+#endif
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+/* 32x32 bytes of source rows stay in L1 while the destination columns are written */
+#define TRANSFORM_TILE 32
+
+/*
+ * Every rotation / flip combination is one of the 8 symmetries of the rectangle,
+ * so the source position of a destination sample is affine :
+ *   src_x = x0 + x * xx + y * yx
+ *   src_y = y0 + x * xy + y * yy
+ * The frame is flipped first, then rotated clockwise, like the sensor does.
+ */
+typedef struct {
+	int x0;
+	int y0;
+	int xx;
+	int xy;
+	int yx;
+	int yy;
+} _camera_transform_map_s;
+
+
+static void __map_point(camera_rotation_e rotation, camera_flip_e flip, int width, int height, int x, int y, int *sx, int *sy){
+	int px;
+	int py;
+
+	switch( rotation ){
+		case CAMERA_ROTATION_90:
+			px = y;
+			py = height - 1 - x;
+			break;
+		case CAMERA_ROTATION_180:
+			px = width - 1 - x;
+			py = height - 1 - y;
+			break;
+		case CAMERA_ROTATION_270:
+			px = width - 1 - y;
+			py = x;
+			break;
+		case CAMERA_ROTATION_NONE:
+		default:
+			px = x;
+			py = y;
+			break;
+	}
+	*sx = (flip & CAMERA_FLIP_HORIZONTAL) ? width - 1 - px : px;
+	*sy = (flip & CAMERA_FLIP_VERTICAL) ? height - 1 - py : py;
+}
+
+static void __make_map(camera_rotation_e rotation, camera_flip_e flip, int width, int height, _camera_transform_map_s *map){
+	int x1;
+	int y1;
+
+	__map_point(rotation, flip, width, height, 0, 0, &map->x0, &map->y0);
+	__map_point(rotation, flip, width, height, 1, 0, &x1, &y1);
+	map->xx = x1 - map->x0;
+	map->xy = y1 - map->y0;
+	__map_point(rotation, flip, width, height, 0, 1, &x1, &y1);
+	map->yx = x1 - map->x0;
+	map->yy = y1 - map->y0;
+}
+
+static inline bool __is_transposed(camera_rotation_e rotation){
+	return rotation == CAMERA_ROTATION_90 || rotation == CAMERA_ROTATION_270;
+}
+
+static void __reverse_row8(const unsigned char *src, unsigned char *dst, int width){
+	int x = 0;
+#if defined(TRANSFORM_USE_SSE2)
+	for( ; x + 16 <= width ; x += 16 ){
+		__m128i v = _mm_loadu_si128((const __m128i*)(src - x - 15));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		v = _mm_shufflelo_epi16(v, 0x1b);
+		v = _mm_shufflehi_epi16(v, 0x1b);
+		v = _mm_shuffle_epi32(v, 0x4e);
+		_mm_storeu_si128((__m128i*)(dst + x), v);
+	}
+#elif defined(TRANSFORM_USE_NEON)
+	for( ; x + 16 <= width ; x += 16 ){
+		uint8x16_t v = vrev64q_u8(vld1q_u8(src - x - 15));
+		vst1q_u8(dst + x, vcombine_u8(vget_high_u8(v), vget_low_u8(v)));
+	}
+#endif
+	for( ; x < width ; x++ )
+		dst[x] = src[-x];
+}
+
+/* rows[i] are 8 source rows, out[j] receives source column j of those rows */
+static inline void __transpose8x8(const unsigned char *rows[8], unsigned char *out[8]){
+#if defined(TRANSFORM_USE_SSE2)
+	__m128i a0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)rows[0]), _mm_loadl_epi64((const __m128i*)rows[1]));
+	__m128i a1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)rows[2]), _mm_loadl_epi64((const __m128i*)rows[3]));
+	__m128i a2 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)rows[4]), _mm_loadl_epi64((const __m128i*)rows[5]));
+	__m128i a3 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)rows[6]), _mm_loadl_epi64((const __m128i*)rows[7]));
+	__m128i b0 = _mm_unpacklo_epi16(a0, a1);
+	__m128i b1 = _mm_unpackhi_epi16(a0, a1);
+	__m128i b2 = _mm_unpacklo_epi16(a2, a3);
+	__m128i b3 = _mm_unpackhi_epi16(a2, a3);
+	__m128i c0 = _mm_unpacklo_epi32(b0, b2);
+	__m128i c1 = _mm_unpackhi_epi32(b0, b2);
+	__m128i c2 = _mm_unpacklo_epi32(b1, b3);
+	__m128i c3 = _mm_unpackhi_epi32(b1, b3);
+	_mm_storel_epi64((__m128i*)out[0], c0);
+	_mm_storel_epi64((__m128i*)out[1], _mm_srli_si128(c0, 8));
+	_mm_storel_epi64((__m128i*)out[2], c1);
+	_mm_storel_epi64((__m128i*)out[3], _mm_srli_si128(c1, 8));
+	_mm_storel_epi64((__m128i*)out[4], c2);
+	_mm_storel_epi64((__m128i*)out[5], _mm_srli_si128(c2, 8));
+	_mm_storel_epi64((__m128i*)out[6], c3);
+	_mm_storel_epi64((__m128i*)out[7], _mm_srli_si128(c3, 8));
+#elif defined(TRANSFORM_USE_NEON)
+	uint8x8x2_t t0 = vtrn_u8(vld1_u8(rows[0]), vld1_u8(rows[1]));
+	uint8x8x2_t t1 = vtrn_u8(vld1_u8(rows[2]), vld1_u8(rows[3]));
+	uint8x8x2_t t2 = vtrn_u8(vld1_u8(rows[4]), vld1_u8(rows[5]));
+	uint8x8x2_t t3 = vtrn_u8(vld1_u8(rows[6]), vld1_u8(rows[7]));
+	uint16x4x2_t u0 = vtrn_u16(vreinterpret_u16_u8(t0.val[0]), vreinterpret_u16_u8(t1.val[0]));
+	uint16x4x2_t u1 = vtrn_u16(vreinterpret_u16_u8(t0.val[1]), vreinterpret_u16_u8(t1.val[1]));
+	uint16x4x2_t u2 = vtrn_u16(vreinterpret_u16_u8(t2.val[0]), vreinterpret_u16_u8(t3.val[0]));
+	uint16x4x2_t u3 = vtrn_u16(vreinterpret_u16_u8(t2.val[1]), vreinterpret_u16_u8(t3.val[1]));
+	uint32x2x2_t v0 = vtrn_u32(vreinterpret_u32_u16(u0.val[0]), vreinterpret_u32_u16(u2.val[0]));
+	uint32x2x2_t v1 = vtrn_u32(vreinterpret_u32_u16(u1.val[0]), vreinterpret_u32_u16(u3.val[0]));
+	uint32x2x2_t v2 = vtrn_u32(vreinterpret_u32_u16(u0.val[1]), vreinterpret_u32_u16(u2.val[1]));
+	uint32x2x2_t v3 = vtrn_u32(vreinterpret_u32_u16(u1.val[1]), vreinterpret_u32_u16(u3.val[1]));
+	vst1_u8(out[0], vreinterpret_u8_u32(v0.val[0]));
+	vst1_u8(out[1], vreinterpret_u8_u32(v1.val[0]));
+	vst1_u8(out[2], vreinterpret_u8_u32(v2.val[0]));
+	vst1_u8(out[3], vreinterpret_u8_u32(v3.val[0]));
+	vst1_u8(out[4], vreinterpret_u8_u32(v0.val[1]));
+	vst1_u8(out[5], vreinterpret_u8_u32(v1.val[1]));
+	vst1_u8(out[6], vreinterpret_u8_u32(v2.val[1]));
+	vst1_u8(out[7], vreinterpret_u8_u32(v3.val[1]));
+#else
+	int i;
+	int j;
+	for( j = 0 ; j < 8 ; j++ )
+		for( i = 0 ; i < 8 ; i++ )
+			out[j][i] = rows[i][j];
+#endif
+}
+
+/* 8 bit plane (Y, or U / V of planar formats) */
+static void __transform_plane8(const unsigned char *src, int width, int height, unsigned char *dst, camera_rotation_e rotation, camera_flip_e flip){
+	_camera_transform_map_s m;
+	int dst_width = __is_transposed(rotation) ? height : width;
+	int dst_height = __is_transposed(rotation) ? width : height;
+	int tx;
+	int ty;
+	int x;
+	int y;
+
+	__make_map(rotation, flip, width, height, &m);
+
+	if( !__is_transposed(rotation) ){
+		for( y = 0 ; y < dst_height ; y++ ){
+			const unsigned char *s = src + (m.y0 + y * m.yy) * width + m.x0;
+			if( m.xx > 0 )
+				memcpy(dst + y * dst_width, s, dst_width);
+			else
+				__reverse_row8(s, dst + y * dst_width, dst_width);
+		}
+		return;
+	}
+
+	/* destination row y is source column x0 + y * yx, destination column x is source row y0 + x * xy */
+	for( ty = 0 ; ty < dst_height ; ty += TRANSFORM_TILE ){
+		int th = dst_height - ty < TRANSFORM_TILE ? dst_height - ty : TRANSFORM_TILE;
+		for( tx = 0 ; tx < dst_width ; tx += TRANSFORM_TILE ){
+			int tw = dst_width - tx < TRANSFORM_TILE ? dst_width - tx : TRANSFORM_TILE;
+			for( y = 0 ; y + 8 <= th ; y += 8 ){
+				for( x = 0 ; x + 8 <= tw ; x += 8 ){
+					const unsigned char *rows[8];
+					unsigned char *out[8];
+					int column = m.x0 + (ty + y) * m.yx;
+					int first = m.yx > 0 ? column : column - 7;
+					int i;
+					for( i = 0 ; i < 8 ; i++ ){
+						rows[i] = src + (m.y0 + (tx + x + i) * m.xy) * width + first;
+						out[m.yx > 0 ? i : 7 - i] = dst + (ty + y + i) * dst_width + tx + x;
+					}
+					__transpose8x8(rows, out);
+				}
+				for( ; x < tw ; x++ ){
+					int i;
+					for( i = 0 ; i < 8 ; i++ )
+						dst[(ty + y + i) * dst_width + tx + x] = src[(m.y0 + (tx + x) * m.xy) * width + m.x0 + (ty + y + i) * m.yx];
+				}
+			}
+			for( ; y < th ; y++ ){
+				for( x = 0 ; x < tw ; x++ )
+					dst[(ty + y) * dst_width + tx + x] = src[(m.y0 + (tx + x) * m.xy) * width + m.x0 + (ty + y) * m.yx];
+			}
+		}
+	}
+}
+
+static void __reverse_row16(const unsigned short *src, unsigned short *dst, int width){
+	int x = 0;
+#if defined(TRANSFORM_USE_SSE2)
+	for( ; x + 8 <= width ; x += 8 ){
+		__m128i v = _mm_loadu_si128((const __m128i*)(src - x - 7));
+		v = _mm_shufflelo_epi16(v, 0x1b);
+		v = _mm_shufflehi_epi16(v, 0x1b);
+		_mm_storeu_si128((__m128i*)(dst + x), _mm_shuffle_epi32(v, 0x4e));
+	}
+#elif defined(TRANSFORM_USE_NEON)
+	for( ; x + 8 <= width ; x += 8 ){
+		uint16x8_t v = vrev64q_u16(vld1q_u16(src - x - 7));
+		vst1q_u16(dst + x, vcombine_u16(vget_high_u16(v), vget_low_u16(v)));
+	}
+#endif
+	for( ; x < width ; x++ )
+		dst[x] = src[-x];
+}
+
+/* 16 bit samples, rows[i] are 8 source rows, out[j] receives source column j of those rows */
+static inline void __transpose8x8_16(const unsigned short *rows[8], unsigned short *out[8]){
+#if defined(TRANSFORM_USE_SSE2)
+	__m128i a0 = _mm_unpacklo_epi16(_mm_loadu_si128((const __m128i*)rows[0]), _mm_loadu_si128((const __m128i*)rows[1]));
+	__m128i a1 = _mm_unpackhi_epi16(_mm_loadu_si128((const __m128i*)rows[0]), _mm_loadu_si128((const __m128i*)rows[1]));
+	__m128i a2 = _mm_unpacklo_epi16(_mm_loadu_si128((const __m128i*)rows[2]), _mm_loadu_si128((const __m128i*)rows[3]));
+	__m128i a3 = _mm_unpackhi_epi16(_mm_loadu_si128((const __m128i*)rows[2]), _mm_loadu_si128((const __m128i*)rows[3]));
+	__m128i a4 = _mm_unpacklo_epi16(_mm_loadu_si128((const __m128i*)rows[4]), _mm_loadu_si128((const __m128i*)rows[5]));
+	__m128i a5 = _mm_unpackhi_epi16(_mm_loadu_si128((const __m128i*)rows[4]), _mm_loadu_si128((const __m128i*)rows[5]));
+	__m128i a6 = _mm_unpacklo_epi16(_mm_loadu_si128((const __m128i*)rows[6]), _mm_loadu_si128((const __m128i*)rows[7]));
+	__m128i a7 = _mm_unpackhi_epi16(_mm_loadu_si128((const __m128i*)rows[6]), _mm_loadu_si128((const __m128i*)rows[7]));
+	__m128i b0 = _mm_unpacklo_epi32(a0, a2);
+	__m128i b1 = _mm_unpackhi_epi32(a0, a2);
+	__m128i b2 = _mm_unpacklo_epi32(a1, a3);
+	__m128i b3 = _mm_unpackhi_epi32(a1, a3);
+	__m128i b4 = _mm_unpacklo_epi32(a4, a6);
+	__m128i b5 = _mm_unpackhi_epi32(a4, a6);
+	__m128i b6 = _mm_unpacklo_epi32(a5, a7);
+	__m128i b7 = _mm_unpackhi_epi32(a5, a7);
+	_mm_storeu_si128((__m128i*)out[0], _mm_unpacklo_epi64(b0, b4));
+	_mm_storeu_si128((__m128i*)out[1], _mm_unpackhi_epi64(b0, b4));
+	_mm_storeu_si128((__m128i*)out[2], _mm_unpacklo_epi64(b1, b5));
+	_mm_storeu_si128((__m128i*)out[3], _mm_unpackhi_epi64(b1, b5));
+	_mm_storeu_si128((__m128i*)out[4], _mm_unpacklo_epi64(b2, b6));
+	_mm_storeu_si128((__m128i*)out[5], _mm_unpackhi_epi64(b2, b6));
+	_mm_storeu_si128((__m128i*)out[6], _mm_unpacklo_epi64(b3, b7));
+	_mm_storeu_si128((__m128i*)out[7], _mm_unpackhi_epi64(b3, b7));
+#elif defined(TRANSFORM_USE_NEON)
+	uint16x8x2_t t0 = vtrnq_u16(vld1q_u16(rows[0]), vld1q_u16(rows[1]));
+	uint16x8x2_t t1 = vtrnq_u16(vld1q_u16(rows[2]), vld1q_u16(rows[3]));
+	uint16x8x2_t t2 = vtrnq_u16(vld1q_u16(rows[4]), vld1q_u16(rows[5]));
+	uint16x8x2_t t3 = vtrnq_u16(vld1q_u16(rows[6]), vld1q_u16(rows[7]));
+	/* columns 0 / 4 and 2 / 6 of the even pairs, 1 / 5 and 3 / 7 of the odd ones */
+	uint32x4x2_t u0 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[0]), vreinterpretq_u32_u16(t1.val[0]));
+	uint32x4x2_t u1 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[1]), vreinterpretq_u32_u16(t1.val[1]));
+	uint32x4x2_t u2 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[0]), vreinterpretq_u32_u16(t3.val[0]));
+	uint32x4x2_t u3 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[1]), vreinterpretq_u32_u16(t3.val[1]));
+	vst1q_u16(out[0], vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u0.val[0]), vget_low_u32(u2.val[0]))));
+	vst1q_u16(out[1], vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u1.val[0]), vget_low_u32(u3.val[0]))));
+	vst1q_u16(out[2], vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u0.val[1]), vget_low_u32(u2.val[1]))));
+	vst1q_u16(out[3], vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u1.val[1]), vget_low_u32(u3.val[1]))));
+	vst1q_u16(out[4], vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u0.val[0]), vget_high_u32(u2.val[0]))));
+	vst1q_u16(out[5], vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u1.val[0]), vget_high_u32(u3.val[0]))));
+	vst1q_u16(out[6], vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u0.val[1]), vget_high_u32(u2.val[1]))));
+	vst1q_u16(out[7], vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u1.val[1]), vget_high_u32(u3.val[1]))));
+#else
+	int i;
+	int j;
+	for( j = 0 ; j < 8 ; j++ )
+		for( i = 0 ; i < 8 ; i++ )
+			out[j][i] = rows[i][j];
+#endif
+}
+
+/* interleaved 16 bit samples (UV plane of NV12 / NV21) */
+static void __transform_plane16(const unsigned short *src, int width, int height, unsigned short *dst, camera_rotation_e rotation, camera_flip_e flip){
+	_camera_transform_map_s m;
+	int dst_width = __is_transposed(rotation) ? height : width;
+	int dst_height = __is_transposed(rotation) ? width : height;
+	int tx;
+	int ty;
+	int x;
+	int y;
+
+	__make_map(rotation, flip, width, height, &m);
+
+	if( !__is_transposed(rotation) ){
+		for( y = 0 ; y < dst_height ; y++ ){
+			const unsigned short *s = src + (m.y0 + y * m.yy) * width + m.x0;
+			if( m.xx > 0 )
+				memcpy(dst + y * dst_width, s, dst_width * sizeof(unsigned short));
+			else
+				__reverse_row16(s, dst + y * dst_width, dst_width);
+		}
+		return;
+	}
+
+	/* same walk as the 8 bit planes, a UV pair moves as one sample */
+	for( ty = 0 ; ty < dst_height ; ty += TRANSFORM_TILE ){
+		int th = dst_height - ty < TRANSFORM_TILE ? dst_height - ty : TRANSFORM_TILE;
+		for( tx = 0 ; tx < dst_width ; tx += TRANSFORM_TILE ){
+			int tw = dst_width - tx < TRANSFORM_TILE ? dst_width - tx : TRANSFORM_TILE;
+			for( y = 0 ; y + 8 <= th ; y += 8 ){
+				for( x = 0 ; x + 8 <= tw ; x += 8 ){
+					const unsigned short *rows[8];
+					unsigned short *out[8];
+					int column = m.x0 + (ty + y) * m.yx;
+					int first = m.yx > 0 ? column : column - 7;
+					int i;
+					for( i = 0 ; i < 8 ; i++ ){
+						rows[i] = src + (m.y0 + (tx + x + i) * m.xy) * width + first;
+						out[m.yx > 0 ? i : 7 - i] = dst + (ty + y + i) * dst_width + tx + x;
+					}
+					__transpose8x8_16(rows, out);
+				}
+				for( ; x < tw ; x++ ){
+					int i;
+					for( i = 0 ; i < 8 ; i++ )
+						dst[(ty + y + i) * dst_width + tx + x] = src[(m.y0 + (tx + x) * m.xy) * width + m.x0 + (ty + y + i) * m.yx];
+				}
+			}
+			for( ; y < th ; y++ ){
+				for( x = 0 ; x < tw ; x++ )
+					dst[(ty + y) * dst_width + tx + x] = src[(m.y0 + (tx + x) * m.xy) * width + m.x0 + (ty + y) * m.yx];
+			}
+		}
+	}
+}
+
+/*
+ * Mirrored 4:2:2 row : macro pixels come in reverse order with their two luma
+ * samples swapped, src is the last macro pixel of the source row.
+ */
+static void __reverse_row422(const unsigned char *src, unsigned char *dst, int macros, int y_offset){
+	int k = 0;
+#if defined(TRANSFORM_USE_SSE2)
+	const __m128i luma = _mm_set1_epi32(y_offset ? 0xff00ff00 : 0x00ff00ff);
+	for( ; k + 4 <= macros ; k += 4 ){
+		__m128i v = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(src - (k + 3) * 4)), 0x1b);
+		__m128i swapped = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1);
+		_mm_storeu_si128((__m128i*)(dst + k * 4), _mm_or_si128(_mm_and_si128(luma, swapped), _mm_andnot_si128(luma, v)));
+	}
+#elif defined(TRANSFORM_USE_NEON)
+	const uint8x16_t luma = vreinterpretq_u8_u32(vdupq_n_u32(y_offset ? 0xff00ff00 : 0x00ff00ff));
+	for( ; k + 4 <= macros ; k += 4 ){
+		uint32x4_t r = vrev64q_u32(vld1q_u32((const uint32_t*)(src - (k + 3) * 4)));
+		uint8x16_t v = vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(r), vget_low_u32(r)));
+		uint8x16_t swapped = vreinterpretq_u8_u16(vrev32q_u16(vreinterpretq_u16_u8(v)));
+		vst1q_u8(dst + k * 4, vbslq_u8(luma, swapped, v));
+	}
+#endif
+	for( ; k < macros ; k++ ){
+		const unsigned char *s = src - k * 4;
+		unsigned char *d = dst + k * 4;
+		d[y_offset] = s[y_offset + 2];
+		d[y_offset + 2] = s[y_offset];
+		d[1 - y_offset] = s[1 - y_offset];
+		d[3 - y_offset] = s[3 - y_offset];
+	}
+}
+
+#if defined(TRANSFORM_USE_SSE2) || defined(TRANSFORM_USE_NEON)
+/*
+ * 8x8 pixels of a rotated 4:2:2 frame. rows[i] point at an even pixel of 8 source
+ * rows, out[j] receives source column j from there as 8 pixels. Luma is transposed
+ * as bytes, each output pair takes the chroma word its even row has at that column.
+ */
+static inline void __transpose_packed422_8x8(const unsigned char *rows[8], unsigned char *out[8], int y_offset){
+#if defined(TRANSFORM_USE_SSE2)
+	const __m128i low = _mm_set1_epi16(0x00ff);
+	__m128i y[8];
+	__m128i c[4];
+	int i;
+
+	for( i = 0 ; i < 8 ; i++ ){
+		__m128i v = _mm_loadu_si128((const __m128i*)rows[i]);
+		y[i] = _mm_packus_epi16(y_offset ? _mm_srli_epi16(v, 8) : _mm_and_si128(v, low), v);
+	}
+	/* chroma of every pixel, the two pixels of a macro pixel share it */
+	for( i = 0 ; i < 4 ; i++ ){
+		__m128i v = _mm_loadu_si128((const __m128i*)rows[i * 2]);
+		v = _mm_packus_epi16(y_offset ? _mm_and_si128(v, low) : _mm_srli_epi16(v, 8), v);
+		c[i] = _mm_unpacklo_epi16(v, v);
+	}
+
+	__m128i a0 = _mm_unpacklo_epi8(y[0], y[1]);
+	__m128i a1 = _mm_unpacklo_epi8(y[2], y[3]);
+	__m128i a2 = _mm_unpacklo_epi8(y[4], y[5]);
+	__m128i a3 = _mm_unpacklo_epi8(y[6], y[7]);
+	__m128i b0 = _mm_unpacklo_epi16(a0, a1);
+	__m128i b1 = _mm_unpackhi_epi16(a0, a1);
+	__m128i b2 = _mm_unpacklo_epi16(a2, a3);
+	__m128i b3 = _mm_unpackhi_epi16(a2, a3);
+	/* luma of columns 2k and 2k + 1 */
+	__m128i l[4] = { _mm_unpacklo_epi32(b0, b2), _mm_unpackhi_epi32(b0, b2), _mm_unpacklo_epi32(b1, b3), _mm_unpackhi_epi32(b1, b3) };
+	__m128i d0 = _mm_unpacklo_epi16(c[0], c[1]);
+	__m128i d1 = _mm_unpackhi_epi16(c[0], c[1]);
+	__m128i d2 = _mm_unpacklo_epi16(c[2], c[3]);
+	__m128i d3 = _mm_unpackhi_epi16(c[2], c[3]);
+	/* the 4 chroma words of columns 2k and 2k + 1 */
+	__m128i u[4] = { _mm_unpacklo_epi32(d0, d2), _mm_unpackhi_epi32(d0, d2), _mm_unpacklo_epi32(d1, d3), _mm_unpackhi_epi32(d1, d3) };
+
+	for( i = 0 ; i < 4 ; i++ ){
+		_mm_storeu_si128((__m128i*)out[i * 2], y_offset ? _mm_unpacklo_epi8(u[i], l[i]) : _mm_unpacklo_epi8(l[i], u[i]));
+		_mm_storeu_si128((__m128i*)out[i * 2 + 1], y_offset ? _mm_unpackhi_epi8(u[i], l[i]) : _mm_unpackhi_epi8(l[i], u[i]));
+	}
+#else
+	uint8x8_t y[8];
+	uint16x8_t c[4];
+	int i;
+
+	for( i = 0 ; i < 8 ; i++ ){
+		uint8x8x2_t v = vld2_u8(rows[i]);
+		y[i] = v.val[y_offset];
+	}
+	/* chroma of every pixel, the two pixels of a macro pixel share it */
+	for( i = 0 ; i < 4 ; i++ ){
+		uint16x4_t a = vreinterpret_u16_u8(vld2_u8(rows[i * 2]).val[1 - y_offset]);
+		uint16x4x2_t z = vzip_u16(a, a);
+		c[i] = vcombine_u16(z.val[0], z.val[1]);
+	}
+
+	uint8x8x2_t t0 = vtrn_u8(y[0], y[1]);
+	uint8x8x2_t t1 = vtrn_u8(y[2], y[3]);
+	uint8x8x2_t t2 = vtrn_u8(y[4], y[5]);
+	uint8x8x2_t t3 = vtrn_u8(y[6], y[7]);
+	uint16x4x2_t s0 = vtrn_u16(vreinterpret_u16_u8(t0.val[0]), vreinterpret_u16_u8(t1.val[0]));
+	uint16x4x2_t s1 = vtrn_u16(vreinterpret_u16_u8(t0.val[1]), vreinterpret_u16_u8(t1.val[1]));
+	uint16x4x2_t s2 = vtrn_u16(vreinterpret_u16_u8(t2.val[0]), vreinterpret_u16_u8(t3.val[0]));
+	uint16x4x2_t s3 = vtrn_u16(vreinterpret_u16_u8(t2.val[1]), vreinterpret_u16_u8(t3.val[1]));
+	uint32x2x2_t v0 = vtrn_u32(vreinterpret_u32_u16(s0.val[0]), vreinterpret_u32_u16(s2.val[0]));
+	uint32x2x2_t v1 = vtrn_u32(vreinterpret_u32_u16(s1.val[0]), vreinterpret_u32_u16(s3.val[0]));
+	uint32x2x2_t v2 = vtrn_u32(vreinterpret_u32_u16(s0.val[1]), vreinterpret_u32_u16(s2.val[1]));
+	uint32x2x2_t v3 = vtrn_u32(vreinterpret_u32_u16(s1.val[1]), vreinterpret_u32_u16(s3.val[1]));
+	uint8x8_t l[8] = {
+		vreinterpret_u8_u32(v0.val[0]), vreinterpret_u8_u32(v1.val[0]), vreinterpret_u8_u32(v2.val[0]), vreinterpret_u8_u32(v3.val[0]),
+		vreinterpret_u8_u32(v0.val[1]), vreinterpret_u8_u32(v1.val[1]), vreinterpret_u8_u32(v2.val[1]), vreinterpret_u8_u32(v3.val[1])
+	};
+	uint16x8x2_t e0 = vtrnq_u16(c[0], c[1]);
+	uint16x8x2_t e1 = vtrnq_u16(c[2], c[3]);
+	/* chroma words of columns 0 / 4, 2 / 6, 1 / 5 and 3 / 7 */
+	uint32x4x2_t w0 = vtrnq_u32(vreinterpretq_u32_u16(e0.val[0]), vreinterpretq_u32_u16(e1.val[0]));
+	uint32x4x2_t w1 = vtrnq_u32(vreinterpretq_u32_u16(e0.val[1]), vreinterpretq_u32_u16(e1.val[1]));
+	uint8x8_t u[8] = {
+		vreinterpret_u8_u32(vget_low_u32(w0.val[0])), vreinterpret_u8_u32(vget_low_u32(w1.val[0])),
+		vreinterpret_u8_u32(vget_low_u32(w0.val[1])), vreinterpret_u8_u32(vget_low_u32(w1.val[1])),
+		vreinterpret_u8_u32(vget_high_u32(w0.val[0])), vreinterpret_u8_u32(vget_high_u32(w1.val[0])),
+		vreinterpret_u8_u32(vget_high_u32(w0.val[1])), vreinterpret_u8_u32(vget_high_u32(w1.val[1]))
+	};
+
+	for( i = 0 ; i < 8 ; i++ ){
+		uint8x8x2_t pixels;
+		pixels.val[y_offset] = l[i];
+		pixels.val[1 - y_offset] = u[i];
+		vst2_u8(out[i], pixels);
+	}
+#endif
+}
+#endif
+
+/* one output pair at x, y of a 4:2:2 frame, the chroma is the one of its first pixel */
+static inline void __packed422_pair(const unsigned char *src, int src_stride, const _camera_transform_map_s *m, unsigned char *d, int x, int y, int y_offset){
+	int u_offset = y_offset ? 0 : 1;
+	int sx0 = m->x0 + x * m->xx + y * m->yx;
+	int sy0 = m->y0 + x * m->xy + y * m->yy;
+	int sx1 = sx0 + m->xx;
+	int sy1 = sy0 + m->xy;
+	const unsigned char *p0 = src + sy0 * src_stride + (sx0 & ~1) * 2;
+
+	d[y_offset] = p0[(sx0 & 1) * 2 + y_offset];
+	d[y_offset + 2] = src[sy1 * src_stride + sx1 * 2 + y_offset];
+	d[u_offset] = p0[u_offset];
+	d[u_offset + 2] = p0[u_offset + 2];
+}
+
+/* YUYV / UYVY : luma per pixel, each output pair takes the chroma of its first pixel */
+static void __transform_packed422(const unsigned char *src, int width, int height, unsigned char *dst, int y_offset, camera_rotation_e rotation, camera_flip_e flip){
+	_camera_transform_map_s m;
+	int dst_width = __is_transposed(rotation) ? height : width;
+	int dst_height = __is_transposed(rotation) ? width : height;
+	int src_stride = width * 2;
+	int tx;
+	int ty;
+	int x;
+	int y;
+
+	__make_map(rotation, flip, width, height, &m);
+
+	// rows keep their pixel order, macro pixels can be copied whole
+	if( m.xx == 1 ){
+		for( y = 0 ; y < dst_height ; y++ )
+			memcpy(dst + y * src_stride, src + (m.y0 + y * m.yy) * src_stride, src_stride);
+		return;
+	}
+	// mirrored rows, a macro pixel stays whole with its luma swapped
+	if( m.xx == -1 ){
+		for( y = 0 ; y < dst_height ; y++ )
+			__reverse_row422(src + (m.y0 + y * m.yy) * src_stride + src_stride - 4, dst + y * src_stride, width / 2, y_offset);
+		return;
+	}
+
+	for( ty = 0 ; ty < dst_height ; ty += TRANSFORM_TILE ){
+		int th = dst_height - ty < TRANSFORM_TILE ? dst_height - ty : TRANSFORM_TILE;
+		for( tx = 0 ; tx < dst_width ; tx += TRANSFORM_TILE ){
+			int tw = dst_width - tx < TRANSFORM_TILE ? dst_width - tx : TRANSFORM_TILE;
+			y = ty;
+#if defined(TRANSFORM_USE_SSE2) || defined(TRANSFORM_USE_NEON)
+			for( ; y + 8 <= ty + th ; y += 8 ){
+				int column = m.x0 + y * m.yx;
+				/* the width is even, so a block starting at column 0 or ending at width - 1 starts on a macro pixel */
+				int first = m.yx > 0 ? column : column - 7;
+				for( x = tx ; x + 8 <= tx + tw ; x += 8 ){
+					const unsigned char *rows[8];
+					unsigned char *out[8];
+					int i;
+					for( i = 0 ; i < 8 ; i++ ){
+						rows[i] = src + (m.y0 + (x + i) * m.xy) * src_stride + first * 2;
+						out[m.yx > 0 ? i : 7 - i] = dst + (y + i) * dst_width * 2 + x * 2;
+					}
+					__transpose_packed422_8x8(rows, out, y_offset);
+				}
+				for( ; x < tx + tw ; x += 2 ){
+					int i;
+					for( i = 0 ; i < 8 ; i++ )
+						__packed422_pair(src, src_stride, &m, dst + (y + i) * dst_width * 2 + x * 2, x, y + i, y_offset);
+				}
+			}
+#endif
+			for( ; y < ty + th ; y++ ){
+				for( x = tx ; x < tx + tw ; x += 2 )
+					__packed422_pair(src, src_stride, &m, dst + y * dst_width * 2 + x * 2, x, y, y_offset);
+			}
+		}
+	}
+}
+
+bool _camera_image_is_transform_supported(camera_pixel_format_e format){
+	switch( format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+			return true;
+		default:
+			return false;
+	}
+}
+
+int _camera_image_transform(camera_image_data_s *src, camera_rotation_e rotation, camera_flip_e flip, camera_image_data_s *dst){
+	int w;
+	int h;
+	unsigned int size;
+
+	if( src == NULL || dst == NULL || dst->data == NULL || !_camera_image_is_transform_supported(src->format) || !_camera_image_is_valid(src) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	w = src->width;
+	h = src->height;
+	size = _camera_get_image_size(src->format, w, h);
+	/* packed 4:2:2 needs an even width after rotation too */
+	if( __is_transposed(rotation) && _camera_get_image_size(src->format, h, w) == 0 )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( dst->size < size )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	switch( src->format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV21:
+			__transform_plane8(src->data, w, h, dst->data, rotation, flip);
+			__transform_plane16((const unsigned short*)(src->data + w * h), w / 2, h / 2, (unsigned short*)(dst->data + w * h), rotation, flip);
+			break;
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+			__transform_plane8(src->data, w, h, dst->data, rotation, flip);
+			__transform_plane8(src->data + w * h, w / 2, h / 2, dst->data + w * h, rotation, flip);
+			__transform_plane8(src->data + w * h + w * h / 4, w / 2, h / 2, dst->data + w * h + w * h / 4, rotation, flip);
+			break;
+		case CAMERA_PIXEL_FORMAT_YUYV:
+			__transform_packed422(src->data, w, h, dst->data, 0, rotation, flip);
+			break;
+		case CAMERA_PIXEL_FORMAT_UYVY:
+			__transform_packed422(src->data, w, h, dst->data, 1, rotation, flip);
+			break;
+		default:
+			return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	dst->size = size;
+	dst->format = src->format;
+	dst->width = __is_transposed(rotation) ? h : w;
+	dst->height = __is_transposed(rotation) ? w : h;
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_image_buffer_reserve(camera_image_buffer_s *buffer, unsigned int size){
+	unsigned char *data;
+
+	if( buffer == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( buffer->capacity >= size )
+		return CAMERA_ERROR_NONE;
+
+	data = (unsigned char*)realloc(buffer->data, size);
+	if( data == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	buffer->data = data;
+	buffer->capacity = size;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_image_buffer_release(camera_image_buffer_s *buffer){
+	if( buffer == NULL )
+		return;
+	free(buffer->data);
+	buffer->data = NULL;
+	buffer->capacity = 0;
+}
+
+int camera_image_transform(camera_image_data_s *image, camera_rotation_e rotation, camera_flip_e flip, camera_image_data_s *transformed){
+	camera_image_data_s dst;
+	int ret;
+
+	if( image == NULL || transformed == NULL || rotation < CAMERA_ROTATION_NONE || rotation > CAMERA_ROTATION_270 || flip < CAMERA_FLIP_NONE || flip > CAMERA_FLIP_BOTH ){
+		LOGE( "[%s] INVALID_PARAMETER(0x%08x)",__func__,CAMERA_ERROR_INVALID_PARAMETER);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+	if( !_camera_image_is_transform_supported(image->format) || !_camera_image_is_valid(image) ){
+		LOGE( "[%s] unsupported image(format %d, %dx%d)",__func__, image->format, image->width, image->height);
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	}
+
+	dst.size = _camera_get_image_size(image->format, image->width, image->height);
+	dst.data = (unsigned char*)malloc(dst.size);
+	if( dst.data == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	ret = _camera_image_transform(image, rotation, flip, &dst);
+	if( ret != CAMERA_ERROR_NONE ){
+		free(dst.data);
+		return ret;
+	}
+	*transformed = dst;
+	return CAMERA_ERROR_NONE;
+}
@@ -0,0 +1,375 @@
+/*
+* Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <camera.h>
+#include <camera_private.h>
+#include <dlog.h>
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define WDR_USE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define WDR_USE_SSE2
+#endif
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_CAMERA"
+
+#define WDR_TILES_X 8
+#define WDR_TILES_Y 8
+/* a histogram bin is clipped at this many times the mean bin count */
+#define WDR_CLIP_LIMIT 3
+/* share of the equalized curve in the tone curve, out of 256, the rest is identity */
+#define WDR_STRENGTH 192
+/* tile rows whose histograms are refreshed per preview frame */
+#define WDR_REFRESH_ROWS 2
+/* weight of a refreshed curve against the previous one, out of 256 */
+#define WDR_TEMPORAL 96
+/* histograms sample every other pixel of every other row */
+#define WDR_SAMPLE_STEP 2
+
+/*
+ * Software WDR : contrast limited adaptive histogram equalization of the
+ * luma. Every tile of an 8x8 grid gets a tone curve from its clipped
+ * histogram, and each pixel blends the curves of the four nearest tile
+ * centers. Chroma is left alone.
+ *
+ * On a stream only WDR_REFRESH_ROWS tile rows are measured per frame and
+ * their curves move towards the new ones by WDR_TEMPORAL, which keeps the
+ * cost per frame low and stops the tone from flickering. A single frame
+ * (wdr == NULL) is measured completely.
+ */
+struct _camera_wdr_s {
+	int width;
+	int height;
+	camera_pixel_format_e format;
+	bool valid;
+	int next_row;
+	int tile_x[WDR_TILES_X + 1];
+	int tile_y[WDR_TILES_Y + 1];
+	unsigned char *column;
+	unsigned char *weight_x;
+	unsigned char *tile_row;
+	unsigned char *weight_y;
+	unsigned char lut[WDR_TILES_Y][WDR_TILES_X][256];
+	unsigned char row_lut[WDR_TILES_X][256];
+};
+
+bool _camera_wdr_is_supported_format(camera_pixel_format_e format){
+	switch( format ){
+		case CAMERA_PIXEL_FORMAT_NV12:
+		case CAMERA_PIXEL_FORMAT_NV16:
+		case CAMERA_PIXEL_FORMAT_NV21:
+		case CAMERA_PIXEL_FORMAT_YUYV:
+		case CAMERA_PIXEL_FORMAT_UYVY:
+		case CAMERA_PIXEL_FORMAT_422P:
+		case CAMERA_PIXEL_FORMAT_I420:
+		case CAMERA_PIXEL_FORMAT_YV12:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * SSE2 and NEON have no scatter, so the histogram is counted into four
+ * interleaved sub-histograms to keep the increments independent, and the
+ * vector units do the merge.
+ */
+static void __wdr_histogram(const unsigned char *luma, int stride, int step, int x0, int x1, int y0, int y1, unsigned int *histogram){
+	unsigned int sub[4][256];
+	int x;
+	int y;
+	int i;
+
+	memset(sub, 0, sizeof(sub));
+	for( y = y0 ; y < y1 ; y += WDR_SAMPLE_STEP ){
+		const unsigned char *row = luma + y * stride;
+		int inc = WDR_SAMPLE_STEP * step;
+		x = x0 * step;
+		for( ; x + 3 * inc < x1 * step ; x += 4 * inc ){
+			sub[0][row[x]]++;
+			sub[1][row[x + inc]]++;
+			sub[2][row[x + 2 * inc]]++;
+			sub[3][row[x + 3 * inc]]++;
+		}
+		for( ; x < x1 * step ; x += inc )
+			sub[0][row[x]]++;
+	}
+
+	i = 0;
+#if defined(WDR_USE_SSE2)
+	for( ; i < 256 ; i += 4 ){
+		__m128i a = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(sub[0] + i)), _mm_loadu_si128((const __m128i*)(sub[1] + i)));
+		__m128i b = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(sub[2] + i)), _mm_loadu_si128((const __m128i*)(sub[3] + i)));
+		_mm_storeu_si128((__m128i*)(histogram + i), _mm_add_epi32(a, b));
+	}
+#elif defined(WDR_USE_NEON)
+	for( ; i < 256 ; i += 4 )
+		vst1q_u32(histogram + i, vaddq_u32(vaddq_u32(vld1q_u32(sub[0] + i), vld1q_u32(sub[1] + i)), vaddq_u32(vld1q_u32(sub[2] + i), vld1q_u32(sub[3] + i))));
+#endif
+	for( ; i < 256 ; i++ )
+		histogram[i] = sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i];
+}
+
+/* clipped histogram to tone curve, blended into lut by weight out of 256 */
+static void __wdr_make_curve(unsigned int *histogram, unsigned char *lut, int weight){
+	unsigned int total = 0;
+	unsigned int limit;
+	unsigned int excess = 0;
+	unsigned int cdf = 0;
+	unsigned int bonus;
+	int i;
+
+	for( i = 0 ; i < 256 ; i++ )
+		total += histogram[i];
+	if( total == 0 )
+		return;
+	limit = WDR_CLIP_LIMIT * total / 256;
+	if( limit < 1 )
+		limit = 1;
+	for( i = 0 ; i < 256 ; i++ ){
+		if( histogram[i] > limit ){
+			excess += histogram[i] - limit;
+			histogram[i] = limit;
+		}
+	}
+	// the clipped counts are spread evenly, which caps the slope of the curve
+	bonus = excess / 256;
+	excess -= bonus * 256;
+	for( i = 0 ; i < 256 ; i++ ){
+		int equalized;
+		int value;
+		cdf += histogram[i] + bonus + (i < (int)excess);
+		equalized = (int)((unsigned long long)cdf * 255 / total);
+		value = (equalized * WDR_STRENGTH + i * (256 - WDR_STRENGTH) + 128) >> 8;
+		lut[i] = (lut[i] * (256 - weight) + value * weight + 128) >> 8;
+	}
+}
+
+/* row_lut = lut_top + (lut_bottom - lut_top) * weight / 256 for every tile column */
+static void __wdr_blend_rows(const unsigned char *top, const unsigned char *bottom, int weight, unsigned char *out){
+	int i = 0;
+	int count = WDR_TILES_X * 256;
+
+#if defined(WDR_USE_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i wb = _mm_set1_epi16(weight);
+	const __m128i wt = _mm_set1_epi16(256 - weight);
+	const __m128i round = _mm_set1_epi16(128);
+	for( ; i < count ; i += 16 ){
+		__m128i t = _mm_loadu_si128((const __m128i*)(top + i));
+		__m128i b = _mm_loadu_si128((const __m128i*)(bottom + i));
+		__m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(t, zero), wt), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), wb));
+		__m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(t, zero), wt), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), wb));
+		lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 8);
+		hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 8);
+		_mm_storeu_si128((__m128i*)(out + i), _mm_packus_epi16(lo, hi));
+	}
+#elif defined(WDR_USE_NEON)
+	const uint16x8_t wb = vdupq_n_u16(weight);
+	const uint16x8_t wt = vdupq_n_u16(256 - weight);
+	for( ; i < count ; i += 16 ){
+		uint8x16_t t = vld1q_u8(top + i);
+		uint8x16_t b = vld1q_u8(bottom + i);
+		uint16x8_t lo = vmlaq_u16(vmulq_u16(vmovl_u8(vget_low_u8(t)), wt), vmovl_u8(vget_low_u8(b)), wb);
+		uint16x8_t hi = vmlaq_u16(vmulq_u16(vmovl_u8(vget_high_u8(t)), wt), vmovl_u8(vget_high_u8(b)), wb);
+		vst1q_u8(out + i, vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+	}
+#endif
+	for( ; i < count ; i++ )
+		out[i] = (top[i] * (256 - weight) + bottom[i] * weight + 128) >> 8;
+}
+
+/* tile index left of (or above) each position and the weight of the next tile, out of 256 with 255 for all */
+static void __wdr_interpolation(const int *bounds, int tiles, int length, unsigned char *index, unsigned char *weight){
+	int i;
+	int t = 0;
+
+	for( i = 0 ; i < length ; i++ ){
+		int center;
+		int next;
+		while( t < tiles - 2 && i >= (bounds[t + 1] + bounds[t + 2]) / 2 )
+			t++;
+		center = (bounds[t] + bounds[t + 1]) / 2;
+		next = (bounds[t + 1] + bounds[t + 2]) / 2;
+		index[i] = t;
+		if( i <= center )
+			weight[i] = 0;
+		else if( i >= next )
+			weight[i] = 255;
+		else
+			weight[i] = (i - center) * 256 / (next - center);
+	}
+}
+
+static int __wdr_reset(camera_wdr_s *wdr, camera_image_data_s *image){
+	unsigned char *data;
+	int i;
+	int j;
+
+	data = (unsigned char*)realloc(wdr->column, (image->width + image->height) * 2);
+	if( data == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	wdr->column = data;
+	wdr->weight_x = data + image->width;
+	wdr->tile_row = data + image->width * 2;
+	wdr->weight_y = wdr->tile_row + image->height;
+	for( i = 0 ; i <= WDR_TILES_X ; i++ )
+		wdr->tile_x[i] = image->width * i / WDR_TILES_X;
+	for( i = 0 ; i <= WDR_TILES_Y ; i++ )
+		wdr->tile_y[i] = image->height * i / WDR_TILES_Y;
+	__wdr_interpolation(wdr->tile_x, WDR_TILES_X, image->width, wdr->column, wdr->weight_x);
+	__wdr_interpolation(wdr->tile_y, WDR_TILES_Y, image->height, wdr->tile_row, wdr->weight_y);
+	for( i = 0 ; i < WDR_TILES_Y ; i++ ){
+		for( j = 0 ; j < WDR_TILES_X ; j++ )
+			memset(wdr->lut[i][j], 0, 256);
+	}
+	wdr->width = image->width;
+	wdr->height = image->height;
+	wdr->format = image->format;
+	wdr->valid = false;
+	wdr->next_row = 0;
+	return CAMERA_ERROR_NONE;
+}
+
+int _camera_wdr_create(camera_wdr_s **wdr){
+	camera_wdr_s *handle;
+
+	if( wdr == NULL )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	handle = (camera_wdr_s*)calloc(1, sizeof(camera_wdr_s));
+	if( handle == NULL ){
+		LOGE("[%s] malloc fail",__func__);
+		return CAMERA_ERROR_OUT_OF_MEMORY;
+	}
+	*wdr = handle;
+	return CAMERA_ERROR_NONE;
+}
+
+void _camera_wdr_destroy(camera_wdr_s *wdr){
+	if( wdr == NULL )
+		return;
+	free(wdr->column);
+	free(wdr);
+}
+
+static void __wdr_map(camera_wdr_s *wdr, unsigned char *luma, int stride, int step){
+	int x;
+	int y;
+
+	for( y = 0 ; y < wdr->height ; y++ ){
+		unsigned char *row = luma + y * stride;
+		int t = wdr->tile_row[y];
+		// the vertical blend is shared by the whole row, the horizontal one is per pixel
+		__wdr_blend_rows(wdr->lut[t][0], wdr->lut[t + 1][0], wdr->weight_y[y], wdr->row_lut[0]);
+		x = 0;
+		while( x < wdr->width ){
+			// runs of pixels between the same two tile centers share both curves
+			int column = wdr->column[x];
+			const unsigned char *left = wdr->row_lut[column];
+			const unsigned char *right = left + 256;
+			const unsigned char *weight = wdr->weight_x;
+			int end = column < WDR_TILES_X - 2 ? (wdr->tile_x[column + 1] + wdr->tile_x[column + 2]) / 2 : wdr->width;
+			if( step == 1 ){
+				for( ; x < end ; x++ ){
+					int a = left[row[x]];
+					row[x] = a + (((right[row[x]] - a) * weight[x] + 128) >> 8);
+				}
+			}else{
+				for( ; x < end ; x++ ){
+					int a = left[row[2 * x]];
+					row[2 * x] = a + (((right[row[2 * x]] - a) * weight[x] + 128) >> 8);
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Tone maps the luma of src into dst, which may be the same buffer.
+ * wdr keeps the tile curves of a stream, NULL measures a single frame.
+ */
+int _camera_wdr_apply(camera_wdr_s *wdr, camera_image_data_s *src, camera_image_data_s *dst){
+	camera_wdr_s *once = NULL;
+	unsigned int histogram[256];
+	unsigned char *luma;
+	int stride;
+	int step = 1;
+	int rows;
+	int weight;
+	int ty;
+	int tx;
+	int i;
+
+	if( src == NULL || dst == NULL || dst->data == NULL || !_camera_wdr_is_supported_format(src->format) || !_camera_image_is_valid(src) )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+	if( src->width < 2 * WDR_TILES_X || src->height < 2 * WDR_TILES_Y )
+		return CAMERA_ERROR_INVALID_PARAMETER;
+
+	if( wdr == NULL ){
+		if( _camera_wdr_create(&once) != CAMERA_ERROR_NONE )
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		wdr = once;
+	}
+	if( !wdr->valid || wdr->width != src->width || wdr->height != src->height || wdr->format != src->format ){
+		if( __wdr_reset(wdr, src) != CAMERA_ERROR_NONE ){
+			_camera_wdr_destroy(once);
+			return CAMERA_ERROR_OUT_OF_MEMORY;
+		}
+	}
+
+	if( dst->data != src->data )
+		memcpy(dst->data, src->data, _camera_get_image_size(src->format, src->width, src->height));
+	dst->size = _camera_get_image_size(src->format, src->width, src->height);
+	dst->width = src->width;
+	dst->height = src->height;
+	dst->format = src->format;
+
+	luma = dst->data;
+	stride = src->width;
+	if( src->format == CAMERA_PIXEL_FORMAT_YUYV || src->format == CAMERA_PIXEL_FORMAT_UYVY ){
+		step = 2;
+		stride = src->width * 2;
+		if( src->format == CAMERA_PIXEL_FORMAT_UYVY )
+			luma++;
+	}
+
+	// the curves are measured on the frame before it is mapped
+	rows = wdr->valid ? WDR_REFRESH_ROWS : WDR_TILES_Y;
+	weight = wdr->valid ? WDR_TEMPORAL : 256;
+	for( i = 0 ; i < rows ; i++ ){
+		ty = (wdr->next_row + i) % WDR_TILES_Y;
+		for( tx = 0 ; tx < WDR_TILES_X ; tx++ ){
+			__wdr_histogram(luma, stride, step, wdr->tile_x[tx], wdr->tile_x[tx + 1], wdr->tile_y[ty], wdr->tile_y[ty + 1], histogram);
+			__wdr_make_curve(histogram, wdr->lut[ty][tx], weight);
+		}
+	}
+	wdr->next_row = (wdr->next_row + rows) % WDR_TILES_Y;
+	wdr->valid = true;
+
+	__wdr_map(wdr, luma, stride, step);
+	_camera_wdr_destroy(once);
+	return CAMERA_ERROR_NONE;
+}
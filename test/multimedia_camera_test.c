@@ -21,6 +21,9 @@
 #include <Ecore_X.h>
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <jpeglib.h>
 #include <camera.h>
 
 #include <assert.h>
@@ -1429,6 +1432,881 @@ Eina_Bool captured_event_check(void *data){
 	return false;
 }
 
+typedef struct {
+	int count;
+	bool completed;
+	gint64 first_shot;
+	gint64 last_shot;
+} sw_jpeg_test_data;
+
+void _sw_jpeg_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data){
+	sw_jpeg_test_data *test_data = (sw_jpeg_test_data*)user_data;
+	if( test_data->count++ == 0 )
+		test_data->first_shot = g_get_monotonic_time();
+	test_data->last_shot = g_get_monotonic_time();
+	printf("shot %d format %d size %d\n", test_data->count, image->format, image->size);
+}
+
+void _sw_jpeg_capture_completed_cb(void *user_data){
+	sw_jpeg_test_data *test_data = (sw_jpeg_test_data*)user_data;
+	test_data->completed = true;
+}
+
+int software_jpeg_encoding_test(){
+	printf("--------------software jpeg encoding test--------------------\n");
+	camera_h camera;
+	sw_jpeg_test_data test_data = { 0, false, 0, 0 };
+	int timeout = 30;
+	int ret;
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_display(camera,CAMERA_DISPLAY_TYPE_X11, GET_DISPLAY(preview_win));
+	camera_set_capture_format(camera, CAMERA_PIXEL_FORMAT_YUYV);
+	camera_attr_set_image_quality(camera, 90);
+	ret = camera_attr_enable_software_jpeg_encoding(camera, true);
+	printf("camera_attr_enable_software_jpeg_encoding %x\n", ret);
+	camera_start_preview(camera);
+	ret = camera_start_continuous_capture(camera, 20, 0, _sw_jpeg_capturing_cb, _sw_jpeg_capture_completed_cb, &test_data);
+	printf("camera_start_continuous_capture %x\n", ret);
+	while( test_data.completed == false && timeout-- > 0 )
+		sleep(1);
+	printf("%d shots encoded in %lld ms\n", test_data.count, (test_data.last_shot - test_data.first_shot)/1000);
+	camera_start_preview(camera);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return test_data.count == 20 ? 0 : -1;
+}
+
+void _capture_to_path_saved_cb(int index, const char *path, camera_error_e error, void *user_data){
+	printf("saved %d %s (%x)\n", index, path, error);
+}
+
+void _capture_to_path_completed_cb(void *user_data){
+	*(bool*)user_data = true;
+}
+
+int capture_to_path_test(){
+	printf("--------------capture to path test--------------------\n");
+	camera_h camera;
+	bool completed = false;
+	int timeout = 30;
+	int ret;
+	gint64 start;
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_display(camera,CAMERA_DISPLAY_TYPE_X11, GET_DISPLAY(preview_win));
+	camera_attr_set_capture_file_sync_policy(camera, CAMERA_FILE_SYNC_BURST);
+	camera_start_preview(camera);
+	start = g_get_monotonic_time();
+	ret = camera_start_capture_to_path(camera, "/opt/media/burst_%03d.jpg", 10, 0, _capture_to_path_saved_cb, _capture_to_path_completed_cb, &completed);
+	printf("camera_start_capture_to_path %x\n", ret);
+	while( completed == false && timeout-- > 0 )
+		sleep(1);
+	printf("burst written in %lld ms\n", (g_get_monotonic_time() - start)/1000);
+	camera_start_preview(camera);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return completed ? 0 : -1;
+}
+
+void _postview_bench_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data){
+	sw_jpeg_test_data *test_data = (sw_jpeg_test_data*)user_data;
+	gint64 now = g_get_monotonic_time();
+	if( test_data->count++ == 0 )
+		test_data->first_shot = now;
+	test_data->last_shot = now;
+}
+
+int postview_overhead_test(){
+	printf("--------------postview overhead test--------------------\n");
+	camera_h camera;
+	int i;
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_display(camera,CAMERA_DISPLAY_TYPE_X11, GET_DISPLAY(preview_win));
+	for( i = 0 ; i < 2 ; i++ ){
+		sw_jpeg_test_data test_data = { 0, false, 0, 0 };
+		int timeout = 30;
+		camera_attr_enable_capture_postview(camera, i == 0);
+		camera_start_preview(camera);
+		camera_start_continuous_capture(camera, 20, 0, _postview_bench_capturing_cb, _sw_jpeg_capture_completed_cb, &test_data);
+		while( test_data.completed == false && timeout-- > 0 )
+			sleep(1);
+		if( test_data.count > 1 )
+			printf("postview %s : %lld us per shot\n", i == 0 ? "on" : "off", (test_data.last_shot - test_data.first_shot)/(test_data.count - 1));
+		camera_start_preview(camera);
+		camera_stop_preview(camera);
+	}
+	camera_destroy(camera);
+	return 0;
+}
+
+void _software_thumbnail_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data){
+	if( thumbnail )
+		printf("thumbnail %dx%d format %d size %d\n", thumbnail->width, thumbnail->height, thumbnail->format, thumbnail->size);
+	else
+		printf("no thumbnail\n");
+}
+
+int software_thumbnail_test(){
+	printf("--------------software thumbnail test--------------------\n");
+	camera_h camera;
+	bool completed = false;
+	int timeout = 10;
+	int ret;
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_display(camera,CAMERA_DISPLAY_TYPE_X11, GET_DISPLAY(preview_win));
+	ret = camera_attr_set_software_thumbnail_size(camera, 320, 240);
+	printf("camera_attr_set_software_thumbnail_size %x\n", ret);
+	camera_start_preview(camera);
+	camera_start_capture(camera, _software_thumbnail_capturing_cb, _capture_to_path_completed_cb, &completed);
+	while( completed == false && timeout-- > 0 )
+		sleep(1);
+	camera_start_preview(camera);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return completed ? 0 : -1;
+}
+
+void _exif_bench_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data){
+	camera_image_data_s *copy = (camera_image_data_s*)user_data;
+	if( image->format != CAMERA_PIXEL_FORMAT_JPEG || copy->data )
+		return;
+	*copy = *image;
+	copy->data = malloc(image->size);
+	memcpy(copy->data, image->data, image->size);
+}
+
+/* what applications do without camera_image_update_exif() : decode and encode the whole picture again */
+static void _exif_bench_rewrite(camera_image_data_s *image){
+	struct jpeg_decompress_struct dinfo;
+	struct jpeg_compress_struct cinfo;
+	struct jpeg_error_mgr derr;
+	struct jpeg_error_mgr cerr;
+	unsigned char *out = NULL;
+	unsigned long out_size = 0;
+	JSAMPROW row[1];
+
+	dinfo.err = jpeg_std_error(&derr);
+	jpeg_create_decompress(&dinfo);
+	jpeg_mem_src(&dinfo, image->data, image->size);
+	jpeg_read_header(&dinfo, TRUE);
+	jpeg_start_decompress(&dinfo);
+	cinfo.err = jpeg_std_error(&cerr);
+	jpeg_create_compress(&cinfo);
+	jpeg_mem_dest(&cinfo, &out, &out_size);
+	cinfo.image_width = dinfo.output_width;
+	cinfo.image_height = dinfo.output_height;
+	cinfo.input_components = dinfo.output_components;
+	cinfo.in_color_space = dinfo.out_color_space;
+	jpeg_set_defaults(&cinfo);
+	jpeg_set_quality(&cinfo, 95, TRUE);
+	jpeg_start_compress(&cinfo, TRUE);
+	row[0] = malloc(dinfo.output_width * dinfo.output_components);
+	while( dinfo.output_scanline < dinfo.output_height ){
+		jpeg_read_scanlines(&dinfo, row, 1);
+		jpeg_write_scanlines(&cinfo, row, 1);
+	}
+	jpeg_finish_compress(&cinfo);
+	jpeg_finish_decompress(&dinfo);
+	jpeg_destroy_compress(&cinfo);
+	jpeg_destroy_decompress(&dinfo);
+	free(row[0]);
+	free(out);
+}
+
+int exif_update_benchmark(){
+	printf("--------------exif update benchmark--------------------\n");
+	camera_h camera;
+	camera_image_data_s image = { NULL, 0, 0, 0, 0 };
+	camera_image_data_s updated;
+	camera_exif_info_s info;
+	int timeout = 10;
+	int i;
+	gint64 start;
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_display(camera,CAMERA_DISPLAY_TYPE_X11, GET_DISPLAY(preview_win));
+	camera_start_preview(camera);
+	camera_start_capture(camera, _exif_bench_capturing_cb, NULL, &image);
+	while( image.data == NULL && timeout-- > 0 )
+		sleep(1);
+	camera_start_preview(camera);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	if( image.data == NULL )
+		return -1;
+
+	memset(&info, 0, sizeof(info));
+	info.set_orientation = true;
+	info.orientation = CAMERA_ATTR_TAG_ORIENTATION_RIGHT_TOP;
+	info.set_geotag = true;
+	info.latitude = 37.2582;
+	info.longitude = 127.0478;
+	info.altitude = 40.0;
+
+	start = g_get_monotonic_time();
+	for( i = 0 ; i < 100 ; i++ ){
+		if( camera_image_update_exif(&image, &info, &updated) == CAMERA_ERROR_NONE )
+			free(updated.data);
+	}
+	printf("camera_image_update_exif : %lld us\n", (g_get_monotonic_time() - start)/100);
+
+	start = g_get_monotonic_time();
+	for( i = 0 ; i < 5 ; i++ )
+		_exif_bench_rewrite(&image);
+	printf("full rewrite : %lld us\n", (g_get_monotonic_time() - start)/5);
+	free(image.data);
+	return 0;
+}
+
+int stream_transform_benchmark(){
+	printf("--------------stream transform benchmark--------------------\n");
+	camera_pixel_format_e formats[] = { CAMERA_PIXEL_FORMAT_YUYV, CAMERA_PIXEL_FORMAT_UYVY, CAMERA_PIXEL_FORMAT_NV12, CAMERA_PIXEL_FORMAT_I420 };
+	const char *names[] = { "YUYV", "UYVY", "NV12", "I420" };
+	camera_image_data_s image;
+	camera_image_data_s transformed;
+	int i;
+	int rotation;
+	int n;
+	gint64 start;
+
+	for( i = 0 ; i < 4 ; i++ ){
+		image.width = 1920;
+		image.height = 1080;
+		image.format = formats[i];
+		image.size = (formats[i] == CAMERA_PIXEL_FORMAT_YUYV || formats[i] == CAMERA_PIXEL_FORMAT_UYVY) ? 1920*1080*2 : 1920*1080*3/2;
+		image.data = (unsigned char*)malloc(image.size);
+		memset(image.data, 0x80, image.size);
+		for( rotation = CAMERA_ROTATION_NONE ; rotation <= CAMERA_ROTATION_270 ; rotation++ ){
+			start = g_get_monotonic_time();
+			for( n = 0 ; n < 30 ; n++ ){
+				if( camera_image_transform(&image, rotation, CAMERA_FLIP_NONE, &transformed) != CAMERA_ERROR_NONE )
+					break;
+				free(transformed.data);
+			}
+			printf("%s %4d : %.1f MB/s\n", names[i], rotation*90, n * (double)image.size / (g_get_monotonic_time() - start + 1));
+		}
+		free(image.data);
+	}
+	return 0;
+}
+
+int software_effect_benchmark(){
+	printf("--------------software effect benchmark--------------------\n");
+	camera_pixel_format_e formats[] = { CAMERA_PIXEL_FORMAT_YUYV, CAMERA_PIXEL_FORMAT_UYVY, CAMERA_PIXEL_FORMAT_NV12, CAMERA_PIXEL_FORMAT_I420 };
+	const char *names[] = { "YUYV", "UYVY", "NV12", "I420" };
+	camera_image_data_s image;
+	camera_image_data_s result;
+	int i;
+	int effect;
+	int n;
+	gint64 start;
+
+	for( i = 0 ; i < 4 ; i++ ){
+		image.width = 1920;
+		image.height = 1080;
+		image.format = formats[i];
+		image.size = (formats[i] == CAMERA_PIXEL_FORMAT_YUYV || formats[i] == CAMERA_PIXEL_FORMAT_UYVY) ? 1920*1080*2 : 1920*1080*3/2;
+		image.data = (unsigned char*)malloc(image.size);
+		for( n = 0 ; n < image.size ; n++ )
+			image.data[n] = n * 7;
+		for( effect = CAMERA_ATTR_EFFECT_NONE ; effect <= CAMERA_ATTR_EFFECT_SKETCH ; effect++ ){
+			start = g_get_monotonic_time();
+			for( n = 0 ; n < 30 ; n++ ){
+				if( camera_image_apply_effect(&image, effect, &result) != CAMERA_ERROR_NONE )
+					break;
+				free(result.data);
+			}
+			printf("%s effect %2d : %.1f fps\n", names[i], effect, n * 1000000.0 / (g_get_monotonic_time() - start + 1));
+		}
+		free(image.data);
+	}
+	return 0;
+}
+
+static int software_hdr_images;
+static gint64 software_hdr_start;
+
+void _software_hdr_capturing_cb(camera_image_data_s* image, camera_image_data_s* postview, camera_image_data_s* thumbnail, void *user_data){
+	software_hdr_images++;
+	printf("hdr image %d : %dx%d format %d size %d, %lld ms after start\n", software_hdr_images, image->width, image->height, image->format, image->size,
+				(g_get_monotonic_time() - software_hdr_start)/1000);
+}
+
+void _software_hdr_completed_cb(void *user_data){
+	printf("hdr capture complete, %d images (expected %d)\n", software_hdr_images, GPOINTER_TO_INT(user_data));
+}
+
+int software_hdr_capture_test(){
+	camera_h camera;
+	camera_state_e state;
+	camera_attr_hdr_mode_e mode;
+	int i;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	if( !camera_attr_is_supported_hdr_capture(camera) ){
+		printf("Not supported HDR Capture\n");
+		camera_destroy(camera);
+		return 0;
+	}
+	camera_attr_set_hdr_capture_progress_cb(camera, _hdr_progress_cb, NULL);
+	camera_start_preview(camera);
+	for( i = CAMERA_ATTR_HDR_MODE_ENABLE ; i <= CAMERA_ATTR_HDR_MODE_KEEP_ORIGINAL ; i++ ){
+		camera_attr_set_hdr_mode(camera, i);
+		camera_attr_get_hdr_mode(camera, &mode);
+		printf("hdr mode %d -> %d\n", i, mode);
+		software_hdr_images = 0;
+		software_hdr_start = g_get_monotonic_time();
+		camera_start_capture(camera, _software_hdr_capturing_cb, _software_hdr_completed_cb, GINT_TO_POINTER(i == CAMERA_ATTR_HDR_MODE_KEEP_ORIGINAL ? 2 : 1));
+		camera_get_state(camera, &state);
+		while( state == CAMERA_STATE_CAPTURING ){
+			usleep(10000);
+			camera_get_state(camera, &state);
+		}
+		sleep(2);
+		camera_start_preview(camera);
+	}
+	camera_attr_set_hdr_mode(camera, CAMERA_ATTR_HDR_MODE_DISABLE);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+typedef struct {
+	int frames;
+	int width;
+	int height;
+	gint64 last;
+	gint64 worst_interval;
+} anti_shake_test_s;
+
+void _anti_shake_preview_cb(void *stream_buffer, int buffer_size, int width, int height, camera_pixel_format_e format, void *user_data){
+	anti_shake_test_s *data = (anti_shake_test_s*)user_data;
+	gint64 now = g_get_monotonic_time();
+	if( data->frames > 0 && now - data->last > data->worst_interval )
+		data->worst_interval = now - data->last;
+	data->last = now;
+	data->width = width;
+	data->height = height;
+	data->frames++;
+}
+
+int anti_shake_preview_test(){
+	camera_h camera;
+	anti_shake_test_s data;
+	int preview_width;
+	int preview_height;
+	bool enabled = false;
+	int i;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_get_preview_resolution(camera, &preview_width, &preview_height);
+	camera_set_preview_cb(camera, _anti_shake_preview_cb, &data);
+	for( i = 0 ; i < 2 ; i++ ){
+		memset(&data, 0, sizeof(data));
+		camera_attr_enable_anti_shake(camera, i == 1);
+		camera_attr_is_enabled_anti_shake(camera, &enabled);
+		camera_start_preview(camera);
+		sleep(5);
+		camera_stop_preview(camera);
+		printf("anti-shake %d : %d frames of %dx%d from %dx%d preview, worst frame interval %lld ms\n", enabled, data.frames, data.width, data.height,
+					preview_width, preview_height, data.worst_interval/1000);
+	}
+	camera_attr_enable_anti_shake(camera, false);
+	camera_destroy(camera);
+	return 0;
+}
+
+int auto_contrast_preview_test(){
+	camera_h camera;
+	anti_shake_test_s data;
+	bool enabled = false;
+	int i;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_preview_cb(camera, _anti_shake_preview_cb, &data);
+	for( i = 0 ; i < 2 ; i++ ){
+		memset(&data, 0, sizeof(data));
+		camera_attr_enable_auto_contrast(camera, i == 1);
+		camera_attr_is_enabled_auto_contrast(camera, &enabled);
+		camera_start_preview(camera);
+		sleep(5);
+		camera_stop_preview(camera);
+		printf("auto contrast %d : %d frames of %dx%d, worst frame interval %lld ms\n", enabled, data.frames, data.width, data.height, data.worst_interval/1000);
+	}
+	camera_attr_enable_auto_contrast(camera, false);
+	camera_destroy(camera);
+	return 0;
+}
+
+typedef struct {
+	int calls;
+	int last_id;
+	int last_x;
+	int id_changes;
+	int max_step;
+} face_tracking_test_s;
+
+void _face_tracking_cb(camera_detected_face_s *faces, int count, void *user_data){
+	face_tracking_test_s *data = (face_tracking_test_s*)user_data;
+	data->calls++;
+	if( count < 1 )
+		return;
+	if( data->last_id != 0 && faces[0].id != data->last_id )
+		data->id_changes++;
+	else if( data->last_id != 0 && abs(faces[0].x - data->last_x) > data->max_step )
+		data->max_step = abs(faces[0].x - data->last_x);
+	data->last_id = faces[0].id;
+	data->last_x = faces[0].x;
+}
+
+int face_tracking_test(){
+	camera_h camera;
+	face_tracking_test_s data;
+	gint64 end;
+
+	memset(&data, 0, sizeof(data));
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_start_preview(camera);
+	if( camera_start_face_detection(camera, _face_tracking_cb, &data) == CAMERA_ERROR_NONE ){
+		// faces are delivered from the main loop
+		end = g_get_monotonic_time() + 10*G_USEC_PER_SEC;
+		while( g_get_monotonic_time() < end ){
+			if( !g_main_context_iteration(NULL, FALSE) )
+				usleep(10000);
+		}
+		camera_stop_face_detection(camera);
+		printf("face tracking : %d updates, first face changed id %d times, largest move %d px\n", data.calls, data.id_changes, data.max_step);
+	}
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+int software_face_detection_test(){
+	camera_h camera;
+	face_tracking_test_s data;
+	camera_pixel_format_e format = CAMERA_PIXEL_FORMAT_INVALID;
+	gint64 end;
+	int ret;
+
+	memset(&data, 0, sizeof(data));
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_get_preview_format(camera, &format);
+	printf("preview format %d, face detection supported %d\n", format, camera_is_supported_face_detection(camera));
+	camera_start_preview(camera);
+	// no preview callback, the faces come from the device or the software detector alone
+	ret = camera_start_face_detection(camera, _face_tracking_cb, &data);
+	printf("camera_start_face_detection %x\n", ret);
+	if( ret == CAMERA_ERROR_NONE ){
+		end = g_get_monotonic_time() + 10*G_USEC_PER_SEC;
+		while( g_get_monotonic_time() < end ){
+			if( !g_main_context_iteration(NULL, FALSE) )
+				usleep(10000);
+		}
+		if( data.last_id != 0 ){
+			ret = camera_face_zoom(camera, data.last_id);
+			printf("camera_face_zoom %d : %x\n", data.last_id, ret);
+			camera_cancel_face_zoom(camera);
+		}
+		camera_stop_face_detection(camera);
+		printf("software face detection : %d updates, last face id %d\n", data.calls, data.last_id);
+	}
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+int face_max_count;
+void _face_crowd_cb(camera_detected_face_s *faces, int count, void *user_data){
+	// the array is only lent for the call
+	if( count > face_max_count )
+		face_max_count = count;
+}
+
+int face_crowd_test(){
+	camera_h camera;
+	gint64 end;
+
+	face_max_count = 0;
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_start_preview(camera);
+	if( camera_start_face_detection(camera, _face_crowd_cb, NULL) == CAMERA_ERROR_NONE ){
+		end = g_get_monotonic_time() + 20*G_USEC_PER_SEC;
+		while( g_get_monotonic_time() < end ){
+			if( !g_main_context_iteration(NULL, FALSE) )
+				usleep(10000);
+		}
+		camera_stop_face_detection(camera);
+		printf("largest crowd : %d faces\n", face_max_count);
+	}
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+typedef struct {
+	int frames;
+	unsigned int best;
+	unsigned int last;
+	int masks;
+	int peaking_pixels;
+} focus_metric_test_s;
+
+void _focus_metric_cb(unsigned int sharpness, void *user_data){
+	focus_metric_test_s *data = (focus_metric_test_s*)user_data;
+	data->frames++;
+	data->last = sharpness;
+	if( sharpness > data->best )
+		data->best = sharpness;
+}
+
+void _focus_peaking_cb(unsigned char *mask, int width, int height, void *user_data){
+	focus_metric_test_s *data = (focus_metric_test_s*)user_data;
+	int i;
+	data->masks++;
+	data->peaking_pixels = 0;
+	for( i = 0 ; i < width * height ; i++ )
+		data->peaking_pixels += mask[i] != 0;
+}
+
+int focus_metric_test(){
+	camera_h camera;
+	focus_metric_test_s data;
+	int width = 0;
+	int height = 0;
+
+	memset(&data, 0, sizeof(data));
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_get_preview_resolution(camera, &width, &height);
+	// the center quarter, where the lens focuses by default
+	camera_attr_set_focus_metric_area(camera, width/4, height/4, width/2, height/2);
+	camera_set_focus_metric_cb(camera, _focus_metric_cb, &data);
+	camera_start_preview(camera);
+	camera_start_focusing(camera, false);
+	sleep(3);
+	printf("focus metric : %d frames, best %u, last %u\n", data.frames, data.best, data.last);
+	// the peaking callback is added while previewing
+	camera_set_focus_peaking_cb(camera, _focus_peaking_cb, &data);
+	sleep(1);
+	camera_unset_focus_peaking_cb(camera);
+	camera_unset_focus_metric_cb(camera);
+	printf("focus peaking : %d masks, %d peaking pixels in the last one\n", data.masks, data.peaking_pixels);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+int metering_regions_test(){
+	camera_h camera;
+	camera_region_statistics_s statistics;
+	camera_region_s regions[2];
+	int width = 0;
+	int height = 0;
+	int mean = 0;
+	int i;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_get_preview_resolution(camera, &width, &height);
+	// the center counts three times as much as the whole frame
+	regions[0].x = 0;
+	regions[0].y = 0;
+	regions[0].width = width;
+	regions[0].height = height;
+	regions[0].weight = 100;
+	regions[1].x = width/3;
+	regions[1].y = height/3;
+	regions[1].width = width/3;
+	regions[1].height = height/3;
+	regions[1].weight = 300;
+	camera_attr_set_af_regions(camera, &regions[1], 1);
+	camera_attr_set_ae_regions(camera, regions, 2);
+	camera_start_preview(camera);
+	sleep(2);
+	for( i = 0 ; i < 2 ; i++ ){
+		if( camera_attr_get_ae_region_statistics(camera, i, &statistics) == CAMERA_ERROR_NONE )
+			printf("region %d : frame %u, mean %d, dark %d/1000, bright %d/1000\n", i, statistics.frame, statistics.mean, statistics.dark_clipping, statistics.bright_clipping);
+	}
+	if( camera_attr_get_ae_weighted_mean(camera, &mean) == CAMERA_ERROR_NONE )
+		printf("weighted mean %d\n", mean);
+	camera_attr_set_ae_regions(camera, NULL, 0);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+typedef struct {
+	unsigned int frames;
+	camera_frame_statistics_s last;
+} preview_statistics_test_s;
+
+void _preview_statistics_cb(const camera_frame_statistics_s *statistics, void *user_data){
+	preview_statistics_test_s *data = (preview_statistics_test_s*)user_data;
+	// the statistics are only lent for the call
+	data->frames++;
+	data->last = *statistics;
+}
+
+int preview_statistics_test(){
+	camera_h camera;
+	preview_statistics_test_s data;
+	const camera_awb_cell_s *center;
+
+	memset(&data, 0, sizeof(data));
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_preview_statistics_cb(camera, _preview_statistics_cb, &data);
+	camera_start_preview(camera);
+	sleep(2);
+	camera_unset_preview_statistics_cb(camera);
+	center = &data.last.awb_grid[CAMERA_STATISTICS_GRID_ROWS/2][CAMERA_STATISTICS_GRID_COLUMNS/2];
+	printf("preview statistics : %u frames, last %u\n", data.frames, data.last.frame);
+	printf("luma %d, rgb %d %d %d, clipped %u %u %u of %u\n", data.last.luma_mean, data.last.red_mean, data.last.green_mean, data.last.blue_mean,
+		data.last.clipped_red, data.last.clipped_green, data.last.clipped_blue, data.last.pixels);
+	printf("center gains red %d/1024 blue %d/1024 from %u pixels\n", center->red_gain, center->blue_gain, center->pixels);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+void _session_preview_cb(camera_image_data_s *first, camera_image_data_s *second, int skew, void *user_data){
+	int *pairs = (int*)user_data;
+	(*pairs)++;
+	if( *pairs % 30 == 1 )
+		printf("pair %d : %dx%d and %dx%d, skew %d us\n", *pairs, first->width, first->height, second->width, second->height, skew);
+}
+
+int camera_session_test(){
+	camera_session_h session;
+	camera_h camera;
+	camera_session_skew_s skew;
+	int pairs = 0;
+	int ret;
+
+	ret = camera_session_create(&session);
+	if( ret != 0 ){
+		printf("camera_session_create fail %x\n", ret);
+		return -1;
+	}
+	camera_session_get_camera(session, CAMERA_DEVICE_CAMERA1, &camera);
+	camera_set_preview_resolution(camera, 320, 240);
+	camera_session_set_preview_cb(session, _session_preview_cb, &pairs);
+	ret = camera_session_start_preview(session);
+	if( ret != 0 )
+		printf("camera_session_start_preview fail %x\n", ret);
+	sleep(3);
+	camera_session_stop_preview(session);
+	camera_session_get_skew_statistics(session, &skew);
+	printf("session : %u pairs, unpaired %u %u, skew mean %d last %d largest %d us\n", skew.pairs, skew.unpaired_first, skew.unpaired_second,
+		skew.mean_skew, skew.last_skew, skew.largest_skew);
+	camera_session_destroy(session);
+	return 0;
+}
+
+typedef struct {
+	unsigned int frame;
+} luma_sum_encoder_s;
+
+// a stand-in encoder, each unit is the sum of the luma plane of its frame
+int _luma_sum_encoder_open(int width, int height, camera_pixel_format_e format, void *user_data, void **instance){
+	*instance = calloc(1, sizeof(luma_sum_encoder_s));
+	return *instance ? CAMERA_ERROR_NONE : CAMERA_ERROR_OUT_OF_MEMORY;
+}
+
+int _luma_sum_encoder_encode(void *instance, camera_image_data_s *frame, long long pts, camera_preview_encoder_output_cb output, void *output_data){
+	luma_sum_encoder_s *encoder = (luma_sum_encoder_s*)instance;
+	unsigned int sum = 0;
+	int i;
+	for( i = 0 ; i < frame->width * frame->height ; i++ )
+		sum += frame->data[i];
+	output((unsigned char*)&sum, sizeof(sum), pts, encoder->frame++ % 30 == 0, output_data);
+	return CAMERA_ERROR_NONE;
+}
+
+void _luma_sum_encoder_close(void *instance, camera_preview_encoder_output_cb output, void *output_data){
+	free(instance);
+}
+
+int preview_encoder_test(){
+	camera_h camera;
+	camera_preview_encoder_s encoder = { _luma_sum_encoder_open, _luma_sum_encoder_encode, _luma_sum_encoder_close, NULL };
+	camera_preview_encoder_statistics_s statistics;
+	camera_encoded_unit_s unit;
+	int units = 0;
+	int keys = 0;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_preview_format(camera, CAMERA_PIXEL_FORMAT_NV12);
+	camera_start_preview_encoder(camera, &encoder, NULL, 16);
+	camera_start_preview(camera);
+	while( units < 90 && camera_preview_encoder_poll(camera, 1000, &unit) == CAMERA_ERROR_NONE && unit.data ){
+		units++;
+		if( unit.key_frame )
+			keys++;
+	}
+	camera_stop_preview_encoder(camera);
+	camera_preview_encoder_get_statistics(camera, &statistics);
+	printf("preview encoder : %d units polled, %d key frames\n", units, keys);
+	printf("%u frames, %u units, %u dropped, encode %d us, lag mean %d largest %d us, queue delay mean %d us\n", statistics.frames, statistics.units,
+		statistics.dropped_units, statistics.mean_encode_time, statistics.mean_lag, statistics.largest_lag, statistics.mean_queue_delay);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+void _frame_replay_completed_cb(int frames, void *user_data){
+	printf("frame replay completed : %d frames\n", frames);
+}
+
+void _frame_replay_preview_cb(void *stream_buffer, int buffer_size, int width, int height, camera_pixel_format_e format, void *user_data){
+	int *frames = (int*)user_data;
+	(*frames)++;
+}
+
+int frame_trace_test(){
+	camera_h camera;
+	int frames = 0;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_start_frame_trace(camera, "/opt/media/camera.trace");
+	camera_start_preview(camera);
+	sleep(1);
+	camera_start_capture(camera, NULL, NULL, NULL);
+	sleep(2);
+	camera_stop_frame_trace(camera);
+	camera_stop_preview(camera);
+
+	// the recorded frames come back through the preview callback, without the device
+	camera_set_preview_cb(camera, _frame_replay_preview_cb, &frames);
+	camera_start_frame_replay(camera, "/opt/media/camera.trace", 0, _frame_replay_completed_cb, NULL);
+	sleep(2);
+	camera_stop_frame_replay(camera);
+	printf("frame trace : %d preview frames replayed\n", frames);
+	camera_destroy(camera);
+	return 0;
+}
+
+void _fps_changed_cb(camera_attr_fps_e previous, camera_attr_fps_e current, camera_fps_governor_reason_e reason, void *user_data){
+	printf("fps changed %d -> %d, reason %d\n", previous, current, reason);
+}
+
+// a preview callback slow enough to miss frames at 30 fps
+void _slow_preview_cb(void *stream_buffer, int buffer_size, int width, int height, camera_pixel_format_e format, void *user_data){
+	int *delay = (int*)user_data;
+	usleep(*delay);
+}
+
+int fps_governor_test(){
+	camera_h camera;
+	camera_fps_governor_statistics_s statistics;
+	int delay = 40000;
+	int ret;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_attr_set_preview_fps(camera, CAMERA_ATTR_FPS_30);
+	camera_set_preview_cb(camera, _slow_preview_cb, &delay);
+	ret = camera_start_fps_governor(camera, _fps_changed_cb, NULL);
+	if( ret != 0 )
+		printf("camera_start_fps_governor fail %x\n", ret);
+	camera_start_preview(camera);
+	sleep(5);
+	// the load goes away, the rate should climb back
+	delay = 0;
+	sleep(10);
+	camera_fps_governor_get_statistics(camera, &statistics);
+	printf("fps governor : %u frames, %u dropped, %u down %u up, callback mean %d largest %d us, cpu %d%%, queue %d%%, %d fps\n", statistics.frames,
+		statistics.dropped_frames, statistics.steps_down, statistics.steps_up, statistics.mean_callback_time, statistics.largest_callback_time,
+		statistics.cpu_load, statistics.queue_level, statistics.fps);
+	camera_stop_fps_governor(camera);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+void _thermal_level_changed_cb(camera_thermal_level_e previous, camera_thermal_level_e current, void *user_data){
+	printf("thermal level %d -> %d\n", previous, current);
+}
+
+int thermal_policy_test(){
+	camera_h camera;
+	camera_thermal_statistics_s statistics;
+	int ret;
+	int i;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_set_preview_resolution(camera, 1280, 720);
+	camera_attr_set_preview_fps(camera, CAMERA_ATTR_FPS_30);
+	// low thresholds, so a device at room temperature already steps down
+	ret = camera_start_thermal_policy(camera, 20000, 25000, 30000, _thermal_level_changed_cb, NULL);
+	if( ret != 0 )
+		printf("camera_start_thermal_policy fail %x\n", ret);
+	camera_start_preview(camera);
+	sleep(10);
+	camera_thermal_policy_get_statistics(camera, &statistics);
+	printf("thermal policy : level %d, %d zones, %d mC, cpu cap %d%%, %u polls, %u down %u up\n", statistics.level, statistics.zones,
+		statistics.temperature, statistics.cpu_frequency, statistics.polls, statistics.steps_down, statistics.steps_up);
+	for( i = 0 ; i < statistics.step_count ; i++ )
+		printf("  %lld ms : %d -> %d, %d fps %dx%d quality %d\n", statistics.steps[i].timestamp, statistics.steps[i].previous, statistics.steps[i].level,
+			statistics.steps[i].fps, statistics.steps[i].preview_width, statistics.steps[i].preview_height, statistics.steps[i].jpeg_quality);
+	camera_stop_thermal_policy(camera);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+int deferred_attributes_test(){
+	camera_h camera;
+	camera_pixel_format_e format;
+	camera_attr_fps_e fps;
+	int width;
+	int height;
+	int ret;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	// only the last of these reaches the camcorder, when the preview starts
+	camera_set_preview_resolution(camera, 320, 240);
+	camera_set_preview_resolution(camera, 640, 480);
+	camera_set_preview_format(camera, CAMERA_PIXEL_FORMAT_NV12);
+	camera_attr_set_preview_fps(camera, CAMERA_ATTR_FPS_15);
+	camera_attr_set_preview_fps(camera, CAMERA_ATTR_FPS_30);
+	camera_get_preview_resolution(camera, &width, &height);
+	camera_get_preview_format(camera, &format);
+	camera_attr_get_preview_fps(camera, &fps);
+	printf("recorded : %dx%d format %d, %d fps\n", width, height, format, fps);
+	ret = camera_start_preview(camera);
+	if( ret != 0 )
+		printf("camera_start_preview fail %x\n", ret);
+	camera_get_preview_resolution(camera, &width, &height);
+	camera_get_preview_format(camera, &format);
+	camera_attr_get_preview_fps(camera, &fps);
+	printf("applied : %dx%d format %d, %d fps\n", width, height, format, fps);
+	sleep(2);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
+int attribute_cache_test(){
+	camera_h camera;
+	int zoom;
+	int i;
+
+	camera_create(CAMERA_DEVICE_CAMERA0, &camera);
+	camera_start_preview(camera);
+	sleep(1);
+	// a slider drag, only the last level of each frame reaches the sensor
+	for( i = 10 ; i < 40 ; i++ ){
+		camera_attr_set_zoom(camera, i);
+		camera_attr_set_brightness(camera, i % 9);
+		usleep(5000);
+	}
+	camera_attr_get_zoom(camera, &zoom);
+	printf("zoom %d\n", zoom);
+	// the white balance in use already, nothing is sent
+	camera_attr_set_whitebalance(camera, CAMERA_ATTR_WHITE_BALANCE_AUTOMATIC);
+	camera_attr_set_whitebalance(camera, CAMERA_ATTR_WHITE_BALANCE_AUTOMATIC);
+	sleep(1);
+	camera_stop_preview(camera);
+	camera_destroy(camera);
+	return 0;
+}
+
 int camera_test(){
 
 	int ret=0;
@@ -1448,6 +2326,29 @@ int camera_test(){
 	//preview_format_test();
 	//hdr_capture_test();
 	//hdr_capture_test();
+	//ret += software_jpeg_encoding_test();
+	//ret += capture_to_path_test();
+	//postview_overhead_test();
+	//ret += software_thumbnail_test();
+	//exif_update_benchmark();
+	//stream_transform_benchmark();
+	//software_effect_benchmark();
+	//software_hdr_capture_test();
+	//anti_shake_preview_test();
+	//auto_contrast_preview_test();
+	//face_tracking_test();
+	//software_face_detection_test();
+	//face_crowd_test();
+	//focus_metric_test();
+	//metering_regions_test();
+	//preview_statistics_test();
+	//camera_session_test();
+	//preview_encoder_test();
+	//frame_trace_test();
+	//fps_governor_test();
+	//thermal_policy_test();
+	//deferred_attributes_test();
+	//attribute_cache_test();
 	hdr_capture_test2();
 
 	return ret;